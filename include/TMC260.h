@@ -13,7 +13,7 @@
 #define TMC260_H
 
 #include <stdint.h>
-#include "stm32f4xx_conf.h"
+#include "hal.h"
 
 typedef enum {MICROSTEP_CONFIG_256 = 0,
               MICROSTEP_CONFIG_128,
@@ -31,7 +31,12 @@ typedef enum {MICROSTEP_CONFIG_256 = 0,
 #define TMC260_ERROR_INVALID_INPUT 1
 
 
-#define TMC260_SPI_DELAY_COUNT 0x0000001F
+/* Chip select timing around a datagram, about what the old Delay() loops
+ * gave.  The datasheet minimums are far shorter, these are what the board has
+ * been running with.
+ */
+#define TMC260_SPI_CSN_SETUP_NS  1000
+#define TMC260_SPI_CSN_HOLD_NS   8000
 
 /** @todo Keep in mind that all registers will need to be shifted left 12 bits
  *  and transferred starting with the highest byte to lowest byte.  This will
@@ -9,24 +9,158 @@
 #define ANALOG_INPUT_H
 
 #include <stdint.h>
-#include "stm32f4xx_conf.h"
+
+/* ************************************************************* */
+/* * Channels                                                  * */
+/* ************************************************************* */
+/* Every channel is converted on each scan, in this order.  The pins and ADC
+ * channels behind them are in analog_input_stm32.c.
+ */
+enum analog_input_channels
+{
+   ANALOG_INPUT_VC14,        /* PC4, ADC channel 14. */
+   ANALOG_INPUT_VC15,        /* PC5, ADC channel 15. */
+   ANALOG_INPUT_NUM_CHANNELS
+};
+
+/* ************************************************************* */
+/* * Filtering                                                 * */
+/* ************************************************************* */
+/* A timer starts a scan of every channel ANALOG_INPUT_SCAN_HZ times a second
+ * and DMA drops the results in a circular buffer, nothing waits on the ADC.
+ *
+ * Each channel is oversampled by 2^ANALOG_INPUT_OVERSAMPLE_SHIFT: that many
+ * scans are summed (a boxcar, with its first null at the output rate) and
+ * decimated to one value, which adds half a bit of resolution per doubling
+ * on a noisy input.  The F4 ADC has no oversampling of its own so this is all
+ * done in the DMA interrupt, once per half buffer.
+ *
+ * The decimated values then go through a single pole low pass,
+ *
+ *    y += (x - y) / 2^ANALOG_INPUT_SMOOTH_SHIFT
+ *
+ * 0 turns it off.  At the defaults, 16 kHz scans decimate to 1 kHz and the
+ * smoothing has an 8 ms time constant.
+ *
+ * Values are unsigned 16 bit fractions of full scale (the 12 bit reading
+ * shifted up) so the filter keeps the extra bits oversampling buys.
+ */
+#define ANALOG_INPUT_SCAN_HZ              16000
+#define ANALOG_INPUT_OVERSAMPLE_SHIFT     4
+#define ANALOG_INPUT_SMOOTH_SHIFT         3
+
+#define ANALOG_INPUT_OVERSAMPLE           (1 << ANALOG_INPUT_OVERSAMPLE_SHIFT)
+#define ANALOG_INPUT_OUTPUT_HZ            (ANALOG_INPUT_SCAN_HZ / ANALOG_INPUT_OVERSAMPLE)
+
+#define ANALOG_INPUT_ADC_BITS             12
+#define ANALOG_INPUT_FULL_SCALE           65536
+
+/* VDD = 2.935 Volts on discovery card. */
+#define ANALOG_INPUT_VREF                 2.935f
+
+#if (ANALOG_INPUT_OVERSAMPLE_SHIFT > (32 - ANALOG_INPUT_ADC_BITS))
+#error "ANALOG_INPUT_OVERSAMPLE_SHIFT overflows the 32 bit sum."
+#endif
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define ANALOG_INPUT_SUCCESS              0x00
+#define ANALOG_INPUT_ERROR_NOT_READY      0x01
+
+/* ************************************************************* */
+/* * Analog Input Functions                                    * */
+/* ************************************************************* */
+/* External Calls */
 
 /**
  * @fn void analog_input_init(void)
  * @brief Initializes analog input for this project.
  *
+ * Clears the filters and starts the timer triggered scans.
+ *
  * @param None
  * @return None
  */
 void analog_input_init(void);
 
 /**
- * @fn void analog_input_read(float *vc14, float *vc15);
- * @brief Returns the values on ADC channels.
+ * @fn uint8_t analog_input_read(float *vc14, float *vc15)
+ * @brief Latest filtered voltages on PC4 and PC5.
+ *
+ * Doesn't start a conversion or wait for one, safe from any context.
+ *
+ * @param vc14 Volts on ADC channel 14, -9.99 if there's no reading yet.
+ * @param vc15 Volts on ADC channel 15, -9.99 if there's no reading yet.
+ * @return uint8_t Analog input return code.
+ */
+uint8_t analog_input_read(float *vc14, float *vc15);
+
+/**
+ *
+ * @fn uint16_t analog_input_get(uint8_t channel)
+ * @brief Latest filtered value of one channel.
+ * @param channel One of analog_input_channels.
+ * @return uint16_t Fraction of full scale, 65535 is VREF.  0 for a bad
+ * channel or before the first output.
+ *
+ */
+uint16_t analog_input_get(uint8_t channel);
+
+/**
  *
+ * @fn uint32_t analog_input_count(void)
+ * @brief Filter outputs so far, for noticing a new one.
  * @param None
+ * @return uint32_t Count, ANALOG_INPUT_OUTPUT_HZ a second.
+ *
+ */
+uint32_t analog_input_count(void);
+
+/**
+ *
+ * @fn void analog_input_filter(const uint16_t *scans)
+ * @brief Decimates one block of scans and updates every channel's output.
+ *
+ * Called by the port from the DMA interrupt for each half of the buffer.
+ *
+ * @param scans ANALOG_INPUT_OVERSAMPLE scans of ANALOG_INPUT_NUM_CHANNELS
+ * right aligned readings, channel order within each scan.
  * @return None
+ *
  */
-uint8_t analog_input_read(float *vc14, float *vc15);
+void analog_input_filter(const uint16_t *scans);
+
+/**
+ *
+ * @fn void analog_input_filter_reset(void)
+ * @brief Forgets every output, the next block starts the filters fresh.
+ * @param None
+ * @return None
+ *
+ */
+void analog_input_filter_reset(void);
+
+/* ************************************************************* */
+/* * Port Functions                                            * */
+/* ************************************************************* */
+/* Supplied by analog_input_stm32.c on the target.  A host build links none,
+ * and feeds analog_input_filter() and analog_telemetry_block() directly.
+ */
+
+/**
+ *
+ * @fn void analog_input_port_init(uint16_t *buffer, uint32_t length)
+ * @brief Starts the trigger timer, ADC scan and circular DMA into buffer.
+ *
+ * analog_input_filter() and analog_telemetry_block() get each half of the
+ * buffer as it fills.
+ *
+ * @param buffer DMA target, in SRAM.
+ * @param length Readings in buffer, two blocks.
+ * @return None
+ *
+ */
+void analog_input_port_init(uint16_t *buffer, uint32_t length);
 
 #endif
@@ -0,0 +1,176 @@
+/**
+ * @file analog_telemetry.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the supply and battery monitoring windows.
+ *
+ */
+
+#ifndef ANALOG_TELEMETRY_H
+#define ANALOG_TELEMETRY_H
+
+#include <stdint.h>
+#include "analog_input.h"
+
+/* ************************************************************* */
+/* * Windows                                                   * */
+/* ************************************************************* */
+/* Every raw reading of every channel, all ANALOG_INPUT_SCAN_HZ of them, goes
+ * into a running min, max, sum and sum of squares.  When a window's worth of
+ * scans is in the totals are latched, the running ones start over and
+ * EVENT_ANALOG_WINDOW is posted.  The main loop only ever sees the latched
+ * totals, turned into min, max, mean and RMS by analog_telemetry_window().
+ *
+ * Windows are whole blocks of ANALOG_INPUT_OVERSAMPLE scans (a millisecond at
+ * the defaults) and up to ANALOG_TELEMETRY_MAX_WINDOW_MS long, the longest
+ * the 32 bit sum of 12 bit readings can cover.
+ */
+#define ANALOG_TELEMETRY_WINDOW_MS        100
+#define ANALOG_TELEMETRY_MAX_WINDOW_MS    60000
+
+#if (((ANALOG_TELEMETRY_MAX_WINDOW_MS / 1000) * ANALOG_INPUT_SCAN_HZ) > (0xFFFFFFFF >> ANALOG_INPUT_ADC_BITS))
+#error "ANALOG_TELEMETRY_MAX_WINDOW_MS overflows the 32 bit sum."
+#endif
+
+typedef struct {
+   uint32_t number;        /* Counts up from 1, a gap is a window nobody read. */
+   uint32_t samples;       /* Readings behind the numbers below. */
+   uint16_t min;           /* All four are fractions of full scale like */
+   uint16_t max;           /* analog_input_get(), 65535 is VREF. */
+   uint16_t mean;
+   uint16_t rms;
+   uint8_t alert;          /* Non zero if the channel was in alert at any */
+} analog_telemetry_window_t;  /* point in the window. */
+
+/* ************************************************************* */
+/* * Alerts                                                    * */
+/* ************************************************************* */
+/* Each channel can have a low and a high threshold, checked against the
+ * oversampled value of every block (ANALOG_INPUT_OUTPUT_HZ times a second)
+ * rather than single readings so noise doesn't trip them.  Crossing one posts
+ * EVENT_ANALOG_ALERT from the DMA interrupt straight away, without waiting for
+ * the window.  The alert clears once the value is back
+ * ANALOG_TELEMETRY_HYSTERESIS inside the threshold, which posts the event
+ * again with how far it went and for how long.
+ *
+ * A threshold of 0 (low) or 65535 (high) never trips.
+ */
+#define ANALOG_TELEMETRY_HYSTERESIS       256
+
+enum analog_telemetry_alert_states
+{
+   ANALOG_TELEMETRY_ALERT_NONE,
+   ANALOG_TELEMETRY_ALERT_LOW,
+   ANALOG_TELEMETRY_ALERT_HIGH
+};
+
+typedef struct {
+   uint8_t state;          /* analog_telemetry_alert_states, NONE once cleared. */
+   uint8_t previous;       /* The state before, LOW or HIGH when it cleared. */
+   uint16_t value;         /* Block value that tripped it, or the furthest */
+                           /* past the threshold it went once cleared. */
+   uint32_t blocks;        /* Blocks it lasted, 0 while it's still active. */
+   uint32_t count;         /* Alerts on this channel so far. */
+} analog_telemetry_alert_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define ANALOG_TELEMETRY_SUCCESS            0x00
+#define ANALOG_TELEMETRY_ERROR_CHANNEL      0x01
+#define ANALOG_TELEMETRY_ERROR_WINDOW       0x02
+#define ANALOG_TELEMETRY_ERROR_NOT_READY    0x03
+
+/* ************************************************************* */
+/* * Telemetry Functions                                       * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void analog_telemetry_init(void)
+ * @brief Clears the totals and alerts and sets the default window, with no
+ * thresholds.
+ *
+ * Call before analog_input_init(), blocks start arriving right after it.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void analog_telemetry_init(void);
+
+/**
+ *
+ * @fn uint8_t analog_telemetry_set_window(uint32_t window_ms)
+ * @brief Changes the window length, starting with the next window.
+ *
+ * Rounded down to whole blocks, with one block the shortest.
+ *
+ * @param window_ms 1 to ANALOG_TELEMETRY_MAX_WINDOW_MS.
+ * @return uint8_t Telemetry return code.
+ *
+ */
+uint8_t analog_telemetry_set_window(uint32_t window_ms);
+
+/**
+ *
+ * @fn uint8_t analog_telemetry_set_alert(uint8_t channel, uint16_t low, uint16_t high)
+ * @brief Sets a channel's alert thresholds, checked from the next block on.
+ * @param channel One of analog_input_channels.
+ * @param low Alert below this fraction of full scale, 0 for never.
+ * @param high Alert above this fraction of full scale, 65535 for never.
+ * @return uint8_t Telemetry return code.
+ *
+ */
+uint8_t analog_telemetry_set_alert(uint8_t channel, uint16_t low, uint16_t high);
+
+/**
+ *
+ * @fn uint8_t analog_telemetry_window(uint8_t channel, analog_telemetry_window_t *window)
+ * @brief The last complete window of a channel.
+ *
+ * Safe to call while blocks are arriving, a window that completes during the
+ * copy is picked up instead of being mixed with the old one.
+ *
+ * @param channel One of analog_input_channels.
+ * @param window Filled in.
+ * @return uint8_t Telemetry return code, ANALOG_TELEMETRY_ERROR_NOT_READY
+ * before the first window.
+ *
+ */
+uint8_t analog_telemetry_window(uint8_t channel, analog_telemetry_window_t *window);
+
+/**
+ *
+ * @fn uint8_t analog_telemetry_alert(uint8_t channel, analog_telemetry_alert_t *alert)
+ * @brief Takes the latest alert change on a channel.
+ *
+ * Each trip and each clear is handed out once.  If a channel trips and clears
+ * before the main loop gets here only the clear is seen, with the depth and
+ * length of the whole alert.
+ *
+ * @param channel One of analog_input_channels.
+ * @param alert Filled in.
+ * @return uint8_t Telemetry return code, ANALOG_TELEMETRY_ERROR_NOT_READY if
+ * nothing changed since the last call.
+ *
+ */
+uint8_t analog_telemetry_alert(uint8_t channel, analog_telemetry_alert_t *alert);
+
+/**
+ *
+ * @fn void analog_telemetry_block(const uint16_t *scans)
+ * @brief Adds one block of scans to the windows and checks the thresholds.
+ *
+ * Called by the analog input port from the DMA interrupt next to
+ * analog_input_filter(), with the same block.
+ *
+ * @param scans ANALOG_INPUT_OVERSAMPLE scans of ANALOG_INPUT_NUM_CHANNELS
+ * right aligned readings, channel order within each scan.
+ * @return None
+ *
+ */
+void analog_telemetry_block(const uint16_t *scans);
+
+#endif
@@ -0,0 +1,172 @@
+/**
+ * @file crash_dump.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the fault handler crash dump and its upload after the
+ * reset.
+ *
+ */
+
+#ifndef CRASH_DUMP_H
+#define CRASH_DUMP_H
+
+#include <stdint.h>
+#include "stm32f4xx_conf.h"
+
+#include "generic_packet.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+#include "trace.h"
+
+/* ************************************************************* */
+/* * Dump                                                      * */
+/* ************************************************************* */
+/* Which handler took the fault, crash_dump_t.fault. */
+#define CRASH_DUMP_FAULT_HARD      1
+#define CRASH_DUMP_FAULT_MEMMANAGE 2
+#define CRASH_DUMP_FAULT_BUS       3
+#define CRASH_DUMP_FAULT_USAGE     4
+
+/* Words from the faulting stack pointer up, and the newest trace records. */
+#define CRASH_DUMP_STACK_WORDS     32
+#define CRASH_DUMP_TRACE_RECORDS   32
+
+/* crash_dump_t.flags */
+#define CRASH_DUMP_FLAG_FRAME      0x01   /* Stacked registers were readable. */
+#define CRASH_DUMP_FLAG_FPU_FRAME  0x02   /* Extended frame, FP registers stacked too. */
+#define CRASH_DUMP_FLAG_PSP        0x04   /* Faulted on the process stack. */
+
+#define CRASH_DUMP_MAGIC           0x43524153
+
+/* Everything is a word, so scripts/crash_decode.c can read it as an array of
+ * little endian words.  Keep the two in sync.
+ */
+typedef struct {
+   uint32_t magic;
+   uint32_t length;                         /* sizeof(crash_dump_t). */
+   uint32_t fault;                          /* CRASH_DUMP_FAULT_x */
+   uint32_t flags;                          /* CRASH_DUMP_FLAG_x */
+   uint32_t exc_return;
+   uint32_t ms;                             /* hal_millis() at the fault. */
+   uint32_t cycles;                         /* CYCCNT at the fault. */
+
+   /* r0-r3 and r12 from the exception frame, r4-r11 saved on the way in. */
+   uint32_t r[13];
+   uint32_t sp;                             /* Before the exception. */
+   uint32_t lr;
+   uint32_t pc;
+   uint32_t xpsr;
+
+   uint32_t cfsr;
+   uint32_t hfsr;
+   uint32_t mmfar;
+   uint32_t bfar;
+   uint32_t shcsr;
+
+   uint32_t stack_words;                    /* Valid words in stack[]. */
+   uint32_t stack[CRASH_DUMP_STACK_WORDS];
+
+   uint32_t trace_count;                    /* Valid records in trace[]. */
+   trace_record_t trace[CRASH_DUMP_TRACE_RECORDS];
+
+   uint32_t checksum;                       /* Sum of every word before it. */
+} crash_dump_t;
+
+/* ************************************************************* */
+/* * Upload                                                    * */
+/* ************************************************************* */
+/* The dump is too big for one packet.  It goes out as UNIVERSAL_CRASH
+ * packets of CRASH_DUMP_CHUNK_BYTES, each with its offset and the total so
+ * the host can put it back together.
+ */
+#define CRASH_DUMP_CHUNK_BYTES     192
+#define CRASH_DUMP_CHUNKS          ((sizeof(crash_dump_t) + CRASH_DUMP_CHUNK_BYTES - 1) / CRASH_DUMP_CHUNK_BYTES)
+
+/* ************************************************************* */
+/* * Fault Handler Entry                                       * */
+/* ************************************************************* */
+/* The whole body of a naked fault handler.  Finds the exception frame from
+ * EXC_RETURN, moves MSP onto crash_dump_fault_stack (the fault may be a
+ * stack overflow), saves r4-r11 there and goes to crash_dump_capture(),
+ * which never returns.
+ */
+#define CRASH_DUMP_FAULT_STACK_BYTES 256
+
+#define CRASH_DUMP_STR(x)   #x
+#define CRASH_DUMP_XSTR(x)  CRASH_DUMP_STR(x)
+
+#define CRASH_DUMP_ENTRY(fault)                                                  \
+   __asm volatile("tst lr, #4\n"                                                  \
+                  "ite eq\n"                                                      \
+                  "mrseq r0, msp\n"                                               \
+                  "mrsne r0, psp\n"                                               \
+                  "mov r1, lr\n"                                                  \
+                  "movw r2, #:lower16:(crash_dump_fault_stack+" CRASH_DUMP_XSTR(CRASH_DUMP_FAULT_STACK_BYTES) ")\n" \
+                  "movt r2, #:upper16:(crash_dump_fault_stack+" CRASH_DUMP_XSTR(CRASH_DUMP_FAULT_STACK_BYTES) ")\n" \
+                  "msr msp, r2\n"                                                 \
+                  "push {r4-r11}\n"                                               \
+                  "mov r2, sp\n"                                                  \
+                  "movs r3, #" CRASH_DUMP_XSTR(fault) "\n"                        \
+                  "b crash_dump_capture\n")
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define CRASH_DUMP_SUCCESS         0x00
+#define CRASH_DUMP_NONE            0x01
+#define CRASH_DUMP_ERROR_QUEUE     0x02
+
+/* ************************************************************* */
+/* * Crash Dump Functions                                      * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void crash_dump_init(void)
+ * @brief Enables the MemManage, BusFault and UsageFault handlers.
+ *
+ * Without this they all escalate to HardFault, which still dumps but with
+ * the reason only in CFSR.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void crash_dump_init(void);
+
+/**
+ *
+ * @fn void crash_dump_capture(const uint32_t *frame, uint32_t exc_return, const uint32_t *callee, uint32_t fault)
+ * @brief Fills in the dump and resets.
+ *
+ * Only from CRASH_DUMP_ENTRY(), it runs on crash_dump_fault_stack with the
+ * faulting context in the arguments.
+ *
+ * @param frame Exception frame, on whichever stack was in use.
+ * @param exc_return LR on exception entry.
+ * @param callee r4-r11 as they were at the fault.
+ * @param fault CRASH_DUMP_FAULT_x.
+ * @return None, it resets.
+ *
+ */
+void crash_dump_capture(const uint32_t *frame, uint32_t exc_return, const uint32_t *callee, uint32_t fault) __attribute__((noreturn, used));
+
+/**
+ *
+ * @fn uint8_t crash_dump_report(void)
+ * @brief Queues the dump left by the last fault, if there is one, as
+ * UNIVERSAL_CRASH packets and clears it.
+ *
+ * Call once at boot after full_duplex_usart_dma_init().  A dump that fails
+ * its checksum (RAM after power up) is cleared without being sent.
+ *
+ * @param None
+ * @return uint8_t CRASH_DUMP_SUCCESS if one was queued, CRASH_DUMP_NONE if
+ * there wasn't one, CRASH_DUMP_ERROR_QUEUE if the TX queue was full.
+ *
+ */
+uint8_t crash_dump_report(void);
+
+#endif
@@ -9,7 +9,7 @@
 #define DEBUG_H
 
 #include <stdint.h>
-#include "stm32f4xx_conf.h"
+#include "hal.h"
 
 #ifndef GIT_REVISION
 #define GIT_REVISION "generic-stm32f4-DEADBEEF"
@@ -37,8 +37,7 @@ typedef struct {
    debug_states state;
    debug_blink_rate blink;
    uint8_t initialized;
-   GPIO_TypeDef *port;
-   uint16_t pin;
+   uint8_t pin;                  /* One of hal_pins. */
 } debug_struct;
 
 
@@ -0,0 +1,123 @@
+/**
+ * @file event_scheduler.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the main loop event scheduler.
+ *
+ */
+
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <stdint.h>
+#include "hal.h"
+
+/* ************************************************************* */
+/* * Events                                                    * */
+/* ************************************************************* */
+/* One bit per event.  Lower bits are handled first when several are
+ * pending.
+ */
+#define EVENT_FDUD_RX         (1UL << 0)  /* Bytes moved into the USART1 RAM buffer. */
+#define EVENT_FDUD_TX         (1UL << 1)  /* Packet added to the USART1 TX queue. */
+#define EVENT_TILT_SYNC       (1UL << 2)  /* Hokuyo sync pulse, tilt angle due. */
+#define EVENT_RS485_MASTER    (1UL << 3)  /* Bytes moved into the RS485 master RAM buffer. */
+#define EVENT_RS485_SLAVE     (1UL << 4)  /* Bytes moved into the RS485 slave RAM buffer. */
+#define EVENT_ANALOG_ALERT    (1UL << 5)  /* An analog input crossed or cleared a threshold. */
+#define EVENT_ANALOG_WINDOW   (1UL << 6)  /* Analog telemetry window complete. */
+
+#define EVENT_MAX_EVENTS      32
+
+/* Idle percentage is latched over windows of this many milliseconds. */
+#define EVENT_IDLE_WINDOW_MS  1000
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define EVENT_SUCCESS         0x00
+#define EVENT_ERROR_BAD_EVENT 0x01
+
+typedef void (*EventHandler)(void);
+
+/* ************************************************************* */
+/* * Scheduler Functions                                       * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void event_init(void)
+ * @brief Clears the handler table and any pending events.
+ * @param None
+ * @return None
+ *
+ */
+void event_init(void);
+
+/**
+ *
+ * @fn uint8_t event_register(uint32_t event, EventHandler handler)
+ * @brief Sets the function that runs when an event is posted.
+ * @param event Exactly one EVENT_* bit.
+ * @param handler Runs from event_dispatch() in the main loop, NULL to ignore the event.
+ * @return uint8_t Event return code.
+ *
+ */
+uint8_t event_register(uint32_t event, EventHandler handler);
+
+/**
+ *
+ * @fn void event_post(uint32_t events)
+ * @brief Marks events as pending.
+ *
+ * Safe from any interrupt priority, it never masks interrupts.  Posting an
+ * event that is already pending runs its handler once.
+ *
+ * @param events One or more EVENT_* bits.
+ * @return None
+ *
+ */
+void event_post(uint32_t events);
+
+/**
+ *
+ * @fn void event_dispatch(void)
+ * @brief Runs the handlers of every pending event, then sleeps.
+ *
+ * Call from the main while loop.  When nothing is pending the core waits in
+ * WFI until the next interrupt, so everything the main loop does has to be
+ * started by an event.  Needs systick_init() for the idle accounting.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void event_dispatch(void);
+
+/**
+ *
+ * @fn void event_set_idle(EventHandler handler)
+ * @brief Sets a function that runs once nothing is pending, just before the
+ * core goes to sleep.
+ *
+ * For background work that can wait, like draining a log.  If it posts an
+ * event the core doesn't sleep and the event is handled on the next
+ * event_dispatch().
+ *
+ * @param handler NULL for none.
+ * @return None
+ *
+ */
+void event_set_idle(EventHandler handler);
+
+/**
+ *
+ * @fn uint8_t event_idle_percent(void)
+ * @brief Time spent asleep in WFI over the last EVENT_IDLE_WINDOW_MS.
+ * @param None
+ * @return uint8_t Percent idle, 0 to 100.
+ *
+ */
+uint8_t event_idle_percent(void);
+
+#endif
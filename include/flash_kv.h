@@ -0,0 +1,160 @@
+/**
+ * @file flash_kv.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the wear leveled key/value store in on-chip flash.
+ *
+ */
+
+#ifndef FLASH_KV_H
+#define FLASH_KV_H
+
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Store Layout                                              * */
+/* ************************************************************* */
+/* Two flash sectors take turns being the active log.  Word 0 of a sector
+ * is its state and word 1 its generation, which goes up by one every time
+ * the log moves over.  Records follow as two word pairs, the value and then
+ * the key with a check value, appended until the sector is full.  The newest
+ * record for a key wins.  When the active sector fills up the latest value of
+ * every key is copied to the other sector, so both sectors wear evenly and a
+ * key can be rewritten about FLASH_KV_SECTOR_RECORDS times per erase.  The
+ * sector left behind is erased by the next flash_kv_init(), so the log can
+ * move once per boot.
+ */
+#ifndef FLASH_KV_SECTOR_WORDS
+#define FLASH_KV_SECTOR_WORDS      (16384 / 4)
+#endif
+#define FLASH_KV_HEADER_WORDS      2
+#define FLASH_KV_RECORD_WORDS      2
+#define FLASH_KV_SECTOR_RECORDS    ((FLASH_KV_SECTOR_WORDS - FLASH_KV_HEADER_WORDS) / FLASH_KV_RECORD_WORDS)
+
+/* Sector states only ever clear bits so each one can be programmed over the
+ * last without an erase.
+ */
+#define FLASH_KV_SECTOR_ERASED     0xFFFFFFFF
+#define FLASH_KV_SECTOR_RECEIVING  0xEEEEEEEE
+#define FLASH_KV_SECTOR_ACTIVE     0x00000000
+
+/* ************************************************************* */
+/* * Keys                                                      * */
+/* ************************************************************* */
+/* Keys are 16 bits, 0xFFFF is reserved for erased flash. */
+#define FLASH_KV_KEY_INVALID         0xFFFF
+#define FLASH_KV_KEY_RS485_ADDRESS   0x0001
+#define FLASH_KV_KEY_BATTERY_ALERT   0x0002  /* High threshold << 16 | low. */
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define FLASH_KV_SUCCESS           0x00
+#define FLASH_KV_ERROR_NOT_FOUND   0x01
+#define FLASH_KV_ERROR_FULL        0x02
+#define FLASH_KV_ERROR_FLASH       0x03
+#define FLASH_KV_ERROR_KEY         0x04
+#define FLASH_KV_ERROR_INIT        0x05
+
+/* ************************************************************* */
+/* * Store Functions                                           * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t flash_kv_init(void)
+ * @brief Finds the active sector and finishes anything a reset interrupted.
+ *
+ * A move to the other sector that didn't complete is thrown away, one that
+ * completed gets its old sector erased.  Blank flash is formatted.  This is
+ * the only place the store erases.  Erasing a sector stalls the whole chip
+ * for a few hundred milliseconds, so call this before watchdog_init().
+ *
+ * @param None
+ * @return uint8_t Flash KV return code.
+ *
+ */
+uint8_t flash_kv_init(void);
+
+/**
+ *
+ * @fn uint8_t flash_kv_read(uint16_t key, uint32_t *value)
+ * @brief Reads the newest value stored for a key.
+ * @param key Key to look up.
+ * @param *value Set to the value if the key was found.
+ * @return uint8_t Flash KV return code.
+ *
+ */
+uint8_t flash_kv_read(uint16_t key, uint32_t *value);
+
+/**
+ *
+ * @fn uint8_t flash_kv_write(uint16_t key, uint32_t value)
+ * @brief Stores a value for a key.
+ *
+ * Writing the value that is already stored does nothing.  A write to a full
+ * sector moves the log to the other one, which flash_kv_init() left erased.
+ * Nothing is ever erased here, so a write only stalls the chip for the few
+ * words it programs and is safe with the watchdog running.  A second move
+ * before the next flash_kv_init() is refused with FLASH_KV_ERROR_FULL and
+ * the old value stays.  Power loss at any point leaves either the old or the
+ * new value.
+ *
+ * @param key Key to store, anything but FLASH_KV_KEY_INVALID.
+ * @param value Value to store.  Floats can be stored by their bits.
+ * @return uint8_t Flash KV return code.
+ *
+ */
+uint8_t flash_kv_write(uint16_t key, uint32_t value);
+
+/**
+ *
+ * @fn uint32_t flash_kv_generation(void)
+ * @brief Number of times the log has moved sectors since the store was formatted.
+ * @param None
+ * @return uint32_t Generation of the active sector.
+ *
+ */
+uint32_t flash_kv_generation(void);
+
+/* ************************************************************* */
+/* * Port Functions                                            * */
+/* ************************************************************* */
+/* Supplied by flash_kv_stm32.c on the target.  scripts/flash_kv_test.c has
+ * a set on RAM that behaves like NOR flash.
+ */
+
+/**
+ *
+ * @fn const volatile uint32_t *flash_kv_port_sector(uint8_t sector)
+ * @brief Memory mapped start of store sector 0 or 1.
+ * @param sector Store sector, 0 or 1.
+ * @return Pointer to FLASH_KV_SECTOR_WORDS readable words.
+ *
+ */
+const volatile uint32_t *flash_kv_port_sector(uint8_t sector);
+
+/**
+ *
+ * @fn uint8_t flash_kv_port_erase(uint8_t sector)
+ * @brief Erases a store sector to all ones.
+ * @param sector Store sector, 0 or 1.
+ * @return uint8_t Flash KV return code.
+ *
+ */
+uint8_t flash_kv_port_erase(uint8_t sector);
+
+/**
+ *
+ * @fn uint8_t flash_kv_port_program(uint8_t sector, uint32_t word, uint32_t value)
+ * @brief Programs one word of a store sector.
+ * @param sector Store sector, 0 or 1.
+ * @param word Word index within the sector.
+ * @param value Value to program, bits can only go from 1 to 0.
+ * @return uint8_t Flash KV return code.
+ *
+ */
+uint8_t flash_kv_port_program(uint8_t sector, uint32_t word, uint32_t value);
+
+#endif
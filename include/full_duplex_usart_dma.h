@@ -4,7 +4,7 @@
 #include <stdlib.h>
 
 /* Hardware related defines for this processor. */
-#include "stm32f4xx_conf.h"
+#include "hal.h"
 
 /* High level packet information as we will be sending packets. */
 #include "generic_packet.h"
@@ -0,0 +1,457 @@
+/**
+ * @file gp_proj_local.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Packets this firmware uses that stm32f4_generic_packet doesn't have
+ * yet.
+ *
+ * Everything here belongs in the library next to the other packets of the
+ * same project (gp_proj_universal.c, gp_proj_thermal.c and so on).  Until it
+ * gets there this module keeps the firmware and the host decoders linking
+ * against the library as it is.  When the library picks a packet up, delete
+ * it here.  The spec ids are enumerators like the library's, so a library
+ * enumerator with the same name is a redeclaration and stops the build, and
+ * each one is guarded against a library #define of the same name.
+ *
+ * The spec ids count down from 0xFF in each project so they stay clear of the
+ * library's own, which count up from 0.  Payloads are packed little endian in
+ * the order the create_*() function takes its arguments, the same as the
+ * library's, and every extract_*() checks the ids and the payload length
+ * before it reads anything.
+ *
+ * No target dependencies, the host decoders in scripts/ build it too.
+ */
+
+#ifndef GP_PROJ_LOCAL_H
+#define GP_PROJ_LOCAL_H
+
+#include <stdint.h>
+
+#include "generic_packet.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_thermal.h"
+#include "gp_proj_analog.h"
+#include "gp_proj_motor.h"
+#include "gp_proj_rs485_sb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ************************************************************* */
+/* * Spec IDs                                                  * */
+/* ************************************************************* */
+/* A library #define of the same name would turn the enums below into a
+ * syntax error, say what happened instead.
+ */
+#if defined(UNIVERSAL_QUERY_PROFILE)
+#error "UNIVERSAL_QUERY_PROFILE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_RESP_PROFILE)
+#error "UNIVERSAL_RESP_PROFILE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_QUERY_STACK)
+#error "UNIVERSAL_QUERY_STACK is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_RESP_STACK)
+#error "UNIVERSAL_RESP_STACK is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_TRACE)
+#error "UNIVERSAL_TRACE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_WATCHDOG)
+#error "UNIVERSAL_WATCHDOG is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(UNIVERSAL_CRASH)
+#error "UNIVERSAL_CRASH is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(THERMAL_LEPTON_COMPRESSED_LINE)
+#error "THERMAL_LEPTON_COMPRESSED_LINE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(ANALOG_WINDOW)
+#error "ANALOG_WINDOW is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(ANALOG_ALERT)
+#error "ANALOG_ALERT is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(MOTOR_QUERY_PID)
+#error "MOTOR_QUERY_PID is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(MOTOR_AUTOTUNE)
+#error "MOTOR_AUTOTUNE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_QUERY_LATENCY)
+#error "RS485_QUERY_LATENCY is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_RESP_LATENCY)
+#error "RS485_RESP_LATENCY is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_QUERY_UNIQUE_ID)
+#error "RS485_QUERY_UNIQUE_ID is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_RESP_UNIQUE_ID)
+#error "RS485_RESP_UNIQUE_ID is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_SET_ADDRESS)
+#error "RS485_SET_ADDRESS is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+#if defined(RS485_SYNC_SAMPLE)
+#error "RS485_SYNC_SAMPLE is in stm32f4_generic_packet now, delete it from gp_proj_local"
+#endif
+
+/* GP_PROJ_UNIVERSAL */
+enum
+{
+   UNIVERSAL_QUERY_PROFILE             = 0xFF,
+   UNIVERSAL_RESP_PROFILE              = 0xFE,
+   UNIVERSAL_QUERY_STACK               = 0xFD,
+   UNIVERSAL_RESP_STACK                = 0xFC,
+   UNIVERSAL_TRACE                     = 0xFB,
+   UNIVERSAL_WATCHDOG                  = 0xFA,
+   UNIVERSAL_CRASH                     = 0xF9
+};
+
+/* GP_PROJ_THERMAL */
+enum
+{
+   THERMAL_LEPTON_COMPRESSED_LINE      = 0xFF
+};
+
+/* GP_PROJ_ANALOG */
+enum
+{
+   ANALOG_WINDOW                       = 0xFF,
+   ANALOG_ALERT                        = 0xFE
+};
+
+/* GP_PROJ_MOTOR */
+enum
+{
+   MOTOR_QUERY_PID                     = 0xFF,
+   MOTOR_AUTOTUNE                      = 0xFE
+};
+
+/* GP_PROJ_RS485_SB */
+enum
+{
+   RS485_QUERY_LATENCY                 = 0xFF,
+   RS485_RESP_LATENCY                  = 0xFE,
+   RS485_QUERY_UNIQUE_ID               = 0xFD,
+   RS485_RESP_UNIQUE_ID                = 0xFC,
+   RS485_SET_ADDRESS                   = 0xFB,
+   RS485_SYNC_SAMPLE                   = 0xFA
+};
+
+/* ************************************************************* */
+/* * Payload Sizes                                             * */
+/* ************************************************************* */
+/* UNIVERSAL_TRACE records are trace_record_t as the M4 lays it out, cycles
+ * (4), id (1), arg8 (1), arg16 (2).
+ */
+#define GP_LOCAL_TRACE_RECORD_BYTES         8
+
+/* The 96 bit STM32 unique device ID. */
+#define GP_LOCAL_UNIQUE_ID_WORDS            3
+
+/* Largest payload a packet can carry, start, ids, length and checksum
+ * aside.  The length is one byte, so never more than 255.
+ */
+#define GP_LOCAL_MAX_PAYLOAD                (((GP_MAX_PACKET_LENGTH - GP_LOC_DATA_START - 1) < 255) ? \
+                                             (GP_MAX_PACKET_LENGTH - GP_LOC_DATA_START - 1) : 255)
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+/* GP_SUCCESS or one of these. */
+#define GP_LOCAL_ERROR_LENGTH               0xE0  /* Doesn't fit, or the payload is short. */
+#define GP_LOCAL_ERROR_TYPE                 0xE1  /* Not the packet the extract_*() is for. */
+
+/* ************************************************************* */
+/* * GP_PROJ_UNIVERSAL                                         * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t create_universal_query_profile(GenericPacket *gp, uint8_t clear)
+ * @brief Asks for the profiler table, profile_dump().
+ * @param *gp Packet to fill.
+ * @param clear Non zero to start a new window once it's sent.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_universal_query_profile(GenericPacket *gp, uint8_t clear);
+uint8_t extract_universal_query_profile(GenericPacket *gp, uint8_t *clear);
+
+/**
+ *
+ * @fn uint8_t create_universal_profile(GenericPacket *gp, uint8_t id, uint32_t count, uint32_t min_cycles, uint32_t max_cycles, uint32_t mean_cycles, uint32_t max_latency, uint32_t load_ppm, const uint16_t *hist, uint8_t bins)
+ * @brief One profile_entry_t, answers UNIVERSAL_QUERY_PROFILE.
+ * @param *gp Packet to fill.
+ * @param id PROFILE_ID_x
+ * @param count Sections completed.
+ * @param min_cycles Shortest, own cycles.
+ * @param max_cycles Longest, own cycles.
+ * @param mean_cycles Mean, own cycles.
+ * @param max_latency Longest timer update to handler entry, cycles.
+ * @param load_ppm Share of the window spent in the section.
+ * @param *hist bins counts, log2 of own cycles.
+ * @param bins Number of histogram bins.
+ * @return uint8_t GP_SUCCESS or GP_LOCAL_ERROR_LENGTH.
+ *
+ */
+uint8_t create_universal_profile(GenericPacket *gp, uint8_t id, uint32_t count, uint32_t min_cycles,
+                                 uint32_t max_cycles, uint32_t mean_cycles, uint32_t max_latency,
+                                 uint32_t load_ppm, const uint16_t *hist, uint8_t bins);
+uint8_t extract_universal_profile(GenericPacket *gp, uint8_t *id, uint32_t *count, uint32_t *min_cycles,
+                                  uint32_t *max_cycles, uint32_t *mean_cycles, uint32_t *max_latency,
+                                  uint32_t *load_ppm, uint16_t *hist, uint8_t bins);
+
+/**
+ *
+ * @fn uint8_t create_universal_query_stack(GenericPacket *gp)
+ * @brief Asks for the stack high-water mark, stack_monitor_report().
+ * @param *gp Packet to fill.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_universal_query_stack(GenericPacket *gp);
+
+/**
+ *
+ * @fn uint8_t create_universal_stack(GenericPacket *gp, uint32_t used, uint32_t size, uint32_t budget)
+ * @brief Stack high-water mark, answers UNIVERSAL_QUERY_STACK.
+ * @param *gp Packet to fill.
+ * @param used Deepest the stack has been, bytes.
+ * @param size Room between _sstack and _estack, bytes.
+ * @param budget _Min_Stack_Size, bytes.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_universal_stack(GenericPacket *gp, uint32_t used, uint32_t size, uint32_t budget);
+uint8_t extract_universal_stack(GenericPacket *gp, uint32_t *used, uint32_t *size, uint32_t *budget);
+
+/**
+ *
+ * @fn uint8_t create_universal_trace(GenericPacket *gp, uint32_t ms, uint32_t cycles, uint16_t dropped, const uint8_t *records, uint8_t count)
+ * @brief A run of trace records.
+ * @param *gp Packet to fill.
+ * @param ms hal_millis() when it was built.
+ * @param cycles hal_cycles() when it was built, ties ms to the records.
+ * @param dropped Records lost to a full ring since the last packet.
+ * @param *records count records of GP_LOCAL_TRACE_RECORD_BYTES each.
+ * @param count Number of records.
+ * @return uint8_t GP_SUCCESS or GP_LOCAL_ERROR_LENGTH.
+ *
+ */
+uint8_t create_universal_trace(GenericPacket *gp, uint32_t ms, uint32_t cycles, uint16_t dropped,
+                               const uint8_t *records, uint8_t count);
+uint8_t extract_universal_trace(GenericPacket *gp, uint32_t *ms, uint32_t *cycles, uint16_t *dropped,
+                                uint8_t *records, uint8_t *count);
+
+/**
+ *
+ * @fn uint8_t create_universal_watchdog(GenericPacket *gp, uint8_t task, uint32_t deadline_ms, uint32_t silent_ms, uint32_t uptime_ms)
+ * @brief Which heartbeat let the window watchdog reset the board.
+ * @param *gp Packet to fill.
+ * @param task WATCHDOG_TASK_x
+ * @param deadline_ms Its deadline.
+ * @param silent_ms Time since its last heartbeat.
+ * @param uptime_ms Time since watchdog_init().
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_universal_watchdog(GenericPacket *gp, uint8_t task, uint32_t deadline_ms,
+                                  uint32_t silent_ms, uint32_t uptime_ms);
+uint8_t extract_universal_watchdog(GenericPacket *gp, uint8_t *task, uint32_t *deadline_ms,
+                                   uint32_t *silent_ms, uint32_t *uptime_ms);
+
+/**
+ *
+ * @fn uint8_t create_universal_crash(GenericPacket *gp, uint16_t offset, uint16_t total, const uint8_t *data, uint8_t length)
+ * @brief One chunk of a crash dump.
+ * @param *gp Packet to fill.
+ * @param offset Where data goes in the dump.
+ * @param total Size of the whole dump.
+ * @param *data length bytes of the dump.
+ * @param length Bytes in this chunk.
+ * @return uint8_t GP_SUCCESS or GP_LOCAL_ERROR_LENGTH.
+ *
+ */
+uint8_t create_universal_crash(GenericPacket *gp, uint16_t offset, uint16_t total,
+                               const uint8_t *data, uint8_t length);
+uint8_t extract_universal_crash(GenericPacket *gp, uint16_t *offset, uint16_t *total,
+                                uint8_t *data, uint8_t *length);
+
+/* ************************************************************* */
+/* * GP_PROJ_THERMAL                                           * */
+/* ************************************************************* */
+/**
+ *
+ * @fn uint8_t create_thermal_lepton_compressed_line(GenericPacket *gp, const uint8_t *data, uint16_t length)
+ * @brief A VoSPI line from lepton_compress_line().
+ * @param *gp Packet to fill.
+ * @param *data The compressed line.
+ * @param length Bytes in data.
+ * @return uint8_t GP_SUCCESS or GP_LOCAL_ERROR_LENGTH.
+ *
+ * The payload is the compressed line and nothing else, its length is the
+ * packet's payload length.
+ *
+ */
+uint8_t create_thermal_lepton_compressed_line(GenericPacket *gp, const uint8_t *data, uint16_t length);
+uint8_t extract_thermal_lepton_compressed_line(GenericPacket *gp, uint8_t *data, uint16_t *length);
+
+/* ************************************************************* */
+/* * GP_PROJ_ANALOG                                            * */
+/* ************************************************************* */
+/**
+ *
+ * @fn uint8_t create_analog_window(GenericPacket *gp, uint8_t channel, uint32_t number, uint16_t min, uint16_t max, uint16_t mean, uint16_t rms, uint8_t alert)
+ * @brief One analog_telemetry_window_t.
+ * @param *gp Packet to fill.
+ * @param channel ANALOG_INPUT_x
+ * @param number Window number, a gap is a window nobody sent.
+ * @param min Fraction of full scale, 65535 is VREF, as are the next three.
+ * @param max
+ * @param mean
+ * @param rms
+ * @param alert Non zero if the channel was in alert during the window.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_analog_window(GenericPacket *gp, uint8_t channel, uint32_t number, uint16_t min,
+                             uint16_t max, uint16_t mean, uint16_t rms, uint8_t alert);
+uint8_t extract_analog_window(GenericPacket *gp, uint8_t *channel, uint32_t *number, uint16_t *min,
+                              uint16_t *max, uint16_t *mean, uint16_t *rms, uint8_t *alert);
+
+/**
+ *
+ * @fn uint8_t create_analog_alert(GenericPacket *gp, uint8_t channel, uint8_t state, uint8_t previous, uint16_t value, uint32_t blocks, uint32_t count)
+ * @brief One analog_telemetry_alert_t, sent when a channel's alert changes.
+ * @param *gp Packet to fill.
+ * @param channel ANALOG_INPUT_x
+ * @param state analog_telemetry_alert_states
+ * @param previous The state before.
+ * @param value Block value that tripped it, or the furthest it went.
+ * @param blocks Blocks it lasted, 0 while it's active.
+ * @param count Alerts on the channel so far.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_analog_alert(GenericPacket *gp, uint8_t channel, uint8_t state, uint8_t previous,
+                            uint16_t value, uint32_t blocks, uint32_t count);
+uint8_t extract_analog_alert(GenericPacket *gp, uint8_t *channel, uint8_t *state, uint8_t *previous,
+                             uint16_t *value, uint32_t *blocks, uint32_t *count);
+
+/* ************************************************************* */
+/* * GP_PROJ_MOTOR                                             * */
+/* ************************************************************* */
+/**
+ *
+ * @fn uint8_t create_motor_query_pid(GenericPacket *gp)
+ * @brief Asks for the brushed tilt gains, answered with MOTOR_RESP_PID.
+ * @param *gp Packet to fill.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_motor_query_pid(GenericPacket *gp);
+
+/**
+ *
+ * @fn uint8_t create_motor_autotune(GenericPacket *gp)
+ * @brief Starts a relay autotune of the brushed tilt axis.
+ * @param *gp Packet to fill.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_motor_autotune(GenericPacket *gp);
+
+/* ************************************************************* */
+/* * GP_PROJ_RS485_SB                                          * */
+/* ************************************************************* */
+/**
+ *
+ * @fn uint8_t create_rs485_query_latency(GenericPacket *gp, uint8_t address)
+ * @brief Asks the master for one slave's turnaround statistics.
+ * @param *gp Packet to fill.
+ * @param address Slave address.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_rs485_query_latency(GenericPacket *gp, uint8_t address);
+uint8_t extract_rs485_query_latency(GenericPacket *gp, uint8_t *address);
+
+/**
+ *
+ * @fn uint8_t create_rs485_resp_latency(GenericPacket *gp, uint8_t address, uint32_t p99_usec, uint32_t timeout_usec, const uint16_t *hist, uint8_t bins)
+ * @brief One slave's turnaround statistics, answers RS485_QUERY_LATENCY.
+ * @param *gp Packet to fill.
+ * @param address Slave address.
+ * @param p99_usec Running p99 turnaround.
+ * @param timeout_usec Response timeout the master uses for it now.
+ * @param *hist bins counts, bin n is 2^n to 2^(n+1) usec.
+ * @param bins Number of histogram bins.
+ * @return uint8_t GP_SUCCESS or GP_LOCAL_ERROR_LENGTH.
+ *
+ */
+uint8_t create_rs485_resp_latency(GenericPacket *gp, uint8_t address, uint32_t p99_usec,
+                                  uint32_t timeout_usec, const uint16_t *hist, uint8_t bins);
+uint8_t extract_rs485_resp_latency(GenericPacket *gp, uint8_t *address, uint32_t *p99_usec,
+                                   uint32_t *timeout_usec, uint16_t *hist, uint8_t bins);
+
+/**
+ *
+ * @fn uint8_t create_rs485_query_unique_id(GenericPacket *gp, uint8_t address)
+ * @brief Asks a slave, or every unaddressed one, for its unique ID.
+ * @param *gp Packet to fill.
+ * @param address Slave address or RS485_ADDRESS_CONFIGURATION.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_rs485_query_unique_id(GenericPacket *gp, uint8_t address);
+uint8_t extract_rs485_query_unique_id(GenericPacket *gp, uint8_t *address);
+
+/**
+ *
+ * @fn uint8_t create_rs485_resp_unique_id(GenericPacket *gp, uint8_t address, const uint32_t *unique_id)
+ * @brief A slave's address and unique ID.
+ * @param *gp Packet to fill.
+ * @param address The slave's address now.
+ * @param *unique_id GP_LOCAL_UNIQUE_ID_WORDS words.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_rs485_resp_unique_id(GenericPacket *gp, uint8_t address, const uint32_t *unique_id);
+uint8_t extract_rs485_resp_unique_id(GenericPacket *gp, uint8_t *address, uint32_t *unique_id);
+
+/**
+ *
+ * @fn uint8_t create_rs485_set_address(GenericPacket *gp, const uint32_t *unique_id, uint8_t address)
+ * @brief Gives the slave with unique_id a new address.
+ * @param *gp Packet to fill.
+ * @param *unique_id GP_LOCAL_UNIQUE_ID_WORDS words.
+ * @param address The new address.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_rs485_set_address(GenericPacket *gp, const uint32_t *unique_id, uint8_t address);
+uint8_t extract_rs485_set_address(GenericPacket *gp, uint32_t *unique_id, uint8_t *address);
+
+/**
+ *
+ * @fn uint8_t create_rs485_sync_sample(GenericPacket *gp, uint16_t slot_usec)
+ * @brief Broadcast, every slave samples now and answers in its own slot.
+ * @param *gp Packet to fill.
+ * @param slot_usec Slot width, a slave answers (address - first) slots on.
+ * @return uint8_t GP_SUCCESS
+ *
+ */
+uint8_t create_rs485_sync_sample(GenericPacket *gp, uint16_t slot_usec);
+uint8_t extract_rs485_sync_sample(GenericPacket *gp, uint16_t *slot_usec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,396 @@
+/**
+ * @file gp_stream.hpp
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header only C++ decoder for the GenericPacket stream, PC side.
+ *
+ * For programs on the other end of USART1 (or the RS485 bus) that want
+ * packets out of a byte stream without linking the C library.  Feed it
+ * whatever read() returns, any size, and it calls back with each packet that
+ * passes its checksum.  Nothing is allocated, packets that arrive whole in one
+ * chunk are handed over in place and only a packet split across chunks is
+ * copied, into a buffer inside the decoder.
+ *
+ * Needs C++17.  Only the generic_packet headers and gp_proj_local.h are used,
+ * for the field locations and ids, none of the library is linked.
+ *
+ *    gp_stream::decoder dec;
+ *    dec.feed(buf, n, [](const gp_stream::packet &p)
+ *    {
+ *       if(auto pos = gp_stream::view_as<gp_stream::motor_position_ts>(p))
+ *       {
+ *          printf("%f at %u\n", pos->rad(), pos->timestamp());
+ *       }
+ *    });
+ *
+ * Build and run scripts/gp_stream_bench.cpp ("make gp_stream_bench") after a
+ * generic_packet update, it checks this against the library byte for byte.
+ */
+
+#ifndef GP_STREAM_HPP
+#define GP_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "generic_packet.h"
+#include "gp_proj_motor.h"
+#include "gp_proj_thermal.h"
+#include "gp_proj_rs485_sb.h"
+#include "gp_proj_local.h"
+
+namespace gp_stream
+{
+
+/* ************************************************************* */
+/* * Wire Format                                               * */
+/* ************************************************************* */
+/* Framing as generic_packet.c writes it,
+ *
+ *    start, project id, project spec, payload length, payload..., checksum
+ *
+ * The checksum is the 8 bit sum of everything from the project id to the end
+ * of the payload.  There's no escaping, so a start byte inside a payload looks
+ * like a frame start.  A bad checksum only gives up the one start byte and the
+ * search carries on from the next, so a packet hiding behind a false start is
+ * still found.
+ */
+struct wire
+{
+   static constexpr uint8_t start = 0xA5;
+   static constexpr size_t loc_proj_id = GP_LOC_PROJ_ID;
+   static constexpr size_t loc_proj_spec = GP_LOC_PROJ_SPEC;
+   static constexpr size_t loc_length = GP_LOC_DATA_START - 1;
+   static constexpr size_t header = GP_LOC_DATA_START;
+   static constexpr size_t checksum = 1;
+   static constexpr size_t max_packet = GP_MAX_PACKET_LENGTH;
+   static constexpr size_t max_payload = GP_MAX_PACKET_LENGTH - GP_LOC_DATA_START - 1;
+
+   static uint8_t sum(const uint8_t *bytes, size_t length)
+   {
+      uint32_t total = 0;
+
+      /* Wide accumulator so the compiler can vectorise the loop. */
+      for(size_t ii = 0; ii < length; ii++)
+      {
+         total += bytes[ii];
+      }
+
+      return (uint8_t)total;
+   }
+};
+
+static_assert((GP_LOC_PROJ_ID == 1)&&(GP_LOC_PROJ_SPEC == 2)&&(GP_LOC_DATA_START == 4),
+              "generic_packet.h header layout changed, update gp_stream::wire");
+
+/* ************************************************************* */
+/* * Packets                                                   * */
+/* ************************************************************* */
+/* One checked packet.  Points into the chunk that was fed or the decoder's
+ * own buffer, so it's only good until the callback returns.  Copy what's
+ * needed out of it.
+ */
+class packet
+{
+public:
+   packet(const uint8_t *bytes, size_t length) : bytes_(bytes), length_(length) {}
+
+   uint8_t proj_id() const { return bytes_[wire::loc_proj_id]; }
+   uint8_t proj_spec() const { return bytes_[wire::loc_proj_spec]; }
+   const uint8_t *payload() const { return &(bytes_[wire::header]); }
+   size_t payload_length() const { return bytes_[wire::loc_length]; }
+
+   /* The whole frame, start byte to checksum. */
+   const uint8_t *bytes() const { return bytes_; }
+   size_t length() const { return length_; }
+
+private:
+   const uint8_t *bytes_;
+   size_t length_;
+};
+
+/* Typed access to one kind of payload.  Fields are packed little endian in
+ * the order the create_*() function takes them.  Use view_as<>() to get one,
+ * it checks the ids and that the payload is long enough first.
+ */
+template <uint8_t ProjId, uint8_t ProjSpec, size_t MinLength>
+class payload_view
+{
+public:
+   static constexpr uint8_t proj_id = ProjId;
+   static constexpr uint8_t proj_spec = ProjSpec;
+   static constexpr size_t min_length = MinLength;
+
+   explicit payload_view(const packet &p) : p_(p) {}
+
+   const packet &raw() const { return p_; }
+
+protected:
+   template <typename T>
+   T load(size_t offset) const
+   {
+      T value;
+
+      /* memcpy, the payload has no alignment to speak of. */
+      std::memcpy(&value, p_.payload() + offset, sizeof(T));
+      return value;
+   }
+
+private:
+   packet p_;
+};
+
+/**
+ *
+ * @fn template <typename View> std::optional<View> view_as(const packet &p)
+ * @brief The packet as a View if it is one.
+ * @param p Packet from the decoder.
+ * @return std::optional<View> Empty if the ids don't match or it's short.
+ *
+ */
+template <typename View>
+std::optional<View> view_as(const packet &p)
+{
+   if((p.proj_id() != View::proj_id)||(p.proj_spec() != View::proj_spec)||(p.payload_length() < View::min_length))
+   {
+      return std::nullopt;
+   }
+
+   return View(p);
+}
+
+/* ************************************************************* */
+/* * GP_PROJ_MOTOR                                             * */
+/* ************************************************************* */
+/* create_motor_resp_position() */
+struct motor_position : payload_view<GP_PROJ_MOTOR, MOTOR_RESP_POSITION, 4>
+{
+   using payload_view::payload_view;
+   float rad() const { return load<float>(0); }
+};
+
+/* create_motor_resp_position_ts(), sent on every Hokuyo sync. */
+struct motor_position_ts : payload_view<GP_PROJ_MOTOR, MOTOR_RESP_POSITION_TS, 8>
+{
+   using payload_view::payload_view;
+   float rad() const { return load<float>(0); }
+   uint32_t timestamp() const { return load<uint32_t>(4); }
+};
+
+/* create_motor_tmc260_resp_status(), fields of tmc260_status_struct. */
+struct motor_tmc260_status : payload_view<GP_PROJ_MOTOR, MOTOR_TMC260_RESP_STATUS, 7>
+{
+   using payload_view::payload_view;
+   uint16_t position() const { return load<uint16_t>(0); }
+   uint16_t stall_guard() const { return load<uint16_t>(2); }
+   uint16_t current() const { return load<uint16_t>(4); }
+   uint8_t status_byte() const { return load<uint8_t>(6); }
+};
+
+/* ************************************************************* */
+/* * GP_PROJ_THERMAL                                           * */
+/* ************************************************************* */
+/* create_thermal_begin_lepton_image() */
+struct thermal_begin_image : payload_view<GP_PROJ_THERMAL, THERMAL_BEGIN_LEPTON_IMAGE, 6>
+{
+   using payload_view::payload_view;
+   uint16_t image_num() const { return load<uint16_t>(0); }
+   uint32_t ms() const { return load<uint32_t>(2); }
+};
+
+/* create_thermal_lepton_frame(), one raw 164 byte VoSPI packet. */
+struct thermal_lepton_frame : payload_view<GP_PROJ_THERMAL, THERMAL_LEPTON_FRAME, 164>
+{
+   using payload_view::payload_view;
+   const uint8_t *data() const { return raw().payload(); }
+   uint8_t line() const { return raw().payload()[1]; }
+};
+
+/* create_thermal_lepton_compressed_line(), lepton_decompress_line() it. */
+struct thermal_compressed_line : payload_view<GP_PROJ_THERMAL, THERMAL_LEPTON_COMPRESSED_LINE, 1>
+{
+   using payload_view::payload_view;
+   const uint8_t *data() const { return raw().payload(); }
+   size_t length() const { return raw().payload_length(); }
+};
+
+struct thermal_end_image : payload_view<GP_PROJ_THERMAL, THERMAL_END_LEPTON_IMAGE, 0>
+{
+   using payload_view::payload_view;
+};
+
+struct thermal_image_timeout : payload_view<GP_PROJ_THERMAL, THERMAL_IMAGE_TIMEOUT, 0>
+{
+   using payload_view::payload_view;
+};
+
+/* ************************************************************* */
+/* * GP_PROJ_RS485_SB                                          * */
+/* ************************************************************* */
+/* create_rs485_resp_unique_id(), a slave answering the address search. */
+struct rs485_unique_id : payload_view<GP_PROJ_RS485_SB, RS485_RESP_UNIQUE_ID, 13>
+{
+   using payload_view::payload_view;
+   uint8_t address() const { return load<uint8_t>(0); }
+   uint32_t unique_id(size_t word) const { return load<uint32_t>(1 + (word * 4)); }
+};
+
+/* ************************************************************* */
+/* * Decoder                                                   * */
+/* ************************************************************* */
+struct decoder_stats
+{
+   uint64_t bytes = 0;
+   uint64_t packets = 0;
+   uint64_t checksum_errors = 0;
+   uint64_t bad_lengths = 0;
+   uint64_t skipped = 0;                    /* Bytes outside any good packet. */
+};
+
+class decoder
+{
+public:
+   /**
+    *
+    * @fn template <typename Handler> void feed(const uint8_t *data, size_t length, Handler &&on_packet)
+    * @brief Decodes the next piece of the stream.
+    *
+    * on_packet(const packet &) is called for each good packet in order, before
+    * feed() returns.  Anything left over waits for the next feed().
+    *
+    * @param data Bytes as they came off the wire.
+    * @param length Number of bytes, 0 is fine.
+    * @param on_packet Callback.
+    * @return None
+    *
+    */
+   template <typename Handler>
+   void feed(const uint8_t *data, size_t length, Handler &&on_packet)
+   {
+      size_t want, take, used;
+
+      stats_.bytes += length;
+
+      /* Finish whatever is sitting in the buffer first. */
+      while((length > 0)&&(pending_ > 0))
+      {
+         want = (pending_ < wire::header) ? wire::header : frame_length(buffer_);
+         if(want > pending_)
+         {
+            take = ((want - pending_) < length) ? (want - pending_) : length;
+            std::memcpy(&(buffer_[pending_]), data, take);
+            pending_ += take;
+            data += take;
+            length -= take;
+            if(pending_ < want)
+            {
+               return;
+            }
+         }
+
+         used = scan(buffer_, pending_, on_packet);
+         std::memmove(buffer_, &(buffer_[used]), pending_ - used);
+         pending_ -= used;
+      }
+
+      if(length > 0)
+      {
+         used = scan(data, length, on_packet);
+         std::memcpy(buffer_, &(data[used]), length - used);
+         pending_ = length - used;
+      }
+   }
+
+   /**
+    *
+    * @fn void reset(void)
+    * @brief Drops any partial packet, for a reopened port.  Keeps the stats.
+    * @param None
+    * @return None
+    *
+    */
+   void reset()
+   {
+      stats_.skipped += pending_;
+      pending_ = 0;
+   }
+
+   const decoder_stats &stats() const { return stats_; }
+
+private:
+   /* Header must be there.  Too long comes back as 1 so scan() skips it. */
+   static size_t frame_length(const uint8_t *frame)
+   {
+      size_t payload = frame[wire::loc_length];
+
+      return (payload > wire::max_payload) ? 1 : (wire::header + payload + wire::checksum);
+   }
+
+   /* Hands over every good packet in bytes and returns how many bytes it got
+    * through.  What's left is the start of a packet that isn't all there yet,
+    * always shorter than wire::max_packet.
+    */
+   template <typename Handler>
+   size_t scan(const uint8_t *bytes, size_t length, Handler &on_packet)
+   {
+      const uint8_t *found;
+      size_t ii = 0;
+      size_t total;
+
+      while(ii < length)
+      {
+         found = (const uint8_t *)std::memchr(&(bytes[ii]), wire::start, length - ii);
+         if(found == nullptr)
+         {
+            stats_.skipped += length - ii;
+            return length;
+         }
+         stats_.skipped += (size_t)(found - &(bytes[ii]));
+         ii = (size_t)(found - bytes);
+
+         if((length - ii) < wire::header)
+         {
+            return ii;
+         }
+
+         if(bytes[ii + wire::loc_length] > wire::max_payload)
+         {
+            stats_.bad_lengths++;
+            stats_.skipped++;
+            ii++;
+            continue;
+         }
+
+         total = frame_length(&(bytes[ii]));
+         if((length - ii) < total)
+         {
+            return ii;
+         }
+
+         if(wire::sum(&(bytes[ii + wire::loc_proj_id]), total - wire::loc_proj_id - wire::checksum) == bytes[ii + total - 1])
+         {
+            stats_.packets++;
+            on_packet(packet(&(bytes[ii]), total));
+            ii += total;
+         }
+         else
+         {
+            stats_.checksum_errors++;
+            stats_.skipped++;
+            ii++;
+         }
+      }
+
+      return length;
+   }
+
+   uint8_t buffer_[wire::max_packet];
+   size_t pending_ = 0;
+   decoder_stats stats_;
+};
+
+} /* namespace gp_stream */
+
+#endif
@@ -0,0 +1,322 @@
+/**
+ * @file hal.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Hardware boundary for the modules that also build on a PC.
+ *
+ * Modules written against this header don't touch StdPeriph or the CMSIS
+ * registers themselves.  On the STM32 the calls below are inline wrappers
+ * (hal_stm32.h) plus the init functions in hal_stm32.c, so there's nothing
+ * added to the interrupt paths.  Built with HAL_HOST defined they go to
+ * hal_host.c instead, which simulates the peripherals on a virtual clock and
+ * calls the real interrupt handlers when they're due.
+ *
+ * Peripherals are named for what they do rather than which one it is, the
+ * mapping to TIM5, PA2 and so on is in hal_stm32.h and hal_stm32.c.
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Peripherals                                               * */
+/* ************************************************************* */
+enum hal_timers
+{
+   HAL_TIMER_TILT_STEP,       /* TIM5, 32 bit, one update per micro step. */
+   HAL_TIMER_TILT_STATE,      /* TIM11, tilt state machine tick. */
+   HAL_TIMER_LINK_SERVICE,    /* TIM12, moves USART1 DMA bytes to RAM. */
+   HAL_TIMER_RS485_MASTER,    /* TIM9, RS485 master state machine tick. */
+   HAL_TIMER_RS485_SLAVE,     /* TIM10, RS485 slave state machine tick. */
+   HAL_TIMER_SW_TIMER,        /* TIM2, 32 bit, free runs under the software timers. */
+   HAL_NUM_TIMERS
+};
+
+enum hal_pins
+{
+   HAL_PIN_LED_GREEN,         /* PD12 */
+   HAL_PIN_LED_ORANGE,        /* PD13 */
+   HAL_PIN_LED_RED,           /* PD14 */
+   HAL_PIN_LED_BLUE,          /* PD15 */
+   HAL_PIN_TMC260_EN,         /* PA0, active low, an input on the real board. */
+   HAL_PIN_TMC260_DIR,        /* PA1 */
+   HAL_PIN_TMC260_STEP,       /* PA2 */
+   HAL_PIN_TMC260_CSN,        /* PC13 */
+   HAL_PIN_TMC260_SG,         /* PC2, stall guard. */
+   HAL_PIN_TILT_HOME,         /* PC0 (PC1 on the TOS_100 dev board), low when covered. */
+   HAL_PIN_HOKUYO_SYNC,       /* PB12 */
+   HAL_PIN_RS485_MASTER_TR,   /* PD7, high to drive the bus. */
+   HAL_PIN_RS485_SLAVE_TR,    /* PC8, high to drive the bus. */
+   HAL_NUM_PINS
+};
+
+enum hal_spis
+{
+   HAL_SPI_TMC260,            /* SPI1 on PA5-7, chip select is HAL_PIN_TMC260_CSN. */
+   HAL_NUM_SPIS
+};
+
+enum hal_usarts
+{
+   HAL_USART_LINK,            /* USART1 on PB6/7, RX DMA2_Stream5, TX DMA2_Stream7. */
+   HAL_USART_RS485_MASTER,    /* USART2 TX PA2, RX PD6, RX DMA1_Stream5, TX DMA1_Stream6. */
+   HAL_USART_RS485_SLAVE,     /* USART6 on PC6/7, RX DMA2_Stream1, TX DMA2_Stream6. */
+   HAL_NUM_USARTS
+};
+
+/* hal_gpio_init() modes. */
+#define HAL_GPIO_OUTPUT           0x00
+#define HAL_GPIO_INPUT            0x01
+#define HAL_GPIO_INPUT_PULLUP     0x02
+
+/* hal_exti_init() edges. */
+#define HAL_EXTI_RISING           0x01
+#define HAL_EXTI_FALLING          0x02
+#define HAL_EXTI_BOTH             (HAL_EXTI_RISING | HAL_EXTI_FALLING)
+
+/* hal_unique_id() length. */
+#define HAL_UNIQUE_ID_WORDS       3
+
+/* ************************************************************* */
+/* * Init Functions                                            * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void hal_timer_init(uint8_t timer, uint16_t prescaler, uint32_t period, uint8_t priority, uint8_t subpriority)
+ * @brief Starts a timer with its update interrupt enabled.
+ *
+ * The update interrupt fires every (prescaler + 1) * (period + 1) timer
+ * clocks.  Timers on APB1 count at SystemCoreClock/2, on APB2 at
+ * SystemCoreClock.
+ *
+ * @param timer One of hal_timers.
+ * @param prescaler Timer clock divider less one.
+ * @param period Auto-reload value.
+ * @param priority NVIC preemption priority.
+ * @param subpriority NVIC sub priority.
+ * @return None
+ *
+ */
+void hal_timer_init(uint8_t timer, uint16_t prescaler, uint32_t period, uint8_t priority, uint8_t subpriority);
+
+/**
+ *
+ * @fn void hal_timer_compare_init(uint8_t timer, uint16_t prescaler, uint8_t priority, uint8_t subpriority)
+ * @brief Starts a timer free running over its whole range with only the
+ * compare interrupt enabled.
+ *
+ * The counter counts every prescaler + 1 timer clocks and wraps at its
+ * width.  The compare interrupt fires when it reaches the value from
+ * hal_timer_compare_set().
+ *
+ * @param timer One of hal_timers.
+ * @param prescaler Timer clock divider less one.
+ * @param priority NVIC preemption priority.
+ * @param subpriority NVIC sub priority.
+ * @return None
+ *
+ */
+void hal_timer_compare_init(uint8_t timer, uint16_t prescaler, uint8_t priority, uint8_t subpriority);
+
+/**
+ *
+ * @fn void hal_gpio_init(uint8_t pin, uint8_t mode)
+ * @brief Configures a pin as a push-pull output or an input.
+ * @param pin One of hal_pins.
+ * @param mode HAL_GPIO_OUTPUT, HAL_GPIO_INPUT or HAL_GPIO_INPUT_PULLUP.
+ * @return None
+ *
+ */
+void hal_gpio_init(uint8_t pin, uint8_t mode);
+
+/**
+ *
+ * @fn void hal_exti_init(uint8_t pin, uint8_t edge, uint8_t priority, uint8_t subpriority)
+ * @brief Interrupts on an input pin's edges.
+ * @param pin One of hal_pins, already set up with hal_gpio_init().
+ * @param edge HAL_EXTI_RISING, HAL_EXTI_FALLING or HAL_EXTI_BOTH.
+ * @param priority NVIC preemption priority.
+ * @param subpriority NVIC sub priority.
+ * @return None
+ *
+ */
+void hal_exti_init(uint8_t pin, uint8_t edge, uint8_t priority, uint8_t subpriority);
+
+/**
+ *
+ * @fn void hal_spi_init(uint8_t spi)
+ * @brief Starts an SPI master with the settings its device needs.
+ * @param spi One of hal_spis.
+ * @return None
+ *
+ */
+void hal_spi_init(uint8_t spi);
+
+/**
+ *
+ * @fn void hal_usart_dma_init(uint8_t usart, uint32_t baud, uint8_t *rx_buffer, uint16_t rx_size, uint8_t priority, uint8_t subpriority)
+ * @brief Starts a USART, 8N1, with circular RX DMA and interrupt driven TX DMA.
+ *
+ * RX bytes land in rx_buffer from the start, wrapping at rx_size, with no
+ * CPU involvement, see hal_usart_dma_rx_head().  The TX complete interrupt is
+ * only enabled by hal_usart_dma_tx_start().
+ *
+ * @param usart One of hal_usarts.
+ * @param baud Bits per second.
+ * @param rx_buffer Circular RX buffer, must be in SRAM.
+ * @param rx_size Size of rx_buffer.
+ * @param priority NVIC preemption priority of the TX complete interrupt.
+ * @param subpriority NVIC sub priority.
+ * @return None
+ *
+ */
+void hal_usart_dma_init(uint8_t usart, uint32_t baud, uint8_t *rx_buffer, uint16_t rx_size, uint8_t priority, uint8_t subpriority);
+
+/**
+ *
+ * @fn void hal_usart_idle_init(uint8_t usart, uint8_t priority, uint8_t subpriority)
+ * @brief Interrupts when the RX line goes idle.
+ *
+ * The idle flag is raised one character time after the last byte received,
+ * see hal_usart_idle_pending().  hal_usart_dma_init() first.
+ *
+ * @param usart One of hal_usarts.
+ * @param priority NVIC preemption priority.
+ * @param subpriority NVIC sub priority.
+ * @return None
+ *
+ */
+void hal_usart_idle_init(uint8_t usart, uint8_t priority, uint8_t subpriority);
+
+/**
+ *
+ * @fn void hal_watchdog_init(uint8_t window, uint8_t count)
+ * @brief Starts the window watchdog.
+ *
+ * It resets when the 7 bit counter drops below 0x40, or when it's refreshed
+ * while still above window.
+ *
+ * @param window Highest count a refresh is allowed at.
+ * @param count Starting count, more than 0x40.
+ * @return None
+ *
+ */
+void hal_watchdog_init(uint8_t window, uint8_t count);
+
+/**
+ *
+ * @fn void hal_cycles_init(void)
+ * @brief Starts the core cycle counter read by hal_cycles().
+ * @param None
+ * @return None
+ *
+ */
+void hal_cycles_init(void);
+
+/**
+ *
+ * @fn void hal_unique_id(uint32_t *words)
+ * @brief Reads the 96 bit device unique ID.
+ * @param *words Filled with HAL_UNIQUE_ID_WORDS words.
+ * @return None
+ *
+ */
+void hal_unique_id(uint32_t *words);
+
+/* ************************************************************* */
+/* * Fast Functions                                            * */
+/* ************************************************************* */
+/* These are static inline on the STM32 and plain functions on the host.
+ *
+ * Timers:
+ *   void hal_timer_set_period(uint8_t timer, uint32_t period)
+ *      New auto-reload value, takes effect straight away (no preload).
+ *   void hal_timer_enable(uint8_t timer)
+ *   void hal_timer_disable(uint8_t timer)
+ *      Stop and restart the counter where it was.
+ *   uint8_t hal_timer_update_pending(uint8_t timer)
+ *   void hal_timer_update_clear(uint8_t timer)
+ *      For the update interrupt handler.
+ *   uint32_t hal_timer_update_cycles(uint8_t timer)
+ *      Core cycles since the last update, from the counter.  How late the
+ *      update interrupt handler is running.
+ *   uint32_t hal_timer_count(uint8_t timer)
+ *   void hal_timer_compare_set(uint8_t timer, uint32_t compare)
+ *      Takes effect straight away, a match already passed waits for the
+ *      counter to come round again.
+ *   void hal_timer_compare_force(uint8_t timer)
+ *      Raises the compare interrupt now, for a compare set too late.
+ *   uint8_t hal_timer_compare_pending(uint8_t timer)
+ *   void hal_timer_compare_clear(uint8_t timer)
+ *      For the compare interrupt handler.
+ *
+ * GPIO and EXTI:
+ *   void hal_gpio_set(uint8_t pin)
+ *   void hal_gpio_clear(uint8_t pin)
+ *   uint8_t hal_gpio_read(uint8_t pin)
+ *      1 if the pin is high.  Outputs read back what they're driving.
+ *   uint8_t hal_exti_pending(uint8_t pin)
+ *   void hal_exti_clear(uint8_t pin)
+ *
+ * SPI, polled, chip select is up to the caller:
+ *   void hal_spi_write(uint8_t spi, uint8_t byte)
+ *      Waits for room and queues a byte, what comes back is dropped.
+ *   uint8_t hal_spi_transfer(uint8_t spi, uint8_t byte)
+ *      Sends a byte and waits for the one clocked in with it.
+ *   void hal_spi_wait_idle(uint8_t spi)
+ *      Waits until the last bit is out, before releasing chip select.
+ *
+ * USART with DMA:
+ *   uint16_t hal_usart_dma_rx_head(uint8_t usart)
+ *      Where the RX DMA will write next, 0 to rx_size - 1.
+ *   void hal_usart_dma_tx_start(uint8_t usart, const uint8_t *data, uint16_t length)
+ *      Sends straight out of data, which has to stay put until the TX
+ *      complete interrupt.
+ *   uint8_t hal_usart_dma_tx_complete(uint8_t usart)
+ *   void hal_usart_dma_tx_stop(uint8_t usart)
+ *      Waits for the last byte to leave the shift register and turns TX
+ *      DMA off.
+ *   void hal_usart_dma_tx_clear(uint8_t usart)
+ *      Clears the TX complete interrupt.
+ *   uint8_t hal_usart_idle_pending(uint8_t usart)
+ *   void hal_usart_idle_clear(uint8_t usart)
+ *      For the idle line interrupt handler.
+ *
+ * Watchdog:
+ *   uint8_t hal_watchdog_count(void)
+ *   void hal_watchdog_refresh(uint8_t count)
+ *
+ * Core:
+ *   void hal_irq_disable(void)
+ *   void hal_irq_enable(void)
+ *   uint32_t hal_irq_save(void)
+ *   void hal_irq_restore(uint32_t key)
+ *      Masks interrupts and puts them back how they were.
+ *   uint32_t hal_atomic_or(volatile uint32_t *word, uint32_t bits)
+ *   uint32_t hal_atomic_take(volatile uint32_t *word)
+ *      Set bits, or read and clear, without masking interrupts.  Both return
+ *      the old value.
+ *   void hal_memory_barrier(void)
+ *   void hal_wait_for_interrupt(void)
+ *      Sleeps until an interrupt is pending, even a masked one.
+ *   uint32_t hal_cycles(void)
+ *      Core clock cycles, stops in sleep.
+ *   uint32_t hal_sleep_cycles(void)
+ *      Core clock cycles from SysTick, keeps counting in sleep.  Only
+ *      differences mean anything.
+ *   uint32_t hal_millis(void)
+ *   void hal_delay_ns(uint32_t ns)
+ *      Busy wait, at least ns.
+ */
+#ifdef HAL_HOST
+#include "hal_host.h"
+#else
+#include "hal_stm32.h"
+#endif
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ * @file hal_host.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief PC side of hal.h, peripherals simulated on a virtual clock.
+ *
+ * Include hal.h with HAL_HOST defined rather than this.  Time only moves when
+ * the firmware waits for it, in hal_wait_for_interrupt(), hal_delay_ns() and
+ * the SPI and USART busy waits, or when the harness calls
+ * hal_host_run_until().  Timer updates, EXTI edges and DMA completions that
+ * come due along the way call the same interrupt handlers the vector table
+ * would, in priority order.  A handler always runs to completion, anything
+ * that comes due while it runs (or while interrupts are masked) is pending
+ * and runs as soon as it returns.  Nothing preempts, unlike the NVIC.  Code
+ * between waits takes no virtual time at all, so this says when things
+ * happen, not how long the CPU spends on them.
+ *
+ * Seconds of firmware time run in milliseconds and come out the same every
+ * run, so timing behaviour can be tested without a board.
+ */
+
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+#include <stdint.h>
+
+/* Virtual core clock, SystemCoreClock is set to this. */
+#define HAL_HOST_CORE_HZ          168000000UL
+
+extern uint32_t SystemCoreClock;
+
+/* ************************************************************* */
+/* * Simulated Interrupts                                      * */
+/* ************************************************************* */
+enum hal_host_irqs
+{
+   HAL_HOST_IRQ_TIM5,
+   HAL_HOST_IRQ_TIM11,
+   HAL_HOST_IRQ_TIM12,
+   HAL_HOST_IRQ_DMA2_STREAM7,
+   HAL_HOST_IRQ_EXTI0,
+   HAL_HOST_IRQ_EXTI1,
+   HAL_HOST_IRQ_EXTI2,
+   HAL_HOST_IRQ_EXTI15_10,
+   HAL_HOST_IRQ_TIM9,
+   HAL_HOST_IRQ_TIM10,
+   HAL_HOST_IRQ_TIM2,
+   HAL_HOST_IRQ_DMA1_STREAM6,
+   HAL_HOST_IRQ_DMA2_STREAM6,
+   HAL_HOST_IRQ_USART2,
+   HAL_HOST_IRQ_USART6,
+   HAL_HOST_NUM_IRQS
+};
+
+/* Called when an output pin changes, ns is the virtual time it changed at. */
+typedef void (*hal_host_pin_watch)(uint8_t pin, uint8_t level, uint64_t ns);
+
+/* The device on an SPI bus, returns the byte it clocks out for mosi. */
+typedef uint8_t (*hal_host_spi_device)(uint8_t spi, uint8_t mosi);
+
+/* Called with each DMA transmission once its last byte is out. */
+typedef void (*hal_host_usart_sink)(uint8_t usart, const uint8_t *data, uint16_t length, uint64_t ns);
+
+/* ************************************************************* */
+/* * Fast Functions                                            * */
+/* ************************************************************* */
+/* See hal.h. */
+void hal_timer_set_period(uint8_t timer, uint32_t period);
+void hal_timer_enable(uint8_t timer);
+void hal_timer_disable(uint8_t timer);
+uint8_t hal_timer_update_pending(uint8_t timer);
+void hal_timer_update_clear(uint8_t timer);
+uint32_t hal_timer_update_cycles(uint8_t timer);
+uint32_t hal_timer_count(uint8_t timer);
+void hal_timer_compare_set(uint8_t timer, uint32_t compare);
+void hal_timer_compare_force(uint8_t timer);
+uint8_t hal_timer_compare_pending(uint8_t timer);
+void hal_timer_compare_clear(uint8_t timer);
+
+void hal_gpio_set(uint8_t pin);
+void hal_gpio_clear(uint8_t pin);
+uint8_t hal_gpio_read(uint8_t pin);
+uint8_t hal_exti_pending(uint8_t pin);
+void hal_exti_clear(uint8_t pin);
+
+void hal_spi_write(uint8_t spi, uint8_t byte);
+uint8_t hal_spi_transfer(uint8_t spi, uint8_t byte);
+void hal_spi_wait_idle(uint8_t spi);
+
+uint16_t hal_usart_dma_rx_head(uint8_t usart);
+void hal_usart_dma_tx_start(uint8_t usart, const uint8_t *data, uint16_t length);
+uint8_t hal_usart_dma_tx_complete(uint8_t usart);
+void hal_usart_dma_tx_stop(uint8_t usart);
+void hal_usart_dma_tx_clear(uint8_t usart);
+uint8_t hal_usart_idle_pending(uint8_t usart);
+void hal_usart_idle_clear(uint8_t usart);
+
+uint8_t hal_watchdog_count(void);
+void hal_watchdog_refresh(uint8_t count);
+
+void hal_irq_disable(void);
+void hal_irq_enable(void);
+uint32_t hal_irq_save(void);
+void hal_irq_restore(uint32_t key);
+uint32_t hal_atomic_or(volatile uint32_t *word, uint32_t bits);
+uint32_t hal_atomic_take(volatile uint32_t *word);
+void hal_memory_barrier(void);
+void hal_wait_for_interrupt(void);
+uint32_t hal_cycles(void);
+uint32_t hal_sleep_cycles(void);
+uint32_t hal_millis(void);
+void hal_delay_ns(uint32_t ns);
+
+/* ************************************************************* */
+/* * Simulation Control                                        * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void hal_host_reset(void)
+ * @brief Back to time zero with every peripheral off and no callbacks.
+ * @param None
+ * @return None
+ *
+ */
+void hal_host_reset(void);
+
+/**
+ *
+ * @fn uint64_t hal_host_now_ns(void)
+ * @brief Virtual time since hal_host_reset().
+ * @param None
+ * @return uint64_t Nanoseconds.
+ *
+ */
+uint64_t hal_host_now_ns(void);
+
+/**
+ *
+ * @fn void hal_host_run_until(uint64_t ns)
+ * @brief Moves virtual time forward, running interrupts as they come due.
+ *
+ * For driving interrupt handlers without a main loop.  Does nothing if ns has
+ * already passed.
+ *
+ * @param ns Virtual time to stop at.
+ * @return None
+ *
+ */
+void hal_host_run_until(uint64_t ns);
+
+/**
+ *
+ * @fn void hal_host_gpio_input(uint8_t pin, uint8_t level)
+ * @brief Drives an input pin from outside, firing its EXTI on a matching edge.
+ * @param pin One of hal_pins.
+ * @param level 0 or 1.
+ * @return None
+ *
+ */
+void hal_host_gpio_input(uint8_t pin, uint8_t level);
+
+/**
+ *
+ * @fn uint16_t hal_host_usart_rx(uint8_t usart, const uint8_t *data, uint16_t length)
+ * @brief Bytes arriving on a USART, written by the simulated RX DMA.
+ *
+ * They land straight away, as if the last of them just finished arriving,
+ * and the idle line flag follows one character time later.  Like the real
+ * DMA, nothing stops it lapping the firmware if it doesn't keep up.
+ *
+ * @param usart One of hal_usarts.
+ * @param data Bytes received.
+ * @param length Number of bytes.
+ * @return uint16_t Bytes written, 0 if the USART isn't running.
+ *
+ */
+uint16_t hal_host_usart_rx(uint8_t usart, const uint8_t *data, uint16_t length);
+
+/**
+ *
+ * @fn void hal_host_set_pin_watch(hal_host_pin_watch watch)
+ * @brief Sets the function called on output pin changes, NULL for none.
+ * @param watch Callback.
+ * @return None
+ *
+ */
+void hal_host_set_pin_watch(hal_host_pin_watch watch);
+
+/**
+ *
+ * @fn void hal_host_set_spi_device(hal_host_spi_device device)
+ * @brief Sets what answers on the SPI buses, NULL reads back 0xFF.
+ * @param device Callback.
+ * @return None
+ *
+ */
+void hal_host_set_spi_device(hal_host_spi_device device);
+
+/**
+ *
+ * @fn void hal_host_set_usart_sink(hal_host_usart_sink sink)
+ * @brief Sets where transmitted data goes, NULL to drop it.
+ * @param sink Callback.
+ * @return None
+ *
+ */
+void hal_host_set_usart_sink(hal_host_usart_sink sink);
+
+/**
+ *
+ * @fn void hal_host_set_unique_id(const uint32_t *words)
+ * @brief Sets what hal_unique_id() reads, all 0 after hal_host_reset().
+ * @param *words HAL_UNIQUE_ID_WORDS words.
+ * @return None
+ *
+ */
+void hal_host_set_unique_id(const uint32_t *words);
+
+/**
+ *
+ * @fn uint32_t hal_host_irq_count(uint8_t irq)
+ * @brief Times an interrupt handler has run since hal_host_reset().
+ * @param irq One of hal_host_irqs.
+ * @return uint32_t Count.
+ *
+ */
+uint32_t hal_host_irq_count(uint8_t irq);
+
+/**
+ *
+ * @fn uint32_t hal_host_watchdog_resets(void)
+ * @brief Times the watchdog would have reset the board.
+ *
+ * The simulation carries on after a watchdog reset with the counter reloaded,
+ * so one run can count them all.
+ *
+ * @param None
+ * @return uint32_t Count.
+ *
+ */
+uint32_t hal_host_watchdog_resets(void);
+
+#endif
@@ -0,0 +1,381 @@
+/**
+ * @file hal_stm32.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief STM32F4 side of hal.h, the parts that sit on interrupt paths.
+ *
+ * Include hal.h rather than this.  The tables are static const so a call
+ * with a constant id folds down to the same register access as writing
+ * StdPeriph directly.
+ */
+
+#ifndef HAL_STM32_H
+#define HAL_STM32_H
+
+#include <stdint.h>
+#include "stm32f4xx_conf.h"
+
+#include "systick.h"
+
+/* Reference manual section 39.1, the 96 bit unique device ID. */
+#define HAL_STM32_UNIQUE_ID_BASE  0x1FFF7A10
+
+typedef struct {
+   GPIO_TypeDef *port;
+   uint16_t pin;                 /* GPIO_Pin_n, also EXTI_Line_n. */
+} hal_stm32_pin_t;
+
+typedef struct {
+   USART_TypeDef *usart;
+   DMA_Stream_TypeDef *rx_stream;
+   DMA_Stream_TypeDef *tx_stream;
+   uint32_t tx_it_tc;            /* DMA_IT_TCIFn of the TX stream. */
+   uint32_t tx_flag_tc;          /* DMA_FLAG_TCIFn of the TX stream. */
+} hal_stm32_usart_t;
+
+static TIM_TypeDef * const hal_stm32_timers[HAL_NUM_TIMERS] =
+{
+   TIM5,
+   TIM11,
+   TIM12,
+   TIM9,
+   TIM10,
+   TIM2
+};
+
+/* Core cycles per timer clock, 2 on APB1 and 1 on APB2. */
+static const uint8_t hal_stm32_timer_clk_div[HAL_NUM_TIMERS] =
+{
+   2,
+   1,
+   2,
+   1,
+   1,
+   2
+};
+
+static const hal_stm32_pin_t hal_stm32_pins[HAL_NUM_PINS] =
+{
+   {GPIOD, GPIO_Pin_12},
+   {GPIOD, GPIO_Pin_13},
+   {GPIOD, GPIO_Pin_14},
+   {GPIOD, GPIO_Pin_15},
+   {GPIOA, GPIO_Pin_0},
+   {GPIOA, GPIO_Pin_1},
+   {GPIOA, GPIO_Pin_2},
+   {GPIOC, GPIO_Pin_13},
+   {GPIOC, GPIO_Pin_2},
+#ifdef TOS_100_DEV_BOARD
+   {GPIOC, GPIO_Pin_1},
+#else
+   {GPIOC, GPIO_Pin_0},
+#endif
+   {GPIOB, GPIO_Pin_12},
+   {GPIOD, GPIO_Pin_7},
+   {GPIOC, GPIO_Pin_8}
+};
+
+static SPI_TypeDef * const hal_stm32_spis[HAL_NUM_SPIS] =
+{
+   SPI1
+};
+
+static const hal_stm32_usart_t hal_stm32_usarts[HAL_NUM_USARTS] =
+{
+   {USART1, DMA2_Stream5, DMA2_Stream7, DMA_IT_TCIF7, DMA_FLAG_TCIF7},
+   {USART2, DMA1_Stream5, DMA1_Stream6, DMA_IT_TCIF6, DMA_FLAG_TCIF6},
+   {USART6, DMA2_Stream1, DMA2_Stream6, DMA_IT_TCIF6, DMA_FLAG_TCIF6}
+};
+
+/* From hal_usart_dma_init(), in hal_stm32.c. */
+extern uint16_t hal_stm32_usart_rx_size[HAL_NUM_USARTS];
+
+/* SysTick counts, in systick.c. */
+extern volatile uint32_t ms_counter;
+
+/* ************************************************************* */
+/* * Timers                                                    * */
+/* ************************************************************* */
+static inline void hal_timer_set_period(uint8_t timer, uint32_t period)
+{
+   TIM_SetAutoreload(hal_stm32_timers[timer], period);
+}
+
+static inline void hal_timer_enable(uint8_t timer)
+{
+   TIM_Cmd(hal_stm32_timers[timer], ENABLE);
+}
+
+static inline void hal_timer_disable(uint8_t timer)
+{
+   TIM_Cmd(hal_stm32_timers[timer], DISABLE);
+}
+
+static inline uint8_t hal_timer_update_pending(uint8_t timer)
+{
+   return (TIM_GetITStatus(hal_stm32_timers[timer], TIM_IT_Update) != RESET);
+}
+
+static inline void hal_timer_update_clear(uint8_t timer)
+{
+   TIM_ClearITPendingBit(hal_stm32_timers[timer], TIM_IT_Update);
+}
+
+static inline uint32_t hal_timer_update_cycles(uint8_t timer)
+{
+   TIM_TypeDef *tim = hal_stm32_timers[timer];
+
+   return tim->CNT * (tim->PSC + 1) * hal_stm32_timer_clk_div[timer];
+}
+
+static inline uint32_t hal_timer_count(uint8_t timer)
+{
+   return hal_stm32_timers[timer]->CNT;
+}
+
+static inline void hal_timer_compare_set(uint8_t timer, uint32_t compare)
+{
+   TIM_SetCompare1(hal_stm32_timers[timer], compare);
+}
+
+static inline void hal_timer_compare_force(uint8_t timer)
+{
+   TIM_GenerateEvent(hal_stm32_timers[timer], TIM_EventSource_CC1);
+}
+
+static inline uint8_t hal_timer_compare_pending(uint8_t timer)
+{
+   return (TIM_GetITStatus(hal_stm32_timers[timer], TIM_IT_CC1) != RESET);
+}
+
+static inline void hal_timer_compare_clear(uint8_t timer)
+{
+   TIM_ClearITPendingBit(hal_stm32_timers[timer], TIM_IT_CC1);
+}
+
+/* ************************************************************* */
+/* * GPIO and EXTI                                             * */
+/* ************************************************************* */
+static inline void hal_gpio_set(uint8_t pin)
+{
+   GPIO_SetBits(hal_stm32_pins[pin].port, hal_stm32_pins[pin].pin);
+}
+
+static inline void hal_gpio_clear(uint8_t pin)
+{
+   GPIO_ResetBits(hal_stm32_pins[pin].port, hal_stm32_pins[pin].pin);
+}
+
+static inline uint8_t hal_gpio_read(uint8_t pin)
+{
+   return (GPIO_ReadInputDataBit(hal_stm32_pins[pin].port, hal_stm32_pins[pin].pin) == Bit_SET);
+}
+
+static inline uint8_t hal_exti_pending(uint8_t pin)
+{
+   return (EXTI_GetITStatus(hal_stm32_pins[pin].pin) != RESET);
+}
+
+static inline void hal_exti_clear(uint8_t pin)
+{
+   EXTI_ClearITPendingBit(hal_stm32_pins[pin].pin);
+}
+
+/* ************************************************************* */
+/* * SPI                                                       * */
+/* ************************************************************* */
+static inline void hal_spi_write(uint8_t spi, uint8_t byte)
+{
+   while(SPI_I2S_GetFlagStatus(hal_stm32_spis[spi], SPI_FLAG_TXE) == RESET);
+   SPI_I2S_SendData(hal_stm32_spis[spi], (uint16_t)byte);
+}
+
+static inline uint8_t hal_spi_transfer(uint8_t spi, uint8_t byte)
+{
+   while(SPI_I2S_GetFlagStatus(hal_stm32_spis[spi], SPI_FLAG_TXE) == RESET);
+   SPI_I2S_SendData(hal_stm32_spis[spi], (uint16_t)byte);
+   while(SPI_I2S_GetFlagStatus(hal_stm32_spis[spi], SPI_FLAG_RXNE) == RESET);
+   while(SPI_I2S_GetFlagStatus(hal_stm32_spis[spi], SPI_FLAG_BSY) == SET);
+
+   return (uint8_t)(SPI_I2S_ReceiveData(hal_stm32_spis[spi]) & 0xFF);
+}
+
+static inline void hal_spi_wait_idle(uint8_t spi)
+{
+   while(SPI_I2S_GetFlagStatus(hal_stm32_spis[spi], SPI_FLAG_BSY) == SET);
+}
+
+/* ************************************************************* */
+/* * USART with DMA                                            * */
+/* ************************************************************* */
+static inline uint16_t hal_usart_dma_rx_head(uint8_t usart)
+{
+   /* NDTR counts down from the buffer size and reloads when it wraps. */
+   return (uint16_t)(hal_stm32_usart_rx_size[usart] - hal_stm32_usarts[usart].rx_stream->NDTR);
+}
+
+static inline void hal_usart_dma_tx_start(uint8_t usart, const uint8_t *data, uint16_t length)
+{
+   const hal_stm32_usart_t *u = &(hal_stm32_usarts[usart]);
+
+   DMA_Cmd(u->tx_stream, DISABLE);
+   USART_DMACmd(u->usart, USART_DMAReq_Tx, DISABLE);
+
+   DMA_ClearFlag(u->tx_stream, u->tx_flag_tc);
+   USART_ClearFlag(u->usart, USART_FLAG_TC);
+
+   u->tx_stream->NDTR = length;
+   u->tx_stream->M0AR = (uint32_t)data;
+
+   DMA_ITConfig(u->tx_stream, DMA_IT_TC, ENABLE);
+
+   USART_DMACmd(u->usart, USART_DMAReq_Tx, ENABLE);
+   DMA_Cmd(u->tx_stream, ENABLE);
+}
+
+static inline uint8_t hal_usart_dma_tx_complete(uint8_t usart)
+{
+   return (DMA_GetITStatus(hal_stm32_usarts[usart].tx_stream, hal_stm32_usarts[usart].tx_it_tc) != RESET);
+}
+
+static inline void hal_usart_dma_tx_stop(uint8_t usart)
+{
+   const hal_stm32_usart_t *u = &(hal_stm32_usarts[usart]);
+
+   while(DMA_GetFlagStatus(u->tx_stream, u->tx_flag_tc) == RESET);
+   /* DMA is done but the last byte can still be in the shift register. */
+   while(USART_GetFlagStatus(u->usart, USART_FLAG_TC) == RESET);
+
+   DMA_Cmd(u->tx_stream, DISABLE);
+   USART_DMACmd(u->usart, USART_DMAReq_Tx, DISABLE);
+}
+
+static inline void hal_usart_dma_tx_clear(uint8_t usart)
+{
+   DMA_ClearITPendingBit(hal_stm32_usarts[usart].tx_stream, hal_stm32_usarts[usart].tx_it_tc);
+}
+
+static inline uint8_t hal_usart_idle_pending(uint8_t usart)
+{
+   return (USART_GetITStatus(hal_stm32_usarts[usart].usart, USART_IT_IDLE) != RESET);
+}
+
+static inline void hal_usart_idle_clear(uint8_t usart)
+{
+   /* Cleared by reading SR then DR.  The DMA already took the data. */
+   USART_ReceiveData(hal_stm32_usarts[usart].usart);
+}
+
+/* ************************************************************* */
+/* * Watchdog                                                  * */
+/* ************************************************************* */
+static inline uint8_t hal_watchdog_count(void)
+{
+   return (uint8_t)(WWDG->CR & 0x7F);
+}
+
+static inline void hal_watchdog_refresh(uint8_t count)
+{
+   WWDG_SetCounter(count);
+}
+
+/* ************************************************************* */
+/* * Core                                                      * */
+/* ************************************************************* */
+static inline void hal_irq_disable(void)
+{
+   __disable_irq();
+}
+
+static inline void hal_irq_enable(void)
+{
+   __enable_irq();
+}
+
+static inline uint32_t hal_irq_save(void)
+{
+   uint32_t primask;
+
+   primask = __get_PRIMASK();
+   __disable_irq();
+
+   return primask;
+}
+
+static inline void hal_irq_restore(uint32_t key)
+{
+   __set_PRIMASK(key);
+}
+
+static inline uint32_t hal_atomic_or(volatile uint32_t *word, uint32_t bits)
+{
+   uint32_t old;
+
+   /* Exclusive access retries if anything else wrote in between. */
+   do{
+      old = __LDREXW(word);
+   }while(__STREXW(old | bits, word) != 0);
+
+   return old;
+}
+
+static inline uint32_t hal_atomic_take(volatile uint32_t *word)
+{
+   uint32_t old;
+
+   do{
+      old = __LDREXW(word);
+   }while(__STREXW(0, word) != 0);
+
+   return old;
+}
+
+static inline void hal_memory_barrier(void)
+{
+   __DSB();
+}
+
+static inline void hal_wait_for_interrupt(void)
+{
+   __DSB();
+   __WFI();
+}
+
+static inline uint32_t hal_cycles(void)
+{
+   return DWT->CYCCNT;
+}
+
+static inline uint32_t hal_sleep_cycles(void)
+{
+   uint32_t ms;
+   uint32_t val;
+   uint32_t load;
+
+   /* Called with interrupts masked around WFI, so a SysTick wrap may not be
+    * in ms_counter yet.  A pending SysTick with a freshly reloaded counter
+    * means it wrapped.
+    */
+   load = SysTick->LOAD;
+   ms = ms_counter;
+   val = SysTick->VAL;
+
+   if((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)&&(val > (load / 2)))
+   {
+      ms++;
+   }
+
+   return (ms * (load + 1)) + (load - val);
+}
+
+static inline uint32_t hal_millis(void)
+{
+   return ms_counter;
+}
+
+static inline void hal_delay_ns(uint32_t ns)
+{
+   systick_delay_ns(ns);
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef HARDWARE_TB6612_H
 #define HARDWARE_TB6612_H
 
+#include <stdint.h>
+
 typedef enum {TB6612_CW, TB6612_CCW, TB6612_SHORT_BRAKE, TB6612_STOP} TB6612_driver_states;
 typedef enum {TB6612_MOTOR_A, TB6612_MOTOR_B} TB6612_motor_select;
 
@@ -13,12 +15,41 @@ typedef enum {TB6612_MOTOR_A, TB6612_MOTOR_B} TB6612_motor_select;
 #define TB6612_PWM_PIN    GPIO_Pin_1
 #define TB6612_ENABLE_PIN GPIO_Pin_2
 
+/* TIM1 counts up and down (center-aligned), so both edges of the pulse move
+ * symmetrically about the middle of the period and one period is two counts
+ * of TB6612_PWM_PERIOD.  CCR1 and ARR are preloaded: a new duty takes effect
+ * at the next update (once a period, the repetition counter skips the one in
+ * the middle), never part way through a pulse.
+ *
+ * Duty is Q15, -32768 full CCW to 32767 full CW, the same as
+ * motor_control_run_q()'s output.  Turning it into a compare value is a
+ * multiply and a shift, TB6612_duty_q15_to_ccr().
+ *
+ * With TB6612_enable_duty_dma() the compare value goes to a word in RAM
+ * instead and DMA2 Stream3 (TIM1_CH1 request) copies it into CCR1 every
+ * period.  The control loop's store is then a plain RAM write and TIM1 is
+ * only ever written by the DMA.
+ */
+#define TB6612_PWM_HZ        24000
+#define TB6612_PWM_PERIOD    (SystemCoreClock / (2 * TB6612_PWM_HZ))
+#define TB6612_DUTY_Q15_MAX  32767
+
 void TB6612_initialize(void);
 void TB6612_init_gpio(void);
 void TB6612_set_duty(float duty);
+void TB6612_set_duty_q15(int16_t duty);
+void TB6612_enable_duty_dma(void);
 void TB6612_brake(void);
 void TB6612_enable(void);
 void TB6612_disable(void);
 void TB6612_init_complimentary_pwm(void);
 
+/* -32768 is 0 and 32767 is period, with no float and no rounding error
+ * bigger than one count.
+ */
+static inline uint32_t TB6612_duty_q15_to_ccr(int16_t duty, uint32_t period)
+{
+   return ((uint32_t)((int32_t)duty + 32768) * (period + 1)) >> 16;
+}
+
 #endif
@@ -0,0 +1,102 @@
+/**
+ * @file lepton_compress.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the lossless Lepton VoSPI line codec.
+ *
+ */
+
+#ifndef LEPTON_COMPRESS_H
+#define LEPTON_COMPRESS_H
+
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * VoSPI Line Layout                                         * */
+/* ************************************************************* */
+#define LEPTON_LINE_BYTES         164
+#define LEPTON_LINE_HEADER_BYTES  4
+#define LEPTON_LINE_PIXELS        80
+
+/* ************************************************************* */
+/* * Compressed Line Layout                                    * */
+/* ************************************************************* */
+/* Bytes 0-3 are the untouched VoSPI ID and CRC words, byte 4 is the
+ * predictor (upper nibble) and Rice parameter (lower nibble), followed by
+ * the MSB first Rice coded residual bitstream. */
+#define LEPTON_COMPRESS_LOC_MODE      4
+#define LEPTON_COMPRESS_HEADER_BYTES  5
+
+/* Worst case is every pixel escaping to a raw 16 bit residual. */
+#define LEPTON_COMPRESS_MAX_BYTES     (LEPTON_COMPRESS_HEADER_BYTES + \
+                                       ((LEPTON_LINE_PIXELS*(LEPTON_COMPRESS_RICE_QMAX+16))+7)/8)
+
+/* Quotients at or above this are sent as QMAX zeros and 16 raw bits. */
+#define LEPTON_COMPRESS_RICE_QMAX     15
+#define LEPTON_COMPRESS_RICE_KMAX     15
+
+/* ************************************************************* */
+/* * Predictors                                                * */
+/* ************************************************************* */
+enum lepton_compress_predictors
+{
+   LEPTON_PRED_LEFT,
+   LEPTON_PRED_UP,
+   LEPTON_PRED_AVG,
+   LEPTON_PRED_MED,
+   LEPTON_PRED_COUNT
+};
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define LEPTON_COMPRESS_SUCCESS           0x00
+#define LEPTON_COMPRESS_ERROR_OVERFLOW    0x01
+#define LEPTON_COMPRESS_ERROR_NO_GAIN     0x02
+#define LEPTON_COMPRESS_ERROR_NO_PREV     0x03
+#define LEPTON_COMPRESS_ERROR_TRUNCATED   0x04
+#define LEPTON_COMPRESS_ERROR_MODE        0x05
+
+/* ************************************************************* */
+/* * Codec Functions                                           * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t lepton_compress_line(const uint8_t *line, const uint8_t *prev, uint8_t *out, uint16_t out_max, uint16_t *out_len)
+ * @brief Losslessly compresses one 164 byte VoSPI line.
+ * @param *line The raw VoSPI line (ID, CRC and 80 big endian pixels).
+ * @param *prev The previous line of the same image or NULL for the first line.
+ * @param *out Buffer the compressed line is written into.
+ * @param out_max Size of out in bytes.
+ * @param *out_len Number of bytes written to out.
+ * @return uint8_t Lepton compress return code.
+ *
+ * Each pixel is predicted from its left, upper, averaged or median (LOCO-I)
+ * neighbour, whichever gives the smallest residual sum over the line, and the
+ * residuals are Rice coded with a single parameter picked for the line.  The
+ * arithmetic is modulo 2^16 so any pixel format round trips.  If the result
+ * would not be smaller than the raw line LEPTON_COMPRESS_ERROR_NO_GAIN is
+ * returned and the caller should send the raw line instead.
+ *
+ * This file has no target dependencies and is also the host side decoder
+ * library (see the lepton_compress_host target in the Makefile).
+ *
+ */
+uint8_t lepton_compress_line(const uint8_t *line, const uint8_t *prev, uint8_t *out, uint16_t out_max, uint16_t *out_len);
+
+/**
+ *
+ * @fn uint8_t lepton_decompress_line(const uint8_t *in, uint16_t in_len, const uint8_t *prev, uint8_t *line)
+ * @brief Restores a raw VoSPI line from lepton_compress_line() output.
+ * @param *in The compressed line.
+ * @param in_len Number of bytes in in.
+ * @param *prev The previously decoded line of the same image or NULL.
+ * @param *line Output buffer of LEPTON_LINE_BYTES bytes.
+ * @return uint8_t Lepton compress return code.
+ *
+ */
+uint8_t lepton_decompress_line(const uint8_t *in, uint16_t in_len, const uint8_t *prev, uint8_t *line);
+
+#endif
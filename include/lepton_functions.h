@@ -4,6 +4,7 @@
 #include "generic_packet.h"
 #include "gp_proj_universal.h"
 #include "gp_proj_thermal.h"
+#include "gp_proj_local.h"
 
 /* SPI - Software Chip Select - Active Low - B2 */
 #define SPI_PIN_CS_AL    GPIO_Pin_2
@@ -0,0 +1,59 @@
+/**
+ * @file memory_sections.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Attributes that move code and data out of the default sections.
+ *
+ */
+
+#ifndef MEMORY_SECTIONS_H
+#define MEMORY_SECTIONS_H
+
+/* ************************************************************* */
+/* * Code in RAM                                               * */
+/* ************************************************************* */
+/* Flash runs with wait states behind the ART accelerator, so a handler that
+ * misses its cache pays for it on every miss.  RAMFUNC code is copied to SRAM
+ * with .data at reset and always runs at zero wait states.  Calls between RAM
+ * and flash are too far for a BL, the linker adds veneers for them.  Keep it
+ * to short hot paths, every byte costs SRAM as well as flash.
+ *
+ * Library code that can't be annotated is moved by object file in
+ * STM32F417IG_FLASH.ld instead.
+ */
+#ifdef HAL_HOST
+#define RAMFUNC
+#else
+#define RAMFUNC         __attribute__((section(".ramfunc"), noinline))
+#endif
+
+/* ************************************************************* */
+/* * Data in CCM                                               * */
+/* ************************************************************* */
+/* The 64KB CCM is on the D-bus only.  The CPU reads it at zero wait states
+ * without competing with DMA for SRAM, but DMA can't reach it at all.
+ * CCM_BSS is for buffers only the CPU touches, zeroed at reset like .bss.
+ * Anything a DMA stream reads or writes has to stay in SRAM.  CCM can't hold
+ * code either.
+ */
+#ifdef HAL_HOST
+#define CCM_BSS
+#else
+#define CCM_BSS         __attribute__((section(".ccmbss")))
+#endif
+
+/* ************************************************************* */
+/* * Data kept over a reset                                    * */
+/* ************************************************************* */
+/* NOINIT data is in SRAM the startup code neither loads nor clears, so it
+ * holds what was written before a watchdog or software reset.  After power
+ * up it's garbage, anything kept there needs a magic number or a checksum
+ * to tell.  Stays in SRAM, CCM isn't guaranteed over every reset source.
+ */
+#ifdef HAL_HOST
+#define NOINIT
+#else
+#define NOINIT          __attribute__((section(".noinit")))
+#endif
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file motor_autotune.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for relay feedback PID tuning.
+ *
+ */
+
+#ifndef MOTOR_AUTOTUNE_H
+#define MOTOR_AUTOTUNE_H
+
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Relay Experiment                                          * */
+/* ************************************************************* */
+/* Astrom and Hagglund's relay test.  Instead of the controller the drive is
+ * a relay, +relay while the position is below the setpoint and -relay above
+ * it, with hysteresis so encoder noise can't chatter it.  The axis settles
+ * into a limit cycle at the frequency where the loop's phase is -180
+ * degrees, which is what Ziegler and Nichols' ultimate gain experiment finds
+ * without ever running the loop on the edge of stability.
+ *
+ * Once the first MOTOR_AUTOTUNE_SETTLE_CYCLES cycles have let it settle the
+ * next MOTOR_AUTOTUNE_CYCLES are measured, period between rising crossings
+ * and peak to peak amplitude.  Then, with a the half amplitude and e the
+ * hysteresis,
+ *
+ *    Ku = 4 * relay / (pi * sqrt(a^2 - e^2))
+ *    Pu = mean period
+ *
+ * It fails if the position goes further than limit from the setpoint (the
+ * relay is pushing the wrong way or something is jammed), if a half cycle
+ * takes more than MOTOR_AUTOTUNE_TIMEOUT_S, or if the periods disagree by
+ * more than a quarter.
+ */
+#define MOTOR_AUTOTUNE_SETTLE_CYCLES   2
+#define MOTOR_AUTOTUNE_CYCLES          4
+#define MOTOR_AUTOTUNE_TIMEOUT_S       2.0f
+
+enum motor_autotune_states
+{
+   MOTOR_AUTOTUNE_IDLE,
+   MOTOR_AUTOTUNE_RUNNING,
+   MOTOR_AUTOTUNE_DONE,
+   MOTOR_AUTOTUNE_FAILED
+};
+
+/* Rules from Ku and Pu to gains, most aggressive first.
+ *
+ *    ZIEGLER_NICHOLS   Kp = 0.6 Ku,   Ti = Pu / 2,   Td = Pu / 8
+ *    SOME_OVERSHOOT    Kp = 0.33 Ku,  Ti = 0.8 Pu,   Td = Pu / 3
+ *    NO_OVERSHOOT      Kp = 0.2 Ku,   Ti = 1.5 Pu,   Td = Pu / 3
+ *    TYREUS_LUYBEN     Kp = 0.45 Ku,  Ti = 2.2 Pu,   Td = Pu / 6.3
+ *
+ * The textbook SOME_OVERSHOOT and NO_OVERSHOOT keep Ti = Pu / 2, which on a
+ * position loop (the motor integrates) overshoots more than ZIEGLER_NICHOLS
+ * at their lower Kp.  Ti is stretched here until they do what they say on
+ * motor_control_sim's tilt motor, about 5% and under 1%.
+ */
+enum motor_autotune_rules
+{
+   MOTOR_AUTOTUNE_ZIEGLER_NICHOLS,
+   MOTOR_AUTOTUNE_SOME_OVERSHOOT,
+   MOTOR_AUTOTUNE_NO_OVERSHOOT,
+   MOTOR_AUTOTUNE_TYREUS_LUYBEN
+};
+
+typedef struct {
+   /* Set by motor_autotune_start(). */
+   float setpoint;
+   float relay;
+   float hysteresis;
+   float limit;
+   float dt;
+
+   /* Experiment. */
+   uint8_t state;
+   float out;
+   uint32_t ticks;          /* Since the start. */
+   uint32_t switch_ticks;   /* At the last relay switch. */
+   uint32_t rise_ticks;     /* At the last rising crossing. */
+   uint8_t cycles;          /* Rising crossings so far. */
+   float high;              /* Furthest each way this cycle. */
+   float low;
+   float period_sum;
+   float period_min;
+   float period_max;
+   float amplitude_sum;
+
+   /* Results, once DONE. */
+   float ku;
+   float pu;
+} motor_autotune_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define MOTOR_AUTOTUNE_SUCCESS           0x00
+#define MOTOR_AUTOTUNE_ERROR_PARAMETER   0x01
+#define MOTOR_AUTOTUNE_ERROR_NOT_DONE    0x02
+
+/* ************************************************************* */
+/* * Autotune Functions                                        * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t motor_autotune_start(motor_autotune_t *mat, float setpoint, float relay, float hysteresis, float limit, float dt)
+ * @brief Sets up a relay experiment, the next motor_autotune_run() starts it.
+ * @param mat Experiment.
+ * @param setpoint Position to oscillate around.
+ * @param relay Drive either way, more than 0 and at most 1.
+ * @param hysteresis Position band around the setpoint the relay holds in,
+ * a few counts' worth.
+ * @param limit Furthest from the setpoint that's allowed, more than
+ * hysteresis.
+ * @param dt Seconds between motor_autotune_run() calls.
+ * @return uint8_t Motor autotune return code.
+ *
+ */
+uint8_t motor_autotune_start(motor_autotune_t *mat, float setpoint, float relay, float hysteresis, float limit, float dt);
+
+/**
+ *
+ * @fn float motor_autotune_run(motor_autotune_t *mat, float msr)
+ * @brief One sample of the experiment.
+ *
+ * Call at dt in place of the controller while mat->state is
+ * MOTOR_AUTOTUNE_RUNNING.  Once it's DONE or FAILED the drive is 0.
+ *
+ * @param mat Experiment.
+ * @param msr Position.
+ * @return float Drive, +/- relay or 0.
+ *
+ */
+float motor_autotune_run(motor_autotune_t *mat, float msr);
+
+/**
+ *
+ * @fn uint8_t motor_autotune_gains(const motor_autotune_t *mat, uint8_t rule, float *p, float *i, float *d)
+ * @brief Gains for motor_control_set_pid_gains() from a finished experiment.
+ *
+ * motor_control_run_pid() scales everything by p, so p is Kp, i is dt / Ti
+ * (it's per sample) and d is Td.
+ *
+ * @param mat Experiment, DONE.
+ * @param rule One of motor_autotune_rules.
+ * @param p Proportional.
+ * @param i Integral, per sample.
+ * @param d Derivative, seconds.
+ * @return uint8_t Motor autotune return code.
+ *
+ */
+uint8_t motor_autotune_gains(const motor_autotune_t *mat, uint8_t rule, float *p, float *i, float *d);
+
+#endif
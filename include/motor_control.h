@@ -1,8 +1,42 @@
+/**
+ * @file motor_control.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the motor position controllers.
+ *
+ */
+
 #ifndef MOTOR_CONTROL_H
 #define MOTOR_CONTROL_H
 
 #include <stdint.h>
 
+/* ************************************************************* */
+/* * Floating Point PID                                        * */
+/* ************************************************************* */
+/* Every bit of state lives in the struct, so any number of controllers can
+ * run from any number of contexts as long as each struct has one owner.
+ *
+ *    err  = p * (cmd - msr)
+ *    derr = average of d * (err - last err) / dt, clamped to the d limits
+ *    ierr = ierr + i * err, clamped to the i limits
+ *    out  = err + ierr + derr + kv * ff_vel + ka * ff_acc
+ *
+ * and out is clamped to the p limits.  The derivative is averaged over about
+ * MOVING_DERIVATIVE_AVG_PTS samples.
+ *
+ * Anti-windup is by back-calculation as well as the integrator clamp: what
+ * the output clamp cut off, times aw, is taken back out of the integrator
+ * each sample, so it stops winding as soon as the output saturates instead of
+ * running to its own limit.  0 leaves just the clamp.
+ *
+ * ff_vel and ff_acc are the velocity and acceleration the command is moving
+ * at, set by whoever sets cmd.  With kv and ka right the loop only has to
+ * correct the error, not produce the whole drive.
+ *
+ * dt is only divided by when the gains or the period change, call
+ * motor_control_set_period() rather than writing it.
+ */
 #define MOVING_DERIVATIVE_AVG_PTS 25.0f
 
 typedef struct {
@@ -18,19 +52,222 @@ typedef struct {
    float p;
    float i;
    float d;
+   float aw;                /* Back-calculation gain, 0 to 1. */
+   float kv;                /* Output per unit of ff_vel. */
+   float ka;                /* Output per unit of ff_acc. */
    motor_control_pid_limits_t pid_limits;
    float cmd;
    float msr;
+   float ff_vel;
+   float ff_acc;
    float dt;
+   float d_dt;              /* d / dt. */
    float err;
    float ierr;
    float derr;
    float out;
 } motor_control_pid_t;
 
+/* ************************************************************* */
+/* * Fixed Point PID                                           * */
+/* ************************************************************* */
+/* The same controller on integers, for loops that run in counts and can't
+ * afford the FPU context in their interrupt.  The gains are Q16.16 and
+ * already per sample (ki includes dt, kd divides by it), so a sample is
+ * multiplies, shifts and saturating adds.  On the M4 the adds are QADD/QSUB
+ * and the output is clamped with SSAT, elsewhere plain C does the same.
+ *
+ *    e    = cmd - msr
+ *    derr = derr + ((kd * (e - last e)) - derr) / 2^d_shift, clamped to
+ *           +/- d_limit
+ *    ierr = ierr + ki * e, clamped to +/- i_limit
+ *    u    = kp * e + ierr + derr + kv * ff_vel + ka * ff_acc
+ *    out  = u saturated to Q15 (+/- 1.0 of full drive)
+ *    ierr = ierr + kaw * (out - u)
+ *
+ * Everything saturates rather than wraps.
+ */
+#define MOTOR_CONTROL_Q_SHIFT      16
+#define MOTOR_CONTROL_Q(x)         ((int32_t)((x) * (float)(1 << MOTOR_CONTROL_Q_SHIFT)))
+#define MOTOR_CONTROL_Q_OUT_BITS   16
+#define MOTOR_CONTROL_Q_OUT_MAX    ((1 << (MOTOR_CONTROL_Q_OUT_BITS - 1)) - 1)
+
+typedef struct {
+   int32_t kp;              /* Q16.16 */
+   int32_t ki;
+   int32_t kd;
+   int32_t kaw;
+   int32_t kv;
+   int32_t ka;
+   int32_t i_limit;         /* Q15 */
+   int32_t d_limit;         /* Q15 */
+   uint8_t d_shift;
+   int32_t cmd;
+   int32_t msr;
+   int32_t ff_vel;
+   int32_t ff_acc;
+   int32_t err;
+   int32_t ierr;
+   int32_t derr;
+   int32_t out;             /* Q15 */
+} motor_control_q_t;
+
+/* ************************************************************* */
+/* * Controller Bank                                           * */
+/* ************************************************************* */
+/* Up to MOTOR_CONTROL_BANK_AXES fixed point controllers stored as one array
+ * per field, updated together by motor_control_run_bank().  Each axis gets
+ * exactly what motor_control_run_q() would give it, bit for bit, but the
+ * loop over axes has no calls and no branches (the clamps are selects), so
+ * on the M4 it stays in registers with QADD/QSUB/SSAT and on a PC the
+ * compiler can vectorize it.  d_shift is shared by every axis.
+ *
+ * Axes past axes are left alone, set axes with
+ * motor_control_init_bank() and write the gains and inputs by index.
+ */
+#define MOTOR_CONTROL_BANK_AXES    16
+
+typedef struct {
+   uint8_t axes;
+   uint8_t d_shift;
+   int32_t kp[MOTOR_CONTROL_BANK_AXES];
+   int32_t ki[MOTOR_CONTROL_BANK_AXES];
+   int32_t kd[MOTOR_CONTROL_BANK_AXES];
+   int32_t kaw[MOTOR_CONTROL_BANK_AXES];
+   int32_t kv[MOTOR_CONTROL_BANK_AXES];
+   int32_t ka[MOTOR_CONTROL_BANK_AXES];
+   int32_t i_limit[MOTOR_CONTROL_BANK_AXES];
+   int32_t d_limit[MOTOR_CONTROL_BANK_AXES];
+   int32_t cmd[MOTOR_CONTROL_BANK_AXES];
+   int32_t msr[MOTOR_CONTROL_BANK_AXES];
+   int32_t ff_vel[MOTOR_CONTROL_BANK_AXES];
+   int32_t ff_acc[MOTOR_CONTROL_BANK_AXES];
+   int32_t err[MOTOR_CONTROL_BANK_AXES];
+   int32_t ierr[MOTOR_CONTROL_BANK_AXES];
+   int32_t derr[MOTOR_CONTROL_BANK_AXES];
+   int32_t out[MOTOR_CONTROL_BANK_AXES];
+} motor_control_bank_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define MOTOR_CONTROL_SUCCESS      0x00
+#define MOTOR_CONTROL_ERROR_PERIOD 0x01
+#define MOTOR_CONTROL_ERROR_AXES   0x02
+
+/* ************************************************************* */
+/* * Motor Control Functions                                   * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t motor_control_init_pid(motor_control_pid_t *mcp)
+ * @brief Default tilt gains and limits, 1 kHz, no feed-forward, state cleared.
+ * @param mcp Controller.
+ * @return uint8_t Motor control return code.
+ *
+ */
 uint8_t motor_control_init_pid(motor_control_pid_t *mcp);
+
+/**
+ *
+ * @fn uint8_t motor_control_run_pid(motor_control_pid_t *mcp)
+ * @brief One sample, from cmd, msr, ff_vel and ff_acc to out.
+ * @param mcp Controller.
+ * @return uint8_t Motor control return code.
+ *
+ */
 uint8_t motor_control_run_pid(motor_control_pid_t *mcp);
+
+/**
+ *
+ * @fn uint8_t motor_control_seed_integrator(motor_control_pid_t *mcp, float iseed)
+ * @brief Sets the integrator, within its limits.
+ * @param mcp Controller.
+ * @param iseed Integrator value.
+ * @return uint8_t Motor control return code.
+ *
+ */
 uint8_t motor_control_seed_integrator(motor_control_pid_t *mcp, float iseed);
+
+/**
+ *
+ * @fn uint8_t motor_control_set_pid_gains(motor_control_pid_t *mcp, float p, float i, float d)
+ * @brief Sets the PID gains.
+ * @param mcp Controller.
+ * @param p Proportional.
+ * @param i Integral, per sample.
+ * @param d Derivative, per second.
+ * @return uint8_t Motor control return code.
+ *
+ */
 uint8_t motor_control_set_pid_gains(motor_control_pid_t *mcp, float p, float i, float d);
 
+/**
+ *
+ * @fn uint8_t motor_control_set_ff_gains(motor_control_pid_t *mcp, float kv, float ka, float aw)
+ * @brief Sets the feed-forward and back-calculation gains.
+ * @param mcp Controller.
+ * @param kv Output per unit of ff_vel.
+ * @param ka Output per unit of ff_acc.
+ * @param aw Back-calculation gain, 0 for the integrator clamp alone.
+ * @return uint8_t Motor control return code.
+ *
+ */
+uint8_t motor_control_set_ff_gains(motor_control_pid_t *mcp, float kv, float ka, float aw);
+
+/**
+ *
+ * @fn uint8_t motor_control_set_period(motor_control_pid_t *mcp, float dt)
+ * @brief Sets the time between motor_control_run_pid() calls.
+ * @param mcp Controller.
+ * @param dt Seconds, more than 0.
+ * @return uint8_t Motor control return code.
+ *
+ */
+uint8_t motor_control_set_period(motor_control_pid_t *mcp, float dt);
+
+/**
+ *
+ * @fn void motor_control_init_q(motor_control_q_t *mcq)
+ * @brief Zeroes a fixed point controller, gains included.
+ * @param mcq Controller.
+ * @return None
+ *
+ */
+void motor_control_init_q(motor_control_q_t *mcq);
+
+/**
+ *
+ * @fn int32_t motor_control_run_q(motor_control_q_t *mcq)
+ * @brief One sample of the fixed point controller.
+ * @param mcq Controller.
+ * @return int32_t out, Q15.
+ *
+ */
+int32_t motor_control_run_q(motor_control_q_t *mcq);
+
+/**
+ *
+ * @fn uint8_t motor_control_init_bank(motor_control_bank_t *mcb, uint8_t axes)
+ * @brief Zeroes a controller bank, gains included, and sets how many axes
+ * it runs.
+ * @param mcb Bank.
+ * @param axes 1 to MOTOR_CONTROL_BANK_AXES.
+ * @return uint8_t Motor control return code.
+ *
+ */
+uint8_t motor_control_init_bank(motor_control_bank_t *mcb, uint8_t axes);
+
+/**
+ *
+ * @fn void motor_control_run_bank(motor_control_bank_t *mcb)
+ * @brief One sample of every axis in the bank, out[] Q15.
+ * @param mcb Bank.
+ * @return None
+ *
+ */
+void motor_control_run_bank(motor_control_bank_t *mcb);
+
 #endif
@@ -0,0 +1,146 @@
+/**
+ * @file profile.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the cycle counter ISR profiler.
+ *
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+#include "hal.h"
+
+#include "generic_packet.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+/* Set to 0 to compile every PROFILE_* hook out.  Host time only moves
+ * between events, every section would measure 0 cycles there.
+ */
+#ifdef HAL_HOST
+#define PROFILE_ENABLE            (0)
+#else
+#define PROFILE_ENABLE            (1)
+#endif
+
+/* ************************************************************* */
+/* * Profiled Sections                                         * */
+/* ************************************************************* */
+/* Keep scripts/profile_decode.c in sync with this list. */
+enum profile_ids
+{
+   PROFILE_ID_TIM5,          /* Tilt stepper steps. */
+   PROFILE_ID_TIM12,         /* USART1 DMA service. */
+   PROFILE_ID_TIM9,          /* RS485 master state machine. */
+   PROFILE_ID_TIM10,         /* RS485 slave state machine. */
+   PROFILE_ID_TIM11,         /* Tilt stepper state machine. */
+   PROFILE_ID_DMA2_STREAM7,  /* USART1 TX complete. */
+   PROFILE_ID_DMA1_STREAM6,  /* RS485 master TX complete. */
+   PROFILE_ID_DMA2_STREAM6,  /* RS485 slave TX complete. */
+   PROFILE_ID_USART2,        /* RS485 master idle line. */
+   PROFILE_ID_EXTI15_10,     /* Hokuyo sync. */
+   PROFILE_ID_SYSTICK,
+   PROFILE_ID_TIM2,          /* Software timer callbacks. */
+   PROFILE_ID_FDUD_SPIN,     /* Main loop USART1 packet handling. */
+   PROFILE_ID_RS485_MASTER_SPIN,
+   PROFILE_ID_RS485_SLAVE_SPIN,
+   PROFILE_ID_DMA2_STREAM0,  /* ADC block filter. */
+   PROFILE_ID_TIM3,          /* Encoder wrap and edge timing. */
+   PROFILE_ID_TIM7,          /* Brushed tilt state machine and PID. */
+   PROFILE_NUM_IDS
+};
+
+/* Histogram bin n counts sections that took 2^n to 2^(n+1)-1 cycles, the
+ * last bin everything longer.
+ */
+#define PROFILE_HIST_BINS         20
+
+/* Main plus one level per preemption priority in use. */
+#define PROFILE_MAX_DEPTH         8
+
+/* ************************************************************* */
+/* * Hooks                                                     * */
+/* ************************************************************* */
+/* PROFILE_ENTER() goes first in a handler or function and PROFILE_EXIT() on
+ * the way out, in the same block.  Time spent in interrupts that preempt a
+ * section is taken out of that section, so the numbers are the section's own
+ * cycles.  PROFILE_ENTER_TIMER() also records the interrupt latency of a HAL
+ * timer's update interrupt from its counter.  PROFILE_ENTER_TIM() does the
+ * same for a timer the HAL doesn't know, clk_div being 2 for timers on APB1
+ * and 1 for timers on APB2.
+ */
+#if PROFILE_ENABLE
+#define PROFILE_ENTER()  \
+   uint32_t profile_t0 = profile_enter()
+#define PROFILE_ENTER_TIMER(id, timer)  \
+   uint32_t profile_t0 = profile_enter(); \
+   profile_latency((id), hal_timer_update_cycles(timer))
+#define PROFILE_ENTER_TIM(id, tim, clk_div)  \
+   uint32_t profile_t0 = profile_enter(); \
+   profile_latency((id), (tim)->CNT * ((tim)->PSC + 1) * (clk_div))
+#define PROFILE_EXIT(id)  \
+   profile_exit((id), profile_t0)
+#else
+#define PROFILE_ENTER()
+#define PROFILE_ENTER_TIMER(id, timer)
+#define PROFILE_ENTER_TIM(id, tim, clk_div)
+#define PROFILE_EXIT(id)
+#endif
+
+typedef struct {
+   uint32_t count;                          /* Completed sections. */
+   uint32_t min_cycles;
+   uint32_t max_cycles;
+   uint64_t total_cycles;                   /* Own cycles, preemption removed. */
+   uint32_t max_latency_cycles;             /* Timer update to handler entry. */
+   uint16_t hist[PROFILE_HIST_BINS];        /* log2 of own cycles. */
+} profile_entry_t;
+
+/* ************************************************************* */
+/* * Profiler Functions                                        * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void profile_init(void)
+ * @brief Starts the cycle counter and clears the table.
+ * @param None
+ * @return None
+ *
+ */
+void profile_init(void);
+
+/**
+ *
+ * @fn void profile_clear(void)
+ * @brief Clears every entry and restarts the load measurement window.
+ * @param None
+ * @return None
+ *
+ */
+void profile_clear(void);
+
+/**
+ *
+ * @fn uint8_t profile_dump(void)
+ * @brief Queues one UNIVERSAL_RESP_PROFILE packet per profiled section.
+ *
+ * Each packet has the count, min/max/mean cycles, worst latency, share of the
+ * CPU since the last clear in parts per million and the histogram.
+ *
+ * @param None
+ * @return uint8_t 1 if queued, 0 if the previous dump is still going out or
+ * the TX queue is full.
+ *
+ */
+uint8_t profile_dump(void);
+
+/* Used by the hooks. */
+uint32_t profile_enter(void);
+void profile_exit(uint8_t id, uint32_t start);
+void profile_latency(uint8_t id, uint32_t cycles);
+
+#endif
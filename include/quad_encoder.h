@@ -1,9 +1,201 @@
+/**
+ * @file quad_encoder.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the quadrature encoder, 32 bit position and velocity.
+ *
+ */
+
 #ifndef QUAD_ENCODER_H
 #define QUAD_ENCODER_H
 
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Position                                                  * */
+/* ************************************************************* */
+/* The hardware counter is 16 bits.  Every time it wraps the port calls
+ * quad_encoder_overflow() from the update interrupt, which moves the upper
+ * half of a signed 32 bit count up or down by 0x10000.  Which way is taken
+ * from where the counter is when the interrupt runs (just past 0 going up,
+ * just below 0xFFFF going down), so the shaft has to move less than half the
+ * counter within one interrupt latency, which it can't.
+ *
+ * A read that lands between the wrap and its interrupt (from a higher
+ * priority, or with interrupts masked) sees the update still pending and
+ * makes the same correction itself.
+ */
+
+/* ************************************************************* */
+/* * Velocity                                                  * */
+/* ************************************************************* */
+/* Differencing the count once a loop is coarse at low speed: one count per
+ * millisecond is a long way from zero.  So the port also timestamps every
+ * rising edge of channel A along with the count it latched at that edge
+ * (quad_encoder_edge()), and quad_encoder_sample() divides the counts between
+ * the last edges of this sample and of the previous one by the time between
+ * those edges.  Both ends are edges, so the count difference has no
+ * quantization and the time comes from the cycle counter.
+ *
+ * With no new edge the speed can't be more than one line
+ * (QUAD_ENCODER_COUNTS_PER_LINE counts) over the time since the last one, so
+ * the estimate decays along that bound and goes to zero after
+ * QUAD_ENCODER_STOP_MS without an edge.
+ */
+#define QUAD_ENCODER_COUNTS_PER_LINE   4
+#define QUAD_ENCODER_STOP_MS           250
+
+/* ************************************************************* */
+/* * Encoder Functions                                         * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void quad_encoder_init(void)
+ * @brief Starts the encoder counter at 0 and its interrupts.
+ * @param None
+ * @return None
+ *
+ */
 void quad_encoder_init(void);
 
-void quad_encoder_read_position(uint32_t *position_counts);
-void quad_encoder_set_position(uint32_t position_counts);
+/**
+ *
+ * @fn void quad_encoder_read_position(int32_t *position_counts)
+ * @brief Current position, quadrature counts.
+ *
+ * Safe from any context.
+ *
+ * @param position_counts Signed 32 bit count, 0 before quad_encoder_init().
+ * @return None
+ *
+ */
+void quad_encoder_read_position(int32_t *position_counts);
+
+/**
+ *
+ * @fn void quad_encoder_set_position(int32_t position_counts)
+ * @brief Makes the current position read as position_counts.
+ *
+ * Only an offset changes, the hardware counter and the velocity estimate
+ * carry on.
+ *
+ * @param position_counts New position.
+ * @return None
+ *
+ */
+void quad_encoder_set_position(int32_t position_counts);
+
+/**
+ *
+ * @fn void quad_encoder_sample(void)
+ * @brief Updates the velocity estimate.
+ *
+ * Call at a steady rate from one context, the control loop.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void quad_encoder_sample(void);
+
+/**
+ *
+ * @fn float quad_encoder_read_velocity(void)
+ * @brief Velocity as of the last quad_encoder_sample().
+ * @param None
+ * @return float Counts per second, positive counting up.
+ *
+ */
+float quad_encoder_read_velocity(void);
+
+/**
+ *
+ * @fn void quad_encoder_overflow(uint16_t count)
+ * @brief Accounts for one wrap of the hardware counter.
+ *
+ * Called by the port from the update interrupt, after clearing the update
+ * flag.
+ *
+ * @param count The hardware counter, read after the flag was cleared.
+ * @return None
+ *
+ */
+void quad_encoder_overflow(uint16_t count);
+
+/**
+ *
+ * @fn void quad_encoder_edge(uint16_t count, uint32_t ticks)
+ * @brief Records a channel A rising edge.
+ *
+ * Called by the port from the capture interrupt.  If the counter also wrapped
+ * quad_encoder_overflow() has to be called first.
+ *
+ * @param count Hardware counter latched by the edge.
+ * @param ticks quad_encoder_port_ticks() when the edge was seen.
+ * @return None
+ *
+ */
+void quad_encoder_edge(uint16_t count, uint32_t ticks);
+
+/* ************************************************************* */
+/* * Port Functions                                            * */
+/* ************************************************************* */
+/* Supplied by quad_encoder_stm32.c on the target.  A host build links its
+ * own versions around a simulated counter.
+ */
+
+/**
+ *
+ * @fn void quad_encoder_port_init(void)
+ * @brief Starts the counter in encoder mode with update and channel A
+ * capture interrupts.
+ * @param None
+ * @return None
+ *
+ */
+void quad_encoder_port_init(void);
+
+/**
+ *
+ * @fn uint16_t quad_encoder_port_count(void)
+ * @brief The hardware counter.
+ * @param None
+ * @return uint16_t Count.
+ *
+ */
+uint16_t quad_encoder_port_count(void);
+
+/**
+ *
+ * @fn uint8_t quad_encoder_port_overflow_pending(void)
+ * @brief Whether the counter has wrapped without quad_encoder_overflow()
+ * being called for it yet.
+ * @param None
+ * @return uint8_t 1 if pending.
+ *
+ */
+uint8_t quad_encoder_port_overflow_pending(void);
+
+/**
+ *
+ * @fn uint32_t quad_encoder_port_ticks(void)
+ * @brief Free running timestamp counter for the edges.
+ * @param None
+ * @return uint32_t Ticks, wraps every 2^32.
+ *
+ */
+uint32_t quad_encoder_port_ticks(void);
+
+/**
+ *
+ * @fn uint32_t quad_encoder_port_tick_hz(void)
+ * @brief Rate of quad_encoder_port_ticks().
+ * @param None
+ * @return uint32_t Ticks per second.
+ *
+ */
+uint32_t quad_encoder_port_tick_hz(void);
 
 #endif
@@ -13,11 +13,12 @@
 
 #include <stdint.h>
 
-#include "stm32f4xx_conf.h"
+#include "hal.h"
 
 #include "generic_packet.h"
 #include "gp_proj_rs485_sb.h"
 #include "gp_proj_universal.h"
+#include "gp_proj_local.h"
 
 /* Both master and slave will use the same size buffers. */
 #define DMA_RX_BUFFER_SIZE (GP_MAX_PACKET_LENGTH * 4)
@@ -40,9 +41,9 @@
 #error "RS485_MASTER_DELAY_TICKS too small!"
 #endif
 
-/** @todo Optimize bail out time when no response is received from a slave.
- *  Needs to be long enough that a slave has time to respond, but short enough
- *  not to waste time when no response is coming.
+/* Bail out time when no response is received from a live slave that doesn't
+ * have a measured timeout yet (see RS485_MASTER_TIMEOUT_P99_MULT).  Also the
+ * limit for a response frame to complete once it has started.
  */
 #define RS485_MASTER_RESPONSE_TIMEOUT_MSEC  500
 #define RS485_MASTER_RESPONSE_TIMEOUT_TICKS ((RS485_SENSOR_BUS_SM_HZ * RS485_MASTER_RESPONSE_TIMEOUT_MSEC)/1000)
@@ -50,21 +51,120 @@
 #error "RS485_MASTER_RESPONSE_TIMEOUT_TICS too small!"
 #endif
 
+/* Slave table and polling scheduler.  Slaves are expected to live at
+ * addresses RS485_MASTER_FIRST_SLAVE_ADDRESS through
+ * RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES - 1.
+ */
+#define RS485_MASTER_FIRST_SLAVE_ADDRESS  0x01
+#define RS485_MASTER_MAX_SLAVES           32
+
+/* Rate each live slave is polled at unless changed with
+ * rs485_master_set_poll_rate().
+ */
+#define RS485_MASTER_DEFAULT_POLL_HZ      100
+
+/* Wait for a slave that isn't known to be on the bus.  Used by the discovery
+ * sweep and when re-probing absent addresses so dead nodes cost a few
+ * milliseconds instead of a full RS485_MASTER_RESPONSE_TIMEOUT_MSEC.
+ */
+#define RS485_MASTER_PROBE_TIMEOUT_MSEC   5
+#define RS485_MASTER_PROBE_TIMEOUT_TICKS  ((RS485_SENSOR_BUS_SM_HZ * RS485_MASTER_PROBE_TIMEOUT_MSEC)/1000)
+#if (RS485_MASTER_PROBE_TIMEOUT_TICKS <= 1)
+#error "RS485_MASTER_PROBE_TIMEOUT_TICKS too small!"
+#endif
+
+/* Consecutive timeouts before a live slave is dropped from the table. */
+#define RS485_MASTER_MAX_MISSES           3
+
+/* Absent addresses are re-probed with an exponential back-off between these
+ * two limits.  This is also how hot plugged slaves get picked up.
+ */
+#define RS485_MASTER_BACKOFF_MIN_MSEC     10
+#define RS485_MASTER_BACKOFF_MAX_MSEC     5000
+#define RS485_MASTER_BACKOFF_MIN_TICKS    ((RS485_SENSOR_BUS_SM_HZ * RS485_MASTER_BACKOFF_MIN_MSEC)/1000)
+#define RS485_MASTER_BACKOFF_MAX_TICKS    ((RS485_SENSOR_BUS_SM_HZ * RS485_MASTER_BACKOFF_MAX_MSEC)/1000)
+
+/* Re-probes of absent addresses are spaced at least this far apart however
+ * many are due, so together they hold the bus for at most one probe timeout
+ * in every spacing and live slaves keep the rest.  Every address still gets
+ * its probe within the back-off as long as RS485_MASTER_MAX_SLAVES probes fit
+ * in RS485_MASTER_BACKOFF_MAX_MSEC.
+ */
+#define RS485_MASTER_PROBE_SPACING_MSEC   50
+#define RS485_MASTER_PROBE_SPACING_TICKS  ((RS485_SENSOR_BUS_SM_HZ * RS485_MASTER_PROBE_SPACING_MSEC)/1000)
+#if (RS485_MASTER_PROBE_SPACING_MSEC <= RS485_MASTER_PROBE_TIMEOUT_MSEC)
+#error "RS485_MASTER_PROBE_SPACING_MSEC leaves no bus time for live slaves!"
+#endif
+#if ((RS485_MASTER_MAX_SLAVES * RS485_MASTER_PROBE_SPACING_MSEC) > RS485_MASTER_BACKOFF_MAX_MSEC)
+#error "RS485_MASTER_PROBE_SPACING_MSEC too long to probe every address within the back-off!"
+#endif
+
+
+/* Adaptive response timeouts.  The master measures each slave's turnaround,
+ * from the end of the query (DMA1_Stream6 transfer complete) to its first
+ * response byte, and tracks a running p99 of it.  Once a slave has
+ * RS485_MASTER_LATENCY_MIN_SAMPLES its timeout becomes
+ * RS485_MASTER_TIMEOUT_P99_MULT times that p99, never more than
+ * RS485_MASTER_RESPONSE_TIMEOUT_MSEC.
+ */
+#define RS485_MASTER_LATENCY_BINS         16
+#define RS485_MASTER_LATENCY_MIN_SAMPLES  16
+#define RS485_MASTER_TIMEOUT_P99_MULT     4
+#define RS485_MASTER_MIN_TIMEOUT_TICKS    2
+/* The p99 estimate is kept in 1/16 usec and moves up 99 steps for every
+ * sample above it and down 1 step for every sample at or below it, so it
+ * settles where 1% of samples are above.  A step is 1/64 of the running mean
+ * distance between the samples and the estimate (a 1/16 average), never less
+ * than RS485_MASTER_P99_STEP.  A slave whose turnaround changes a lot, or a
+ * first sample far off, is caught up in tens of samples rather than
+ * thousands, and a steady slave still settles to 1/16 usec steps.
+ */
+#define RS485_MASTER_P99_FRAC_BITS        4
+#define RS485_MASTER_P99_STEP             1
+#define RS485_MASTER_P99_STEP_SHIFT       6
+#define RS485_MASTER_P99_DEV_SHIFT        4
+#define RS485_MASTER_TICK_USEC            (1000000 / RS485_SENSOR_BUS_SM_HZ)
+
+/* Broadcast snapshots (TDMA).  The master broadcasts RS485_SYNC_SAMPLE, every
+ * slave samples right away and answers in its own slot, slot k belonging to
+ * address RS485_MASTER_FIRST_SLAVE_ADDRESS + k.  Slot 0 starts one slot after
+ * the broadcast so every slave has time to parse it.  Slaves time their slot
+ * with their state machine tick, so they can be up to one tick apart and a
+ * slot has to fit one response plus RS485_TDMA_GUARD_TICKS.
+ */
+#define RS485_TDMA_MIN_SLOT_TICKS   3
+#define RS485_TDMA_GUARD_TICKS      1
+
 
 /* Sensor Bus Return Codes */
 #define RS485_SB_SUCCESS      0x00
 #define RS485_SB_INIT_FAIL    0x01
+#define RS485_SB_BAD_ADDRESS  0x02
+#define RS485_SB_BAD_RATE     0x03
+#define RS485_SB_BUSY         0x04
 
-/* Hard code the slave address for now.  In the future, this will need to be
- * stored in flash memory.  Functions will be provided to allow the master to
- * set the address.  This could be used at manufacturing to configure sensors
- * for the robot.
+/* Slave addressing.  A slave boots on the address stored in flash
+ * (FLASH_KV_KEY_RS485_ADDRESS) or on RS485_ADDRESS_CONFIGURATION if it has
+ * none.  The master reads unique IDs with RS485_QUERY_UNIQUE_ID and hands out
+ * addresses with RS485_SET_ADDRESS, which only the slave with that ID takes.
+ * Several new slaves can share the configuration address, so they answer a
+ * unique ID query in one of RS485_CONFIG_SLOTS slots picked at random for
+ * each query.  Repeating the query sorts out collisions.
  */
-/** @todo  All slaves should be programmed with RS485_ADDRESS_CONFIGURATION
- *  initially and receive their final address as a command from the master.
- *  @todo  The new slave address should be stored in non volatile memory.
+#define RS485_CONFIG_SLOTS            8
+#define RS485_CONFIG_SLOT_USEC        1000
+#define RS485_CONFIG_WAIT_TICKS       (((RS485_CONFIG_SLOTS + 1) * RS485_CONFIG_SLOT_USEC) / RS485_MASTER_TICK_USEC + RS485_TDMA_GUARD_TICKS)
+
+/* 96 bit unique device ID, see hal_unique_id(). */
+#define RS485_UNIQUE_ID_WORDS         HAL_UNIQUE_ID_WORDS
+
+/* Answers the master passes upstream are built into one of
+ * RS485_MASTER_FORWARD_PACKETS packets and held until the link has sent
+ * them, the bus can hand over answers faster than the link drains them.  An
+ * answer that finds them all busy, or the link's queue full, is dropped and
+ * counted (rs485_master_forward_drops()).
  */
-#define SLAVE_ADDRESS 0x01
+#define RS485_MASTER_FORWARD_PACKETS  RS485_MASTER_MAX_SLAVES
 
 /** @enum rs485_master_states
  *
@@ -75,10 +175,34 @@ typedef enum {RS485_MASTER_INIT,
               RS485_MASTER_FIND_ATTACHED_DEVICES,
               RS485_MASTER_QUERY_DEVICE,
               RS485_MASTER_AWAIT_RESPONSE,
+              RS485_MASTER_AWAIT_SLOTS,
+              RS485_MASTER_AWAIT_CONFIG,
               RS485_MASTER_DELAY,
               RS485_MASTER_IDLE,
               RS485_MASTER_ERROR} rs485_master_states;
 
+/**
+ *
+ * One entry of the master's live slave table.  All times are in state
+ * machine ticks (RS485_SENSOR_BUS_SM_HZ).
+ *
+ */
+typedef struct {
+   uint8_t present;            /* Answered and hasn't missed RS485_MASTER_MAX_MISSES since. */
+   uint8_t misses;             /* Consecutive unanswered queries. */
+   uint8_t checking;           /* Pipelined response waiting for rs485_master_spin() to check it. */
+   uint32_t poll_period_ticks; /* Time between queries while present. */
+   uint32_t backoff_ticks;     /* Current re-probe interval while absent. */
+   uint32_t next_poll_tick;    /* Tick the slave is next due. */
+   uint32_t responses;         /* Total responses received. */
+   uint32_t timeouts;          /* Total queries that timed out. */
+   uint32_t timeout_ticks;     /* Adaptive response timeout, 0 until enough samples. */
+   uint32_t p99_x16;           /* Running p99 turnaround estimate in 1/16 usec. */
+   uint32_t dev_x16;           /* Mean distance of the samples from it. */
+   uint32_t latency_samples;   /* Number of turnaround measurements. */
+   uint16_t latency_hist[RS485_MASTER_LATENCY_BINS]; /* Bin n counts turnarounds of 2^n to 2^(n+1) usec. */
+} rs485_slave_entry_t;
+
 /**
  *
  * @fn uint8_t rs485_sensor_bus_init_master(void);
@@ -134,6 +258,147 @@ uint8_t rs485_sensor_bus_init_master(void);
  */
 void rs485_master_spin(void);
 
+/**
+ *
+ * @fn uint8_t rs485_master_set_poll_rate(uint8_t address, uint16_t hz);
+ *
+ * @brief Sets how often a slave is queried while it is on the bus.
+ *
+ * The scheduler always services the most overdue slave first, so the sum of
+ * the requested rates is what the bus has to sustain.  If that's more than
+ * the bus can do every slave simply falls behind by the same amount.
+ *
+ * @param address Slave address to change.
+ * @param hz Poll rate, 1 to RS485_SENSOR_BUS_SM_HZ.
+ * @return uint8_t RS485 sensor bus return code.
+ *
+ */
+uint8_t rs485_master_set_poll_rate(uint8_t address, uint16_t hz);
+
+/**
+ *
+ * @fn void rs485_master_set_pipelined(uint8_t enable);
+ *
+ * @brief Turns pipelined transactions on (default) or off.
+ *
+ * Pipelined, a response is done as soon as its bytes stop arriving and the
+ * next query goes out immediately, while the previous response is still
+ * being checked and dispatched by rs485_master_spin().  The slave only counts
+ * as answered, and its turnaround only goes into the statistics, once that
+ * check passes, and it isn't queried again until then.  Off, the master
+ * waits for the parsed response and RS485_MASTER_DELAY_TIME_USEC between
+ * queries.  Pipelining assumes a slave only ever sends one frame per query.
+ *
+ * @param enable Non zero to pipeline.
+ * @return  None
+ *
+ */
+void rs485_master_set_pipelined(uint8_t enable);
+
+/**
+ *
+ * @fn uint8_t rs485_master_set_snapshot_rate(uint16_t hz, uint16_t slot_usec);
+ *
+ * @brief Starts or stops periodic broadcast snapshots of the whole bus.
+ *
+ * Each snapshot is one broadcast followed by one time slot per address up to
+ * the highest live slave, instead of one query and turnaround per slave.
+ * Individual polling keeps running in between, so lower the per-slave rates
+ * with rs485_master_set_poll_rate() if the snapshots are enough.
+ *
+ * @param hz Snapshots per second, 0 to stop.
+ * @param slot_usec Slot width, rounded down to state machine ticks.
+ * @return uint8_t RS485 sensor bus return code.
+ *
+ */
+uint8_t rs485_master_set_snapshot_rate(uint16_t hz, uint16_t slot_usec);
+
+/**
+ *
+ * @fn void rs485_master_rediscover(void);
+ *
+ * @brief Runs the discovery sweep again.
+ *
+ * Live entries are kept.  Every address is probed once more so newly attached
+ * slaves are found right away instead of at their back-off interval.
+ *
+ * @param   None
+ * @return  None
+ *
+ */
+void rs485_master_rediscover(void);
+
+/**
+ *
+ * @fn uint8_t rs485_master_query_unique_id(uint8_t address);
+ *
+ * @brief Asks the slave(s) on an address for their unique ID.
+ *
+ * The query goes out the next time the bus is idle and the answers are
+ * forwarded upstream as RS485_RESP_UNIQUE_ID.  Use RS485_ADDRESS_CONFIGURATION
+ * to list slaves that don't have an address yet.
+ *
+ * @param address Slave address or RS485_ADDRESS_CONFIGURATION.
+ * @return uint8_t RS485 sensor bus return code.
+ *
+ */
+uint8_t rs485_master_query_unique_id(uint8_t address);
+
+/**
+ *
+ * @fn uint8_t rs485_master_assign_address(const uint32_t *unique_id, uint8_t address);
+ *
+ * @brief Gives the slave with a unique ID a new address.
+ *
+ * The slave stores the address in flash and answers from it, and the new
+ * address is probed right away.
+ *
+ * @param unique_id RS485_UNIQUE_ID_WORDS words of the slave's ID.
+ * @param address New slave address.
+ * @return uint8_t RS485 sensor bus return code.
+ *
+ */
+uint8_t rs485_master_assign_address(const uint32_t *unique_id, uint8_t address);
+
+/**
+ *
+ * @fn uint32_t rs485_master_forward_drops(void);
+ *
+ * @brief Answers not passed upstream for want of a free packet.
+ *
+ * @param None
+ * @return uint32_t Since rs485_sensor_bus_init_master().
+ *
+ */
+uint32_t rs485_master_forward_drops(void);
+
+/**
+ *
+ * @fn const rs485_slave_entry_t * rs485_master_get_slave(uint8_t address);
+ *
+ * @brief Read only access to the slave table.
+ *
+ * @param address Slave address to look up.
+ * @return Pointer to the table entry or NULL if the address is out of range.
+ *
+ */
+const rs485_slave_entry_t * rs485_master_get_slave(uint8_t address);
+
+/**
+ *
+ * @fn void rs485_master_clear_latency(uint8_t address);
+ *
+ * @brief Resets a slave's turnaround histogram and p99 estimate.
+ *
+ * The slave goes back to the fixed timeouts until it has collected
+ * RS485_MASTER_LATENCY_MIN_SAMPLES again.
+ *
+ * @param address Slave address to clear.
+ * @return  None
+ *
+ */
+void rs485_master_clear_latency(uint8_t address);
+
 /** @enum rs485_slave_states
  *
  * Describes the states in the RS485 slave state machine.
@@ -203,4 +468,16 @@ uint8_t rs485_sensor_bus_init_slave(void);
  */
 void rs485_slave_spin(void);
 
+/**
+ *
+ * @fn uint8_t rs485_slave_get_address(void);
+ *
+ * @brief Address this slave currently answers on.
+ *
+ * @param   None
+ * @return  uint8_t Slave address, RS485_ADDRESS_CONFIGURATION if unassigned.
+ *
+ */
+uint8_t rs485_slave_get_address(void);
+
 #endif
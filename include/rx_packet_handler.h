@@ -10,6 +10,7 @@
 #include "gp_proj_sonar.h"
 #include "gp_proj_motor.h"
 #include "gp_proj_rs485_sb.h"
+#include "gp_proj_local.h"
 
 #include "full_duplex_usart_dma.h"
 
@@ -17,6 +18,12 @@
 
 #define RX_PACKET_HANDLER_GP_QUEUE_SIZE 16
 
+/* A command that can't be carried out is answered with a UNIVERSAL_WORD of
+ * RX_PACKET_HANDLER_NAK with its project ID and spec in the low 16 bits,
+ * (GP_LOC_PROJ_ID << 8) | GP_LOC_PROJ_SPEC.
+ */
+#define RX_PACKET_HANDLER_NAK           0x4E410000
+
 void rx_packet_handler_init(void);
 void rx_packet_handler(GenericPacket *gp_ptr);
 void rx_packet_handler_packet_send_callback(uint32_t new_tail);
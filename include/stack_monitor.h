@@ -0,0 +1,93 @@
+/**
+ * @file stack_monitor.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the stack high-water mark monitor.
+ *
+ */
+
+#ifndef STACK_MONITOR_H
+#define STACK_MONITOR_H
+
+#include <stdint.h>
+#include "stm32f4xx_conf.h"
+
+#include "generic_packet.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+/* ************************************************************* */
+/* * Stack Painting                                            * */
+/* ************************************************************* */
+/* Everything between the heap reservation (_sstack in the linker script) and
+ * _estack is stack, main and every interrupt share it.  It's painted with
+ * STACK_MONITOR_PAINT at boot and the lowest word that's been written since
+ * is the high-water mark.
+ */
+#define STACK_MONITOR_PAINT       0xC5C5C5C5
+
+/* Left unpainted below the stack pointer when painting, covers
+ * stack_monitor_init()'s own frame.
+ */
+#define STACK_MONITOR_MARGIN      64
+
+/* ************************************************************* */
+/* * Stack Monitor Functions                                   * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void stack_monitor_init(void)
+ * @brief Paints the unused stack.
+ *
+ * Call first thing in main(), before any interrupt is enabled.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void stack_monitor_init(void);
+
+/**
+ *
+ * @fn uint32_t stack_monitor_used(void)
+ * @brief Deepest the stack has been since stack_monitor_init().
+ *
+ * Scans up from the bottom of the stack, so the time taken goes with how
+ * much is still unused.  Don't call it from an interrupt.
+ *
+ * @param None
+ * @return uint32_t Bytes from _estack down to the lowest overwritten word.
+ *
+ */
+uint32_t stack_monitor_used(void);
+
+/**
+ *
+ * @fn uint32_t stack_monitor_size(void)
+ * @brief Bytes the stack can grow to before it runs into the heap.
+ * @param None
+ * @return uint32_t Bytes from _estack down to _sstack.
+ *
+ */
+uint32_t stack_monitor_size(void);
+
+/**
+ *
+ * @fn uint8_t stack_monitor_report(void)
+ * @brief Queues a UNIVERSAL_RESP_STACK packet.
+ *
+ * The packet has the high-water mark, the stack size and _Min_Stack_Size
+ * from the linker script, the budget make budget checks against.  A
+ * high-water mark equal to the size means the paint at the bottom is gone and
+ * the stack has probably overflowed into the heap.
+ *
+ * @param None
+ * @return uint8_t 1 if queued, 0 if the last report is still going out or the
+ * TX queue is full.
+ *
+ */
+uint8_t stack_monitor_report(void);
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file sw_timer.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the software timers.
+ *
+ */
+
+#ifndef SW_TIMER_H
+#define SW_TIMER_H
+
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Timers                                                    * */
+/* ************************************************************* */
+/* Any number of one-shot or periodic timers share one hardware compare.
+ * Running timers are kept in a list sorted by expiry and the compare is
+ * always set for the head of the list.  Times are in microseconds on a 32 bit
+ * counter, so a delay or period can be up to 2^31 us (about 35 minutes).
+ *
+ * Ordering:
+ *  +Timers fire in order of expiry time.
+ *  +Timers that expire at the same microsecond fire in the order they were
+ *   started.
+ *  +A periodic timer is due again period_us after it was last due, not after
+ *   the callback ran, so it doesn't drift.  Periods missed completely (a
+ *   callback or a higher priority interrupt ran longer than a period) are
+ *   skipped rather than fired back to back.
+ */
+
+typedef void (*SwTimerCallback)(uint32_t data);
+
+typedef struct sw_timer_s {
+   uint32_t expires_us;
+   uint32_t period_us;                      /* 0 for one-shot. */
+   SwTimerCallback callback;
+   uint32_t data;                           /* Handed to the callback. */
+   uint8_t active;
+   struct sw_timer_s *next;
+} sw_timer_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define SW_TIMER_SUCCESS           0x00
+#define SW_TIMER_ERROR_DELAY       0x01
+#define SW_TIMER_ERROR_CALLBACK    0x02
+
+#define SW_TIMER_MAX_DELAY_US      0x7FFFFFFF
+
+/* ************************************************************* */
+/* * Timer Functions                                           * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void sw_timer_init(void)
+ * @brief Stops every timer and starts the hardware timer behind them.
+ * @param None
+ * @return None
+ *
+ */
+void sw_timer_init(void);
+
+/**
+ *
+ * @fn uint8_t sw_timer_start(sw_timer_t *timer, uint32_t delay_us, uint32_t period_us, SwTimerCallback callback, uint32_t data)
+ * @brief Starts (or restarts) a timer.
+ *
+ * The timer struct belongs to the caller and must stay put while the timer
+ * runs, file scope or static.  Safe from the main loop and any interrupt.
+ * Callbacks run in the hardware timer interrupt, keep them short and post an
+ * event for anything more.
+ *
+ * @param timer Timer to start.  Restarting a running timer moves it.
+ * @param delay_us Microseconds until the first expiry.
+ * @param period_us Microseconds between expiries after that, 0 for one-shot.
+ * @param callback Called on every expiry.
+ * @param data Handed to the callback.
+ * @return uint8_t SW timer return code.
+ *
+ */
+uint8_t sw_timer_start(sw_timer_t *timer, uint32_t delay_us, uint32_t period_us, SwTimerCallback callback, uint32_t data);
+
+/**
+ *
+ * @fn void sw_timer_stop(sw_timer_t *timer)
+ * @brief Stops a timer.  Nothing happens if it isn't running.
+ *
+ * Once this returns the callback won't be called again, unless it was
+ * already running in an interrupt this one preempted.
+ *
+ * @param timer Timer to stop.
+ * @return None
+ *
+ */
+void sw_timer_stop(sw_timer_t *timer);
+
+/**
+ *
+ * @fn uint32_t sw_timer_now(void)
+ * @brief The microsecond counter the timers run on.
+ * @param None
+ * @return uint32_t Microseconds, wraps every 2^32.
+ *
+ */
+uint32_t sw_timer_now(void);
+
+/**
+ *
+ * @fn void sw_timer_expire(void)
+ * @brief Runs the callbacks of every timer that is due and sets the hardware
+ * compare for the next one.
+ *
+ * Called by the port from the hardware timer interrupt.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void sw_timer_expire(void);
+
+/* ************************************************************* */
+/* * Port Functions                                            * */
+/* ************************************************************* */
+/* Supplied by sw_timer_hal.c, on the real timer or on hal_host.c's virtual
+ * one.  A host build can also link its own versions with a simulated clock.
+ */
+
+/**
+ *
+ * @fn void sw_timer_port_init(void)
+ * @brief Starts the free running microsecond counter and its compare
+ * interrupt.
+ * @param None
+ * @return None
+ *
+ */
+void sw_timer_port_init(void);
+
+/**
+ *
+ * @fn uint32_t sw_timer_port_now(void)
+ * @brief Current value of the microsecond counter.
+ * @param None
+ * @return uint32_t Microseconds.
+ *
+ */
+uint32_t sw_timer_port_now(void);
+
+/**
+ *
+ * @fn void sw_timer_port_arm(uint32_t expires_us)
+ * @brief Sets the compare so sw_timer_expire() runs at expires_us.
+ *
+ * If expires_us has already gone by the interrupt has to happen right away
+ * rather than after the counter wraps.
+ *
+ * @param expires_us Counter value to interrupt at.
+ * @return None
+ *
+ */
+void sw_timer_port_arm(uint32_t expires_us);
+
+/**
+ *
+ * @fn uint32_t sw_timer_port_lock(void)
+ * @brief Masks the interrupts that can touch the timer list.
+ * @param None
+ * @return uint32_t Handed back to sw_timer_port_unlock().
+ *
+ */
+uint32_t sw_timer_port_lock(void);
+
+/**
+ *
+ * @fn void sw_timer_port_unlock(uint32_t key)
+ * @brief Undoes sw_timer_port_lock().
+ * @param key From sw_timer_port_lock().
+ * @return None
+ *
+ */
+void sw_timer_port_unlock(uint32_t key);
+
+#endif
@@ -26,17 +26,67 @@
  */
 void systick_init(void);
 
+/**
+ *
+ * @fn uint64_t systick_cycles(void)
+ * @brief Core clock cycles since systick_init(), never wraps.
+ *
+ * The DWT cycle counter extended to 64 bits.  Safe from any context.
+ *
+ * @param None
+ * @return uint64_t Cycles.
+ *
+ */
+uint64_t systick_cycles(void);
+
+/**
+ *
+ * @fn uint64_t systick_us(void)
+ * @brief Microseconds since systick_init(), never wraps.
+ * @param None
+ * @return uint64_t Microseconds.
+ *
+ */
+uint64_t systick_us(void);
+
+/**
+ *
+ * @fn void systick_delay_ns(uint32_t delay_ns)
+ * @brief Waits at least delay_ns nanoseconds on the cycle counter.
+ *
+ * For setup and hold times of a few cycles up to a few microseconds, where
+ * a software timer would cost more than the wait.  Resolution is one core
+ * clock (6ns at 168MHz) plus the call, and interrupts can only make it
+ * longer.
+ *
+ * @param delay_ns Nanoseconds, up to about 25s.
+ * @return None
+ *
+ */
+void systick_delay_ns(uint32_t delay_ns);
+
+/**
+ *
+ * @fn void systick_delay_us(uint32_t delay_us)
+ * @brief Waits at least delay_us microseconds on the cycle counter.
+ * @param delay_us Microseconds, up to about 25s.
+ * @return None
+ *
+ */
+void systick_delay_us(uint32_t delay_us);
+
 /**
  *
  * @fn void systick_delay_ms(uint32_t delay_ms)
  * @brief A simple delay function.
  *
- * @param None
+ * Busy waits on ms_counter, prefer a software timer (sw_timer.h) for
+ * anything this long.
+ *
+ * @param delay_ms Milliseconds.
  * @return None
  *
  */
 void systick_delay_ms(uint32_t delay_ms);
 
-void Delay(__IO uint32_t nCount);
-
 #endif
@@ -16,7 +16,7 @@
 #define TILT_MIN_ANGLE_RAD         (-TILT_HALF_ANGLE_RAD)
 #define TILT_MAX_ANGLE_RAD         (TILT_HALF_ANGLE_RAD)
 
-typedef enum {TILT_INITIALIZE, TILT_FIND_HOME, TILT_CW, TILT_CCW, TILT_HORIZONTAL_HOLD, TILT_DISABLE, TILT_TABLE, TILT_ERROR} tilt_motor_states;
+typedef enum {TILT_INITIALIZE, TILT_FIND_HOME, TILT_CW, TILT_CCW, TILT_HORIZONTAL_HOLD, TILT_DISABLE, TILT_TABLE, TILT_ERROR, TILT_AUTOTUNE} tilt_motor_states;
 
 typedef enum {TILT_HOME_INITIALIZE, TILT_HOME_MOVE_CW, TILT_HOME_MOVE_CCW} tilt_home_states;
 
@@ -24,9 +24,14 @@ void tilt_motor_init(void);
 void tilt_motor_init_flag(void);
 void tilt_motor_init_state_machine(void);
 void tilt_motor_get_angle(float *tilt_angle);
-void tilt_motor_angle_to_counts(float tilt_angle_rad, uint32_t *quad_counts);
+void tilt_motor_get_velocity(float *tilt_rad_per_s);
+void tilt_motor_angle_to_counts(float tilt_angle_rad, int32_t *quad_counts);
 uint8_t tilt_motor_set_pid_gains(float p, float i, float d);
+uint8_t tilt_motor_set_ff_gains(float kv, float ka, float aw);
+uint8_t tilt_motor_set_sweep_period(float period_s);
 uint8_t tilt_motor_query_pid_gains(float *p, float *i, float *d);
+uint8_t tilt_motor_autotune(void);
+void tilt_motor_flag_edge(void);
 uint8_t tilt_motor_start(void);
 uint8_t tilt_motor_stop(void);
 
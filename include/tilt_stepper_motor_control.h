@@ -20,6 +20,20 @@
 
 #define TILT_STEPPER_TWO_PI 6.28318530718f
 
+/* Tilting sweeps from home to TILT_STEPPER_SWEEP_RAD and back in the old
+ * stepper table's shape, trajectory_set_ramp() from trajectory.h.  At a
+ * profile multiplier of 1.0 it takes the table's 0.9164 s each way and
+ * cruises at just under its 70k microsteps a second, the ramps at each end
+ * taking TILT_STEPPER_SWEEP_RAMP of the sweep.  The table jumped from 23k to
+ * 70k in a step, the ramps are smooth.  The multiplier only slows it down, no
+ * tick ever asks for more steps than TILT_STEPPER_MAX_STEP_HZ allows.
+ */
+#define TILT_STEPPER_SWEEP_RAD  (TILT_STEPPER_TWO_PI / 2.0f)
+#define TILT_STEPPER_SWEEP_S    0.9164f
+#define TILT_STEPPER_SWEEP_RAMP 0.077f
+#define TILT_STEPPER_MAX_STEP_HZ         70000
+#define TILT_STEPPER_MAX_STEPS_PER_TICK  (TILT_STEPPER_MAX_STEP_HZ / TILT_STEPPER_STATE_MACHINE_HZ)
+
 typedef enum {TILT_STEPPER_INITIALIZE,
               TILT_STEPPER_HOME,
               TILT_STEPPER_HOLD,
@@ -57,7 +71,19 @@ void tilt_stepper_motor_pos(float *rad, uint32_t *timestamp);
 void tilt_stepper_motor_stop(void);
 void tilt_stepper_motor_tilt(void);
 void tilt_stepper_motor_home(void);
-void tilt_stepper_motor_set_profile_multiplier(float multiplier);
+
+/**
+ * @fn float tilt_stepper_motor_set_profile_multiplier(float multiplier)
+ * @brief Sweeps take TILT_STEPPER_SWEEP_S times multiplier, from now.
+ * @param multiplier 1.0 or more, anything less would step faster than
+ *        TILT_STEPPER_MAX_STEP_HZ and is held at 1.0.
+ * @return float The multiplier in use.
+ *
+ * Mid sweep it carries on from the same point of the sweep at the new speed.
+ */
+float tilt_stepper_motor_set_profile_multiplier(float multiplier);
+
+
 void tilt_stepper_motor_go_to_pos(float rad);
 
 #endif
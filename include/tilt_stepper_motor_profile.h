@@ -1,7417 +1,14 @@
 #ifndef TILT_STEPPER_MOTOR_PROFILE_H
 #define TILT_STEPPER_MOTOR_PROFILE_H
 
-/* Parameters used to calculate this table. */
+/* Stepper and gearbox.  The sweep itself comes from trajectory.c now, the
+ * step timing is worked out from it as it goes.
+ */
 /* steps_per_rev = 200 */
 /* micro_steps_per_step = 128 */
 uint32_t micro_steps_per_rev = 25600;
-/* tics_per_sec = 84000000 */
-/* Table is in units of tics per micro step. */
 float stepper_gear_ratio_num = 74.000000000000f;
 float stepper_gear_ratio_den = 16.000000000000f;
 float rad_per_micro_step = 0.000053067443f;
-static uint32_t tilt_elements = 59200;
-static uint32_t stepper_profile[] = { 
-117624, 115248, 112872, 110496, 108120, 105744, 103368, 100992,
-98616, 96240, 93864, 91488, 89112, 86736, 84360, 81984,
-79608, 77232, 74856, 72480, 70104, 67728, 65352, 62976,
-60600, 58224, 55848, 53472, 51096, 48720, 46344, 43968,
-41592, 39216, 36840, 34464, 32088, 29712, 27336, 24960,
-22584, 20208, 17832, 15456, 13080, 10704, 8328, 5952,
-3576, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
-1200, 1200, 1200, 1200, 3576, 5952, 8328, 10704,
-13080, 15456, 17832, 20208, 22584, 24960, 27336, 29712,
-32088, 34464, 36840, 39216, 41592, 43968, 46344, 48720,
-51096, 53472, 55848, 58224, 60600, 62976, 65352, 67728,
-70104, 72480, 74856, 77232, 79608, 81984, 84360, 86736,
-89112, 91488, 93864, 96240, 98616, 100992, 103368, 105744,
-108120, 110496, 112872, 115248, 117624, 120000, 0, 0,
-0};
 
 #endif
@@ -0,0 +1,127 @@
+/**
+ * @file trace.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the binary trace ring.
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include "hal.h"
+
+#include "generic_packet.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+/* Set to 0 to compile every TRACE() call out. */
+#define TRACE_ENABLE              (1)
+
+/* ************************************************************* */
+/* * Trace Events                                              * */
+/* ************************************************************* */
+/* Keep scripts/trace_decode.c in sync with this list. */
+enum trace_ids
+{
+   TRACE_ID_TILT_STATE,            /* arg8 new state, arg16 old state. */
+   TRACE_ID_RS485_MASTER_STATE,    /* arg8 new state, arg16 old state. */
+   TRACE_ID_FDUD_PACKET_RESET,     /* arg8 unused, arg16 TIM12 ticks since the last byte. */
+   TRACE_ID_TX_CALLBACK_MISMATCH,  /* arg8 callback tail, arg16 queue tail. */
+   TRACE_NUM_IDS
+};
+
+/* Records in the ring, must be a power of two. */
+#define TRACE_RING_SIZE           256
+
+/* Records per UNIVERSAL_TRACE packet and packets in flight at once. */
+#define TRACE_RECORDS_PER_PACKET  6
+#define TRACE_TX_PACKETS          4
+
+#if (TRACE_RING_SIZE & (TRACE_RING_SIZE - 1))
+#error "TRACE_RING_SIZE must be a power of two."
+#endif
+
+/* 8 bytes, sent over the link as is (little endian). */
+typedef struct {
+   uint32_t cycles;                         /* DWT CYCCNT when written. */
+   uint8_t id;
+   uint8_t arg8;
+   uint16_t arg16;
+} trace_record_t;
+
+#if TRACE_ENABLE
+#define TRACE(id, arg8, arg16)  \
+   trace_write((id), (arg8), (arg16))
+#else
+#define TRACE(id, arg8, arg16)
+#endif
+
+/* ************************************************************* */
+/* * Trace Functions                                           * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void trace_init(void)
+ * @brief Starts the DWT cycle counter used for the timestamps and empties
+ * the ring.
+ * @param None
+ * @return None
+ *
+ */
+void trace_init(void);
+
+/**
+ *
+ * @fn void trace_write(uint8_t id, uint8_t arg8, uint16_t arg16)
+ * @brief Adds a record to the ring.
+ *
+ * Safe from any interrupt priority.  Interrupts are masked for the few
+ * instructions it takes to fill the record.  When the ring is full the record
+ * is dropped and counted, the count goes out with the next packet.  Use the
+ * TRACE() macro rather than calling this directly.
+ *
+ * @param id One of enum trace_ids.
+ * @param arg8 Event specific.
+ * @param arg16 Event specific.
+ * @return None
+ *
+ */
+void trace_write(uint8_t id, uint8_t arg8, uint16_t arg16);
+
+/**
+ *
+ * @fn void trace_drain(void)
+ * @brief Moves records from the ring into UNIVERSAL_TRACE packets on the
+ * USART1 TX queue.
+ *
+ * Main loop only, it is registered as the event scheduler idle handler so
+ * the ring empties whenever nothing else is waiting.  Each packet also
+ * carries ms_counter and CYCCNT at the time it was built so the host can put
+ * the records on a timeline.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void trace_drain(void);
+
+/**
+ *
+ * @fn uint32_t trace_snapshot(trace_record_t *records, uint32_t max)
+ * @brief Copies the newest records in the ring, sent or not, oldest first.
+ *
+ * Takes no lock and moves nothing, it's for the fault handler's crash dump
+ * where nothing else is going to run.
+ *
+ * @param records Filled in.
+ * @param max Most records to copy.
+ * @return uint32_t Records copied.
+ *
+ */
+uint32_t trace_snapshot(trace_record_t *records, uint32_t max);
+
+#endif
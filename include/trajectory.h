@@ -0,0 +1,139 @@
+/**
+ * @file trajectory.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Header for the tilt sweep, position, velocity and acceleration at
+ * any time.
+ *
+ */
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <stdint.h>
+
+/* ************************************************************* */
+/* * Sweep                                                     * */
+/* ************************************************************* */
+/* Minimum jerk from one end to the other in period seconds, a dwell, back
+ * again and another dwell, over and over.  With tau the time into a sweep
+ * over period and A the distance,
+ *
+ *    s(tau) = A * (10*tau^3 - 15*tau^4 + 6*tau^5)
+ *
+ * so velocity and acceleration are 0 at both ends and the turn around needs
+ * no dwell.  It's the curve doc/tilt_lidar_profiles used to generate both
+ * tables, evaluated when it's wanted instead.  Any period works, and sampling
+ * it at 1 ms doesn't tie the period to a number of samples.
+ *
+ * trajectory_set_ramp() swaps the curve for the old stepper table's shape:
+ * speeding up over ramp * period, cruising, and slowing down over the same
+ * again.  With u the time into a ramp over its length, speed follows
+ * 3*u^2 - 2*u^3 of the cruise, so acceleration has no steps, and the ramps
+ * cover half as far as cruising for as long would.
+ *
+ * The brushed axis takes the command and the feed-forward straight from it,
+ * the stepper the number of microsteps it should have taken by the next
+ * state machine tick.
+ */
+typedef struct {
+   float pos;               /* rad */
+   float vel;               /* rad/s */
+   float acc;               /* rad/s^2 */
+} trajectory_point_t;
+
+typedef struct {
+   /* Set by trajectory_init_sweep(). */
+   float from;              /* rad, where the first sweep starts. */
+   float span;              /* rad, to less from. */
+   float period;            /* s, one way. */
+   float dwell;             /* s, at each end. */
+   float ramp;              /* Of period, speeding up and again slowing down, 0 for minimum jerk. */
+
+   /* Where it's got to, 0 up to 2 * (period + dwell). */
+   float t;
+} trajectory_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define TRAJECTORY_SUCCESS           0x00
+#define TRAJECTORY_ERROR_PARAMETER   0x01
+
+/* ************************************************************* */
+/* * Trajectory Functions                                      * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn uint8_t trajectory_init_sweep(trajectory_t *trj, float from, float to, float period, float dwell)
+ * @brief Sets up sweeps between from and to and goes back to the start.
+ * @param trj Trajectory.
+ * @param from Where the first sweep starts, rad.
+ * @param to Where it ends, rad.
+ * @param period Seconds for one sweep, more than 0.
+ * @param dwell Seconds stopped at each end, 0 or more.
+ * @return uint8_t Trajectory return code.
+ *
+ */
+uint8_t trajectory_init_sweep(trajectory_t *trj, float from, float to, float period, float dwell);
+
+/**
+ *
+ * @fn uint8_t trajectory_set_period(trajectory_t *trj, float period)
+ * @brief New sweep period, carrying on from the same point of the sweep.
+ *
+ * Position doesn't jump, velocity and acceleration scale with the period.
+ *
+ * @param trj Trajectory.
+ * @param period Seconds for one sweep, more than 0.
+ * @return uint8_t Trajectory return code.
+ *
+ */
+uint8_t trajectory_set_period(trajectory_t *trj, float period);
+
+/**
+ *
+ * @fn uint8_t trajectory_set_ramp(trajectory_t *trj, float ramp)
+ * @brief Cruises between ramps instead of minimum jerk.
+ *
+ * The ramps scale with the period.  Cruising speed is 1 / (1 - ramp) times
+ * the average.  trajectory_init_sweep() starts out at 0, minimum jerk.
+ *
+ * @param trj Trajectory.
+ * @param ramp Share of the period at each end, 0 up to 0.5.
+ * @return uint8_t Trajectory return code.
+ *
+ */
+uint8_t trajectory_set_ramp(trajectory_t *trj, float ramp);
+
+/**
+ *
+ * @fn void trajectory_at(const trajectory_t *trj, float t, trajectory_point_t *pt)
+ * @brief Position, velocity and acceleration t seconds after the start.
+ * @param trj Trajectory.
+ * @param t Seconds, any amount, it repeats every 2 * (period + dwell).
+ * @param pt Filled in.
+ * @return None
+ *
+ */
+void trajectory_at(const trajectory_t *trj, float t, trajectory_point_t *pt);
+
+/**
+ *
+ * @fn void trajectory_advance(trajectory_t *trj, float dt, trajectory_point_t *pt)
+ * @brief Moves on dt and returns where that is.
+ *
+ * For a loop at a fixed rate.  The first call after trajectory_init_sweep()
+ * returns dt after the start, where the axis should be one sample on.
+ *
+ * @param trj Trajectory.
+ * @param dt Seconds.
+ * @param pt Filled in.
+ * @return None
+ *
+ */
+void trajectory_advance(trajectory_t *trj, float dt, trajectory_point_t *pt);
+
+#endif
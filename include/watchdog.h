@@ -4,11 +4,144 @@
  * @date 13 JUL 2017
  * @brief Watchdog implementation in case our micro goes out to lunch...
  */
-#include "stm32f4xx_conf.h"
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include "hal.h"
 
 
 #define WATCHDOG_RESET_COUNT  0x7F
 #define WATCHDOG_WINDOW_COUNT 0x70
 
+/* ************************************************************* */
+/* * Heartbeats                                                * */
+/* ************************************************************* */
+/* watchdog_tickle() runs from the 1 kHz tilt stepper interrupt, so on its
+ * own it only proves that one timer still fires.  Anything else that can
+ * hang registers a heartbeat with a deadline in milliseconds, and the WWDG
+ * is only refreshed while every registered heartbeat has beaten within its
+ * deadline.  Miss one and the refreshes stop, the board resets about 3ms
+ * later.
+ *
+ * A heartbeat that has nothing to do (the USART with an empty queue) calls
+ * watchdog_idle() and isn't checked again until its next beat.
+ */
+#define WATCHDOG_TASK_MAIN      0     /* Main loop pass. */
+#define WATCHDOG_TASK_FDUD_TX   1     /* USART1 TX DMA chain. */
+#define WATCHDOG_TASK_RS485     2     /* RS485 state machine tick. */
+#define WATCHDOG_NUM_TASKS      3
+
+/* The main loop wakes at least every HEARTBEAT_PERIOD_US (50ms) for the
+ * green LED.  One packet is well under a millisecond at 3 MBaud.  The RS485
+ * state machine ticks at RS485_SENSOR_BUS_SM_HZ.
+ */
+#define WATCHDOG_MAIN_DEADLINE_MS     200
+#define WATCHDOG_FDUD_TX_DEADLINE_MS  50
+#define WATCHDOG_RS485_DEADLINE_MS    20
+
+/* ************************************************************* */
+/* * Reset Reason                                              * */
+/* ************************************************************* */
+/* Written just before the refreshes stop, in RAM the startup code leaves
+ * alone (NOINIT in memory_sections.h), so it's still there after the reset.
+ * The magic tells a record from whatever RAM powered up as.
+ */
+#define WATCHDOG_REASON_MAGIC   0x57444F47
+
+typedef struct {
+   uint32_t magic;
+   uint32_t task;             /* WATCHDOG_TASK_x that starved the watchdog. */
+   uint32_t deadline_ms;
+   uint32_t silent_ms;        /* Since its last heartbeat. */
+   uint32_t uptime_ms;        /* Since watchdog_init(). */
+} watchdog_reason_t;
+
+/* ************************************************************* */
+/* * Return Codes                                              * */
+/* ************************************************************* */
+#define WATCHDOG_SUCCESS           0x00
+#define WATCHDOG_ERROR_PARAMETER   0x01
+#define WATCHDOG_NO_REASON         0x02
+
+/* ************************************************************* */
+/* * Watchdog Functions                                        * */
+/* ************************************************************* */
+/* External Calls */
+
+/**
+ *
+ * @fn void watchdog_init(void)
+ * @brief Starts the WWDG, refreshed from watchdog_tickle() from then on.
+ * @param None
+ * @return None
+ *
+ */
 void watchdog_init(void);
+
+/**
+ *
+ * @fn void watchdog_tickle(void)
+ * @brief Refreshes the WWDG if every registered heartbeat is alive.
+ *
+ * Must be called once a millisecond, it's also the heartbeats' clock.  The
+ * first time one is late the reason is recorded and the WWDG is never
+ * refreshed again.
+ *
+ * @param None
+ * @return None
+ *
+ */
 void watchdog_tickle(void);
+
+/**
+ *
+ * @fn uint8_t watchdog_register(uint8_t task, uint32_t deadline_ms)
+ * @brief Starts checking a heartbeat, counting as a beat now.
+ * @param task WATCHDOG_TASK_x.
+ * @param deadline_ms Longest it may go without watchdog_heartbeat(), 1 or
+ * more.
+ * @return uint8_t Watchdog return code.
+ *
+ */
+uint8_t watchdog_register(uint8_t task, uint32_t deadline_ms);
+
+/**
+ *
+ * @fn void watchdog_heartbeat(uint8_t task)
+ * @brief The task has made progress.
+ *
+ * Safe from any interrupt or the main loop.  Does nothing for a task that
+ * isn't registered.
+ *
+ * @param task WATCHDOG_TASK_x.
+ * @return None
+ *
+ */
+void watchdog_heartbeat(uint8_t task);
+
+/**
+ *
+ * @fn void watchdog_idle(uint8_t task)
+ * @brief The task has nothing to do, stop checking it until its next beat.
+ * @param task WATCHDOG_TASK_x.
+ * @return None
+ *
+ */
+void watchdog_idle(uint8_t task);
+
+/**
+ *
+ * @fn uint8_t watchdog_last_reason(watchdog_reason_t *reason)
+ * @brief Takes the record left by a heartbeat that starved the watchdog.
+ *
+ * The record is cleared, so a later reset for some other reason doesn't
+ * report it again.
+ *
+ * @param reason Filled in if there was one.
+ * @return uint8_t WATCHDOG_SUCCESS or WATCHDOG_NO_REASON.
+ *
+ */
+uint8_t watchdog_last_reason(watchdog_reason_t *reason);
+
+#endif
@@ -0,0 +1,328 @@
+/**
+ * @file analog_input_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief analog_input.c's oversampling and smoothing fed synthetic scans.
+ *
+ * The port here only hands over the buffer, the test builds each block of
+ * ANALOG_INPUT_OVERSAMPLE scans itself and calls analog_input_filter() the
+ * way the DMA interrupt does.  Readings are rounded to the 12 bit ADC and
+ * clamped, the same as the part.  Each channel gets its own signal so a mix
+ * up between them shows.
+ *
+ * Runs:
+ *
+ *    ready     Nothing reads back before the first block, the first block
+ *              starts the filter at the input rather than at zero.
+ *    dc        DC levels across the range come back to within the rounding
+ *              of the reading, full scale reads 65520.
+ *    tone      A tone at the output rate sums to zero over a block and is
+ *              gone from the output, whatever its phase.
+ *    noise     A level between two ADC codes plus uniform noise of a few LSB
+ *              averages to better than a quarter of an LSB.
+ *    step      A step settles to 1% in the outputs the single pole needs
+ *              for ANALOG_INPUT_SMOOTH_SHIFT, no sooner and no later.
+ *
+ * analog_input_test [-s seed]
+ *
+ *    -s   Seed for the noise, 1 by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "analog_input.h"
+#include "host_test.h"
+
+#define TEST_BLOCK_LENGTH      (ANALOG_INPUT_OVERSAMPLE * ANALOG_INPUT_NUM_CHANNELS)
+#define TEST_ADC_MAX           ((1 << ANALOG_INPUT_ADC_BITS) - 1)
+
+/* One ADC code in the 16 bit output. */
+#define TEST_LSB               (ANALOG_INPUT_FULL_SCALE >> ANALOG_INPUT_ADC_BITS)
+
+/* A signal in ADC codes at scan n. */
+typedef double (*test_signal)(uint32_t n, uint8_t channel);
+
+uint16_t *test_buffer = NULL;
+uint32_t test_scan = 0;
+uint32_t test_seed = 1;
+
+/* Parameters the signals below read. */
+double test_level[ANALOG_INPUT_NUM_CHANNELS];
+double test_amplitude = 0.0;
+double test_phase = 0.0;
+double test_noise = 0.0;
+
+/* xorshift32, the same noise every run. */
+uint32_t test_random(void)
+{
+   test_seed ^= test_seed << 13;
+   test_seed ^= test_seed >> 17;
+   test_seed ^= test_seed << 5;
+   return test_seed;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void analog_input_port_init(uint16_t *buffer, uint32_t length)
+{
+   test_buffer = buffer;
+}
+
+double test_dc(uint32_t n, uint8_t channel)
+{
+   return test_level[channel];
+}
+
+double test_tone(uint32_t n, uint8_t channel)
+{
+   return test_level[channel] + test_amplitude *
+          sin((2.0 * M_PI * ANALOG_INPUT_OUTPUT_HZ * n) / ANALOG_INPUT_SCAN_HZ + test_phase + channel);
+}
+
+double test_noisy(uint32_t n, uint8_t channel)
+{
+   return test_level[channel] + test_noise * ((2.0 * (test_random() / 4294967296.0)) - 1.0);
+}
+
+/* PRIVATE test_block
+ *
+ * Notes:
+ *  +One DMA half buffer of the signal, rounded and clamped like the ADC,
+ *   through the filter.
+ */
+void test_block(test_signal signal)
+{
+   uint16_t scans[TEST_BLOCK_LENGTH];
+   double x;
+   uint32_t ii;
+   uint8_t ch;
+
+   for(ii=0; ii<ANALOG_INPUT_OVERSAMPLE; ii++)
+   {
+      for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+      {
+         x = floor(signal(test_scan, ch) + 0.5);
+         if(x < 0.0)
+         {
+            x = 0.0;
+         }
+         if(x > TEST_ADC_MAX)
+         {
+            x = TEST_ADC_MAX;
+         }
+         scans[(ii * ANALOG_INPUT_NUM_CHANNELS) + ch] = (uint16_t)x;
+      }
+      test_scan++;
+   }
+
+   analog_input_filter(scans);
+}
+
+void test_start(void)
+{
+   analog_input_filter_reset();
+   test_scan = 0;
+}
+
+void test_ready(void)
+{
+   float vc14, vc15;
+
+   analog_input_init();
+   test_check(test_buffer != NULL, "ready", "port never got the buffer", 0);
+   test_check(analog_input_read(&vc14, &vc15) == ANALOG_INPUT_ERROR_NOT_READY, "ready", "read before the first block", vc14);
+   test_check(analog_input_get(ANALOG_INPUT_NUM_CHANNELS) == 0, "ready", "bad channel read", 0);
+
+   test_start();
+   test_level[ANALOG_INPUT_VC14] = 2000;
+   test_level[ANALOG_INPUT_VC15] = 1000;
+   test_block(&test_dc);
+   test_check(analog_input_count() == 1, "ready", "output count", analog_input_count());
+   test_check(analog_input_get(ANALOG_INPUT_VC14) == (2000 * TEST_LSB), "ready", "first block didn't start at the input",
+              analog_input_get(ANALOG_INPUT_VC14));
+   test_check(analog_input_read(&vc14, &vc15) == ANALOG_INPUT_SUCCESS, "ready", "read after the first block", 0);
+   test_check(fabs(vc14 - ((2000.0 * ANALOG_INPUT_VREF) / (TEST_ADC_MAX + 1))) < 0.001, "ready", "vc14 volts", vc14);
+   test_check(fabs(vc15 - ((1000.0 * ANALOG_INPUT_VREF) / (TEST_ADC_MAX + 1))) < 0.001, "ready", "vc15 volts", vc15);
+}
+
+void test_dc_levels(void)
+{
+   double worst = 0.0;
+   double error;
+   uint32_t level;
+   uint32_t ii;
+   uint8_t ch;
+
+   for(level=0; level<=TEST_ADC_MAX; level+=91)
+   {
+      test_start();
+      test_level[ANALOG_INPUT_VC14] = level;
+      test_level[ANALOG_INPUT_VC15] = TEST_ADC_MAX - level;
+      for(ii=0; ii<8; ii++)
+      {
+         test_block(&test_dc);
+      }
+      for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+      {
+         error = fabs(analog_input_get(ch) - (test_level[ch] * TEST_LSB));
+         if(error > worst)
+         {
+            worst = error;
+         }
+      }
+   }
+   test_check(worst < 1.0, "dc", "level off by", worst);
+
+   test_start();
+   test_level[ANALOG_INPUT_VC14] = TEST_ADC_MAX;
+   test_level[ANALOG_INPUT_VC15] = TEST_ADC_MAX;
+   for(ii=0; ii<64; ii++)
+   {
+      test_block(&test_dc);
+   }
+   test_check(analog_input_get(ANALOG_INPUT_VC14) == 65520, "dc", "full scale", analog_input_get(ANALOG_INPUT_VC14));
+
+   printf("dc       worst error %.1f of 16 bit full scale\n", worst);
+}
+
+void test_tone_null(void)
+{
+   double worst = 0.0;
+   double error;
+   uint32_t ii;
+   uint8_t step;
+   uint8_t ch;
+
+   /* Each reading is rounded by up to half a code, so the block average can
+    * be off by half a code too.
+    */
+   for(step=0; step<16; step++)
+   {
+      test_start();
+      test_level[ANALOG_INPUT_VC14] = 2048;
+      test_level[ANALOG_INPUT_VC15] = 1500;
+      test_amplitude = 1200;
+      test_phase = (2.0 * M_PI * step) / 16.0;
+      for(ii=0; ii<64; ii++)
+      {
+         test_block(&test_tone);
+         for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+         {
+            error = fabs(analog_input_get(ch) - (test_level[ch] * TEST_LSB));
+            if(error > worst)
+            {
+               worst = error;
+            }
+         }
+      }
+   }
+   test_check(worst <= (TEST_LSB / 2.0), "tone", "tone left in the output", worst);
+
+   printf("tone     %d Hz at %.0f codes peak, worst error %.1f of 16 bit full scale\n",
+          ANALOG_INPUT_OUTPUT_HZ, test_amplitude, worst);
+}
+
+void test_noise_average(void)
+{
+   double sum = 0.0;
+   double mean_error;
+   uint32_t outputs = 0;
+   uint32_t ii;
+
+   test_start();
+   test_level[ANALOG_INPUT_VC14] = 1000.3;
+   test_level[ANALOG_INPUT_VC15] = 3000.7;
+   test_noise = 3.0;
+   for(ii=0; ii<4096; ii++)
+   {
+      test_block(&test_noisy);
+      if(ii >= 64)
+      {
+         sum += analog_input_get(ANALOG_INPUT_VC14);
+         outputs++;
+      }
+   }
+
+   mean_error = ((sum / outputs) - (test_level[ANALOG_INPUT_VC14] * TEST_LSB)) / TEST_LSB;
+   test_check(fabs(mean_error) < 0.25, "noise", "mean off by LSB", mean_error);
+
+   printf("noise    %.1f codes +/-%.0f LSB uniform, mean off by %.3f LSB\n",
+          test_level[ANALOG_INPUT_VC14], test_noise, mean_error);
+}
+
+void test_step(void)
+{
+   double remaining;
+   uint32_t expected;
+   uint32_t settled = 0;
+   uint32_t ii;
+
+   /* Outputs for (1 - 2^-shift)^n to get under 1%. */
+   expected = 1;
+   for(remaining = 1.0 - (1.0 / (1 << ANALOG_INPUT_SMOOTH_SHIFT)); remaining > 0.01;
+       remaining *= 1.0 - (1.0 / (1 << ANALOG_INPUT_SMOOTH_SHIFT)))
+   {
+      expected++;
+   }
+
+   test_start();
+   test_level[ANALOG_INPUT_VC14] = 1000;
+   test_level[ANALOG_INPUT_VC15] = 1000;
+   test_block(&test_dc);
+
+   test_level[ANALOG_INPUT_VC14] = 3000;
+   for(ii=1; ii<=200; ii++)
+   {
+      test_block(&test_dc);
+      if((settled == 0)&&(fabs(analog_input_get(ANALOG_INPUT_VC14) - (3000.0 * TEST_LSB)) <= (0.01 * 2000.0 * TEST_LSB)))
+      {
+         settled = ii;
+      }
+   }
+
+   test_check((settled + 1 >= expected)&&(settled <= expected + 1), "step", "outputs to settle to 1%", settled);
+   test_check(analog_input_get(ANALOG_INPUT_VC15) == (1000 * TEST_LSB), "step", "other channel moved",
+              analog_input_get(ANALOG_INPUT_VC15));
+
+   printf("step     settles to 1%% in %u outputs (%.1f ms), %u expected\n",
+          settled, (1000.0 * settled) / ANALOG_INPUT_OUTPUT_HZ, expected);
+}
+
+int main(int argc, char *argv[])
+{
+   int opt;
+
+   while((opt = getopt(argc, argv, "s:")) != -1)
+   {
+      switch(opt)
+      {
+         case 's':
+            test_seed = (uint32_t)strtoul(optarg, NULL, 0);
+            if(test_seed == 0)
+            {
+               test_seed = 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-s seed]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   printf("%d Hz scans, %dx oversampled to %d Hz, smoothing shift %d\n\n",
+          ANALOG_INPUT_SCAN_HZ, ANALOG_INPUT_OVERSAMPLE, ANALOG_INPUT_OUTPUT_HZ, ANALOG_INPUT_SMOOTH_SHIFT);
+
+   test_ready();
+   test_dc_levels();
+   test_tone_null();
+   test_noise_average();
+   test_step();
+
+   return test_summary();
+}
@@ -0,0 +1,421 @@
+/**
+ * @file analog_telemetry_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief analog_telemetry.c's windows and alerts on a made up supply trace.
+ *
+ * VC14 is a 2.2 V rail that sags 0.5 V for 5 ms and takes 15 ms to recover,
+ * every 300 ms, with uniform noise of a few LSB on every reading.  VC15 is a
+ * steady 1.2 V with a high threshold it never reaches.  Readings are rounded
+ * and clamped like the ADC and go to analog_telemetry_block() a block at a
+ * time the way the DMA interrupt hands them over.  The main loop is the test
+ * taking the alerts after every block, except for the last sag where it only
+ * looks once the sag is over.
+ *
+ * Checks:
+ *
+ *    Each sag trips exactly once, on the first block whose noiseless mean is
+ *    below the threshold, and clears once, on the first block back
+ *    ANALOG_TELEMETRY_HYSTERESIS inside it give or take one for the noise.
+ *    The clear carries the depth of the sag and how many blocks it lasted.
+ *    The sag the test doesn't watch shows up as a clear only.
+ *
+ *    Every window's min, max, mean and RMS match the readings that went into
+ *    it, its alert flag is set only when a sag fell inside it, and the window
+ *    events and numbers have no gaps.
+ *
+ * analog_telemetry_test [-s seed] [-d depth]
+ *
+ *    -s   Seed for the noise, 1 by default.
+ *    -d   Depth of the sag in volts, 0.5 by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "analog_telemetry.h"
+#include "event_scheduler.h"
+#include "host_test.h"
+
+#define TEST_BLOCK_LENGTH      (ANALOG_INPUT_OVERSAMPLE * ANALOG_INPUT_NUM_CHANNELS)
+#define TEST_ADC_MAX           ((1 << ANALOG_INPUT_ADC_BITS) - 1)
+#define TEST_SCALE_SHIFT       (16 - ANALOG_INPUT_ADC_BITS)
+
+/* The trace, in milliseconds and volts. */
+#define TEST_RAIL              2.2
+#define TEST_BATTERY           1.2
+#define TEST_SAG_START_MS      50.3
+#define TEST_SAG_PERIOD_MS     300.0
+#define TEST_SAG_MS            5.0
+#define TEST_RECOVERY_MS       15.0
+#define TEST_NOISE_LSB         3.0
+#define TEST_SAGS              10
+
+/* Thresholds, in volts. */
+#define TEST_LOW               1.9
+#define TEST_HIGH              1.3
+
+#define TEST_BLOCKS            ((uint32_t)(((TEST_SAG_START_MS + (TEST_SAGS * TEST_SAG_PERIOD_MS)) * ANALOG_INPUT_OUTPUT_HZ) / 1000))
+
+/* Host side of the totals, raw readings like the interrupt keeps. */
+typedef struct {
+   uint32_t sum;
+   double sum_squares;
+   uint32_t samples;
+   uint16_t min;
+   uint16_t max;
+   uint8_t sag;
+} test_totals_t;
+
+uint32_t test_seed = 1;
+double test_depth = 0.5;
+
+uint32_t test_alert_events = 0;
+uint32_t test_window_events = 0;
+
+/* xorshift32, the same noise every run. */
+uint32_t test_random(void)
+{
+   test_seed ^= test_seed << 13;
+   test_seed ^= test_seed >> 17;
+   test_seed ^= test_seed << 5;
+   return test_seed;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void event_post(uint32_t events)
+{
+   if(events & EVENT_ANALOG_ALERT)
+   {
+      test_alert_events++;
+   }
+   if(events & EVENT_ANALOG_WINDOW)
+   {
+      test_window_events++;
+   }
+}
+
+void test_check_block(uint8_t ok, uint32_t block, const char *what, double detail)
+{
+   char run[16];
+
+   snprintf(run, sizeof(run), "block %u", block);
+   test_check(ok, run, what, detail);
+}
+
+uint16_t test_fraction(double volts)
+{
+   return (uint16_t)((volts * ANALOG_INPUT_FULL_SCALE) / ANALOG_INPUT_VREF);
+}
+
+/* PRIVATE test_rail
+ *
+ * Notes:
+ *  +The supply at scan n, without noise.  Drops straight to the bottom of
+ *   the sag, holds and ramps back up.
+ */
+double test_rail(uint32_t n, uint8_t *sagging)
+{
+   double t_ms = (1000.0 * n) / ANALOG_INPUT_SCAN_HZ;
+   double phase;
+
+   *sagging = 0;
+   if(t_ms < TEST_SAG_START_MS)
+   {
+      return TEST_RAIL;
+   }
+
+   phase = fmod(t_ms - TEST_SAG_START_MS, TEST_SAG_PERIOD_MS);
+   if(phase >= TEST_SAG_MS + TEST_RECOVERY_MS)
+   {
+      return TEST_RAIL;
+   }
+
+   *sagging = 1;
+   if(phase < TEST_SAG_MS)
+   {
+      return TEST_RAIL - test_depth;
+   }
+
+   return TEST_RAIL - (test_depth * (1.0 - ((phase - TEST_SAG_MS) / TEST_RECOVERY_MS)));
+}
+
+uint16_t test_reading(double volts)
+{
+   double x;
+
+   x = (volts * (TEST_ADC_MAX + 1)) / ANALOG_INPUT_VREF;
+   x += TEST_NOISE_LSB * ((2.0 * (test_random() / 4294967296.0)) - 1.0);
+   x = floor(x + 0.5);
+   if(x < 0.0)
+   {
+      x = 0.0;
+   }
+   if(x > TEST_ADC_MAX)
+   {
+      x = TEST_ADC_MAX;
+   }
+
+   return (uint16_t)x;
+}
+
+void test_totals_clear(test_totals_t *totals)
+{
+   memset(totals, 0, sizeof(test_totals_t));
+   totals->min = 0xFFFF;
+}
+
+/* PRIVATE test_window_check
+ *
+ * Notes:
+ *  +The latched window against what the test put in it.
+ */
+void test_window_check(uint32_t block, uint8_t channel, const test_totals_t *totals, uint32_t number)
+{
+   analog_telemetry_window_t window;
+   uint16_t mean;
+   double rms;
+
+   if(analog_telemetry_window(channel, &window) != ANALOG_TELEMETRY_SUCCESS)
+   {
+      test_check_block(0, block, "no window after the window event", channel);
+      return;
+   }
+
+   mean = (uint16_t)(((uint64_t)totals->sum << TEST_SCALE_SHIFT) / totals->samples);
+   rms = sqrt(totals->sum_squares / totals->samples) * (1 << TEST_SCALE_SHIFT);
+
+   test_check_block(window.number == number, block, "window number", window.number);
+   test_check_block(window.samples == totals->samples, block, "window samples", window.samples);
+   test_check_block(window.min == (totals->min << TEST_SCALE_SHIFT), block, "window min", window.min);
+   test_check_block(window.max == (totals->max << TEST_SCALE_SHIFT), block, "window max", window.max);
+   test_check_block(window.mean == mean, block, "window mean", window.mean);
+   test_check_block(fabs(window.rms - rms) <= 1.0, block, "window rms", window.rms - rms);
+   test_check_block((window.alert != 0) == (totals->sag != 0), block, "window alert flag", window.alert);
+}
+
+void test_api(void)
+{
+   analog_telemetry_window_t window;
+   analog_telemetry_alert_t alert;
+
+   analog_telemetry_init();
+
+   test_check_block(analog_telemetry_set_window(0) == ANALOG_TELEMETRY_ERROR_WINDOW, 0, "zero window accepted", 0);
+   test_check_block(analog_telemetry_set_window(ANALOG_TELEMETRY_MAX_WINDOW_MS + 1) == ANALOG_TELEMETRY_ERROR_WINDOW, 0,
+                    "window past the maximum accepted", 0);
+   test_check_block(analog_telemetry_set_alert(ANALOG_INPUT_NUM_CHANNELS, 0, 0xFFFF) == ANALOG_TELEMETRY_ERROR_CHANNEL, 0,
+                    "bad channel alert accepted", 0);
+   test_check_block(analog_telemetry_window(ANALOG_INPUT_VC14, &window) == ANALOG_TELEMETRY_ERROR_NOT_READY, 0,
+                    "window before the first one", 0);
+   test_check_block(analog_telemetry_alert(ANALOG_INPUT_VC14, &alert) == ANALOG_TELEMETRY_ERROR_NOT_READY, 0,
+                    "alert before any change", 0);
+}
+
+int main(int argc, char *argv[])
+{
+   uint16_t scans[TEST_BLOCK_LENGTH];
+   test_totals_t totals[ANALOG_INPUT_NUM_CHANNELS];
+   analog_telemetry_alert_t alert;
+   uint16_t low, clear_at;
+   uint32_t noiseless;
+   uint32_t n = 0;
+   uint32_t block, ii;
+   uint32_t windows = 0;
+   uint32_t window_events = 0;
+   uint32_t window_blocks = 0;
+   uint32_t expected_trip = 0;
+   uint32_t expected_clear = 0;
+   uint32_t trip_block = 0;
+   uint32_t trips = 0;
+   uint32_t clears = 0;
+   uint32_t min_blocks = 0xFFFFFFFF;
+   uint32_t max_blocks = 0;
+   uint8_t in_sag = 0;
+   uint8_t watching;
+   uint8_t sagging, any_sagging;
+   double volts;
+   double depth = 0.0;
+   int opt;
+   uint8_t ch;
+
+   while((opt = getopt(argc, argv, "s:d:")) != -1)
+   {
+      switch(opt)
+      {
+         case 's':
+            test_seed = (uint32_t)strtoul(optarg, NULL, 0);
+            if(test_seed == 0)
+            {
+               test_seed = 1;
+            }
+            break;
+         case 'd':
+            test_depth = atof(optarg);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-s seed] [-d depth]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   if((test_depth <= TEST_RAIL - TEST_LOW)||(test_depth >= TEST_RAIL))
+   {
+      fprintf(stderr, "depth has to take the rail below %.2f V and stay above 0 V\n", TEST_LOW);
+      return 1;
+   }
+
+   test_api();
+
+   low = test_fraction(TEST_LOW);
+   clear_at = low + ANALOG_TELEMETRY_HYSTERESIS;
+   analog_telemetry_set_alert(ANALOG_INPUT_VC14, low, 0xFFFF);
+   analog_telemetry_set_alert(ANALOG_INPUT_VC15, 0, test_fraction(TEST_HIGH));
+
+   printf("%.2f V rail, %.2f V sag for %.0f ms, %.0f ms recovery, every %.0f ms, +/-%.0f LSB noise\n",
+          TEST_RAIL, test_depth, TEST_SAG_MS, TEST_RECOVERY_MS, TEST_SAG_PERIOD_MS, TEST_NOISE_LSB);
+   printf("low threshold %.3f V, clears at %.3f V, %d ms windows\n\n",
+          TEST_LOW, (clear_at * ANALOG_INPUT_VREF) / ANALOG_INPUT_FULL_SCALE, ANALOG_TELEMETRY_WINDOW_MS);
+   printf("sag  trip block  clear block  blocks   depth V\n");
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      test_totals_clear(&(totals[ch]));
+   }
+
+   for(block=0; block<TEST_BLOCKS; block++)
+   {
+      noiseless = 0;
+      any_sagging = 0;
+      for(ii=0; ii<ANALOG_INPUT_OVERSAMPLE; ii++)
+      {
+         volts = test_rail(n, &sagging);
+         any_sagging |= sagging;
+         noiseless += (uint32_t)((volts * (TEST_ADC_MAX + 1)) / ANALOG_INPUT_VREF + 0.5);
+
+         scans[(ii * ANALOG_INPUT_NUM_CHANNELS) + ANALOG_INPUT_VC14] = test_reading(volts);
+         scans[(ii * ANALOG_INPUT_NUM_CHANNELS) + ANALOG_INPUT_VC15] = test_reading(TEST_BATTERY);
+         n++;
+
+         for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+         {
+            uint16_t x = scans[(ii * ANALOG_INPUT_NUM_CHANNELS) + ch];
+
+            totals[ch].sum += x;
+            totals[ch].sum_squares += (double)x * x;
+            totals[ch].samples++;
+            if(x < totals[ch].min)
+            {
+               totals[ch].min = x;
+            }
+            if(x > totals[ch].max)
+            {
+               totals[ch].max = x;
+            }
+         }
+      }
+      noiseless <<= TEST_SCALE_SHIFT;
+      noiseless >>= ANALOG_INPUT_OVERSAMPLE_SHIFT;
+
+      analog_telemetry_block(scans);
+
+      /* Where the block without noise says the alert should be. */
+      if((in_sag == 0)&&(noiseless < low))
+      {
+         in_sag = 1;
+         expected_trip = block;
+      }
+      else if((in_sag != 0)&&(noiseless >= clear_at))
+      {
+         in_sag = 0;
+         expected_clear = block;
+      }
+      if(in_sag)
+      {
+         totals[ANALOG_INPUT_VC14].sag = 1;
+      }
+
+      /* The main loop misses the whole of the last sag. */
+      watching = (block < (uint32_t)(((TEST_SAG_START_MS + ((TEST_SAGS - 1) * TEST_SAG_PERIOD_MS)) * ANALOG_INPUT_OUTPUT_HZ) / 1000)) ||
+                 ((in_sag == 0)&&(any_sagging == 0));
+
+      if((watching)&&(analog_telemetry_alert(ANALOG_INPUT_VC14, &alert) == ANALOG_TELEMETRY_SUCCESS))
+      {
+         if(alert.state == ANALOG_TELEMETRY_ALERT_LOW)
+         {
+            trips++;
+            trip_block = block;
+            test_check_block(block == expected_trip, block, "tripped on the wrong block", expected_trip);
+            test_check_block(alert.value < low, block, "trip value above the threshold", alert.value);
+            test_check_block(alert.blocks == 0, block, "blocks while still active", alert.blocks);
+         }
+         else if((alert.state == ANALOG_TELEMETRY_ALERT_NONE)&&(alert.previous == ANALOG_TELEMETRY_ALERT_LOW))
+         {
+            clears++;
+            if(trips < clears)
+            {
+               /* The one the main loop never saw trip, it only gets the
+                * clear and that blocks after the fact.
+                */
+               trip_block = expected_trip;
+               trips++;
+            }
+            else
+            {
+               test_check_block(block == trip_block + alert.blocks, block, "blocks don't match the trip", alert.blocks);
+            }
+            test_check_block(alert.count == trips, block, "alert count", alert.count);
+            test_check_block((trip_block + alert.blocks + 1 >= expected_clear)&&(trip_block + alert.blocks <= expected_clear + 1),
+                             block, "cleared on the wrong block", expected_clear);
+
+            depth = (alert.value * ANALOG_INPUT_VREF) / ANALOG_INPUT_FULL_SCALE;
+            test_check_block(fabs(depth - (TEST_RAIL - test_depth)) < 0.005, block, "sag depth", depth);
+
+            if(alert.blocks < min_blocks)
+            {
+               min_blocks = alert.blocks;
+            }
+            if(alert.blocks > max_blocks)
+            {
+               max_blocks = alert.blocks;
+            }
+            printf("%3u  %10u  %11u  %6u  %8.3f\n", clears, trip_block, block, alert.blocks, depth);
+         }
+         else
+         {
+            test_check_block(0, block, "unexpected alert state", alert.state);
+         }
+      }
+
+      test_check_block(analog_telemetry_alert(ANALOG_INPUT_VC15, &alert) == ANALOG_TELEMETRY_ERROR_NOT_READY, block,
+                       "battery alerted", alert.state);
+
+      window_blocks++;
+      if(window_blocks >= (ANALOG_TELEMETRY_WINDOW_MS * ANALOG_INPUT_OUTPUT_HZ) / 1000)
+      {
+         windows++;
+         window_events++;
+         for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+         {
+            test_window_check(block, ch, &(totals[ch]), windows);
+            test_totals_clear(&(totals[ch]));
+         }
+         window_blocks = 0;
+      }
+   }
+
+   test_check_block(trips == TEST_SAGS, block, "trips", trips);
+   test_check_block(clears == TEST_SAGS, block, "clears", clears);
+   test_check_block(test_alert_events == (2 * TEST_SAGS), block, "alert events", test_alert_events);
+   test_check_block(test_window_events == window_events, block, "window events", test_window_events);
+
+   printf("\n%u blocks, %u windows, %u alert events, sags lasted %u to %u blocks\n",
+          TEST_BLOCKS, windows, test_alert_events, min_blocks, max_blocks);
+   return test_summary();
+}
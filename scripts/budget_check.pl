@@ -0,0 +1,395 @@
+#!/usr/bin/perl
+# Checks the build against its memory budgets.  From the map file, per module
+# .text/.rodata/.data/.bss and the fill of FLASH, RAM and CCMRAM.  From the
+# -fstack-usage files and the disassembly, the worst case stack: the deepest
+# call chain from Reset_Handler plus the deepest interrupt handlers nested on
+# top of it, one per preemption level.  Exits 1 if anything is over budget so
+# the build stops there.
+#
+# Calls through function pointers can't be followed in the disassembly.  Any
+# function whose address turns up in a literal pool is taken to be reachable
+# from every indirect call, which overestimates, but never under.
+#
+# Usage ./budget_check.pl main.map main.dis obj [options] [-v]
+#   main.dis      objdump -D -j .text -j .data -j .ramfunc main.elf
+#   obj           directory with the .su files
+#   --flash=N     FLASH budget in bytes, default the FLASH region
+#   --ram=N       RAM budget, default RAM less the heap and stack reservations
+#   --ccm=N       CCMRAM budget, default the CCMRAM region
+#   --stack=N     stack budget, default _Min_Stack_Size
+#   --levels=N    interrupt preemption levels that can nest, default 3
+#   -v            also list every function reached and its worst case
+use strict;
+use warnings;
+use File::Basename;
+
+# Registers pushed on exception entry with the FPU context, plus the word
+# the core may skip to keep the stack 8 byte aligned.
+my $EXCEPTION_FRAME = 108;
+
+my %budget;
+my $levels = 3;
+my $verbose = 0;
+my @files;
+foreach my $arg (@ARGV) {
+    if($arg =~ /^--(flash|ram|ccm|stack)=(\d+|0x[0-9a-fA-F]+)$/) {
+        my ($key, $value) = ($1, $2);
+        $budget{$key} = ($value =~ /^0x/) ? hex($value) : $value;
+    }
+    elsif($arg =~ /^--levels=(\d+)$/) {
+        $levels = $1;
+    }
+    elsif($arg eq '-v') {
+        $verbose = 1;
+    }
+    else {
+        push(@files, $arg);
+    }
+}
+if($#files != 2) {
+    die("Usage ./budget_check.pl [main.map] [main.dis] [obj dir] [--flash=N] [--ram=N] [--ccm=N] [--stack=N] [--levels=N] [-v]\n");
+}
+my ($map_file, $dis_file, $obj_dir) = @files;
+
+my $over = 0;
+
+# ************************************************************* #
+# Map file
+# ************************************************************* #
+my %regions;      # name -> [origin, length]
+my @region_order;
+my %modules;      # module -> {text, rodata, data, bss}
+my %used = (FLASH => 0, RAM => 0, CCMRAM => 0);
+my %symbols;      # linker script assignments, _Min_Stack_Size and friends
+my $in_memory_config = 0;
+my $in_map = 0;
+my $out_section = '';
+my $pending_input = '';
+
+sub region_of {
+    my ($addr) = @_;
+    foreach my $name (@region_order) {
+        my ($origin, $length) = @{$regions{$name}};
+        if(($addr >= $origin) && ($addr < ($origin + $length))) {
+            return $name;
+        }
+    }
+    return '';
+}
+
+# obj/main.o -> main, libfoo.a(bar.o) -> bar
+sub module_of {
+    my ($file) = @_;
+    if($file =~ /\(([^)]+)\)\s*$/) {
+        $file = $1;
+    }
+    my $module = basename($file);
+    $module =~ s/\.o$//;
+    return $module;
+}
+
+sub add_input {
+    my ($in_section, $addr, $size, $file) = @_;
+    return if($size == 0);
+
+    my $region = region_of($addr);
+    return if($region eq '');
+
+    my $module = module_of($file);
+    $modules{$module} ||= {text => 0, rodata => 0, data => 0, bss => 0};
+
+    my $kind = 'rodata';
+    if($in_section =~ /^\.(text|ramfunc|glue|vfp11|v4_bx|iplt)/) {
+        $kind = 'text';
+    }
+    elsif($in_section =~ /^\.(bss|ccmbss)|^COMMON$/) {
+        $kind = 'bss';
+    }
+    elsif(($in_section =~ /^\.data/) || ($out_section =~ /^\.(data|ccmram)$/)) {
+        $kind = 'data';
+    }
+    $modules{$module}{$kind} += $size;
+
+    if(exists($used{$region})) {
+        $used{$region} += $size;
+    }
+    # Initialized RAM and CCM are loaded from a copy in flash.
+    if($out_section =~ /^\.(data|ramfunc|ccmram)$/) {
+        $used{FLASH} += $size;
+    }
+}
+
+open(my $map, '<', $map_file) or die("Can't open $map_file: $!\n");
+while(my $line = <$map>) {
+    chomp($line);
+
+    if($line =~ /^Memory Configuration/) {
+        $in_memory_config = 1;
+        next;
+    }
+    if($line =~ /^Linker script and memory map/) {
+        $in_memory_config = 0;
+        $in_map = 1;
+        next;
+    }
+
+    if($in_memory_config) {
+        if(($line =~ /^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)/) && ($1 ne '*default*')) {
+            $regions{$1} = [hex($2), hex($3)];
+            push(@region_order, $1);
+        }
+        next;
+    }
+
+    next unless($in_map);
+
+    if($line =~ /^\s+0x([0-9a-fA-F]+)\s+(_Min_\w+|_sstack|_estack)\s*=/) {
+        $symbols{$2} = hex($1);
+        next;
+    }
+
+    if($line =~ /^(\.\S+)/) {
+        $out_section = $1;
+        $pending_input = '';
+        next;
+    }
+
+    if($line =~ /^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$/) {
+        add_input($1, hex($2), hex($3), $4);
+        $pending_input = '';
+        next;
+    }
+
+    if($line =~ /^ (\.\S+|COMMON)\s*$/) {
+        $pending_input = $1;
+        next;
+    }
+    if(($pending_input ne '') && ($line =~ /^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$/)) {
+        add_input($pending_input, hex($1), hex($2), $3);
+        $pending_input = '';
+        next;
+    }
+    $pending_input = '';
+}
+close($map);
+
+die("No memory map found in $map_file\n") unless(@region_order);
+die("No _Min_Stack_Size in $map_file\n") unless(exists($symbols{_Min_Stack_Size}));
+
+$budget{flash} = $regions{FLASH}[1] unless(exists($budget{flash}));
+$budget{ram} = $regions{RAM}[1] - ($symbols{_Min_Heap_Size} || 0) - $symbols{_Min_Stack_Size} unless(exists($budget{ram}));
+$budget{ccm} = $regions{CCMRAM}[1] unless(exists($budget{ccm}));
+$budget{stack} = $symbols{_Min_Stack_Size} unless(exists($budget{stack}));
+
+printf("\n%-32s %10s %10s %10s %10s\n", 'module', 'text', 'rodata', 'data', 'bss');
+my %total = (text => 0, rodata => 0, data => 0, bss => 0);
+foreach my $module (sort { $modules{$b}{text} + $modules{$b}{rodata} + $modules{$b}{data} + $modules{$b}{bss} <=>
+                           $modules{$a}{text} + $modules{$a}{rodata} + $modules{$a}{data} + $modules{$a}{bss} } keys(%modules)) {
+    my $m = $modules{$module};
+    printf("%-32s %10d %10d %10d %10d\n", $module, $m->{text}, $m->{rodata}, $m->{data}, $m->{bss});
+    foreach my $key (keys(%total)) {
+        $total{$key} += $m->{$key};
+    }
+}
+printf("%-32s %10d %10d %10d %10d\n", 'total', $total{text}, $total{rodata}, $total{data}, $total{bss});
+
+print("\nRegions:\n");
+foreach my $check (['FLASH', 'flash'], ['RAM', 'ram'], ['CCMRAM', 'ccm']) {
+    my ($name, $key) = @{$check};
+    my $result = ($used{$name} > $budget{$key}) ? 'OVER' : 'ok';
+    $over = 1 if($result eq 'OVER');
+    printf("  %-10s %8d of %8d bytes (%5.1f%%) %s\n", $name, $used{$name}, $budget{$key},
+           ($budget{$key} > 0) ? (100.0 * $used{$name} / $budget{$key}) : 0.0, $result);
+}
+
+# ************************************************************* #
+# Stack usage
+# ************************************************************* #
+my %frame;        # function -> bytes
+my %dynamic;      # function -> 1 if its frame depends on arguments
+foreach my $su (glob("$obj_dir/*.su")) {
+    open(my $fh, '<', $su) or die("Can't open $su: $!\n");
+    while(my $line = <$fh>) {
+        chomp($line);
+        # src/foo.c:12:6:foo_function	24	static
+        next unless($line =~ /:([^:\s]+)\t(\d+)\t(\S+)/);
+        my ($name, $bytes, $qualifier) = ($1, $2, $3);
+        # Static functions with the same name in two modules get the bigger
+        # frame, the call graph can't tell them apart either.
+        if(!exists($frame{$name}) || ($bytes > $frame{$name})) {
+            $frame{$name} = $bytes;
+        }
+        if(($qualifier =~ /dynamic/) && ($qualifier !~ /bounded/)) {
+            $dynamic{$name} = 1;
+        }
+    }
+    close($fh);
+}
+die("No .su files in $obj_dir, is -fstack-usage in CFLAGS?\n") unless(%frame);
+
+my %calls;        # function -> {callee => 1}
+my %indirect;     # functions that call through a pointer
+my %address_of;   # function -> address
+my %words;        # literal pool values
+my $function = '';
+open(my $dis, '<', $dis_file) or die("Can't open $dis_file: $!\n");
+while(my $line = <$dis>) {
+    chomp($line);
+
+    if($line =~ /^([0-9a-fA-F]+) <([^>]+)>:/) {
+        $function = $2;
+        $address_of{$function} = hex($1);
+        $calls{$function} ||= {};
+        # __foo_veneer just jumps on to foo.
+        if($function =~ /^__(\w+)_veneer$/) {
+            $calls{$function}{$1} = 1;
+        }
+        next;
+    }
+    next if($function eq '');
+
+    next unless($line =~ /^\s+[0-9a-fA-F]+:\s+[0-9a-fA-F ]+\t(\S+)\s*(.*)$/);
+    my ($op, $args) = ($1, $2);
+
+    if($op =~ /^b(l|lx)?(eq|ne|cs|cc|hs|lo|mi|pl|vs|vc|hi|ls|ge|lt|gt|le)?(\.w|\.n)?$/) {
+        # Branches inside the function show up as <function+0x..>.
+        if(($args =~ /^[0-9a-fA-F]+ <([^>+]+)>/) && ($1 ne $function)) {
+            $calls{$function}{$1} = 1;
+        }
+        elsif($args =~ /^r\d+\b/) {
+            $indirect{$function} = 1;
+        }
+    }
+    elsif(($op =~ /^bx/) && ($args =~ /^r\d+\b/)) {
+        $indirect{$function} = 1;
+    }
+    elsif($op eq '.word') {
+        if($args =~ /^0x([0-9a-fA-F]+)/) {
+            $words{hex($1)} = 1;
+        }
+    }
+}
+close($dis);
+
+# Thumb function pointers have bit 0 set.  Only functions with a .su entry
+# count, which keeps out data that happens to be disassembled from .data.
+my %by_address = map { $address_of{$_} => $_ } grep { exists($frame{$_}) } keys(%address_of);
+my @pointed_to = sort(grep { defined } map { ($_ & 1) ? $by_address{$_ & ~1} : undef } keys(%words));
+foreach my $caller (keys(%indirect)) {
+    foreach my $callee (@pointed_to) {
+        $calls{$caller}{$callee} = 1 unless($callee eq $caller);
+    }
+}
+
+my %worst;        # function -> worst case bytes including callees
+my %deepest;      # function -> callee on the worst case path
+my %active;
+my %recursive;
+my %no_frame;
+
+sub worst_case {
+    my ($name) = @_;
+    return $worst{$name} if(exists($worst{$name}));
+    if($active{$name}) {
+        # Recursion, counted once.
+        $recursive{$name} = 1;
+        return 0;
+    }
+    $active{$name} = 1;
+
+    my $own = $frame{$name};
+    if(!defined($own)) {
+        # Library and assembly code, no .su.  Small, but unknown.
+        $no_frame{$name} = 1 unless($name =~ /_veneer$/);
+        $own = 0;
+    }
+
+    my $max = 0;
+    foreach my $callee (sort(keys(%{$calls{$name} || {}}))) {
+        my $bytes = worst_case($callee);
+        if($bytes > $max) {
+            $max = $bytes;
+            $deepest{$name} = $callee;
+        }
+    }
+
+    delete($active{$name});
+    $worst{$name} = $own + $max;
+    return $worst{$name};
+}
+
+sub chain {
+    my ($name) = @_;
+    my @path = ($name);
+    my %seen = ($name => 1);
+    while(exists($deepest{$path[-1]}) && !$seen{$deepest{$path[-1]}}) {
+        push(@path, $deepest{$path[-1]});
+        $seen{$path[-1]} = 1;
+    }
+    return join(' -> ', @path);
+}
+
+my $thread = exists($address_of{Reset_Handler}) ? 'Reset_Handler' : 'main';
+die("No $thread in $dis_file\n") unless(exists($address_of{$thread}));
+my $thread_bytes = worst_case($thread);
+
+my @handlers = grep { /_(IRQ)?Handler$/ && ($_ ne 'Reset_Handler') && ($_ ne 'Default_Handler') } keys(%address_of);
+foreach my $handler (@handlers) {
+    worst_case($handler);
+}
+@handlers = sort { $worst{$b} <=> $worst{$a} } @handlers;
+
+print("\nStack:\n");
+printf("  %-24s %6d  %s\n", $thread, $thread_bytes, chain($thread));
+my $total_stack = $thread_bytes;
+my $nested = 0;
+foreach my $handler (@handlers) {
+    my $bytes = $worst{$handler} + $EXCEPTION_FRAME;
+    my $note = '';
+    if($nested < $levels) {
+        $total_stack += $bytes;
+        $nested++;
+        $note = ' (nested)';
+    }
+    printf("  %-24s %6d  %s%s\n", $handler, $bytes, chain($handler), $note);
+}
+my $result = ($total_stack > $budget{stack}) ? 'OVER' : 'ok';
+$over = 1 if($result eq 'OVER');
+printf("\n  worst case %d of %d bytes (%5.1f%%) %s, %s plus the %d deepest handlers\n",
+       $total_stack, $budget{stack}, 100.0 * $total_stack / $budget{stack}, $result, $thread, $nested);
+
+print("\nLargest frames:\n");
+my @largest = sort { $frame{$b} <=> $frame{$a} } keys(%frame);
+foreach my $name (@largest[0 .. (($#largest < 9) ? $#largest : 9)]) {
+    printf("  %-32s %6d%s%s\n", $name, $frame{$name},
+           $dynamic{$name} ? ' dynamic' : '', exists($worst{$name}) ? '' : ' (not reached)');
+}
+
+if(%indirect) {
+    printf("\nIndirect calls in %d functions, each taken to reach any of %d functions used as pointers.\n",
+           scalar(keys(%indirect)), scalar(@pointed_to));
+}
+my @dynamic_reached = sort(grep { exists($worst{$_}) } keys(%dynamic));
+if(@dynamic_reached) {
+    print("\nFrames that depend on their arguments, only the fixed part counted:\n  @dynamic_reached\n");
+}
+if(%recursive) {
+    print("\nRecursion, counted once:\n  " . join(' ', sort(keys(%recursive))) . "\n");
+}
+if(%no_frame) {
+    printf("\n%d functions reached without stack usage (library or assembly), counted as 0.\n", scalar(keys(%no_frame)));
+    print("  " . join(' ', sort(keys(%no_frame))) . "\n") if($verbose);
+}
+
+if($verbose) {
+    print("\nReached:\n");
+    foreach my $name (sort { $worst{$b} <=> $worst{$a} } keys(%worst)) {
+        printf("  %-32s %6d %6d\n", $name, defined($frame{$name}) ? $frame{$name} : 0, $worst{$name});
+    }
+}
+print("\n");
+
+if($over) {
+    print("Over budget.\n");
+    exit(1);
+}
@@ -0,0 +1,411 @@
+/**
+ * @file crash_decode.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Host side decoder for the UNIVERSAL_CRASH dump sent after a fault.
+ *
+ * Reads the raw byte stream from the board on stdin, puts the dump back
+ * together from its chunks and prints it with every code address run through
+ * addr2line against the ELF that was flashed, for example
+ *
+ *    stty -F /dev/ttyUSB0 raw 115200; ./crash_decode -e main.elf < /dev/ttyUSB0
+ *
+ * crash_decode [-e elf] [-a addr2line] [-m core_mhz]
+ *
+ *    -e   ELF to symbolize against, main.elf by default.
+ *    -a   addr2line to run, arm-none-eabi-addr2line by default.
+ *    -m   SystemCoreClock in MHz for the trace timeline, 168 by default.
+ *
+ * Without the ELF or addr2line it still prints everything, just as numbers.
+ * The stack excerpt is raw words, anything in flash is symbolized but not
+ * every one of them is a return address.  Build with "make crash_decode".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "generic_packet.h"
+#include "gp_circular_buffer.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+#define CRASH_DECODE_QUEUE_SIZE    4
+
+/* crash_dump.h pulls in the STM32 headers, so this is a copy of crash_dump_t
+ * as word offsets.  Keep it in sync.
+ */
+#define CRASH_DUMP_MAGIC           0x43524153
+#define CRASH_DUMP_STACK_WORDS     32
+#define CRASH_DUMP_TRACE_RECORDS   32
+
+#define CD_MAGIC         0
+#define CD_LENGTH        1
+#define CD_FAULT         2
+#define CD_FLAGS         3
+#define CD_EXC_RETURN    4
+#define CD_MS            5
+#define CD_CYCLES        6
+#define CD_R             7
+#define CD_SP            20
+#define CD_LR            21
+#define CD_PC            22
+#define CD_XPSR          23
+#define CD_CFSR          24
+#define CD_HFSR          25
+#define CD_MMFAR         26
+#define CD_BFAR          27
+#define CD_SHCSR         28
+#define CD_STACK_WORDS   29
+#define CD_STACK         30
+#define CD_TRACE_COUNT   (CD_STACK + CRASH_DUMP_STACK_WORDS)
+#define CD_TRACE         (CD_TRACE_COUNT + 1)
+#define CD_CHECKSUM      (CD_TRACE + (CRASH_DUMP_TRACE_RECORDS * 2))
+#define CD_WORDS         (CD_CHECKSUM + 1)
+
+#define CD_FLAG_FRAME      0x01
+#define CD_FLAG_FPU_FRAME  0x02
+#define CD_FLAG_PSP        0x04
+
+/* STM32F417IG flash, where code addresses can be. */
+#define CRASH_DECODE_FLASH_START   0x08000000UL
+#define CRASH_DECODE_FLASH_END     0x08100000UL
+
+const char *crash_decode_faults[5] =
+{
+   "?",
+   "HardFault",
+   "MemManage",
+   "BusFault",
+   "UsageFault"
+};
+
+/* CFSR bit, name.  MMFSR in the low byte, BFSR the next, UFSR the top half. */
+typedef struct {
+   uint32_t bit;
+   const char *name;
+} crash_decode_bit_t;
+
+const crash_decode_bit_t crash_decode_cfsr[] =
+{
+   {0x00000001, "IACCVIOL (instruction access violation)"},
+   {0x00000002, "DACCVIOL (data access violation)"},
+   {0x00000008, "MUNSTKERR (MPU fault unstacking)"},
+   {0x00000010, "MSTKERR (MPU fault stacking)"},
+   {0x00000020, "MLSPERR (MPU fault on lazy FP state)"},
+   {0x00000080, "MMARVALID"},
+   {0x00000100, "IBUSERR (instruction bus error)"},
+   {0x00000200, "PRECISERR (precise data bus error)"},
+   {0x00000400, "IMPRECISERR (imprecise data bus error)"},
+   {0x00000800, "UNSTKERR (bus fault unstacking)"},
+   {0x00001000, "STKERR (bus fault stacking)"},
+   {0x00002000, "LSPERR (bus fault on lazy FP state)"},
+   {0x00008000, "BFARVALID"},
+   {0x00010000, "UNDEFINSTR (undefined instruction)"},
+   {0x00020000, "INVSTATE (invalid EPSR, ARM state?)"},
+   {0x00040000, "INVPC (bad EXC_RETURN)"},
+   {0x00080000, "NOCP (no coprocessor, FPU off?)"},
+   {0x01000000, "UNALIGNED"},
+   {0x02000000, "DIVBYZERO"},
+   {0, NULL}
+};
+
+const crash_decode_bit_t crash_decode_hfsr[] =
+{
+   {0x00000002, "VECTTBL (vector table read)"},
+   {0x40000000, "FORCED (escalated from a configurable fault)"},
+   {0x80000000, "DEBUGEVT"},
+   {0, NULL}
+};
+
+/* Copy of enum trace_ids, as in trace_decode.c. */
+#define TRACE_NUM_IDS              4
+const char *crash_decode_trace_names[TRACE_NUM_IDS] =
+{
+   "tilt_state",
+   "rs485_master_state",
+   "fdud_packet_reset",
+   "tx_callback_mismatch"
+};
+
+GenericPacketCircularBuffer crash_decode_gpcb;
+GenericPacket crash_decode_queue[CRASH_DECODE_QUEUE_SIZE];
+
+/* The dump as it comes in, and how much of it has arrived. */
+uint8_t crash_decode_bytes[CD_WORDS * 4];
+uint32_t crash_decode_received = 0;
+
+const char *crash_decode_elf = "main.elf";
+const char *crash_decode_addr2line = "arm-none-eabi-addr2line";
+
+/* Used Internally */
+void crash_decode_packet(GenericPacket *gp, double cycles_per_ms);
+void crash_decode_print(const uint32_t *w, double cycles_per_ms);
+void crash_decode_bits(const char *reg, uint32_t value, const crash_decode_bit_t *bits);
+void crash_decode_symbol(uint32_t address, char *text, size_t size);
+uint8_t crash_decode_is_code(uint32_t address);
+
+int main(int argc, char *argv[])
+{
+   double core_mhz = 168.0;
+   int opt;
+   int c;
+
+   while((opt = getopt(argc, argv, "e:a:m:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'e':
+            crash_decode_elf = optarg;
+            break;
+         case 'a':
+            crash_decode_addr2line = optarg;
+            break;
+         case 'm':
+            core_mhz = atof(optarg);
+            break;
+         default:
+            core_mhz = 0.0;
+            break;
+      }
+   }
+
+   if(core_mhz <= 0.0)
+   {
+      fprintf(stderr, "usage: %s [-e elf] [-a addr2line] [-m core_mhz] < stream\n", argv[0]);
+      return 1;
+   }
+
+   gpcb_initialize(&crash_decode_gpcb, crash_decode_queue, CRASH_DECODE_QUEUE_SIZE);
+
+   while((c = getchar()) != EOF)
+   {
+      gpcb_receive_byte((uint8_t)c, &crash_decode_gpcb);
+
+      while(gpcb_increment_tail(&crash_decode_gpcb) == GP_CIRC_BUFFER_SUCCESS)
+      {
+         crash_decode_packet(&(crash_decode_gpcb.gpcb[crash_decode_gpcb.gpcb_tail]), core_mhz * 1000.0);
+      }
+   }
+
+   if(crash_decode_received != 0)
+   {
+      printf("*** stream ended part way through a dump (%u of %u bytes)\n",
+             crash_decode_received, (uint32_t)sizeof(crash_decode_bytes));
+   }
+
+   return 0;
+}
+
+/* PRIVATE crash_decode_packet
+ *
+ * Notes:
+ *  +Adds a UNIVERSAL_CRASH chunk to the dump, skips anything else.
+ *  +Chunks go out in order, offset 0 starts a new dump.  Once the last byte
+ *   is in the dump is printed.
+ */
+void crash_decode_packet(GenericPacket *gp, double cycles_per_ms)
+{
+   uint32_t words[CD_WORDS];
+   uint8_t data[GP_MAX_PACKET_LENGTH];
+   uint16_t offset, total;
+   uint8_t length;
+   uint32_t ii;
+
+   if((gp->gp[GP_LOC_PROJ_ID] != GP_PROJ_UNIVERSAL)||(gp->gp[GP_LOC_PROJ_SPEC] != UNIVERSAL_CRASH))
+   {
+      return;
+   }
+
+   if(extract_universal_crash(gp, &offset, &total, data, &length) != GP_SUCCESS)
+   {
+      return;
+   }
+
+   if(total != sizeof(crash_decode_bytes))
+   {
+      printf("*** crash dump is %u bytes, expected %u, crash_decode.c is out of date\n",
+             total, (uint32_t)sizeof(crash_decode_bytes));
+      return;
+   }
+
+   if(offset == 0)
+   {
+      crash_decode_received = 0;
+   }
+   if((offset != crash_decode_received)||((offset + length) > total))
+   {
+      printf("*** crash dump chunk at %u out of order, dropped\n", offset);
+      crash_decode_received = 0;
+      return;
+   }
+
+   memcpy(&(crash_decode_bytes[offset]), data, length);
+   crash_decode_received += length;
+
+   if(crash_decode_received == total)
+   {
+      /* Little endian on the wire, whatever this host is. */
+      for(ii=0; ii<CD_WORDS; ii++)
+      {
+         words[ii] = crash_decode_bytes[ii * 4] | (crash_decode_bytes[(ii * 4) + 1] << 8) |
+                     (crash_decode_bytes[(ii * 4) + 2] << 16) | ((uint32_t)crash_decode_bytes[(ii * 4) + 3] << 24);
+      }
+      crash_decode_print(words, cycles_per_ms);
+      crash_decode_received = 0;
+   }
+}
+
+/* PRIVATE crash_decode_print
+ *
+ * Notes:
+ *  +Checks the dump the way crash_dump_report() did and prints it.
+ */
+void crash_decode_print(const uint32_t *w, double cycles_per_ms)
+{
+   char symbol[512];
+   uint32_t sum = 0;
+   uint32_t count, cycles, id, arg8, arg16;
+   uint32_t ii;
+   double ms;
+
+   for(ii=0; ii<CD_CHECKSUM; ii++)
+   {
+      sum += w[ii];
+   }
+   if((w[CD_MAGIC] != CRASH_DUMP_MAGIC)||(w[CD_LENGTH] != (CD_WORDS * 4))||(sum != w[CD_CHECKSUM]))
+   {
+      printf("*** crash dump fails its checks, printing it anyway\n");
+   }
+
+   printf("=== %s at %u ms, %s stack%s\n",
+          crash_decode_faults[(w[CD_FAULT] < 5) ? w[CD_FAULT] : 0], w[CD_MS],
+          (w[CD_FLAGS] & CD_FLAG_PSP) ? "process" : "main",
+          (w[CD_FLAGS] & CD_FLAG_FPU_FRAME) ? ", FP context stacked" : "");
+
+   if(!(w[CD_FLAGS] & CD_FLAG_FRAME))
+   {
+      printf("*** exception frame at 0x%08X couldn't be read, r0-r3, r12, lr, pc and xpsr are missing\n", w[CD_SP]);
+   }
+
+   crash_decode_symbol(w[CD_PC], symbol, sizeof(symbol));
+   printf("pc   0x%08X  %s\n", w[CD_PC], symbol);
+   crash_decode_symbol((w[CD_LR] & ~1UL) - 1, symbol, sizeof(symbol));
+   printf("lr   0x%08X  %s\n", w[CD_LR], symbol);
+   printf("sp   0x%08X  xpsr 0x%08X  exc_return 0x%08X\n", w[CD_SP], w[CD_XPSR], w[CD_EXC_RETURN]);
+
+   for(ii=0; ii<13; ii++)
+   {
+      printf("r%-2u  0x%08X%s", ii, w[CD_R + ii], (((ii % 4) == 3)||(ii == 12)) ? "\n" : "   ");
+   }
+
+   crash_decode_bits("cfsr", w[CD_CFSR], crash_decode_cfsr);
+   crash_decode_bits("hfsr", w[CD_HFSR], crash_decode_hfsr);
+   if(w[CD_CFSR] & 0x80)
+   {
+      printf("mmfar 0x%08X\n", w[CD_MMFAR]);
+   }
+   if(w[CD_CFSR] & 0x8000)
+   {
+      printf("bfar  0x%08X\n", w[CD_BFAR]);
+   }
+   printf("shcsr 0x%08X\n", w[CD_SHCSR]);
+
+   count = (w[CD_STACK_WORDS] < CRASH_DUMP_STACK_WORDS) ? w[CD_STACK_WORDS] : CRASH_DUMP_STACK_WORDS;
+   printf("--- stack, %u words up from sp\n", count);
+   for(ii=0; ii<count; ii++)
+   {
+      if(crash_decode_is_code(w[CD_STACK + ii]))
+      {
+         crash_decode_symbol((w[CD_STACK + ii] & ~1UL) - 1, symbol, sizeof(symbol));
+      }
+      else
+      {
+         symbol[0] = '\0';
+      }
+      printf("0x%08X  0x%08X  %s\n", w[CD_SP] + (ii * 4), w[CD_STACK + ii], symbol);
+   }
+
+   /* Placed back from the cycle count at the fault, like trace_decode. */
+   count = (w[CD_TRACE_COUNT] < CRASH_DUMP_TRACE_RECORDS) ? w[CD_TRACE_COUNT] : CRASH_DUMP_TRACE_RECORDS;
+   printf("--- last %u trace records\n", count);
+   for(ii=0; ii<count; ii++)
+   {
+      cycles = w[CD_TRACE + (ii * 2)];
+      id = w[CD_TRACE + (ii * 2) + 1] & 0xFF;
+      arg8 = (w[CD_TRACE + (ii * 2) + 1] >> 8) & 0xFF;
+      arg16 = w[CD_TRACE + (ii * 2) + 1] >> 16;
+
+      ms = w[CD_MS] - ((uint32_t)(w[CD_CYCLES] - cycles) / cycles_per_ms);
+      printf("%12.3f  %-22s %u %u\n", ms, (id < TRACE_NUM_IDS) ? crash_decode_trace_names[id] : "?", arg8, arg16);
+   }
+}
+
+/* PRIVATE crash_decode_bits
+ *
+ * Notes:
+ *  +Register value and the name of every bit set in it.
+ */
+void crash_decode_bits(const char *reg, uint32_t value, const crash_decode_bit_t *bits)
+{
+   printf("%-5s 0x%08X\n", reg, value);
+   for(; bits->name != NULL; bits++)
+   {
+      if(value & bits->bit)
+      {
+         printf("      %s\n", bits->name);
+      }
+   }
+}
+
+/* PRIVATE crash_decode_symbol
+ *
+ * Notes:
+ *  +"function at file:line" from addr2line, or empty if it couldn't say.
+ *  +Return addresses (lr and the stack) are passed in less one so they land
+ *   on the call rather than the line after it.
+ */
+void crash_decode_symbol(uint32_t address, char *text, size_t size)
+{
+   char command[1024];
+   FILE *pipe;
+   size_t length;
+
+   text[0] = '\0';
+   if(access(crash_decode_elf, R_OK) != 0)
+   {
+      return;
+   }
+
+   snprintf(command, sizeof(command), "%s -f -C -p -e '%s' 0x%08X 2>/dev/null",
+            crash_decode_addr2line, crash_decode_elf, address);
+   pipe = popen(command, "r");
+   if(pipe == NULL)
+   {
+      return;
+   }
+
+   if(fgets(text, (int)size, pipe) == NULL)
+   {
+      text[0] = '\0';
+   }
+   pclose(pipe);
+
+   length = strlen(text);
+   while((length > 0)&&((text[length - 1] == '\n')||(text[length - 1] == '\r')))
+   {
+      text[--length] = '\0';
+   }
+}
+
+/* PRIVATE crash_decode_is_code
+ *
+ * Notes:
+ *  +Looks like a Thumb address in flash.
+ */
+uint8_t crash_decode_is_code(uint32_t address)
+{
+   return ((address & 1)&&(address >= CRASH_DECODE_FLASH_START)&&(address < CRASH_DECODE_FLASH_END));
+}
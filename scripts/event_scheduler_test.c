@@ -0,0 +1,411 @@
+/**
+ * @file event_scheduler_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief event_scheduler.c dispatching on the simulated core in hal_host.c.
+ *
+ * The handlers here record what ran and when.  Interrupts come from TIM11,
+ * its handler posts an event on every update the way the firmware's do, and
+ * time only moves while the scheduler sleeps or a handler waits.
+ *
+ * Runs:
+ *
+ *    register  Only single EVENT_* bits are taken.
+ *    order     Events pending together run lowest bit first, an event posted
+ *              several times before dispatch runs once, one without a
+ *              handler is dropped.
+ *    chain     An event posted by a handler or by the idle function runs
+ *              before the core sleeps, or on the next dispatch for the idle
+ *              function, without any time passing.
+ *    ticks     A 1 kHz interrupt for two seconds.  Every tick is handled, at
+ *              the time it fired, and a handler that outlasts a tick gets
+ *              it again before the core sleeps.
+ *    gap       An interrupt that comes due while interrupts are masked just
+ *              before WFI still wakes the core straight away.
+ *    idle      Handlers busy for part of every tick, the idle percentage has
+ *              to match once a window has passed and read 0 before.
+ *
+ * event_scheduler_test [-b busy_us]
+ *
+ *    -b   Time the idle run's handler spends per 1 ms tick, 250 us by
+ *         default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hal.h"
+#include "event_scheduler.h"
+#include "host_test.h"
+
+/* TIM11 counts at SystemCoreClock, a 1 MHz count. */
+#define TEST_TICK_PRESCALER    ((HAL_HOST_CORE_HZ / 1000000) - 1)
+#define TEST_TICK_US           1000
+#define TEST_TICKS_RUN         2000
+
+#define TEST_MAX_RECORDS       64
+
+#define TEST_EVENT_A           EVENT_FDUD_RX
+#define TEST_EVENT_B           EVENT_FDUD_TX
+#define TEST_EVENT_C           EVENT_TILT_SYNC
+#define TEST_EVENT_D           EVENT_RS485_MASTER
+
+/* What ran, in order. */
+char test_record[TEST_MAX_RECORDS + 1];
+uint32_t test_records = 0;
+
+/* The tick interrupt. */
+uint32_t test_ticks = 0;
+uint64_t test_tick_ns = 0;
+uint32_t test_tick_event = 0;
+
+/* The tick handler. */
+uint32_t test_handled = 0;
+uint64_t test_worst_late_ns = 0;
+uint32_t test_busy_ns = 0;
+uint32_t test_busy_every = 0;
+uint8_t test_mask_in_idle = 0;
+
+
+void test_note(char c)
+{
+   if(test_records < TEST_MAX_RECORDS)
+   {
+      test_record[test_records++] = c;
+      test_record[test_records] = '\0';
+   }
+}
+
+void test_a(void)
+{
+   test_note('a');
+}
+
+void test_b(void)
+{
+   test_note('b');
+}
+
+void test_c(void)
+{
+   test_note('c');
+}
+
+/* Posts A, which is lower and already went past. */
+void test_c_posts_a(void)
+{
+   test_note('c');
+   event_post(TEST_EVENT_A);
+}
+
+/* Posts D from the idle function once. */
+void test_idle_posts_d(void)
+{
+   test_note('i');
+   if(strchr(test_record, 'd') == NULL)
+   {
+      event_post(TEST_EVENT_D);
+   }
+}
+
+void test_d(void)
+{
+   test_note('d');
+}
+
+/* The tick event's handler. */
+void test_tick(void)
+{
+   uint64_t late = hal_host_now_ns() - test_tick_ns;
+
+   test_handled++;
+   if(late > test_worst_late_ns)
+   {
+      test_worst_late_ns = late;
+   }
+
+   if((test_busy_ns > 0)&&((test_handled % test_busy_every) == 0))
+   {
+      hal_delay_ns(test_busy_ns);
+   }
+}
+
+/* Masks interrupts and waits past the next tick, the way a tick landing
+ * between event_sleep()'s last check and WFI would look.
+ */
+void test_idle_masked(void)
+{
+   if(test_mask_in_idle)
+   {
+      test_mask_in_idle = 0;
+      hal_irq_disable();
+      hal_delay_ns(TEST_TICK_US * 1000);
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void TIM1_TRG_COM_TIM11_IRQHandler(void)
+{
+   if(hal_timer_update_pending(HAL_TIMER_TILT_STATE))
+   {
+      hal_timer_update_clear(HAL_TIMER_TILT_STATE);
+      test_ticks++;
+      test_tick_ns = hal_host_now_ns();
+      event_post(test_tick_event);
+   }
+}
+
+/* PRIVATE test_start
+ *
+ * Notes:
+ *  +Time zero, nothing registered and the tick off.
+ */
+void test_start(void)
+{
+   hal_host_reset();
+   event_init();
+
+   test_records = 0;
+   test_record[0] = '\0';
+   test_ticks = 0;
+   test_tick_ns = 0;
+   test_tick_event = TEST_EVENT_A;
+   test_handled = 0;
+   test_worst_late_ns = 0;
+   test_busy_ns = 0;
+   test_busy_every = 1;
+   test_mask_in_idle = 0;
+}
+
+void test_tick_start(void)
+{
+   hal_timer_init(HAL_TIMER_TILT_STATE, TEST_TICK_PRESCALER, TEST_TICK_US - 1, 1, 0);
+}
+
+/* Stops the tick and handles the last one if it's still pending. */
+void test_tick_stop(void)
+{
+   hal_timer_disable(HAL_TIMER_TILT_STATE);
+   event_dispatch();
+}
+
+void test_register(void)
+{
+   uint8_t ii;
+   uint8_t bad = 0;
+
+   test_start();
+
+   for(ii=0; ii<EVENT_MAX_EVENTS; ii++)
+   {
+      if(event_register(1UL << ii, &test_a) != EVENT_SUCCESS)
+      {
+         bad++;
+      }
+   }
+   test_check(bad == 0, "register", "single bits refused", bad);
+   test_check(event_register(0, &test_a) == EVENT_ERROR_BAD_EVENT, "register", "no bits taken", 0);
+   test_check(event_register(TEST_EVENT_A | TEST_EVENT_B, &test_a) == EVENT_ERROR_BAD_EVENT, "register",
+              "two bits taken", 0);
+   test_check(event_register(0xFFFFFFFF, &test_a) == EVENT_ERROR_BAD_EVENT, "register", "every bit taken", 0);
+
+   printf("register %d single bits, 0, two bits and all of them tried\n", EVENT_MAX_EVENTS);
+}
+
+void test_order(void)
+{
+   uint8_t ii;
+
+   test_start();
+   event_register(TEST_EVENT_A, &test_a);
+   event_register(TEST_EVENT_B, &test_b);
+   event_register(TEST_EVENT_C, &test_c);
+
+   /* Posted highest first, and B three times. */
+   event_post(TEST_EVENT_C);
+   for(ii=0; ii<3; ii++)
+   {
+      event_post(TEST_EVENT_B);
+   }
+   event_post(TEST_EVENT_A | EVENT_ANALOG_WINDOW);
+   event_dispatch();
+
+   test_check(strcmp(test_record, "abc") == 0, "order", "ran out of order or more than once", test_records);
+
+   /* Nothing left over, the next dispatch only sleeps. */
+   test_records = 0;
+   test_record[0] = '\0';
+   event_dispatch();
+   test_check(test_records == 0, "order", "ran again with nothing posted", test_records);
+
+   printf("order    C, B x3, A and an unhandled event ran \"abc\"\n");
+}
+
+void test_chain(void)
+{
+   uint64_t before;
+   uint64_t slept;
+
+   test_start();
+   event_register(TEST_EVENT_A, &test_a);
+   event_register(TEST_EVENT_C, &test_c_posts_a);
+   event_register(TEST_EVENT_D, &test_d);
+   event_set_idle(&test_idle_posts_d);
+
+   event_post(TEST_EVENT_C);
+   before = hal_host_now_ns();
+   event_dispatch();
+   slept = hal_host_now_ns() - before;
+
+   /* C posts A back, the idle function runs last and posts D. */
+   test_check(strcmp(test_record, "cai") == 0, "chain", "handler's post not run before idle", test_records);
+   test_check(slept == 0, "chain", "slept with an event pending, ns", slept);
+
+   event_dispatch();
+   test_check(strcmp(test_record, "caidi") == 0, "chain", "idle function's post not run next", test_records);
+
+   printf("chain    ran \"%s\" over two dispatches, %llu ns slept with D pending\n",
+          test_record, (unsigned long long)slept);
+}
+
+void test_tick_run(void)
+{
+   uint64_t end;
+
+   test_start();
+   event_register(TEST_EVENT_A, &test_tick);
+   test_tick_start();
+
+   end = (uint64_t)TEST_TICKS_RUN * TEST_TICK_US * 1000;
+   while(hal_host_now_ns() < end)
+   {
+      event_dispatch();
+   }
+   test_tick_stop();
+
+   test_check(test_handled == test_ticks, "ticks", "ticks not handled", (double)test_ticks - test_handled);
+   test_check(test_worst_late_ns == 0, "ticks", "handled after the tick", test_worst_late_ns);
+
+   printf("ticks    %u of %u handled, worst %llu ns after the interrupt\n",
+          test_handled, test_ticks, (unsigned long long)test_worst_late_ns);
+
+   /* Every tenth handler takes a tick and a half, the tick that comes in
+    * meanwhile is pending again when it returns.
+    */
+   test_start();
+   event_register(TEST_EVENT_A, &test_tick);
+   test_busy_ns = (TEST_TICK_US * 1000 * 3) / 2;
+   test_busy_every = 10;
+   test_tick_start();
+
+   while(hal_host_now_ns() < end)
+   {
+      event_dispatch();
+   }
+   test_tick_stop();
+
+   test_check(test_handled == test_ticks, "ticks", "tick lost behind a long handler", (double)test_ticks - test_handled);
+
+   printf("         %u of %u handled with every tenth handler busy %u us\n",
+          test_handled, test_ticks, test_busy_ns / 1000);
+}
+
+void test_gap(void)
+{
+   uint32_t ticks;
+   uint64_t woke;
+
+   test_start();
+   event_register(TEST_EVENT_A, &test_tick);
+   event_set_idle(&test_idle_masked);
+   test_tick_start();
+
+   /* The first tick comes straight away, the dispatch sleeps to the next. */
+   event_dispatch();
+   ticks = test_ticks;
+
+   /* The idle function sits masked over the following tick. */
+   test_mask_in_idle = 1;
+   event_dispatch();
+   woke = hal_host_now_ns();
+   test_check(test_ticks == ticks + 1, "gap", "slept through the masked tick", (double)test_ticks - ticks);
+   test_check(woke < ((uint64_t)(ticks + 1) * TEST_TICK_US * 1000), "gap", "woke late, us",
+              woke / 1000.0);
+
+   event_dispatch();
+   test_check(test_handled == ticks + 1, "gap", "masked tick not handled", test_handled);
+
+   printf("gap      tick in the gap woke the core at %.0f us, the next tick is at %u us\n",
+          woke / 1000.0, (ticks + 1) * TEST_TICK_US);
+}
+
+void test_idle(uint32_t busy_us)
+{
+   uint64_t end;
+   uint32_t expected;
+   uint8_t early;
+
+   test_start();
+   event_register(TEST_EVENT_A, &test_tick);
+   test_busy_ns = busy_us * 1000;
+   test_tick_start();
+
+   end = (uint64_t)(EVENT_IDLE_WINDOW_MS - 10) * 1000000;
+   while(hal_host_now_ns() < end)
+   {
+      event_dispatch();
+   }
+   early = event_idle_percent();
+   test_check(early == 0, "idle", "reported before the first window", early);
+
+   end = (uint64_t)(2 * EVENT_IDLE_WINDOW_MS + 10) * 1000000;
+   while(hal_host_now_ns() < end)
+   {
+      event_dispatch();
+   }
+
+   expected = (100 * (TEST_TICK_US - busy_us)) / TEST_TICK_US;
+   test_check((event_idle_percent() + 1 >= expected)&&(event_idle_percent() <= expected + 1), "idle",
+              "idle percent", event_idle_percent());
+
+   printf("idle     busy %u us of every %u us, %u%% idle, %u%% expected\n",
+          busy_us, TEST_TICK_US, event_idle_percent(), expected);
+}
+
+int main(int argc, char *argv[])
+{
+   uint32_t busy_us = 250;
+   int opt;
+
+   while((opt = getopt(argc, argv, "b:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'b':
+            busy_us = (uint32_t)strtoul(optarg, NULL, 0);
+            if(busy_us >= TEST_TICK_US)
+            {
+               fprintf(stderr, "busy has to be under %u us\n", TEST_TICK_US);
+               return 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-b busy_us]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   test_register();
+   test_order();
+   test_chain();
+   test_tick_run();
+   test_gap();
+   test_idle(busy_us);
+
+   return test_summary();
+}
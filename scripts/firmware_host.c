@@ -0,0 +1,278 @@
+/**
+ * @file firmware_host.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Runs the firmware core on a PC against the simulated peripherals.
+ *
+ * Links the real event scheduler, USART1 packet link, tilt stepper state
+ * machine and TMC260 driver with hal_host.c instead of the STM32.  The mirror
+ * is modelled just well enough to close the loop, its position comes from the
+ * STEP and DIR pins and the home flag is driven from that: uncovered (high)
+ * from -pi to 0, covered from 0 to pi.  A Hokuyo sync arrives every 25ms.
+ *
+ * firmware_host [-t seconds] [-a start_rad] [-i rx_capture] [-o tx_capture]
+ *
+ *    -t   Virtual time to run for, 10 seconds by default.
+ *    -a   Where the mirror starts, 3.0 rad by default.
+ *    -i   Raw bytes fed to USART1 RX at line rate, e.g. a capture of what the
+ *         host sends.
+ *    -o   Everything the firmware transmits on USART1, readable by
+ *         trace_decode and profile_decode.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "hal.h"
+#include "debug.h"
+#include "event_scheduler.h"
+#include "trace.h"
+#include "full_duplex_usart_dma.h"
+#include "tilt_stepper_motor_control.h"
+#include "gp_proj_motor.h"
+#include "watchdog.h"
+
+#define SYNC_PERIOD_NS     25000000ULL
+#define SYNC_PULSE_NS      1000000ULL
+
+/* 3 MBaud, 10 bits a byte. */
+#define RX_BYTES_PER_MS    300
+
+/* From tilt_stepper_motor_control.c and tilt_stepper_motor_profile.h. */
+extern tilt_stepper_states ts_state;
+extern volatile uint8_t tilt_stepper_motor_send_angle;
+extern uint32_t micro_steps_per_rev;
+extern float stepper_gear_ratio_num;
+extern float stepper_gear_ratio_den;
+
+FILE *rx_file = NULL;
+FILE *tx_file = NULL;
+
+int64_t mirror_steps = 0;
+float mirror_start_rad = 3.0f;
+uint32_t step_edges = 0;
+uint32_t home_edges = 0;
+uint32_t rx_packets = 0;
+uint32_t tx_packets = 0;
+uint64_t tx_bytes = 0;
+uint32_t syncs = 0;
+
+GenericPacket gp_angle;
+volatile uint8_t gp_angle_busy = 0;
+
+float mirror_rad(void)
+{
+   return mirror_start_rad + (((float)mirror_steps / (float)micro_steps_per_rev) *
+                              (stepper_gear_ratio_den / stepper_gear_ratio_num) * TILT_STEPPER_TWO_PI);
+}
+
+uint8_t mirror_home_flag(void)
+{
+   float rad = mirror_rad();
+
+   while(rad > (TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad -= TILT_STEPPER_TWO_PI;
+   }
+   while(rad <= -(TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad += TILT_STEPPER_TWO_PI;
+   }
+
+   return (rad <= 0.0f);
+}
+
+void pin_watch(uint8_t pin, uint8_t level, uint64_t ns)
+{
+   uint8_t flag;
+
+   if(pin != HAL_PIN_TMC260_STEP)
+   {
+      return;
+   }
+
+   /* Steps on both edges, DIR low is CW, which counts down. */
+   step_edges++;
+   mirror_steps += hal_gpio_read(HAL_PIN_TMC260_DIR) ? 1 : -1;
+
+   flag = mirror_home_flag();
+   if(flag != hal_gpio_read(HAL_PIN_TILT_HOME))
+   {
+      home_edges++;
+      hal_host_gpio_input(HAL_PIN_TILT_HOME, flag);
+   }
+}
+
+void usart_sink(uint8_t usart, const uint8_t *data, uint16_t length, uint64_t ns)
+{
+   tx_packets++;
+   tx_bytes += length;
+   if(tx_file != NULL)
+   {
+      fwrite(data, 1, length, tx_file);
+   }
+}
+
+void rx_handler(GenericPacket *packet)
+{
+   rx_packets++;
+}
+
+void angle_sent(uint32_t data)
+{
+   gp_angle_busy = 0;
+}
+
+void send_tilt_angle(void)
+{
+   float pos_rad;
+   uint32_t pos_ts;
+
+   if((tilt_stepper_motor_send_angle)&&(!gp_angle_busy))
+   {
+      tilt_stepper_motor_pos(&pos_rad, &pos_ts);
+      create_motor_resp_position_ts(&gp_angle, pos_rad, pos_ts);
+      gp_angle_busy = 1;
+      if(full_duplex_usart_dma_add_to_queue(&gp_angle, &angle_sent, 0) != FDUD_SUCCESS)
+      {
+         gp_angle_busy = 0;
+      }
+      tilt_stepper_motor_send_angle = 0;
+   }
+}
+
+/* Hokuyo sync and RX bytes, called between main loop passes.  Every pass
+ * ends at an interrupt, at least once a millisecond with TIM11 running.
+ */
+void drive_inputs(uint64_t now_ns, uint64_t *next_sync_ns, uint64_t *next_rx_ns)
+{
+   uint8_t bytes[RX_BYTES_PER_MS];
+   size_t count;
+
+   if(now_ns >= *next_sync_ns)
+   {
+      hal_host_gpio_input(HAL_PIN_HOKUYO_SYNC, 0);
+      syncs++;
+      *next_sync_ns += SYNC_PERIOD_NS;
+   }
+   else if(now_ns >= (*next_sync_ns - SYNC_PERIOD_NS + SYNC_PULSE_NS))
+   {
+      hal_host_gpio_input(HAL_PIN_HOKUYO_SYNC, 1);
+   }
+
+   if((rx_file != NULL)&&(now_ns >= *next_rx_ns))
+   {
+      count = fread(bytes, 1, sizeof(bytes), rx_file);
+      if(count > 0)
+      {
+         hal_host_usart_rx(HAL_USART_LINK, bytes, (uint16_t)count);
+      }
+      *next_rx_ns += 1000000ULL;
+   }
+}
+
+int main(int argc, char **argv)
+{
+   struct timespec wall_start, wall_end;
+   uint64_t end_ns;
+   uint64_t next_sync_ns = SYNC_PERIOD_NS;
+   uint64_t next_rx_ns = 0;
+   double seconds = 10.0;
+   double wall;
+   float pos_rad;
+   uint32_t pos_ts;
+   int opt;
+
+   while((opt = getopt(argc, argv, "t:a:i:o:")) != -1)
+   {
+      switch(opt)
+      {
+         case 't':
+            seconds = atof(optarg);
+            break;
+         case 'a':
+            mirror_start_rad = (float)atof(optarg);
+            break;
+         case 'i':
+            rx_file = fopen(optarg, "rb");
+            if(rx_file == NULL)
+            {
+               perror(optarg);
+               return 1;
+            }
+            break;
+         case 'o':
+            tx_file = fopen(optarg, "wb");
+            if(tx_file == NULL)
+            {
+               perror(optarg);
+               return 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-t seconds] [-a start_rad] [-i rx_capture] [-o tx_capture]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   hal_host_reset();
+   hal_host_set_pin_watch(&pin_watch);
+   hal_host_set_usart_sink(&usart_sink);
+   hal_host_gpio_input(HAL_PIN_TILT_HOME, mirror_home_flag());
+   hal_host_gpio_input(HAL_PIN_HOKUYO_SYNC, 1);
+
+   /* Same order as main(). */
+   debug_init();
+   trace_init();
+   event_init();
+   event_register(EVENT_FDUD_RX, &full_duplex_usart_dma_spin);
+   event_register(EVENT_FDUD_TX, &full_duplex_usart_dma_spin);
+   event_register(EVENT_TILT_SYNC, &send_tilt_angle);
+   full_duplex_usart_dma_init(&rx_handler);
+   event_set_idle(&trace_drain);
+   tilt_stepper_motor_init();
+   watchdog_register(WATCHDOG_TASK_MAIN, WATCHDOG_MAIN_DEADLINE_MS);
+
+   end_ns = (uint64_t)(seconds * 1e9);
+   clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+   while(hal_host_now_ns() < end_ns)
+   {
+      drive_inputs(hal_host_now_ns(), &next_sync_ns, &next_rx_ns);
+      event_dispatch();
+      watchdog_heartbeat(WATCHDOG_TASK_MAIN);
+   }
+
+   clock_gettime(CLOCK_MONOTONIC, &wall_end);
+   wall = (wall_end.tv_sec - wall_start.tv_sec) + ((wall_end.tv_nsec - wall_start.tv_nsec) / 1e9);
+
+   tilt_stepper_motor_pos(&pos_rad, &pos_ts);
+
+   printf("virtual %.3f s in %.3f s wall, %.0fx\n", hal_host_now_ns() / 1e9, wall,
+          (wall > 0.0) ? (hal_host_now_ns() / 1e9) / wall : 0.0);
+   printf("irqs     TIM5 %u  TIM11 %u  TIM12 %u  DMA2_S7 %u  EXTI0 %u  EXTI1 %u  EXTI2 %u  EXTI15_10 %u\n",
+          hal_host_irq_count(HAL_HOST_IRQ_TIM5), hal_host_irq_count(HAL_HOST_IRQ_TIM11),
+          hal_host_irq_count(HAL_HOST_IRQ_TIM12), hal_host_irq_count(HAL_HOST_IRQ_DMA2_STREAM7),
+          hal_host_irq_count(HAL_HOST_IRQ_EXTI0), hal_host_irq_count(HAL_HOST_IRQ_EXTI1),
+          hal_host_irq_count(HAL_HOST_IRQ_EXTI2), hal_host_irq_count(HAL_HOST_IRQ_EXTI15_10));
+   printf("mirror   %u step edges, %u home edges, at %.4f rad, firmware says %.4f rad, state %u\n",
+          step_edges, home_edges, mirror_rad(), pos_rad, ts_state);
+   printf("usart1   %u packets (%llu bytes) out, %u packets in, %u syncs\n",
+          tx_packets, (unsigned long long)tx_bytes, rx_packets, syncs);
+   printf("idle     %u%%\n", event_idle_percent());
+   printf("watchdog %u resets\n", hal_host_watchdog_resets());
+
+   if(tx_file != NULL)
+   {
+      fclose(tx_file);
+   }
+   if(rx_file != NULL)
+   {
+      fclose(rx_file);
+   }
+
+   return (hal_host_watchdog_resets() == 0) ? 0 : 2;
+}
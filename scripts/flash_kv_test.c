@@ -0,0 +1,387 @@
+/**
+ * @file flash_kv_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief flash_kv.c on RAM that behaves like the STM32F4's NOR flash, with
+ * power cut at every flash operation in turn.
+ *
+ * The port functions here erase a sector to all ones and program a word by
+ * clearing bits only, the same as the real part.  Programming a 0 back to a 1
+ * is an error.  When the power goes, the operation it lands on is left half
+ * done, a program with some of its bits cleared and an erase with only the
+ * start of the sector blank, and nothing after it reaches the flash.
+ *
+ * Runs:
+ *
+ *    basic     Blank flash formats, values read back, rewriting the stored
+ *              value costs nothing, the log moves sectors once it's full.
+ *    erase     Writes never erase.  A second move before the next init is
+ *              refused with FLASH_KV_ERROR_FULL and keeps the old value, and
+ *              flash_kv_init() makes room again.
+ *    power     A workload that fills the active sector and moves the log, and
+ *              the init after it, cut at every flash operation.  The next
+ *              init has to come up with every key at its last completed value,
+ *              or for the write that was cut either the old or the new one.
+ *
+ * The Makefile builds this with 64 word sectors so every cut point of a move
+ * can be tried quickly.  The store doesn't depend on the size.
+ *
+ * flash_kv_test [-s seed]
+ *
+ *    -s   Seed for the partial programs and erases, 1 by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "flash_kv.h"
+#include "host_test.h"
+
+#define TEST_KEYS              4
+#define TEST_NO_CUT            0xFFFFFFFF
+
+/* The flash. */
+uint32_t test_flash[2][FLASH_KV_SECTOR_WORDS];
+uint32_t test_ops = 0;                      /* Erases and programs so far. */
+uint32_t test_cut_at = TEST_NO_CUT;         /* Operation the power goes on. */
+uint8_t test_powered = 1;
+uint32_t test_erases = 0;
+uint32_t test_misuse = 0;                   /* Programs that set a bit. */
+
+uint32_t test_seed = 1;
+
+/* xorshift32, the same partial operations every run. */
+uint32_t test_random(void)
+{
+   test_seed ^= test_seed << 13;
+   test_seed ^= test_seed >> 17;
+   test_seed ^= test_seed << 5;
+   return test_seed;
+}
+
+/* PRIVATE test_power_check
+ *
+ * Notes:
+ *  +Returns 1 if the operation about to start completes, 0 if the power goes
+ *   during it.  Once off, it stays off until test_power_on().
+ */
+uint8_t test_power_check(void)
+{
+   if(test_powered == 0)
+   {
+      return 0;
+   }
+
+   test_ops++;
+   if(test_ops == test_cut_at)
+   {
+      test_powered = 0;
+      return 0;
+   }
+
+   return 1;
+}
+
+void test_power_on(uint32_t cut_at)
+{
+   test_powered = 1;
+   test_ops = 0;
+   test_cut_at = cut_at;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+const volatile uint32_t *flash_kv_port_sector(uint8_t sector)
+{
+   return test_flash[sector];
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_port_erase(uint8_t sector)
+{
+   uint32_t blank;
+   uint32_t ii;
+
+   if(test_power_check() == 0)
+   {
+      if(test_ops == test_cut_at)
+      {
+         /* Cut part way, the start of the sector is blank. */
+         blank = test_random() % FLASH_KV_SECTOR_WORDS;
+         for(ii=0; ii<blank; ii++)
+         {
+            test_flash[sector][ii] = 0xFFFFFFFF;
+         }
+      }
+      return FLASH_KV_ERROR_FLASH;
+   }
+
+   test_erases++;
+   for(ii=0; ii<FLASH_KV_SECTOR_WORDS; ii++)
+   {
+      test_flash[sector][ii] = 0xFFFFFFFF;
+   }
+
+   return FLASH_KV_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_port_program(uint8_t sector, uint32_t word, uint32_t value)
+{
+   if(word >= FLASH_KV_SECTOR_WORDS)
+   {
+      return FLASH_KV_ERROR_FLASH;
+   }
+
+   if(test_power_check() == 0)
+   {
+      if(test_ops == test_cut_at)
+      {
+         /* Cut part way, only some of the bits got cleared. */
+         test_flash[sector][word] &= (value | test_random());
+      }
+      return FLASH_KV_ERROR_FLASH;
+   }
+
+   if((value & ~test_flash[sector][word]) != 0)
+   {
+      test_misuse++;
+   }
+   test_flash[sector][word] &= value;
+
+   return FLASH_KV_SUCCESS;
+}
+
+void test_blank(void)
+{
+   memset(test_flash, 0xFF, sizeof(test_flash));
+   test_erases = 0;
+   test_misuse = 0;
+   test_power_on(TEST_NO_CUT);
+}
+
+/* PRIVATE test_value
+ *
+ * Notes:
+ *  +The value written the n-th time a key is written, never the same twice
+ *   in a row so every write appends.
+ */
+uint32_t test_value(uint16_t key, uint32_t n)
+{
+   return ((uint32_t)key << 24) ^ (n * 2654435761UL);
+}
+
+void test_basic(void)
+{
+   uint32_t value;
+   uint32_t records;
+   uint32_t generation;
+   uint32_t ii;
+
+   test_blank();
+   test_check(flash_kv_init() == FLASH_KV_SUCCESS, "basic", "init on blank flash", 0);
+   test_check(flash_kv_read(1, &value) == FLASH_KV_ERROR_NOT_FOUND, "basic", "blank store has a key", 0);
+   test_check(flash_kv_write(FLASH_KV_KEY_INVALID, 0) == FLASH_KV_ERROR_KEY, "basic", "invalid key written", 0);
+
+   test_check(flash_kv_write(1, 0x12345678) == FLASH_KV_SUCCESS, "basic", "write", 0);
+   test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == 0x12345678), "basic", "read back", value);
+
+   /* Same value again doesn't use a record. */
+   records = test_ops;
+   test_check(flash_kv_write(1, 0x12345678) == FLASH_KV_SUCCESS, "basic", "rewrite", 0);
+   test_check(test_ops == records, "basic", "rewrite programmed flash", test_ops - records);
+
+   /* Fill the sector and move once. */
+   generation = flash_kv_generation();
+   for(ii=0; ii<FLASH_KV_SECTOR_RECORDS; ii++)
+   {
+      test_check(flash_kv_write(2 + (ii % TEST_KEYS), test_value(2 + (ii % TEST_KEYS), ii)) == FLASH_KV_SUCCESS,
+                 "basic", "write while filling", ii);
+   }
+   test_check(flash_kv_generation() == generation + 1, "basic", "log didn't move", flash_kv_generation());
+   test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == 0x12345678), "basic", "key lost in the move", value);
+   for(ii=FLASH_KV_SECTOR_RECORDS - TEST_KEYS; ii<FLASH_KV_SECTOR_RECORDS; ii++)
+   {
+      test_check((flash_kv_read(2 + (ii % TEST_KEYS), &value) == FLASH_KV_SUCCESS)&&
+                 (value == test_value(2 + (ii % TEST_KEYS), ii)), "basic", "newest value after the move", ii);
+   }
+
+   /* A reset comes back to the same values. */
+   test_check(flash_kv_init() == FLASH_KV_SUCCESS, "basic", "init after the move", 0);
+   test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == 0x12345678), "basic", "key lost over init", value);
+   test_check(test_misuse == 0, "basic", "programmed a 0 back to 1", test_misuse);
+}
+
+void test_erase(void)
+{
+   uint32_t value;
+   uint32_t erases;
+   uint32_t ii;
+   uint8_t retval;
+
+   test_blank();
+   flash_kv_init();
+   erases = test_erases;
+
+   /* Two sectors' worth of writes without an init in between. */
+   retval = FLASH_KV_SUCCESS;
+   for(ii=0; (ii<(3 * FLASH_KV_SECTOR_RECORDS))&&(retval == FLASH_KV_SUCCESS); ii++)
+   {
+      retval = flash_kv_write(1, ii + 1);
+   }
+   test_check(test_erases == erases, "erase", "a write erased", test_erases - erases);
+   test_check(retval == FLASH_KV_ERROR_FULL, "erase", "second move wasn't refused", retval);
+   test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == ii - 1), "erase", "refused write changed the value", value);
+
+   /* Boot erases the old sector and the store takes writes again. */
+   test_check(flash_kv_init() == FLASH_KV_SUCCESS, "erase", "init", 0);
+   test_check(test_erases == erases + 1, "erase", "init erases once", test_erases - erases);
+   test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == ii - 1), "erase", "value over init", value);
+   for(ii=0; ii<FLASH_KV_SECTOR_RECORDS; ii++)
+   {
+      test_check(flash_kv_write(1, 0x80000000 | ii) == FLASH_KV_SUCCESS, "erase", "write after init", ii);
+   }
+   test_check(test_misuse == 0, "erase", "programmed a 0 back to 1", test_misuse);
+}
+
+/* PRIVATE test_workload
+ *
+ * Notes:
+ *  +Writes round robin over the keys until the log has moved, then reboots
+ *   (flash_kv_init() erases the old sector).  committed[] follows every write
+ *   that returned success, pending is the one that was running when the
+ *   power went.
+ *  +Returns the number of flash operations it took, or stops early if the
+ *   power went.
+ */
+uint32_t test_workload(uint32_t *committed, uint16_t *pending_key, uint32_t *pending_value)
+{
+   uint32_t generation;
+   uint32_t value;
+   uint32_t ii;
+   uint16_t key;
+
+   generation = flash_kv_generation();
+   for(ii=0; (flash_kv_generation() == generation)&&(test_powered); ii++)
+   {
+      key = 1 + (ii % TEST_KEYS);
+      value = test_value(key, 1000 + ii);
+      *pending_key = key;
+      *pending_value = value;
+      if(flash_kv_write(key, value) == FLASH_KV_SUCCESS)
+      {
+         committed[key - 1] = value;
+      }
+   }
+   *pending_key = FLASH_KV_KEY_INVALID;
+
+   if(test_powered)
+   {
+      flash_kv_init();
+   }
+
+   return test_ops;
+}
+
+void test_power(void)
+{
+   uint32_t start[2][FLASH_KV_SECTOR_WORDS];
+   uint32_t committed[TEST_KEYS], before[TEST_KEYS];
+   uint32_t total, cut;
+   uint32_t value;
+   uint32_t tried = 0;
+   uint16_t pending_key;
+   uint32_t pending_value;
+   uint8_t retval;
+   uint8_t ii;
+
+   /* A store half full, with a value for every key. */
+   test_blank();
+   flash_kv_init();
+   for(ii=0; ii<TEST_KEYS; ii++)
+   {
+      before[ii] = test_value(1 + ii, 0);
+      flash_kv_write(1 + ii, before[ii]);
+   }
+   for(ii=0; ii<(FLASH_KV_SECTOR_RECORDS / 2); ii++)
+   {
+      before[ii % TEST_KEYS] = test_value(1 + (ii % TEST_KEYS), 100 + ii);
+      flash_kv_write(1 + (ii % TEST_KEYS), before[ii % TEST_KEYS]);
+   }
+   memcpy(start, test_flash, sizeof(start));
+
+   /* How many operations the whole workload takes with the power on. */
+   memcpy(committed, before, sizeof(committed));
+   total = test_workload(committed, &pending_key, &pending_value);
+
+   for(cut=1; cut<=total; cut++)
+   {
+      memcpy(test_flash, start, sizeof(test_flash));
+      memcpy(committed, before, sizeof(committed));
+      flash_kv_init();
+      test_power_on(cut);
+      test_workload(committed, &pending_key, &pending_value);
+      tried++;
+
+      /* Power back, boot. */
+      test_power_on(TEST_NO_CUT);
+      retval = flash_kv_init();
+      test_check(retval == FLASH_KV_SUCCESS, "power", "init after the cut", cut);
+
+      for(ii=0; ii<TEST_KEYS; ii++)
+      {
+         retval = flash_kv_read(1 + ii, &value);
+         if((1 + ii) == pending_key)
+         {
+            test_check((retval == FLASH_KV_SUCCESS)&&((value == committed[ii])||(value == pending_value)),
+                       "power", "cut write isn't the old or the new value", cut);
+         }
+         else
+         {
+            test_check((retval == FLASH_KV_SUCCESS)&&(value == committed[ii]),
+                       "power", "completed write lost", cut);
+         }
+      }
+
+      /* The store keeps working afterwards. */
+      test_check(flash_kv_write(1, 0xC0FFEE) == FLASH_KV_SUCCESS, "power", "write after the cut", cut);
+      test_check((flash_kv_read(1, &value) == FLASH_KV_SUCCESS)&&(value == 0xC0FFEE), "power", "read after the cut", cut);
+   }
+
+   test_check(test_misuse == 0, "power", "programmed a 0 back to 1", test_misuse);
+   printf("power    %u cut points over a move and the init after it\n", tried);
+}
+
+int main(int argc, char *argv[])
+{
+   int opt;
+
+   while((opt = getopt(argc, argv, "s:")) != -1)
+   {
+      switch(opt)
+      {
+         case 's':
+            test_seed = (uint32_t)strtoul(optarg, NULL, 0);
+            if(test_seed == 0)
+            {
+               test_seed = 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-s seed]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   printf("sector   %u words, %u records\n", FLASH_KV_SECTOR_WORDS, FLASH_KV_SECTOR_RECORDS);
+
+   test_basic();
+   test_erase();
+   test_power();
+
+   return test_summary();
+}
@@ -0,0 +1,412 @@
+/**
+ * @file gp_stream_bench.cpp
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Checks gp_stream.hpp against the generic_packet library and times it.
+ *
+ * gp_stream_bench [-s synthetic_mb] [-t seconds] [capture ...]
+ *
+ *    -s   Size of the made up stream, 32 MB by default.
+ *    -t   Time each measurement runs for, 0.5 s by default.
+ *
+ * With no captures it builds a stream with the library's own create_*()
+ * functions, lepton frames and compressed lines with position, TMC260 status
+ * and RS485 packets mixed in, and checks every packet and typed view comes
+ * back as built, fed in random sized pieces.  It then corrupts one packet in
+ * a thousand, adds line noise, and checks the rest still come through.
+ *
+ * Captures are raw bytes as they came off the wire, e.g. from
+ * "firmware_host -o" or cat /dev/ttyUSB0.  Packet counts from gp_stream and
+ * the library's gp_receive_byte() are printed side by side.
+ *
+ * Then each input is decoded over and over in 64 byte, 4 KB and 1 MB pieces,
+ * and once a byte at a time through gp_receive_byte() for comparison, and the
+ * rates printed.  Exits 2 if any check failed.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <unistd.h>
+
+extern "C" {
+#include "generic_packet.h"
+#include "gp_receive.h"
+#include "gp_proj_motor.h"
+#include "gp_proj_thermal.h"
+#include "gp_proj_rs485_sb.h"
+#include "gp_proj_local.h"
+}
+
+#include "gp_stream.hpp"
+
+#define BENCH_LINES_PER_IMAGE    60
+#define BENCH_CORRUPT_EVERY      1000
+#define BENCH_LINE_BYTES         160
+
+typedef std::vector<uint8_t> bytes_t;
+
+uint32_t bench_seed = 0x2545F491;
+uint32_t bench_failures = 0;
+
+/* xorshift32, the same stream every run. */
+uint32_t bench_random(void)
+{
+   bench_seed ^= bench_seed << 13;
+   bench_seed ^= bench_seed >> 17;
+   bench_seed ^= bench_seed << 5;
+   return bench_seed;
+}
+
+void bench_append(bytes_t &out, std::vector<size_t> &starts, const GenericPacket &gp)
+{
+   starts.push_back(out.size());
+   out.insert(out.end(), gp.gp, gp.gp + gp.packet_length);
+}
+
+/* PRIVATE bench_synthesize
+ *
+ * Notes:
+ *  +About what the tilt LIDAR sends, by bytes mostly thermal.  Field values
+ *   are a function of the packet's index so bench_view_ok() can check them.
+ */
+void bench_synthesize(bytes_t &out, std::vector<size_t> &starts, size_t size)
+{
+   GenericPacket gp;
+   VOSPIFrame frame;
+   uint8_t line[BENCH_LINE_BYTES];
+   uint32_t unique_id[3];
+   uint32_t n = 0;
+   uint16_t image = 0;
+   uint32_t ii, jj;
+
+   while(out.size() < size)
+   {
+      create_thermal_begin_lepton_image(&gp, image, image * 111);
+      bench_append(out, starts, gp);
+
+      for(ii=0; ii<BENCH_LINES_PER_IMAGE; ii++, n++)
+      {
+         if(ii % 2)
+         {
+            for(jj=0; jj<sizeof(frame.data); jj++)
+            {
+               frame.data[jj] = (uint8_t)bench_random();
+            }
+            frame.data[1] = (uint8_t)ii;
+            create_thermal_lepton_frame(&gp, &frame);
+         }
+         else
+         {
+            for(jj=0; jj<sizeof(line); jj++)
+            {
+               line[jj] = (uint8_t)bench_random();
+            }
+            create_thermal_lepton_compressed_line(&gp, line, (uint16_t)(40 + (n % 60)));
+         }
+         bench_append(out, starts, gp);
+
+         if((ii % 4) == 0)
+         {
+            create_motor_resp_position_ts(&gp, (float)n * 0.001f, n * 25);
+            bench_append(out, starts, gp);
+         }
+         if((ii % 30) == 0)
+         {
+            create_motor_tmc260_resp_status(&gp, (uint16_t)n, (uint16_t)(n * 3), (uint16_t)(n * 7), (uint8_t)n);
+            bench_append(out, starts, gp);
+         }
+      }
+
+      unique_id[0] = image;
+      unique_id[1] = image * 3u;
+      unique_id[2] = 0xDEADBEEF;
+      create_rs485_resp_unique_id(&gp, (uint8_t)image, unique_id);
+      bench_append(out, starts, gp);
+
+      create_thermal_end_lepton_image(&gp);
+      bench_append(out, starts, gp);
+
+      image++;
+   }
+}
+
+/* PRIVATE bench_view_ok
+ *
+ * Notes:
+ *  +Reads back the typed fields bench_synthesize() put in, position_ts and
+ *   TMC260 status values all derive from the same counter.
+ */
+bool bench_view_ok(const gp_stream::packet &p)
+{
+   if(auto pos = gp_stream::view_as<gp_stream::motor_position_ts>(p))
+   {
+      uint32_t n = pos->timestamp() / 25;
+      return (pos->timestamp() == n * 25)&&(pos->rad() == (float)n * 0.001f);
+   }
+   if(auto stat = gp_stream::view_as<gp_stream::motor_tmc260_status>(p))
+   {
+      uint16_t n = stat->position();
+      return (stat->stall_guard() == (uint16_t)(n * 3))&&(stat->current() == (uint16_t)(n * 7))&&
+             (stat->status_byte() == (uint8_t)n);
+   }
+   if(auto begin = gp_stream::view_as<gp_stream::thermal_begin_image>(p))
+   {
+      return (begin->ms() == begin->image_num() * 111u);
+   }
+   if(auto uid = gp_stream::view_as<gp_stream::rs485_unique_id>(p))
+   {
+      return (uid->unique_id(1) == uid->unique_id(0) * 3u)&&(uid->unique_id(2) == 0xDEADBEEF)&&
+             (uid->address() == (uint8_t)uid->unique_id(0));
+   }
+   if(auto frame = gp_stream::view_as<gp_stream::thermal_lepton_frame>(p))
+   {
+      return (frame->line() < BENCH_LINES_PER_IMAGE);
+   }
+
+   return gp_stream::view_as<gp_stream::thermal_compressed_line>(p)||
+          gp_stream::view_as<gp_stream::thermal_end_image>(p);
+}
+
+void bench_check(const char *what, bool ok)
+{
+   printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+   if(!ok)
+   {
+      bench_failures++;
+   }
+}
+
+/* PRIVATE bench_check_synthetic
+ *
+ * Notes:
+ *  +Random piece sizes from 1 byte to 4 KB so packets get split everywhere,
+ *   including inside the header.
+ */
+void bench_check_synthetic(const bytes_t &stream, const std::vector<size_t> &starts)
+{
+   gp_stream::decoder dec;
+   bytes_t noisy;
+   size_t next = 0;
+   size_t at = 0;
+   size_t piece;
+   bool bytes_match = true;
+   bool views_match = true;
+   uint64_t corrupted = 0;
+   uint64_t found = 0;
+   uint32_t ii;
+
+   printf("synthetic, %zu packets in %.1f MB\n", starts.size(), stream.size() / 1e6);
+
+   while(at < stream.size())
+   {
+      piece = 1 + (bench_random() % 4096);
+      piece = (piece > (stream.size() - at)) ? (stream.size() - at) : piece;
+      dec.feed(&(stream[at]), piece, [&](const gp_stream::packet &p)
+      {
+         size_t end = (next + 1 < starts.size()) ? starts[next + 1] : stream.size();
+
+         if((next >= starts.size())||(p.length() != (end - starts[next]))||
+            (std::memcmp(p.bytes(), &(stream[starts[next]]), p.length()) != 0))
+         {
+            bytes_match = false;
+         }
+         if(!bench_view_ok(p))
+         {
+            views_match = false;
+         }
+         next++;
+      });
+      at += piece;
+   }
+
+   bench_check("every packet found, byte for byte", bytes_match && (next == starts.size()));
+   bench_check("typed views read back what create_*() wrote", views_match);
+   bench_check("no checksum errors on a clean stream", dec.stats().checksum_errors == 0);
+
+   /* Flip a payload byte in every thousandth packet and put noise that can't
+    * look like a start byte between some of the others.
+    */
+   for(ii=0; ii<starts.size(); ii++)
+   {
+      size_t end = (ii + 1 < starts.size()) ? starts[ii + 1] : stream.size();
+
+      noisy.insert(noisy.end(), stream.begin() + starts[ii], stream.begin() + end);
+      if((ii % BENCH_CORRUPT_EVERY) == (BENCH_CORRUPT_EVERY - 1))
+      {
+         noisy[noisy.size() - 2] ^= 0x40;
+         corrupted++;
+      }
+      if((ii % 97) == 0)
+      {
+         noisy.push_back((uint8_t)(bench_random() % gp_stream::wire::start));
+      }
+   }
+
+   gp_stream::decoder resync;
+   resync.feed(noisy.data(), noisy.size(), [&](const gp_stream::packet &p)
+   {
+      found += bench_view_ok(p);
+   });
+
+   printf("  corrupted %llu, found %llu of %llu good, %llu checksum errors, %llu bytes skipped\n",
+          (unsigned long long)corrupted, (unsigned long long)found,
+          (unsigned long long)(starts.size() - corrupted),
+          (unsigned long long)resync.stats().checksum_errors, (unsigned long long)resync.stats().skipped);
+   bench_check("resyncs after corruption and noise (99.9% of good)",
+               (double)found >= 0.999 * (double)(starts.size() - corrupted));
+}
+
+/* PRIVATE bench_library_count
+ *
+ * Notes:
+ *  +The library's own byte at a time receiver, for counts and a baseline.
+ */
+uint64_t bench_library_count(const bytes_t &stream)
+{
+   GenericPacket gp;
+   uint64_t count = 0;
+
+   gp_receive_byte(0, GP_CONTROL_INITIALIZE, &gp);
+   for(uint8_t byte : stream)
+   {
+      if(gp_receive_byte(byte, GP_CONTROL_RUN, &gp) == GP_CHECKSUM_MATCH)
+      {
+         count++;
+      }
+   }
+
+   return count;
+}
+
+double bench_seconds(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* PRIVATE bench_rates
+ *
+ * Notes:
+ *  +Sums a byte of every packet so the callback can't be optimised away.
+ */
+void bench_rates(const bytes_t &stream, double seconds)
+{
+   const size_t pieces[] = {64, 4096, 1 << 20};
+   volatile uint32_t sink = 0;
+   uint64_t total, packets;
+   double elapsed;
+
+   for(size_t piece : pieces)
+   {
+      auto start = std::chrono::steady_clock::now();
+
+      total = 0;
+      packets = 0;
+      do
+      {
+         gp_stream::decoder dec;
+         uint32_t sum = 0;
+
+         for(size_t at = 0; at < stream.size(); at += piece)
+         {
+            dec.feed(&(stream[at]), ((stream.size() - at) < piece) ? (stream.size() - at) : piece,
+                     [&](const gp_stream::packet &p) { sum += p.proj_spec(); });
+         }
+         sink = sink + sum;
+         total += stream.size();
+         packets += dec.stats().packets;
+         elapsed = bench_seconds(start);
+      } while(elapsed < seconds);
+
+      printf("  gp_stream %7zu byte pieces   %6.2f GB/s  %6.1f Mpackets/s\n",
+             piece, total / elapsed / 1e9, packets / elapsed / 1e6);
+   }
+
+   auto start = std::chrono::steady_clock::now();
+   packets = bench_library_count(stream);
+   elapsed = bench_seconds(start);
+   printf("  gp_receive_byte() a byte at a time  %6.2f GB/s  %6.1f Mpackets/s\n",
+          stream.size() / elapsed / 1e9, packets / elapsed / 1e6);
+}
+
+bool bench_read(const char *path, bytes_t &out)
+{
+   FILE *f = fopen(path, "rb");
+   uint8_t buf[65536];
+   size_t count;
+
+   if(f == NULL)
+   {
+      perror(path);
+      return false;
+   }
+   while((count = fread(buf, 1, sizeof(buf), f)) > 0)
+   {
+      out.insert(out.end(), buf, buf + count);
+   }
+   fclose(f);
+
+   return true;
+}
+
+int main(int argc, char **argv)
+{
+   double synthetic_mb = 32.0;
+   double seconds = 0.5;
+   int opt;
+
+   while((opt = getopt(argc, argv, "s:t:")) != -1)
+   {
+      switch(opt)
+      {
+         case 's':
+            synthetic_mb = atof(optarg);
+            break;
+         case 't':
+            seconds = atof(optarg);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-s synthetic_mb] [-t seconds] [capture ...]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   if(optind == argc)
+   {
+      bytes_t stream;
+      std::vector<size_t> starts;
+
+      bench_synthesize(stream, starts, (size_t)(synthetic_mb * 1e6));
+      bench_check_synthetic(stream, starts);
+      bench_check("gp_receive_byte() finds the same packets", bench_library_count(stream) == starts.size());
+      bench_rates(stream, seconds);
+   }
+
+   for(int ii = optind; ii < argc; ii++)
+   {
+      bytes_t stream;
+      gp_stream::decoder dec;
+
+      if(!bench_read(argv[ii], stream))
+      {
+         return 1;
+      }
+      dec.feed(stream.data(), stream.size(), [](const gp_stream::packet &) {});
+
+      printf("%s, %.1f MB\n", argv[ii], stream.size() / 1e6);
+      printf("  gp_stream %llu packets (%llu checksum errors, %llu bytes skipped), gp_receive_byte() %llu\n",
+             (unsigned long long)dec.stats().packets, (unsigned long long)dec.stats().checksum_errors,
+             (unsigned long long)dec.stats().skipped, (unsigned long long)bench_library_count(stream));
+      if(stream.size() > 0)
+      {
+         bench_rates(stream, seconds);
+      }
+   }
+
+   printf("%s\n", (bench_failures == 0) ? "PASS" : "FAIL");
+
+   return (bench_failures == 0) ? 0 : 2;
+}
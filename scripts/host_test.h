@@ -0,0 +1,76 @@
+/**
+ * @file host_test.h
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Checks and the pass or fail ending the host tests in scripts/
+ * share.
+ *
+ * Each test includes it once, from its one source file, so the functions
+ * are static here rather than in a library of their own.  A test calls
+ * test_check() for every check and ends main() with return test_summary().
+ * Only the first TEST_MAX_REPORTED failures are printed, the rest are
+ * counted.
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define TEST_MAX_REPORTED      20
+
+static uint32_t test_failures = 0;
+
+/**
+ *
+ * @fn void test_check(uint8_t ok, const char *run, const char *what, double detail)
+ * @brief Counts a failed check and prints it with the value that failed it.
+ * @param ok Non zero if the check passed.
+ * @param run Run the check belongs to.
+ * @param what What went wrong.
+ * @param detail The value that failed it, whole numbers print without
+ *        decimals.
+ * @return void
+ *
+ */
+static void test_check(uint8_t ok, const char *run, const char *what, double detail)
+{
+   if(ok == 0)
+   {
+      if(test_failures < TEST_MAX_REPORTED)
+      {
+         if((detail > -1e15)&&(detail < 1e15)&&(detail == (double)(int64_t)detail))
+         {
+            printf("FAIL %-8s %s (%lld)\n", run, what, (long long)detail);
+         }
+         else
+         {
+            printf("FAIL %-8s %s (%.3f)\n", run, what, detail);
+         }
+      }
+      test_failures++;
+   }
+}
+
+/**
+ *
+ * @fn int test_summary(void)
+ * @brief Prints whether every check passed.
+ * @return int 0 if every check passed, 2 if one failed, what main() exits
+ *         with.
+ *
+ */
+static int test_summary(void)
+{
+   printf("\n%s\n", (test_failures == 0) ? "every check passed" : "CHECKS FAILED");
+
+   if(test_failures > 0)
+   {
+      return 2;
+   }
+
+   return 0;
+}
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file lepton_compress_bench.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Compression ratio and cycles per line of lepton_compress.c on
+ * recorded or made up Lepton images.
+ *
+ * Every line goes through lepton_compress_line() the way get_image() sends
+ * it, lines that don't shrink are counted at their raw 164 bytes, and is
+ * decompressed again and compared byte for byte.  The ratio is raw bytes
+ * over bytes sent, packet framing left out.
+ *
+ * lepton_compress_bench [-f capture] [-n images]
+ *
+ *    -f   Raw VoSPI lines, 164 bytes each and 60 to an image, as read off
+ *         SPI.  The payloads of THERMAL_LEPTON_FRAME packets from a capture
+ *         with VOSPI_COMPRESS_LINES set to 0 are exactly that.  Without it
+ *         three made up scenes are used instead, a smooth room, the same
+ *         room with a person in it and pure noise as the worst case.
+ *    -n   Made up images per scene, 50 by default.
+ *
+ * Cycles are the PC's TSC.  The M4 takes more per line but the ratio is the
+ * same on both.
+ *
+ * Exits 0 if every line round tripped, 2 if one didn't.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC() __rdtsc()
+#else
+#define BENCH_TSC() 0ULL
+#endif
+
+#include "lepton_compress.h"
+
+#define BENCH_LINES_PER_IMAGE   60
+
+enum bench_scenes
+{
+   BENCH_SCENE_ROOM,
+   BENCH_SCENE_PERSON,
+   BENCH_SCENE_NOISE,
+   BENCH_SCENE_COUNT
+};
+
+const char *bench_scene_names[BENCH_SCENE_COUNT] = {"room", "person", "noise"};
+
+typedef struct {
+   uint64_t lines;
+   uint64_t raw_lines;                      /* Sent raw, NO_GAIN. */
+   uint64_t bytes_in;
+   uint64_t bytes_out;
+   uint64_t mismatches;
+   uint64_t modes[LEPTON_PRED_COUNT];
+   unsigned long long compress_cycles;
+   unsigned long long decompress_cycles;
+} bench_totals_t;
+
+uint32_t bench_seed = 0x1EB70;
+
+/* xorshift32, the same images every run. */
+uint32_t bench_random(void)
+{
+   bench_seed ^= bench_seed << 13;
+   bench_seed ^= bench_seed >> 17;
+   bench_seed ^= bench_seed << 5;
+   return bench_seed;
+}
+
+/* Roughly gaussian, sum of four uniforms, sigma counts. */
+double bench_noise(double sigma)
+{
+   double sum = 0.0;
+   uint8_t ii;
+
+   for(ii=0; ii<4; ii++)
+   {
+      sum += (double)(bench_random() & 0xFFFF) / 65535.0 - 0.5;
+   }
+
+   return sum * sigma * 1.732;
+}
+
+/* PRIVATE bench_make_image
+ *
+ * Notes:
+ *  +Fills 60 VoSPI lines.  Counts are 14 bit around 8000 like a Lepton in
+ *   radiometry off, with a few counts of noise on every pixel.
+ *  +The person is a soft edged ellipse about 400 counts warmer that walks
+ *   across from image to image.
+ */
+void bench_make_image(uint8_t *lines, uint8_t scene, uint32_t image)
+{
+   double value, dx, dy, r;
+   uint16_t pixel;
+   uint8_t *line;
+   uint8_t row, col;
+
+   for(row=0; row<BENCH_LINES_PER_IMAGE; row++)
+   {
+      line = &(lines[row * LEPTON_LINE_BYTES]);
+      line[0] = 0x00;
+      line[1] = row;
+      line[2] = (uint8_t)bench_random();
+      line[3] = (uint8_t)bench_random();
+
+      for(col=0; col<LEPTON_LINE_PIXELS; col++)
+      {
+         if(scene == BENCH_SCENE_NOISE)
+         {
+            pixel = (uint16_t)(bench_random() & 0x3FFF);
+         }
+         else
+         {
+            value = 7900.0 + (1.5 * col) + (0.8 * row) + (30.0 * sin((col + image) * 0.05));
+            if(scene == BENCH_SCENE_PERSON)
+            {
+               dx = (col - (10.0 + ((image * 3) % 60))) / 9.0;
+               dy = (row - 32.0) / 22.0;
+               r = (dx * dx) + (dy * dy);
+               value += 400.0 / (1.0 + exp((r - 1.0) * 8.0));
+            }
+            value += bench_noise(3.0);
+            pixel = (uint16_t)value & 0x3FFF;
+         }
+
+         line[LEPTON_LINE_HEADER_BYTES + (2 * col)] = (uint8_t)(pixel >> 8);
+         line[LEPTON_LINE_HEADER_BYTES + (2 * col) + 1] = (uint8_t)pixel;
+      }
+   }
+}
+
+/* PRIVATE bench_image
+ *
+ * Notes:
+ *  +One image through the codec, line by line as get_image() does it, with
+ *   the previous raw line as the reference.
+ */
+void bench_image(const uint8_t *lines, bench_totals_t *t)
+{
+   uint8_t out[LEPTON_COMPRESS_MAX_BYTES];
+   uint8_t back[LEPTON_LINE_BYTES];
+   const uint8_t *line, *prev;
+   unsigned long long c0, c1;
+   uint16_t out_len;
+   uint8_t retval;
+   uint8_t row;
+
+   for(row=0; row<BENCH_LINES_PER_IMAGE; row++)
+   {
+      line = &(lines[row * LEPTON_LINE_BYTES]);
+      prev = (row > 0) ? &(lines[(row - 1) * LEPTON_LINE_BYTES]) : NULL;
+
+      c0 = BENCH_TSC();
+      retval = lepton_compress_line(line, prev, out, LEPTON_LINE_BYTES, &out_len);
+      c1 = BENCH_TSC();
+      t->compress_cycles += c1 - c0;
+      t->lines++;
+      t->bytes_in += LEPTON_LINE_BYTES;
+
+      if(retval != LEPTON_COMPRESS_SUCCESS)
+      {
+         t->raw_lines++;
+         t->bytes_out += LEPTON_LINE_BYTES;
+         continue;
+      }
+
+      t->bytes_out += out_len;
+      t->modes[out[LEPTON_COMPRESS_LOC_MODE] >> 4]++;
+
+      c0 = BENCH_TSC();
+      retval = lepton_decompress_line(out, out_len, prev, back);
+      c1 = BENCH_TSC();
+      t->decompress_cycles += c1 - c0;
+
+      if((retval != LEPTON_COMPRESS_SUCCESS)||(memcmp(back, line, LEPTON_LINE_BYTES) != 0))
+      {
+         if(t->mismatches == 0)
+         {
+            printf("line %u doesn't round trip (%u)\n", row, retval);
+         }
+         t->mismatches++;
+      }
+   }
+}
+
+void bench_print(const char *name, const bench_totals_t *t)
+{
+   uint64_t compressed = t->lines - t->raw_lines;
+
+   printf("%-10s %7llu %6.1f%%   %5.2f:1   %8.0f   %8.0f    %3.0f%% %3.0f%% %3.0f%% %3.0f%%\n",
+          name, (unsigned long long)t->lines,
+          (t->lines != 0) ? 100.0 * (double)t->raw_lines / (double)t->lines : 0.0,
+          (t->bytes_out != 0) ? (double)t->bytes_in / (double)t->bytes_out : 0.0,
+          (t->lines != 0) ? (double)t->compress_cycles / (double)t->lines : 0.0,
+          (compressed != 0) ? (double)t->decompress_cycles / (double)compressed : 0.0,
+          (compressed != 0) ? 100.0 * (double)t->modes[LEPTON_PRED_LEFT] / (double)compressed : 0.0,
+          (compressed != 0) ? 100.0 * (double)t->modes[LEPTON_PRED_UP] / (double)compressed : 0.0,
+          (compressed != 0) ? 100.0 * (double)t->modes[LEPTON_PRED_AVG] / (double)compressed : 0.0,
+          (compressed != 0) ? 100.0 * (double)t->modes[LEPTON_PRED_MED] / (double)compressed : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+   uint8_t lines[BENCH_LINES_PER_IMAGE * LEPTON_LINE_BYTES];
+   bench_totals_t totals;
+   const char *capture = NULL;
+   uint64_t mismatches = 0;
+   uint32_t images = 50;
+   uint32_t ii;
+   uint8_t scene;
+   FILE *f;
+   int opt;
+
+   while((opt = getopt(argc, argv, "f:n:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'f':
+            capture = optarg;
+            break;
+         case 'n':
+            images = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-f capture] [-n images]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   printf("scene        lines  sent raw   ratio   cyc/line   cyc/line    left  up  avg  med\n");
+   printf("                                          compress  decompress\n");
+
+   if(capture != NULL)
+   {
+      f = fopen(capture, "rb");
+      if(f == NULL)
+      {
+         perror(capture);
+         return 1;
+      }
+
+      memset(&totals, 0, sizeof(totals));
+      while(fread(lines, LEPTON_LINE_BYTES, BENCH_LINES_PER_IMAGE, f) == BENCH_LINES_PER_IMAGE)
+      {
+         bench_image(lines, &totals);
+      }
+      fclose(f);
+
+      bench_print("capture", &totals);
+      mismatches += totals.mismatches;
+   }
+   else
+   {
+      for(scene=0; scene<BENCH_SCENE_COUNT; scene++)
+      {
+         memset(&totals, 0, sizeof(totals));
+         for(ii=0; ii<images; ii++)
+         {
+            bench_make_image(lines, scene, ii);
+            bench_image(lines, &totals);
+         }
+
+         bench_print(bench_scene_names[scene], &totals);
+         mismatches += totals.mismatches;
+      }
+   }
+
+   printf("\n%s\n", (mismatches == 0) ? "every line round tripped" : "LINES DIDN'T ROUND TRIP");
+
+   if(mismatches > 0)
+   {
+      return 2;
+   }
+
+   return 0;
+}
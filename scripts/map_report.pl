@@ -0,0 +1,171 @@
+#!/usr/bin/perl
+# Summarizes a GNU ld map file (main.map) per module: flash, SRAM and CCM
+# bytes, plus the code that runs from RAM.  Then lists everything placed in
+# RAM code or CCM so the RAMFUNC / CCM_BSS annotations can be checked, and
+# the fill of each memory region.
+#
+# Usage ./map_report.pl main.map [-v]
+#   -v  also list every input section with its address.
+use strict;
+use warnings;
+use File::Basename;
+
+my $numArgs = $#ARGV + 1;
+if(($numArgs < 1) || ($numArgs > 2)) {
+    die("Usage ./map_report.pl [main.map] [-v]\n");
+}
+my $verbose = (($numArgs == 2) && ($ARGV[1] eq '-v'));
+
+open(my $map, '<', $ARGV[0]) or die("Can't open $ARGV[0]: $!\n");
+
+my %regions;      # name -> [origin, length]
+my @region_order;
+my %modules;      # module -> {flash, sram, ccm, ramcode}
+my @placed;       # [output section, input section, address, size, module]
+my $in_memory_config = 0;
+my $in_map = 0;
+my $out_section = '';
+my $pending_input = '';
+
+# Which memory an address is in.
+sub region_of {
+    my ($addr) = @_;
+    foreach my $name (@region_order) {
+        my ($origin, $length) = @{$regions{$name}};
+        if(($addr >= $origin) && ($addr < ($origin + $length))) {
+            return $name;
+        }
+    }
+    return '';
+}
+
+# obj/main.o -> main, libfoo.a(bar.o) -> bar
+sub module_of {
+    my ($file) = @_;
+    if($file =~ /\(([^)]+)\)\s*$/) {
+        $file = $1;
+    }
+    my $module = basename($file);
+    $module =~ s/\.o$//;
+    return $module;
+}
+
+sub add_input {
+    my ($in_section, $addr, $size, $file) = @_;
+    return if($size == 0);
+
+    my $module = module_of($file);
+    my $region = region_of($addr);
+    $modules{$module} ||= {flash => 0, sram => 0, ccm => 0, ramcode => 0};
+
+    if($region =~ /FLASH/) {
+        $modules{$module}{flash} += $size;
+    }
+    elsif($region eq 'RAM') {
+        $modules{$module}{sram} += $size;
+        # .data and the code that runs from RAM also sit in flash as the
+        # copy the startup code loads from.
+        if($out_section =~ /^\.(data|ramfunc)$/) {
+            $modules{$module}{flash} += $size;
+        }
+        if($out_section eq '.ramfunc') {
+            $modules{$module}{ramcode} += $size;
+            push(@placed, [$out_section, $in_section, $addr, $size, $module]);
+        }
+    }
+    elsif($region eq 'CCMRAM') {
+        $modules{$module}{ccm} += $size;
+        if($out_section eq '.ccmram') {
+            $modules{$module}{flash} += $size;
+        }
+        push(@placed, [$out_section, $in_section, $addr, $size, $module]);
+    }
+
+    if($verbose) {
+        printf("%-16s %-32s 0x%08x %8d %s\n", $out_section, $in_section, $addr, $size, $module);
+    }
+}
+
+while(my $line = <$map>) {
+    chomp($line);
+
+    if($line =~ /^Memory Configuration/) {
+        $in_memory_config = 1;
+        next;
+    }
+    if($line =~ /^Linker script and memory map/) {
+        $in_memory_config = 0;
+        $in_map = 1;
+        next;
+    }
+
+    if($in_memory_config) {
+        if(($line =~ /^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)/) && ($1 ne '*default*')) {
+            $regions{$1} = [hex($2), hex($3)];
+            push(@region_order, $1);
+        }
+        next;
+    }
+
+    next unless($in_map);
+
+    # Output section, address on the same line or the next.
+    if($line =~ /^(\.\S+)/) {
+        $out_section = $1;
+        $pending_input = '';
+        next;
+    }
+
+    # Input section on one line.
+    if($line =~ /^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$/) {
+        add_input($1, hex($2), hex($3), $4);
+        $pending_input = '';
+        next;
+    }
+
+    # Long input section names put the address on the next line.
+    if($line =~ /^ (\.\S+|COMMON)\s*$/) {
+        $pending_input = $1;
+        next;
+    }
+    if(($pending_input ne '') && ($line =~ /^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$/)) {
+        add_input($pending_input, hex($1), hex($2), $3);
+        $pending_input = '';
+        next;
+    }
+    $pending_input = '';
+}
+close($map);
+
+die("No memory map found in $ARGV[0]\n") unless(@region_order);
+
+printf("\n%-32s %10s %10s %10s %10s\n", 'module', 'flash', 'sram', 'ccm', 'ram code');
+my %total = (flash => 0, sram => 0, ccm => 0, ramcode => 0);
+foreach my $module (sort { $modules{$b}{flash} + $modules{$b}{sram} + $modules{$b}{ccm} <=>
+                           $modules{$a}{flash} + $modules{$a}{sram} + $modules{$a}{ccm} } keys(%modules)) {
+    my $m = $modules{$module};
+    printf("%-32s %10d %10d %10d %10d\n", $module, $m->{flash}, $m->{sram}, $m->{ccm}, $m->{ramcode});
+    foreach my $key (keys(%total)) {
+        $total{$key} += $m->{$key};
+    }
+}
+printf("%-32s %10d %10d %10d %10d\n", 'total', $total{flash}, $total{sram}, $total{ccm}, $total{ramcode});
+
+print("\nPlaced in RAM code and CCM:\n");
+foreach my $p (sort { $a->[2] <=> $b->[2] } @placed) {
+    printf("  %-10s %-24s 0x%08x %8d %s\n", @{$p});
+}
+
+# The stack and heap come out of what's left of RAM.
+print("\nRegions:\n");
+my %used = (RAM => $total{sram}, CCMRAM => $total{ccm});
+foreach my $name (@region_order) {
+    my $length = $regions{$name}[1];
+    my $bytes = $used{$name};
+    if($name eq 'FLASH') {
+        $bytes = $total{flash};
+    }
+    next unless(defined($bytes));
+    printf("  %-10s %8d of %8d bytes (%5.1f%%)\n", $name, $bytes, $length, 100.0 * $bytes / $length);
+}
+print("\n");
@@ -0,0 +1,211 @@
+/**
+ * @file motor_control_bank_bench.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Checks motor_control_run_bank() against motor_control_run_q() and
+ * times both for 1 to MOTOR_CONTROL_BANK_AXES axes.
+ *
+ * Every axis gets its own gains and a command and measurement that wander
+ * through the whole range, saturation included.  Each tick the bank's out,
+ * ierr and derr have to equal the scalar controllers' exactly.
+ *
+ * Then for each axis count it times a tick of the bank against a loop of
+ * motor_control_run_q() calls, per axis, in ns and (on x86) TSC cycles.
+ *
+ * motor_control_bank_bench [-t ticks]
+ *
+ *    -t   Ticks timed per axis count, 1000000 by default.
+ *
+ * Exits 0 if the bank matched, 2 if it didn't.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC() __rdtsc()
+#else
+#define BENCH_TSC() 0ULL
+#endif
+
+#include "motor_control.h"
+
+#define CHECK_TICKS 20000
+
+uint32_t seed = 12345;
+
+uint32_t bench_rand(void)
+{
+   seed = (seed * 1103515245UL) + 12345UL;
+   return seed >> 8;
+}
+
+int32_t bench_range(int32_t range)
+{
+   return (int32_t)(bench_rand() % (uint32_t)(2 * range + 1)) - range;
+}
+
+void bench_gains(motor_control_bank_t *mcb, motor_control_q_t *mcq, uint8_t axes)
+{
+   uint8_t n;
+
+   for(n = 0; n < axes; n++)
+   {
+      motor_control_init_q(&mcq[n]);
+      mcq[n].kp = MOTOR_CONTROL_Q(1.0f) + bench_range(MOTOR_CONTROL_Q(8.0f));
+      mcq[n].ki = bench_range(MOTOR_CONTROL_Q(0.5f));
+      mcq[n].kd = bench_range(MOTOR_CONTROL_Q(64.0f));
+      mcq[n].kaw = bench_range(MOTOR_CONTROL_Q(1.0f));
+      mcq[n].kv = bench_range(MOTOR_CONTROL_Q(4.0f));
+      mcq[n].ka = bench_range(MOTOR_CONTROL_Q(0.5f));
+      mcq[n].i_limit = 1 + (int32_t)(bench_rand() % MOTOR_CONTROL_Q_OUT_MAX);
+      mcq[n].d_limit = 1 + (int32_t)(bench_rand() % MOTOR_CONTROL_Q_OUT_MAX);
+
+      mcb->kp[n] = mcq[n].kp;
+      mcb->ki[n] = mcq[n].ki;
+      mcb->kd[n] = mcq[n].kd;
+      mcb->kaw[n] = mcq[n].kaw;
+      mcb->kv[n] = mcq[n].kv;
+      mcb->ka[n] = mcq[n].ka;
+      mcb->i_limit[n] = mcq[n].i_limit;
+      mcb->d_limit[n] = mcq[n].d_limit;
+   }
+}
+
+void bench_inputs(motor_control_bank_t *mcb, motor_control_q_t *mcq, uint8_t axes, uint32_t tick)
+{
+   uint8_t n;
+   int32_t range;
+
+   for(n = 0; n < axes; n++)
+   {
+      /* Mostly small errors, now and then a huge one. */
+      range = ((tick + n) % 97 == 0) ? 0x3FFFFFFF : 5000;
+
+      mcb->cmd[n] = mcq[n].cmd = bench_range(range);
+      mcb->msr[n] = mcq[n].msr = bench_range(range);
+      mcb->ff_vel[n] = mcq[n].ff_vel = bench_range(range);
+      mcb->ff_acc[n] = mcq[n].ff_acc = bench_range(range);
+   }
+}
+
+uint32_t bench_check(uint8_t axes)
+{
+   motor_control_bank_t mcb;
+   motor_control_q_t mcq[MOTOR_CONTROL_BANK_AXES];
+   uint32_t tick, bad = 0;
+   uint8_t n;
+
+   motor_control_init_bank(&mcb, axes);
+   bench_gains(&mcb, mcq, axes);
+
+   for(tick = 0; tick < CHECK_TICKS; tick++)
+   {
+      bench_inputs(&mcb, mcq, axes, tick);
+
+      motor_control_run_bank(&mcb);
+      for(n = 0; n < axes; n++)
+      {
+         motor_control_run_q(&mcq[n]);
+         if((mcb.out[n] != mcq[n].out)||(mcb.ierr[n] != mcq[n].ierr)||(mcb.derr[n] != mcq[n].derr))
+         {
+            if(bad == 0)
+            {
+               printf("axes %u axis %u tick %u: bank out %d ierr %d derr %d, scalar out %d ierr %d derr %d\n",
+                      axes, n, tick, mcb.out[n], mcb.ierr[n], mcb.derr[n], mcq[n].out, mcq[n].ierr, mcq[n].derr);
+            }
+            bad++;
+         }
+      }
+   }
+
+   return bad;
+}
+
+double bench_ns(struct timespec *t0, struct timespec *t1)
+{
+   return ((t1->tv_sec - t0->tv_sec) * 1e9) + (t1->tv_nsec - t0->tv_nsec);
+}
+
+int main(int argc, char *argv[])
+{
+   motor_control_bank_t mcb;
+   motor_control_q_t mcq[MOTOR_CONTROL_BANK_AXES];
+   struct timespec t0, t1;
+   unsigned long long c0, c1;
+   double bank_ns, bank_cyc, q_ns, q_cyc;
+   uint32_t ticks = 1000000;
+   uint32_t tick, failures = 0;
+   volatile int32_t sink = 0;
+   uint8_t axes, n;
+   int opt;
+
+   while((opt = getopt(argc, argv, "t:")) != -1)
+   {
+      switch(opt)
+      {
+         case 't':
+            ticks = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-t ticks]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   for(axes = 1; axes <= MOTOR_CONTROL_BANK_AXES; axes++)
+   {
+      failures += bench_check(axes);
+   }
+   printf("bank %s motor_control_run_q() over %u ticks\n\n", (failures == 0) ? "matches" : "DOESN'T match", CHECK_TICKS);
+
+   printf("axes  bank ns/axis  cycles/axis   scalar ns/axis  cycles/axis\n");
+   for(axes = 1; axes <= MOTOR_CONTROL_BANK_AXES; axes++)
+   {
+      motor_control_init_bank(&mcb, axes);
+      bench_gains(&mcb, mcq, axes);
+      bench_inputs(&mcb, mcq, axes, 1);
+
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      c0 = BENCH_TSC();
+      for(tick = 0; tick < ticks; tick++)
+      {
+         mcb.msr[0] = (int32_t)(tick & 0xFF);
+         motor_control_run_bank(&mcb);
+         sink += mcb.out[axes - 1];
+      }
+      c1 = BENCH_TSC();
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      bank_ns = bench_ns(&t0, &t1) / ((double)ticks * axes);
+      bank_cyc = (double)(c1 - c0) / ((double)ticks * axes);
+
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      c0 = BENCH_TSC();
+      for(tick = 0; tick < ticks; tick++)
+      {
+         mcq[0].msr = (int32_t)(tick & 0xFF);
+         for(n = 0; n < axes; n++)
+         {
+            motor_control_run_q(&mcq[n]);
+         }
+         sink += mcq[axes - 1].out;
+      }
+      c1 = BENCH_TSC();
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      q_ns = bench_ns(&t0, &t1) / ((double)ticks * axes);
+      q_cyc = (double)(c1 - c0) / ((double)ticks * axes);
+
+      printf("%4u  %12.2f  %11.1f   %14.2f  %11.1f\n", axes, bank_ns, bank_cyc, q_ns, q_cyc);
+   }
+
+   if(failures > 0)
+   {
+      return 2;
+   }
+
+   return 0;
+}
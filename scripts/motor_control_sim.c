@@ -0,0 +1,517 @@
+/**
+ * @file motor_control_sim.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Closed loop checks and timing of motor_control.c on a simulated
+ * brushed DC motor and gearbox.
+ *
+ * The motor is the tilt axis' as far as we know it: 12 V across the TB6612,
+ * 111:1 gearbox, 25 line encoder on the motor shaft read as quadrature counts,
+ * coulomb and viscous friction.  It's integrated in 10 us steps with the
+ * controller run every 1 ms on the encoder count, the duty it returns held
+ * until the next sample.
+ *
+ * Runs, for both the float and the Q16.16 controller:
+ *
+ *    step      0.5 rad step, rise time, overshoot, 2% settling and final error.
+ *    windup    3 rad step that saturates the drive, with and without
+ *              back-calculation.
+ *    sweep     +/-pi/2 minimum jerk sweeps in 0.9 s like the tilt table, with
+ *              and without velocity and acceleration feed-forward.
+ *
+ * then checks two controllers interleaved sample by sample give the same
+ * output as each run alone, and times a call of each.
+ *
+ * Last it runs motor_autotune.c's relay experiment on the same motor and the
+ * 0.5 rad step again with the gains from each of its rules.  Their
+ * overshoot has to come down from Ziegler-Nichols to some overshoot to no
+ * overshoot, the last under SIM_NO_OVERSHOOT_PCT.
+ *
+ * motor_control_sim [-o csv] [-S max_overshoot_pct] [-T max_settle_ms]
+ *                   [-R max_sweep_rms_rad]
+ *
+ *    -o   Writes run, t, cmd, position and duty for every sample.
+ *    -S   Fails if a step overshoots more than this, 30% by default.
+ *    -T   Fails if a step takes longer than this to settle, 400 ms by default.
+ *    -R   Fails if a sweep with feed-forward tracks worse than this RMS,
+ *         0.01 rad by default.
+ *
+ * Exits 0 if every check passed, 2 if one failed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#include "motor_control.h"
+#include "motor_autotune.h"
+
+#define SIM_DT_S           10e-6
+#define SIM_SUBSTEPS       100            /* Per control sample. */
+#define SIM_LOOP_HZ        1000.0
+
+/* Motor, from the datasheet where there is one and a guess where not. */
+#define MOTOR_VOLTS        12.0
+#define MOTOR_OHMS         2.0
+#define MOTOR_KT           0.01           /* N m / A, and V s / rad. */
+#define MOTOR_J            5.0e-6         /* kg m^2, rotor. */
+#define MOTOR_B            1.0e-6         /* N m s / rad, rotor. */
+#define GEAR_RATIO         (24.0 * 74.0 / 16.0)
+#define GEAR_EFFICIENCY    0.8
+#define LOAD_J             2.0e-3         /* kg m^2, mirror and mount. */
+#define LOAD_COULOMB       0.05           /* N m at the output. */
+#define ENCODER_QCPR       (4.0 * 25.0)
+
+#define COUNTS_PER_RAD     ((ENCODER_QCPR * GEAR_RATIO) / (2.0 * M_PI))
+
+/* What the model needs for feed-forward, duty per rad/s and per rad/s^2 at
+ * the output.
+ */
+#define MODEL_KV           ((MOTOR_KT * GEAR_RATIO) / MOTOR_VOLTS)
+#define MODEL_KA           ((MOTOR_OHMS * (MOTOR_J + (LOAD_J / (GEAR_RATIO * GEAR_RATIO * GEAR_EFFICIENCY))) * GEAR_RATIO) / (MOTOR_KT * MOTOR_VOLTS))
+
+/* What motor_autotune.c's no overshoot rule may still overshoot by. */
+#define SIM_NO_OVERSHOOT_PCT   1.0
+
+typedef enum {CTRL_FLOAT, CTRL_Q} ctrl_kind;
+
+typedef struct {
+   double w;                      /* Motor rad/s. */
+   double theta;                  /* Output rad. */
+} motor_t;
+
+typedef struct {
+   ctrl_kind kind;
+   motor_control_pid_t f;
+   motor_control_q_t q;
+} ctrl_t;
+
+typedef struct {
+   double rise_ms;
+   double overshoot_pct;
+   double settle_ms;
+   double final_err_rad;
+   double rms_err_rad;
+   double max_err_rad;
+} result_t;
+
+FILE *csv = NULL;
+uint32_t run_number = 0;
+
+void motor_step(motor_t *m, double duty, double dt)
+{
+   double amps, torque, load, j;
+
+   amps = ((duty * MOTOR_VOLTS) - (MOTOR_KT * m->w)) / MOTOR_OHMS;
+   torque = (MOTOR_KT * amps) - (MOTOR_B * m->w);
+
+   /* Coulomb friction at the output, sticking when it can. */
+   load = LOAD_COULOMB / (GEAR_RATIO * GEAR_EFFICIENCY);
+   if(fabs(m->w) < 1e-3)
+   {
+      if(fabs(torque) <= load)
+      {
+         m->w = 0.0;
+         return;
+      }
+      load = (torque > 0.0) ? load : -load;
+   }
+   else
+   {
+      load = (m->w > 0.0) ? load : -load;
+   }
+
+   j = MOTOR_J + (LOAD_J / (GEAR_RATIO * GEAR_RATIO * GEAR_EFFICIENCY));
+   m->w += ((torque - load) / j) * dt;
+   m->theta += (m->w / GEAR_RATIO) * dt;
+}
+
+/* The tilt defaults, and the same controller in Q16.16 on counts. */
+void ctrl_init(ctrl_t *c, ctrl_kind kind, float aw, uint8_t ff)
+{
+   double rad_per_count = 1.0 / COUNTS_PER_RAD;
+   double q15 = 32768.0;
+
+   c->kind = kind;
+
+   motor_control_init_pid(&(c->f));
+   motor_control_set_ff_gains(&(c->f), ff ? MODEL_KV : 0.0f, ff ? MODEL_KA : 0.0f, aw);
+
+   motor_control_init_q(&(c->q));
+   c->q.kp = MOTOR_CONTROL_Q(c->f.p * rad_per_count * q15);
+   c->q.ki = MOTOR_CONTROL_Q(c->f.p * c->f.i * rad_per_count * q15);
+   c->q.kd = MOTOR_CONTROL_Q(c->f.p * c->f.d_dt * rad_per_count * q15);
+   c->q.kaw = MOTOR_CONTROL_Q(aw);
+   c->q.kv = MOTOR_CONTROL_Q(c->f.kv * rad_per_count * q15);
+   c->q.ka = MOTOR_CONTROL_Q(c->f.ka * rad_per_count * q15);
+   c->q.i_limit = (int32_t)(c->f.pid_limits.i_upper_limit * MOTOR_CONTROL_Q_OUT_MAX);
+   c->q.d_limit = (int32_t)(c->f.pid_limits.d_upper_limit * MOTOR_CONTROL_Q_OUT_MAX);
+}
+
+double ctrl_run(ctrl_t *c, double cmd, double vel, double acc, int32_t counts)
+{
+   if(c->kind == CTRL_FLOAT)
+   {
+      c->f.cmd = (float)cmd;
+      c->f.msr = (float)(counts / COUNTS_PER_RAD);
+      c->f.ff_vel = (float)vel;
+      c->f.ff_acc = (float)acc;
+      motor_control_run_pid(&(c->f));
+      return c->f.out;
+   }
+
+   c->q.cmd = (int32_t)lround(cmd * COUNTS_PER_RAD);
+   c->q.msr = counts;
+   c->q.ff_vel = (int32_t)lround(vel * COUNTS_PER_RAD);
+   c->q.ff_acc = (int32_t)lround(acc * COUNTS_PER_RAD);
+   return motor_control_run_q(&(c->q)) / 32768.0;
+}
+
+/* Minimum jerk from -a to +a and back, period t each way. */
+void sweep_at(double t, double a, double period, double *pos, double *vel, double *acc)
+{
+   double tau, s, sd, sdd;
+   uint32_t n = (uint32_t)(t / period);
+   double dir = (n & 1) ? -1.0 : 1.0;
+
+   tau = (t - (n * period)) / period;
+   s = (10.0 * pow(tau, 3)) - (15.0 * pow(tau, 4)) + (6.0 * pow(tau, 5));
+   sd = ((30.0 * pow(tau, 2)) - (60.0 * pow(tau, 3)) + (30.0 * pow(tau, 4))) / period;
+   sdd = ((60.0 * tau) - (180.0 * pow(tau, 2)) + (120.0 * pow(tau, 3))) / (period * period);
+
+   *pos = dir * (-a + (2.0 * a * s));
+   *vel = dir * 2.0 * a * sd;
+   *acc = dir * 2.0 * a * sdd;
+}
+
+/* Step of height step_rad, or sweeps when step_rad is 0. */
+result_t run(ctrl_t *c, double step_rad, double seconds)
+{
+   motor_t m = {0.0, 0.0};
+   result_t r;
+   uint32_t samples = (uint32_t)(seconds * SIM_LOOP_HZ);
+   uint32_t k, s;
+   double duty = 0.0;
+   double cmd, vel, acc, err, peak = 0.0, sum = 0.0;
+   double last_out = 0.0;
+   int32_t counts;
+   uint32_t n = 0;
+
+   memset(&r, 0, sizeof(r));
+   r.rise_ms = -1.0;
+   run_number++;
+
+   if(step_rad == 0.0)
+   {
+      /* Start on the profile. */
+      m.theta = -M_PI / 2.0;
+   }
+
+   for(k = 0; k < samples; k++)
+   {
+      double t = k / SIM_LOOP_HZ;
+
+      if(step_rad != 0.0)
+      {
+         cmd = step_rad;
+         vel = 0.0;
+         acc = 0.0;
+      }
+      else
+      {
+         sweep_at(t, M_PI / 2.0, 0.9, &cmd, &vel, &acc);
+      }
+
+      counts = (int32_t)floor(m.theta * COUNTS_PER_RAD);
+      duty = ctrl_run(c, cmd, vel, acc, counts);
+
+      if(csv != NULL)
+      {
+         fprintf(csv, "%u,%.4f,%.6f,%.6f,%.5f\n", run_number, t, cmd, m.theta, duty);
+      }
+
+      /* Tracking error is against where the axis is now, the step response
+       * against where this sample's duty takes it.
+       */
+      err = cmd - m.theta;
+
+      for(s = 0; s < SIM_SUBSTEPS; s++)
+      {
+         motor_step(&m, duty, SIM_DT_S);
+      }
+
+      if(step_rad != 0.0)
+      {
+         double frac = m.theta / step_rad;
+
+         if((r.rise_ms < 0.0)&&(frac >= 0.9))
+         {
+            r.rise_ms = (k + 1) * 1e3 / SIM_LOOP_HZ;
+         }
+         if(frac - 1.0 > peak)
+         {
+            peak = frac - 1.0;
+         }
+         if(fabs(frac - 1.0) > 0.02)
+         {
+            r.settle_ms = (k + 1) * 1e3 / SIM_LOOP_HZ;
+         }
+      }
+      else if(t >= 0.9)
+      {
+         /* First sweep is the start up, measure after it. */
+         sum += err * err;
+         n++;
+         if(fabs(err) > r.max_err_rad)
+         {
+            r.max_err_rad = fabs(err);
+         }
+      }
+      last_out = cmd - m.theta;
+   }
+
+   r.overshoot_pct = peak * 100.0;
+   r.final_err_rad = last_out;
+   r.rms_err_rad = (n > 0) ? sqrt(sum / n) : 0.0;
+
+   return r;
+}
+
+/* Two controllers run one sample each in turn must match each run alone. */
+uint32_t check_reentrant(void)
+{
+   ctrl_t a, b, a_alone, b_alone;
+   uint32_t k, bad = 0;
+   double cmd, vel, acc;
+
+   ctrl_init(&a, CTRL_FLOAT, 0.1f, 1);
+   ctrl_init(&b, CTRL_FLOAT, 0.1f, 1);
+   ctrl_init(&a_alone, CTRL_FLOAT, 0.1f, 1);
+   ctrl_init(&b_alone, CTRL_FLOAT, 0.1f, 1);
+
+   for(k = 0; k < 2000; k++)
+   {
+      sweep_at(k / SIM_LOOP_HZ, 1.0, 0.5, &cmd, &vel, &acc);
+      ctrl_run(&a, cmd, vel, acc, (int32_t)(k * 3));
+      ctrl_run(&b, -cmd, -vel, -acc, -(int32_t)(k * 5));
+   }
+   for(k = 0; k < 2000; k++)
+   {
+      sweep_at(k / SIM_LOOP_HZ, 1.0, 0.5, &cmd, &vel, &acc);
+      ctrl_run(&a_alone, cmd, vel, acc, (int32_t)(k * 3));
+   }
+   for(k = 0; k < 2000; k++)
+   {
+      sweep_at(k / SIM_LOOP_HZ, 1.0, 0.5, &cmd, &vel, &acc);
+      ctrl_run(&b_alone, -cmd, -vel, -acc, -(int32_t)(k * 5));
+   }
+
+   if((a.f.out != a_alone.f.out)||(a.f.derr != a_alone.f.derr)||(a.f.ierr != a_alone.f.ierr))
+   {
+      bad++;
+   }
+   if((b.f.out != b_alone.f.out)||(b.f.derr != b_alone.f.derr)||(b.f.ierr != b_alone.f.ierr))
+   {
+      bad++;
+   }
+
+   return bad;
+}
+
+double time_calls(ctrl_kind kind)
+{
+   ctrl_t c;
+   struct timespec t0, t1;
+   uint32_t k, calls = 10000000;
+   volatile double sink = 0.0;
+
+   ctrl_init(&c, kind, 0.1f, 1);
+
+   clock_gettime(CLOCK_MONOTONIC, &t0);
+   for(k = 0; k < calls; k++)
+   {
+      if(kind == CTRL_FLOAT)
+      {
+         c.f.cmd = (float)(k & 0xFF) * 1e-3f;
+         c.f.msr = (float)(k & 0x7F) * 1e-3f;
+         motor_control_run_pid(&(c.f));
+         sink += c.f.out;
+      }
+      else
+      {
+         c.q.cmd = (int32_t)(k & 0xFF);
+         c.q.msr = (int32_t)(k & 0x7F);
+         sink += motor_control_run_q(&(c.q));
+      }
+   }
+   clock_gettime(CLOCK_MONOTONIC, &t1);
+
+   return (((t1.tv_sec - t0.tv_sec) * 1e9) + (t1.tv_nsec - t0.tv_nsec)) / calls;
+}
+
+/* Relay experiment around 0 the way tilt_motor_control.c runs it. */
+uint8_t autotune(motor_autotune_t *mat)
+{
+   motor_t m = {0.0, 0.0};
+   double duty;
+   uint32_t k, s;
+
+   motor_autotune_start(mat, 0.0f, 0.3f, 4.0f / COUNTS_PER_RAD, 0.5f, 1.0f / SIM_LOOP_HZ);
+
+   for(k = 0; (k < 60000)&&(mat->state == MOTOR_AUTOTUNE_RUNNING); k++)
+   {
+      duty = motor_autotune_run(mat, (float)(floor(m.theta * COUNTS_PER_RAD) / COUNTS_PER_RAD));
+      for(s = 0; s < SIM_SUBSTEPS; s++)
+      {
+         motor_step(&m, duty, SIM_DT_S);
+      }
+   }
+
+   return mat->state;
+}
+
+int main(int argc, char *argv[])
+{
+   const char *names[] = {"float", "q16.16"};
+   const char *rule_names[] = {"ziegler-nichols", "some overshoot", "no overshoot", "tyreus-luyben"};
+   motor_autotune_t mat;
+   double rule_overshoot[MOTOR_AUTOTUNE_TYREUS_LUYBEN + 1];
+   float p, i, d;
+   uint8_t rule;
+   double max_overshoot = 30.0;
+   double max_settle = 400.0;
+   double max_rms = 0.01;
+   uint32_t failures = 0;
+   ctrl_t c;
+   result_t r, r_off;
+   int kind;
+   int opt;
+
+   while((opt = getopt(argc, argv, "o:S:T:R:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'o':
+            csv = fopen(optarg, "w");
+            if(csv == NULL)
+            {
+               perror(optarg);
+               return 1;
+            }
+            fprintf(csv, "run,t_s,cmd_rad,pos_rad,duty\n");
+            break;
+         case 'S':
+            max_overshoot = atof(optarg);
+            break;
+         case 'T':
+            max_settle = atof(optarg);
+            break;
+         case 'R':
+            max_rms = atof(optarg);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-o csv] [-S max_overshoot_pct] [-T max_settle_ms] [-R max_sweep_rms_rad]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   printf("motor  %.0f V, %.1f ohm, kt %.3f, %.1f:1, %.0f counts/rad, no load %.2f rad/s at the output\n",
+          MOTOR_VOLTS, MOTOR_OHMS, MOTOR_KT, GEAR_RATIO, COUNTS_PER_RAD, MOTOR_VOLTS / (MOTOR_KT * GEAR_RATIO));
+   printf("model feed-forward kv %.4f duty/(rad/s), ka %.5f duty/(rad/s^2)\n\n", MODEL_KV, MODEL_KA);
+
+   for(kind = CTRL_FLOAT; kind <= CTRL_Q; kind++)
+   {
+      ctrl_init(&c, (ctrl_kind)kind, 0.1f, 0);
+      r = run(&c, 0.5, 1.0);
+      printf("%-7s step 0.5 rad    rise %6.1f ms  overshoot %5.1f%%  settle %6.1f ms  final %+.5f rad\n",
+             names[kind], r.rise_ms, r.overshoot_pct, r.settle_ms, r.final_err_rad);
+      if((r.rise_ms < 0.0)||(r.overshoot_pct > max_overshoot)||(r.settle_ms > max_settle))
+      {
+         failures++;
+      }
+
+      ctrl_init(&c, (ctrl_kind)kind, 0.0f, 0);
+      r_off = run(&c, 3.0, 3.0);
+      ctrl_init(&c, (ctrl_kind)kind, 0.1f, 0);
+      r = run(&c, 3.0, 3.0);
+      printf("%-7s windup 3 rad    overshoot %5.1f%% clamp only, %5.1f%% back-calculation, settle %6.1f / %6.1f ms\n",
+             names[kind], r_off.overshoot_pct, r.overshoot_pct, r_off.settle_ms, r.settle_ms);
+      if(r.overshoot_pct > r_off.overshoot_pct)
+      {
+         failures++;
+      }
+
+      ctrl_init(&c, (ctrl_kind)kind, 0.1f, 0);
+      r_off = run(&c, 0.0, 4.5);
+      ctrl_init(&c, (ctrl_kind)kind, 0.1f, 1);
+      r = run(&c, 0.0, 4.5);
+      printf("%-7s sweep pi/2 0.9s rms %.5f max %.5f rad without feed-forward, rms %.5f max %.5f rad with\n",
+             names[kind], r_off.rms_err_rad, r_off.max_err_rad, r.rms_err_rad, r.max_err_rad);
+      if(r.rms_err_rad > max_rms)
+      {
+         failures++;
+      }
+   }
+
+   if(autotune(&mat) != MOTOR_AUTOTUNE_DONE)
+   {
+      printf("\nrelay autotune failed after %u samples\n", mat.ticks);
+      failures++;
+   }
+   else
+   {
+      printf("\nrelay autotune  Ku %.2f duty/rad, Pu %.1f ms, %u samples\n", mat.ku, mat.pu * 1e3, mat.ticks);
+      for(rule = MOTOR_AUTOTUNE_ZIEGLER_NICHOLS; rule <= MOTOR_AUTOTUNE_TYREUS_LUYBEN; rule++)
+      {
+         motor_autotune_gains(&mat, rule, &p, &i, &d);
+         ctrl_init(&c, CTRL_FLOAT, 0.1f, 0);
+         motor_control_set_pid_gains(&(c.f), p, i, d);
+         r = run(&c, 0.5, 2.0);
+         printf("%-16s p %6.2f i %.5f d %.4f   rise %6.1f ms  overshoot %5.1f%%  settle %6.1f ms  final %+.5f rad\n",
+                rule_names[rule], p, i, d, r.rise_ms, r.overshoot_pct, r.settle_ms, r.final_err_rad);
+         rule_overshoot[rule] = r.overshoot_pct;
+      }
+      if((rule_overshoot[MOTOR_AUTOTUNE_SOME_OVERSHOOT] >= rule_overshoot[MOTOR_AUTOTUNE_ZIEGLER_NICHOLS])||
+         (rule_overshoot[MOTOR_AUTOTUNE_NO_OVERSHOOT] >= rule_overshoot[MOTOR_AUTOTUNE_SOME_OVERSHOOT])||
+         (rule_overshoot[MOTOR_AUTOTUNE_NO_OVERSHOOT] > SIM_NO_OVERSHOOT_PCT))
+      {
+         printf("rules don't overshoot in the order they're named\n");
+         failures++;
+      }
+      /* Tyreus-Luyben, the one tilt_motor_control.c applies, has to meet the
+       * same limits as the fixed gains.
+       */
+      if((r.overshoot_pct > max_overshoot)||(r.settle_ms > max_settle))
+      {
+         failures++;
+      }
+   }
+
+   if(check_reentrant() != 0)
+   {
+      printf("\ninterleaved controllers don't match the same controllers run alone\n");
+      failures++;
+   }
+   else
+   {
+      printf("\ninterleaved controllers match\n");
+   }
+
+   printf("host timing  float %.1f ns/call, q16.16 %.1f ns/call\n", time_calls(CTRL_FLOAT), time_calls(CTRL_Q));
+
+   if(csv != NULL)
+   {
+      fclose(csv);
+   }
+
+   if(failures > 0)
+   {
+      printf("%u check(s) failed\n", failures);
+      return 2;
+   }
+
+   return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file profile_decode.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Host side decoder for UNIVERSAL_RESP_PROFILE packets.
+ *
+ * Reads the raw byte stream from the board on stdin, for example
+ *
+ *    stty -F /dev/ttyUSB0 raw 115200; ./profile_decode < /dev/ttyUSB0
+ *
+ * and prints one line per profiled section as the dump comes in.  Anything
+ * that isn't a profile packet is skipped.  Build with "make profile_decode".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "generic_packet.h"
+#include "gp_circular_buffer.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+#define PROFILE_DECODE_QUEUE_SIZE  4
+
+/* profile.h pulls in the STM32 headers, so these are copies.  Keep them in
+ * sync with enum profile_ids and PROFILE_HIST_BINS.
+ */
+#define PROFILE_NUM_IDS            18
+#define PROFILE_HIST_BINS          20
+
+const char *profile_decode_names[PROFILE_NUM_IDS] =
+{
+   "TIM5",
+   "TIM12",
+   "TIM9",
+   "TIM10",
+   "TIM11",
+   "DMA2_Stream7",
+   "DMA1_Stream6",
+   "DMA2_Stream6",
+   "USART2",
+   "EXTI15_10",
+   "SysTick",
+   "TIM2",
+   "fdud_spin",
+   "rs485_master_spin",
+   "rs485_slave_spin",
+   "DMA2_Stream0",
+   "TIM3",
+   "TIM7"
+};
+
+GenericPacketCircularBuffer profile_decode_gpcb;
+GenericPacket profile_decode_queue[PROFILE_DECODE_QUEUE_SIZE];
+
+/* Used Internally */
+void profile_decode_print(GenericPacket *gp, double cycles_per_usec);
+
+int main(int argc, char *argv[])
+{
+   double core_mhz;
+   int c;
+
+   /* SystemCoreClock on the board, 168MHz unless told otherwise. */
+   core_mhz = (argc > 1) ? atof(argv[1]) : 168.0;
+   if(core_mhz <= 0.0)
+   {
+      fprintf(stderr, "usage: %s [core clock MHz] < stream\n", argv[0]);
+      return 1;
+   }
+
+   gpcb_initialize(&profile_decode_gpcb, profile_decode_queue, PROFILE_DECODE_QUEUE_SIZE);
+
+   printf("%-18s %10s %10s %10s %10s %11s %8s\n",
+          "section", "count", "min us", "mean us", "max us", "latency us", "load %");
+
+   while((c = getchar()) != EOF)
+   {
+      gpcb_receive_byte((uint8_t)c, &profile_decode_gpcb);
+
+      while(gpcb_increment_tail(&profile_decode_gpcb) == GP_CIRC_BUFFER_SUCCESS)
+      {
+         profile_decode_print(&(profile_decode_gpcb.gpcb[profile_decode_gpcb.gpcb_tail]), core_mhz);
+      }
+   }
+
+   return 0;
+}
+
+/* PRIVATE profile_decode_print
+ *
+ * Notes:
+ *  +Prints one table row for a UNIVERSAL_RESP_PROFILE packet, skips anything
+ *   else.
+ *  +The histogram is printed under the row when the section ran at all, one
+ *   count per power of two cycles starting at bin 0.
+ */
+void profile_decode_print(GenericPacket *gp, double cycles_per_usec)
+{
+   uint8_t id;
+   uint32_t count, min_cycles, max_cycles, mean_cycles, max_latency, load_ppm;
+   uint16_t hist[PROFILE_HIST_BINS];
+   const char *name;
+   uint8_t ii;
+
+   if((gp->gp[GP_LOC_PROJ_ID] != GP_PROJ_UNIVERSAL)||(gp->gp[GP_LOC_PROJ_SPEC] != UNIVERSAL_RESP_PROFILE))
+   {
+      return;
+   }
+
+   if(extract_universal_profile(gp, &id, &count, &min_cycles, &max_cycles, &mean_cycles,
+                                &max_latency, &load_ppm, hist, PROFILE_HIST_BINS) != GP_SUCCESS)
+   {
+      return;
+   }
+
+   name = (id < PROFILE_NUM_IDS) ? profile_decode_names[id] : "?";
+
+   printf("%-18s %10u %10.2f %10.2f %10.2f %11.2f %8.3f\n", name, count,
+          min_cycles / cycles_per_usec, mean_cycles / cycles_per_usec,
+          max_cycles / cycles_per_usec, max_latency / cycles_per_usec,
+          load_ppm / 10000.0);
+
+   if(count != 0)
+   {
+      printf("%-18s", "  log2 cycles");
+      for(ii=0; ii<PROFILE_HIST_BINS; ii++)
+      {
+         printf(" %u", hist[ii]);
+      }
+      printf("\n");
+   }
+}
@@ -0,0 +1,373 @@
+/**
+ * @file quad_encoder_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief quad_encoder.c replaying quadrature motion on a simulated 16 bit
+ * counter.
+ *
+ * The shaft moves one count at a time at 1 us resolution.  The port here is
+ * the counter it drives: it wraps at 16 bits and raises an update, latches
+ * the count on every channel A rising edge, and services both after an
+ * interrupt latency the way TIM3's handlers would, the update first.  The
+ * timestamps are the microseconds.
+ *
+ * The motion, one segment after the other:
+ *
+ *    sine      +/-200000 counts, crossing the 16 bit wrap both ways and
+ *              going negative.
+ *    fast      A constant 50000 counts/s.
+ *    crawl     37 counts/s, an edge every 108 ms.
+ *    stop      Longer than QUAD_ENCODER_STOP_MS.
+ *    reverse   A constant -5000 counts/s.
+ *
+ * Checks:
+ *
+ *    Position is read every microsecond, including while an update is
+ *    pending, and has to be exactly the shaft.
+ *
+ *    Velocity is sampled every millisecond.  On the constant segments, once
+ *    two samples have had edges, it has to be within 0.1% of the speed.  While stopped
+ *    it can't be more than one line over the time since the last edge and is
+ *    zero once QUAD_ENCODER_STOP_MS has passed.  On the sine it only has to
+ *    follow to within 1% of the peak speed, the edges thin out at the
+ *    turnarounds where the acceleration is highest.
+ *
+ *    quad_encoder_set_position() moves the reading and nothing else.
+ *
+ * quad_encoder_test [-l latency_us]
+ *
+ *    -l   Interrupt latency, 2 us by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "quad_encoder.h"
+#include "host_test.h"
+
+#define TEST_TICK_HZ           1000000
+#define TEST_SAMPLE_US         1000
+#define TEST_NONE              0xFFFFFFFF
+
+#define TEST_SINE_COUNTS       200000.0
+#define TEST_SINE_US           2000000
+
+enum test_motions
+{
+   TEST_SINE,
+   TEST_CONSTANT,
+   TEST_STOP
+};
+
+typedef struct {
+   const char *name;
+   uint8_t motion;
+   int32_t speed;          /* Counts per second for TEST_CONSTANT. */
+   uint32_t us;
+} test_segment_t;
+
+const test_segment_t test_segments[] = {
+   {"sine", TEST_SINE, 0, TEST_SINE_US},
+   {"fast", TEST_CONSTANT, 50000, 1000000},
+   {"crawl", TEST_CONSTANT, 37, 2000000},
+   {"stop", TEST_STOP, 0, 500000},
+   {"reverse", TEST_CONSTANT, -5000, 500000},
+};
+
+#define TEST_NUM_SEGMENTS      (sizeof(test_segments) / sizeof(test_segments[0]))
+
+/* The simulated counter and its interrupts. */
+uint32_t test_us = 0;
+uint16_t test_counter = 0;
+uint8_t test_update_pending = 0;
+uint32_t test_update_due = TEST_NONE;
+uint16_t test_capture = 0;
+uint32_t test_capture_ticks = 0;
+uint32_t test_capture_due = TEST_NONE;
+uint32_t test_latency = 2;
+
+/* The shaft. */
+int32_t test_position = 0;
+int32_t test_offset = 0;
+uint32_t test_last_edge_us = 0;
+uint32_t test_edges = 0;
+uint32_t test_serviced = 0;                 /* Edges handed to quad_encoder_edge(). */
+uint32_t test_serviced_us = 0;              /* And when the last of them was. */
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_port_init(void)
+{
+   test_counter = 0;
+   test_update_pending = 0;
+   test_update_due = TEST_NONE;
+   test_capture_due = TEST_NONE;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint16_t quad_encoder_port_count(void)
+{
+   return test_counter;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t quad_encoder_port_overflow_pending(void)
+{
+   return test_update_pending;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t quad_encoder_port_ticks(void)
+{
+   return test_us;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t quad_encoder_port_tick_hz(void)
+{
+   return TEST_TICK_HZ;
+}
+
+/* PRIVATE test_step
+ *
+ * Notes:
+ *  +Moves the shaft one count.  A is high in quadrature states 1 and 2, so
+ *   it rises going from 0 to 1 up and from 3 to 2 down.
+ */
+void test_step(int8_t direction)
+{
+   test_position += direction;
+   test_counter += direction;
+
+   if(((direction > 0)&&(test_counter == 0))||((direction < 0)&&(test_counter == 0xFFFF)))
+   {
+      test_update_pending = 1;
+      if(test_update_due == TEST_NONE)
+      {
+         test_update_due = test_us + test_latency;
+      }
+   }
+
+   if(((direction > 0)&&((test_position & 3) == 1))||((direction < 0)&&((test_position & 3) == 2)))
+   {
+      /* A capture that isn't serviced yet is overwritten, like the part,
+       * but the interrupt was already on its way.
+       */
+      test_capture = test_counter;
+      test_capture_ticks = test_us;
+      if(test_capture_due == TEST_NONE)
+      {
+         test_capture_due = test_us + test_latency;
+      }
+      test_last_edge_us = test_us;
+      test_edges++;
+   }
+}
+
+/* PRIVATE test_interrupts
+ *
+ * Notes:
+ *  +Services whatever is due, the update before a capture.
+ */
+void test_interrupts(void)
+{
+   uint8_t capture = (test_capture_due != TEST_NONE)&&(test_us >= test_capture_due);
+
+   if((test_update_pending)&&((test_us >= test_update_due)||(capture)))
+   {
+      test_update_pending = 0;
+      test_update_due = TEST_NONE;
+      quad_encoder_overflow(test_counter);
+   }
+
+   if(capture)
+   {
+      test_capture_due = TEST_NONE;
+      quad_encoder_edge(test_capture, test_capture_ticks);
+      test_serviced++;
+      test_serviced_us = test_capture_ticks;
+   }
+}
+
+int32_t test_floor_div(int64_t a, int64_t b)
+{
+   int64_t q = a / b;
+
+   if(((a % b) != 0)&&((a < 0) != (b < 0)))
+   {
+      q--;
+   }
+
+   return (int32_t)q;
+}
+
+int main(int argc, char *argv[])
+{
+   const test_segment_t *seg;
+   uint32_t segment, elapsed, segment_us;
+   uint32_t sampled_edges = 0;
+   uint32_t sampled;             /* Samples in this segment that got a new edge. */
+   uint32_t pending_reads = 0;
+   uint32_t wraps = 0;
+   int32_t start, target, read;
+   double worst_error, peak, error, bound;
+   float velocity;
+   int opt;
+
+   while((opt = getopt(argc, argv, "l:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'l':
+            test_latency = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-l latency_us]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   quad_encoder_read_position(&read);
+   test_check(read == 0, "init", "position before init", read);
+
+   quad_encoder_init();
+
+   printf("%u us interrupt latency, velocity sampled every %u us\n\n", test_latency, TEST_SAMPLE_US);
+   printf("segment   speed/s   worst velocity error\n");
+
+   for(segment=0; segment<TEST_NUM_SEGMENTS; segment++)
+   {
+      seg = &(test_segments[segment]);
+      start = test_position;
+      sampled = 0;
+      segment_us = test_us;
+      worst_error = 0.0;
+      peak = (2.0 * M_PI * TEST_SINE_COUNTS * TEST_TICK_HZ) / TEST_SINE_US;
+
+      for(elapsed=1; elapsed<=seg->us; elapsed++)
+      {
+         test_us++;
+
+         if(seg->motion == TEST_SINE)
+         {
+            target = start + (int32_t)floor(TEST_SINE_COUNTS * sin((2.0 * M_PI * elapsed) / TEST_SINE_US));
+         }
+         else if(seg->motion == TEST_CONSTANT)
+         {
+            target = start + test_floor_div((int64_t)seg->speed * elapsed, TEST_TICK_HZ);
+         }
+         else
+         {
+            target = test_position;
+         }
+
+         while(test_position != target)
+         {
+            if((test_counter == 0xFFFF)&&(target > test_position))
+            {
+               wraps++;
+            }
+            test_step((target > test_position) ? 1 : -1);
+         }
+
+         test_interrupts();
+
+         quad_encoder_read_position(&read);
+         test_check(read == test_position + test_offset, seg->name, "position", read - (test_position + test_offset));
+         if(test_update_pending)
+         {
+            pending_reads++;
+         }
+
+         if((elapsed % TEST_SAMPLE_US) != 0)
+         {
+            continue;
+         }
+
+         quad_encoder_sample();
+         velocity = quad_encoder_read_velocity();
+
+         /* The estimate is all this segment's once two samples got edges
+          * from it.
+          */
+         if((test_serviced != sampled_edges)&&(test_serviced_us > segment_us))
+         {
+            sampled++;
+         }
+         sampled_edges = test_serviced;
+
+         if((seg->motion != TEST_STOP)&&(sampled < 2))
+         {
+            continue;
+         }
+
+         if(seg->motion == TEST_SINE)
+         {
+            /* The estimate spans the last sample, so it's compared half a
+             * sample back.
+             */
+            error = velocity - (peak * cos((2.0 * M_PI * (elapsed - (TEST_SAMPLE_US / 2))) / TEST_SINE_US));
+            if(fabs(error) > worst_error)
+            {
+               worst_error = fabs(error);
+            }
+         }
+         else if(seg->motion == TEST_CONSTANT)
+         {
+            error = velocity - seg->speed;
+            if(fabs(error) > worst_error)
+            {
+               worst_error = fabs(error);
+            }
+            test_check(fabs(error) <= 0.001 * abs(seg->speed), seg->name, "velocity", velocity);
+         }
+         else
+         {
+            bound = ((double)QUAD_ENCODER_COUNTS_PER_LINE * TEST_TICK_HZ) / (test_us - test_last_edge_us);
+            test_check(fabs(velocity) <= bound * 1.0001, seg->name, "velocity past one line since the edge", velocity);
+            if(elapsed >= (QUAD_ENCODER_STOP_MS * (TEST_TICK_HZ / 1000)) + TEST_SAMPLE_US)
+            {
+               test_check(velocity == 0.0f, seg->name, "still moving", velocity);
+            }
+            if(fabs(velocity) > worst_error)
+            {
+               worst_error = fabs(velocity);
+            }
+         }
+      }
+
+      if(seg->motion == TEST_SINE)
+      {
+         test_check(worst_error <= 0.01 * peak, seg->name, "velocity doesn't follow", worst_error);
+         printf("%-8s %8.0f   %.1f (%.3f%% of peak)\n", seg->name, peak, worst_error, (100.0 * worst_error) / peak);
+      }
+      else if(seg->motion == TEST_CONSTANT)
+      {
+         printf("%-8s %8d   %.4f (%.4f%%)\n", seg->name, seg->speed, worst_error, (100.0 * worst_error) / abs(seg->speed));
+      }
+      else
+      {
+         test_check(quad_encoder_read_velocity() == 0.0f, seg->name, "velocity at the end", quad_encoder_read_velocity());
+         printf("%-8s %8d   %.4f (largest while stopped)\n", seg->name, 0, worst_error);
+      }
+   }
+
+   /* Only the reading moves. */
+   velocity = quad_encoder_read_velocity();
+   quad_encoder_set_position(1000);
+   test_offset = 1000 - test_position;
+   quad_encoder_read_position(&read);
+   test_check(read == 1000, "offset", "position after set", read);
+   test_check(quad_encoder_read_velocity() == velocity, "offset", "velocity changed", quad_encoder_read_velocity());
+
+   printf("\n%u upward wraps, %u reads with the update pending\n", wraps, pending_reads);
+   test_check((pending_reads > 0)||(test_latency == 0), "end", "no read landed on a pending update", 0);
+
+   return test_summary();
+}
@@ -0,0 +1,1119 @@
+/**
+ * @file rs485_bus_sim.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief The RS485 master on simulated peripherals against modelled slaves.
+ *
+ * Links the real rs485_sensor_bus_master.c with hal_host.c.  The slaves are
+ * modelled here.  Each one answers a sensor info query addressed to it after
+ * its turnaround, a fixed delay plus a random jitter, and the response lands
+ * on USART2 when its last byte would have.  A main loop pass, which is where
+ * the master checks responses, runs every SIM_SPIN_NS.
+ *
+ * Every run starts from reset, lets discovery finish and the poll rates
+ * settle, and then counts for the measurement window.  Stop-and-wait and
+ * pipelined runs are printed side by side.
+ *
+ * A third run adds broadcast snapshots (rs485_master_set_snapshot_rate()) to
+ * the pipelined polling.  Each slave keeps its own state machine tick, at a
+ * random phase to the master's, and answers the sync broadcast in its slot
+ * the way rs485_sensor_bus_slave.c does: counted from the first of its ticks
+ * after the broadcast ended, plus the jitter.  Frames that overlap on the bus
+ * collide and reach the master as one garbled frame.  Every snapshot without
+ * a collision has to end with the master crediting exactly the slots that
+ * were sent in.
+ *
+ * A fourth run keeps the pipelined polling going and sends
+ * rs485_master_query_unique_id(RS485_ADDRESS_CONFIGURATION) every
+ * SIM_QUERY_NS.  Unassigned slaves, with unique IDs of their own, answer it
+ * in a random configuration slot the way rs485_sensor_bus_slave.c does and
+ * stop once their ID has been passed upstream, as if the host had given them
+ * an address.  Every unassigned slave has to be passed upstream exactly
+ * once, intact.
+ *
+ * Every response carries the slave in pose.x and a number of its own in
+ * pose.y.  Whatever the master sends on the link is read back.  Each
+ * response that reached the master intact has to be passed upstream once,
+ * unchanged, or be counted by rs485_master_forward_drops(), and nothing
+ * else may show up there.
+ *
+ * Every address above the last slave is absent.  The master re-probes those
+ * on its back-off, and the probes together can't hold the bus for more than
+ * one probe timeout in every RS485_MASTER_PROBE_SPACING_MSEC.
+ *
+ * rs485_bus_sim [-n slaves] [-a] [-t seconds] [-r hz] [-l usec] [-j usec] [-e ppm] [-S hz] [-w usec] [-u slaves] [-s seed]
+ *
+ *    -n   Slaves on the bus, addresses 1 up, 4 by default.
+ *    -a   Pipelined polling only, once for every number of slaves from 1 to
+ *         RS485_MASTER_MAX_SLAVES, for the aggregate rate against the number
+ *         of slaves.  -n is ignored.
+ *    -t   Measurement window, 1 second by default.
+ *    -r   Poll rate asked of every slave, RS485_SENSOR_BUS_SM_HZ (as fast as
+ *         the bus goes) by default.
+ *    -l   Slave turnaround, 10 usec by default.
+ *    -j   Random extra turnaround, 0 to this, 5 usec by default.  The
+ *         responses land whole, so the master doesn't see a first byte until
+ *         the last one is in.  Turnaround and response together have to fit
+ *         a slave's timeout here, where only the turnaround does on the
+ *         bus, which a jitter over about 10 usec doesn't.
+ *    -e   Responses, in parts per million, that arrive with a bit flipped.
+ *         1000 by default.  Snapshot slots are credited by timing alone, so
+ *         their responses are always sent intact.
+ *    -S   Snapshots per second in the snapshot run, 100 by default.
+ *    -w   Snapshot slot width, the minimum RS485_TDMA_MIN_SLOT_TICKS by
+ *         default.
+ *    -u   Unassigned slaves in the unique ID run, 6 by default.
+ *    -s   Seed for the jitter, the errors and the slave tick phases, 1 by
+ *         default.
+ *
+ * Last, rs485_master_record_turnaround() is fed the same turnarounds on its
+ * own.  Its p99 estimate has to come down from a far off first sample, and
+ * from a spell SIM_P99_STEP_USEC slower, within SIM_P99_SETTLE samples and
+ * then have about 1% of the samples above it.
+ *
+ * A corrupt response has to count as a miss, never as an answer or a
+ * turnaround sample.  Exits 0 if the master counted exactly the good
+ * responses and passed them upstream in every run, every snapshot was collision free and credited
+ * right, every unique ID passed upstream once and the p99 estimate
+ * settled, 2 if not.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hal.h"
+#include "trace.h"
+#include "event_scheduler.h"
+#include "full_duplex_usart_dma.h"
+#include "rs485_sensor_bus.h"
+
+#include "gp_circular_buffer.h"
+
+/* Main loop pass interval. */
+#define SIM_SPIN_NS            1000ULL
+
+/* Discovery and the first back-off of the absent addresses. */
+#define SIM_SETTLE_NS          500000000ULL
+
+/* Long enough for every response on board to be checked, and for an
+ * exchange waiting on a garbled frame to time out.
+ */
+#define SIM_DRAIN_NS           (1000000ULL * (RS485_MASTER_RESPONSE_TIMEOUT_MSEC + 2))
+
+#define SIM_BYTE_NS            ((10ULL * 1000000000ULL) / RS485_SENSOR_BUS_BAUD)
+#define SIM_TICK_NS            (1000000000ULL / RS485_SENSOR_BUS_SM_HZ)
+
+/* Frames on the bus at once.  Polls have one, a snapshot one per slave. */
+#define SIM_MAX_FRAMES         (RS485_MASTER_MAX_SLAVES + 1)
+
+#define SIM_STOP_AND_WAIT      0
+#define SIM_PIPELINED          1
+#define SIM_SNAPSHOT           2
+#define SIM_UNIQUE_ID          3
+#define SIM_RUNS               4
+
+/* Unique ID queries in the unique ID run, one every SIM_QUERY_NS. */
+#define SIM_QUERY_NS           20000000ULL
+
+/* What a frame on the bus is, a collision makes any of them corrupt. */
+#define SIM_FRAME_CORRUPT      0
+#define SIM_FRAME_SENSOR_INFO  1
+#define SIM_FRAME_UNIQUE_ID    2
+
+/* Responses numbered in a run, pose.y holds them exactly.  Any past the
+ * last are sent as -1 and only counted.
+ */
+#define SIM_SEQUENCES          (1UL << 20)
+
+/* hal_host_run_until() stops on the core cycle at or before the time asked. */
+#define SIM_CYCLE_NS           ((1000000000ULL + HAL_HOST_CORE_HZ - 1) / HAL_HOST_CORE_HZ)
+
+/* The p99 check.  Samples to settle in after a far off first sample or a
+ * step in the turnaround, the step, and the samples the share above the
+ * estimate is counted over.
+ */
+#define SIM_P99_SETTLE         150
+#define SIM_P99_STEP_USEC      100
+#define SIM_P99_STEP_SAMPLES   300
+#define SIM_P99_SAMPLES        5000
+
+/* From rs485_sensor_bus_master.c. */
+extern rs485_master_states master_state;
+extern volatile uint32_t rs485_master_slots_heard;
+extern rs485_slave_entry_t rs485_slave_table[RS485_MASTER_MAX_SLAVES];
+void rs485_master_record_turnaround(uint8_t address, uint32_t turnaround_usec);
+
+/* The window's counts give the rates.  The check is on the whole run so an
+ * exchange straddling either end of the window can't throw it off.
+ */
+typedef struct {
+   uint32_t responses;      /* Counted by the master in the window. */
+   uint32_t timeouts;       /* Counted by the master in the window. */
+   uint32_t bus_bytes;      /* Both directions in the window. */
+   uint32_t max_p99_usec;   /* At the end of the window. */
+   uint32_t good;           /* Responses sent intact, whole run. */
+   uint32_t corrupt;        /* Responses sent with a bit flipped, whole run. */
+   uint32_t total_responses;
+   uint32_t total_timeouts;
+   uint32_t snapshots;      /* Finished in the window. */
+   uint32_t slots;          /* Slot responses that reached the master in the window. */
+   uint32_t credited;       /* Slots the master credited, whole run. */
+   uint32_t collisions;     /* Whole run. */
+   uint32_t miscredited;    /* Snapshots without a collision credited wrong, whole run. */
+   uint32_t probes;         /* Queries to absent addresses in the window. */
+   uint32_t infos_in;       /* Responses that reached the master intact, whole run. */
+   uint32_t infos_out;      /* Responses passed upstream, whole run. */
+   uint32_t infos_repeated; /* Passed upstream more than once, whole run. */
+   uint32_t infos_wrong;    /* Passed upstream but never sent, whole run. */
+   uint32_t queries;        /* Unique ID queries, whole run. */
+   uint32_t ids_in;         /* Unique IDs that reached the master intact, whole run. */
+   uint32_t ids_out;        /* Unique IDs passed upstream, whole run. */
+   uint32_t ids_repeated;   /* Passed upstream more than once, whole run. */
+   uint32_t ids_wrong;      /* Passed upstream but never sent, whole run. */
+   uint32_t link_garbled;   /* Packets on the link failing their checksum. */
+   uint32_t forward_drops;  /* rs485_master_forward_drops(), whole run. */
+} sim_counts_t;
+
+/* A response on its way.  slots has a bit for every snapshot slot in it,
+ * none for a poll response.  kind is one of SIM_FRAME_*.
+ */
+typedef struct {
+   uint8_t data[GP_MAX_PACKET_LENGTH];
+   uint16_t length;
+   uint64_t start;
+   uint64_t end;
+   uint32_t slots;
+   uint8_t kind;
+} sim_frame_t;
+
+uint32_t sim_slaves = 4;
+uint32_t sim_turnaround_ns = 10000;
+uint32_t sim_jitter_ns = 5000;
+uint32_t sim_error_ppm = 1000;
+uint32_t sim_snapshot_hz = 100;
+uint32_t sim_slot_usec = 0;
+uint32_t sim_unassigned = 6;
+uint32_t sim_seed = 1;
+
+/* Responses in order of their first byte. */
+sim_frame_t sim_frames[SIM_MAX_FRAMES];
+uint8_t sim_frame_count = 0;
+
+/* Each slave's tick phase against the master's, and what went out in the
+ * snapshot running now.
+ */
+uint64_t sim_phase_ns[RS485_MASTER_MAX_SLAVES];
+uint32_t sim_snapshot_sent = 0;
+uint8_t sim_snapshot_collided = 0;
+rs485_master_states sim_last_state = RS485_MASTER_INIT;
+
+/* Bus use is only counted in the window, answers stop once it's over. */
+uint8_t sim_counting = 0;
+uint8_t sim_answering = 1;
+sim_counts_t sim_counts;
+
+GenericPacket sim_rx_packets[4];
+GenericPacketCircularBuffer sim_rx;
+
+/* Each numbered response's pose.x, and how many times it went upstream. */
+uint8_t sim_sent_x[SIM_SEQUENCES];
+uint8_t sim_passed[SIM_SEQUENCES];
+uint32_t sim_sequence = 0;
+
+/* The unassigned slaves, and how many times each ID went upstream. */
+uint32_t sim_unique_ids[RS485_MASTER_MAX_SLAVES][RS485_UNIQUE_ID_WORDS];
+uint8_t sim_ids_passed[RS485_MASTER_MAX_SLAVES];
+uint8_t sim_querying = 0;
+uint64_t sim_next_query_ns = 0;
+
+/* What the master sends on the link. */
+GenericPacket sim_link_packets[4];
+GenericPacketCircularBuffer sim_link;
+
+/* xorshift32, the same bus every run. */
+uint32_t sim_random(void)
+{
+   sim_seed ^= sim_seed << 13;
+   sim_seed ^= sim_seed >> 17;
+   sim_seed ^= sim_seed << 5;
+   return sim_seed;
+}
+
+/* PRIVATE sim_queue_frame
+ *
+ * Notes:
+ *  +Puts a response on the bus, in order of its first byte.
+ */
+void sim_queue_frame(const uint8_t *data, uint16_t length, uint64_t start, uint32_t slots, uint8_t kind)
+{
+   sim_frame_t *frame;
+   uint8_t ii;
+
+   if(sim_frame_count >= SIM_MAX_FRAMES)
+   {
+      return;
+   }
+
+   ii = sim_frame_count;
+   while((ii > 0)&&(sim_frames[ii - 1].start > start))
+   {
+      sim_frames[ii] = sim_frames[ii - 1];
+      ii--;
+   }
+
+   frame = &(sim_frames[ii]);
+   memcpy(frame->data, data, length);
+   frame->length = length;
+   frame->start = start;
+   frame->end = start + (length * SIM_BYTE_NS);
+   frame->slots = slots;
+   frame->kind = kind;
+   sim_frame_count++;
+}
+
+/* PRIVATE sim_response_pose
+ *
+ * Notes:
+ *  +The pose a slave answers with, x as given and the next number in y.
+ */
+PoseIsh sim_response_pose(uint8_t x)
+{
+   PoseIsh pose;
+
+   memset(&pose, 0, sizeof(pose));
+   pose.x = (float)x;
+   pose.y = -1.0f;
+   if(sim_sequence < SIM_SEQUENCES)
+   {
+      sim_sent_x[sim_sequence] = x;
+      pose.y = (float)sim_sequence;
+      sim_sequence++;
+   }
+
+   return pose;
+}
+
+/* PRIVATE sim_link_unique_id
+ *
+ * Notes:
+ *  +A unique ID the master sent on the link has to be one of the unassigned
+ *   slaves', and that slave counts as assigned from here on.
+ */
+void sim_link_unique_id(GenericPacket *packet)
+{
+   uint32_t unique_id[RS485_UNIQUE_ID_WORDS];
+   uint8_t address;
+   uint32_t ii;
+
+   sim_counts.ids_out++;
+   if((extract_rs485_resp_unique_id(packet, &address, unique_id) != GP_SUCCESS)||(address != RS485_ADDRESS_CONFIGURATION))
+   {
+      sim_counts.ids_wrong++;
+      return;
+   }
+
+   for(ii=0; ii<sim_unassigned; ii++)
+   {
+      if(memcmp(unique_id, sim_unique_ids[ii], sizeof(unique_id)) == 0)
+      {
+         break;
+      }
+   }
+
+   if(ii >= sim_unassigned)
+   {
+      sim_counts.ids_wrong++;
+      return;
+   }
+
+   if(sim_ids_passed[ii] != 0)
+   {
+      sim_counts.ids_repeated++;
+   }
+   sim_ids_passed[ii] = 1;
+}
+
+/* PRIVATE sim_link_check
+ *
+ * Notes:
+ *  +One packet the master sent on the link.  A sensor info response has to
+ *   be one that was sent, unchanged, and not passed upstream before.
+ */
+void sim_link_check(GenericPacket *packet)
+{
+   PoseIsh pose;
+   uint8_t address;
+   uint8_t sensor_type;
+   uint32_t sequence;
+
+   if(packet->gp[GP_LOC_PROJ_ID] != GP_PROJ_RS485_SB)
+   {
+      return;
+   }
+
+   if(packet->gp[GP_LOC_PROJ_SPEC] == RS485_RESP_UNIQUE_ID)
+   {
+      sim_link_unique_id(packet);
+      return;
+   }
+
+   if(packet->gp[GP_LOC_PROJ_SPEC] != RS485_RESP_SENSOR_INFO)
+   {
+      return;
+   }
+
+   sim_counts.infos_out++;
+   if((extract_rs485_resp_sensor_info(packet, &address, &sensor_type, &pose) != GP_SUCCESS)||
+      (address != RS485_ADDRESS_BROADCAST)||(sensor_type != RS485_SB_TYPE_PROXIMITY_SONAR)||
+      (pose.z != 0.0f)||(pose.roll != 0.0f)||(pose.pitch != 0.0f)||(pose.yaw != 0.0f))
+   {
+      sim_counts.infos_wrong++;
+      return;
+   }
+
+   if(pose.y == -1.0f)
+   {
+      return;
+   }
+
+   sequence = (uint32_t)pose.y;
+   if((pose.y < 0.0f)||(pose.y != (float)sequence)||(sequence >= sim_sequence)||(pose.x != (float)sim_sent_x[sequence]))
+   {
+      sim_counts.infos_wrong++;
+      return;
+   }
+
+   if(sim_passed[sequence] != 0)
+   {
+      sim_counts.infos_repeated++;
+   }
+   sim_passed[sequence] = 1;
+}
+
+/* PRIVATE sim_usart_sink
+ *
+ * Notes:
+ *  +The slaves listen to everything the master sends.  The one addressed
+ *   answers after its turnaround, the response lands when its last byte is
+ *   in.
+ *  +A sync broadcast has every slave answer in its slot.  The slave notices
+ *   the broadcast on its first tick after it ended and counts the slot from
+ *   there.
+ *  +A unique ID query has every unassigned slave answer the same way, in a
+ *   configuration slot of its own picking.
+ *  +What the master sends on the link is checked by sim_link_check().
+ */
+void sim_usart_sink(uint8_t usart, const uint8_t *data, uint16_t length, uint64_t ns)
+{
+   GenericPacket response;
+   GenericPacket *query;
+   PoseIsh pose;
+   uint8_t address;
+   uint16_t slot_usec;
+   uint64_t slot_ns;
+   uint64_t heard;
+   uint16_t response_length;
+   uint16_t ii;
+   uint8_t kind;
+
+   if(usart == HAL_USART_LINK)
+   {
+      for(ii=0; ii<length; ii++)
+      {
+         if(gpcb_receive_byte(data[ii], &sim_link) == GP_ERROR_CHECKSUM_MISMATCH)
+         {
+            sim_counts.link_garbled++;
+         }
+      }
+      while(gpcb_increment_tail(&sim_link) == GP_CIRC_BUFFER_SUCCESS)
+      {
+         sim_link_check(&(sim_link.gpcb[sim_link.gpcb_tail]));
+      }
+      return;
+   }
+
+   if(usart != HAL_USART_RS485_MASTER)
+   {
+      return;
+   }
+
+   if(sim_counting)
+   {
+      sim_counts.bus_bytes += length;
+   }
+
+   for(ii=0; ii<length; ii++)
+   {
+      gpcb_receive_byte(data[ii], &sim_rx);
+   }
+
+   while(gpcb_increment_tail(&sim_rx) == GP_CIRC_BUFFER_SUCCESS)
+   {
+      query = &(sim_rx.gpcb[sim_rx.gpcb_tail]);
+      if(query->gp[GP_LOC_PROJ_ID] != GP_PROJ_RS485_SB)
+      {
+         continue;
+      }
+
+      if((query->gp[GP_LOC_PROJ_SPEC] == RS485_SYNC_SAMPLE)&&(extract_rs485_sync_sample(query, &slot_usec) == GP_SUCCESS))
+      {
+         slot_ns = (slot_usec / RS485_MASTER_TICK_USEC) * SIM_TICK_NS;
+         if(slot_ns < (RS485_TDMA_MIN_SLOT_TICKS * SIM_TICK_NS))
+         {
+            slot_ns = RS485_TDMA_MIN_SLOT_TICKS * SIM_TICK_NS;
+         }
+
+         sim_snapshot_sent = 0;
+         sim_snapshot_collided = 0;
+         for(address=0; (address<sim_slaves)&&(sim_answering); address++)
+         {
+            pose = sim_response_pose(address);
+            create_rs485_resp_sensor_info(&response, RS485_ADDRESS_MASTER, RS485_SB_TYPE_PROXIMITY_SONAR, pose);
+            response_length = response.packet_length + GP_ALIGNMENT_PADDING;
+            if(sim_counting)
+            {
+               sim_counts.bus_bytes += response_length;
+            }
+
+            heard = ns + ((SIM_TICK_NS - ((ns + SIM_TICK_NS - sim_phase_ns[address]) % SIM_TICK_NS)) % SIM_TICK_NS);
+            sim_queue_frame(response.gp, response_length,
+                            heard + ((address + 1) * slot_ns) + ((sim_jitter_ns != 0) ? (sim_random() % sim_jitter_ns) : 0),
+                            (1UL << address), SIM_FRAME_SENSOR_INFO);
+         }
+         continue;
+      }
+
+      if((query->gp[GP_LOC_PROJ_SPEC] == RS485_QUERY_UNIQUE_ID)&&(extract_rs485_query_unique_id(query, &address) == GP_SUCCESS))
+      {
+         slot_ns = (RS485_CONFIG_SLOT_USEC / RS485_MASTER_TICK_USEC) * SIM_TICK_NS;
+         for(ii=0; (ii<sim_unassigned)&&(address == RS485_ADDRESS_CONFIGURATION)&&(sim_answering); ii++)
+         {
+            if(sim_ids_passed[ii] != 0)
+            {
+               continue;
+            }
+
+            create_rs485_resp_unique_id(&response, RS485_ADDRESS_CONFIGURATION, sim_unique_ids[ii]);
+            response_length = response.packet_length + GP_ALIGNMENT_PADDING;
+            heard = ns + ((SIM_TICK_NS - ((ns + SIM_TICK_NS - sim_phase_ns[ii]) % SIM_TICK_NS)) % SIM_TICK_NS);
+            sim_queue_frame(response.gp, response_length,
+                            heard + (((sim_random() % RS485_CONFIG_SLOTS) + 1) * slot_ns) +
+                            ((sim_jitter_ns != 0) ? (sim_random() % sim_jitter_ns) : 0),
+                            0, SIM_FRAME_UNIQUE_ID);
+         }
+         continue;
+      }
+
+      if((query->gp[GP_LOC_PROJ_SPEC] != RS485_QUERY_SENSOR_INFO)||
+         (extract_rs485_query_sensor_info(query, &address) != GP_SUCCESS))
+      {
+         continue;
+      }
+
+      if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + sim_slaves)))
+      {
+         if(sim_counting)
+         {
+            sim_counts.probes++;
+         }
+         continue;
+      }
+
+      if(sim_answering == 0)
+      {
+         continue;
+      }
+
+      pose = sim_response_pose(address);
+      create_rs485_resp_sensor_info(&response, RS485_ADDRESS_MASTER, RS485_SB_TYPE_PROXIMITY_SONAR, pose);
+      response_length = response.packet_length + GP_ALIGNMENT_PADDING;
+
+      if(sim_counting)
+      {
+         sim_counts.bus_bytes += response_length;
+      }
+
+      kind = SIM_FRAME_SENSOR_INFO;
+      if((sim_random() % 1000000) < sim_error_ppm)
+      {
+         response.gp[response_length / 2] ^= (uint8_t)(1 << (sim_random() % 8));
+         sim_counts.corrupt++;
+         kind = SIM_FRAME_CORRUPT;
+      }
+      else
+      {
+         sim_counts.good++;
+      }
+
+      sim_queue_frame(response.gp, response_length,
+                      ns + sim_turnaround_ns + ((sim_jitter_ns != 0) ? (sim_random() % sim_jitter_ns) : 0), 0, kind);
+   }
+}
+
+/* PRIVATE sim_deliver
+ *
+ * Notes:
+ *  +Called once the first frame's last byte is due.  Any frame that started
+ *   before then collided with it, the master gets one garbled frame running
+ *   to the end of the last of them.
+ */
+void sim_deliver(void)
+{
+   sim_frame_t *frame;
+   uint8_t ii;
+
+   frame = &(sim_frames[0]);
+   while((sim_frame_count > 1)&&(sim_frames[1].start < frame->end))
+   {
+      if(sim_frames[1].end > frame->end)
+      {
+         frame->end = sim_frames[1].end;
+      }
+      frame->slots |= sim_frames[1].slots;
+      if(frame->kind != SIM_FRAME_CORRUPT)
+      {
+         /* Only once, a second flip would undo the first. */
+         frame->data[frame->length / 2] ^= 0x5A;
+         frame->kind = SIM_FRAME_CORRUPT;
+      }
+      sim_counts.collisions++;
+      sim_snapshot_collided = 1;
+
+      for(ii=1; ii<(sim_frame_count - 1); ii++)
+      {
+         sim_frames[ii] = sim_frames[ii + 1];
+      }
+      sim_frame_count--;
+   }
+
+   if((hal_host_now_ns() + SIM_CYCLE_NS) < frame->end)
+   {
+      return;
+   }
+
+   hal_host_usart_rx(HAL_USART_RS485_MASTER, frame->data, frame->length);
+   sim_snapshot_sent |= frame->slots;
+   if(frame->kind == SIM_FRAME_SENSOR_INFO)
+   {
+      sim_counts.infos_in++;
+   }
+   else if(frame->kind == SIM_FRAME_UNIQUE_ID)
+   {
+      sim_counts.ids_in++;
+   }
+   if((sim_counting)&&(frame->slots != 0))
+   {
+      sim_counts.slots++;
+   }
+
+   for(ii=0; ii<(sim_frame_count - 1); ii++)
+   {
+      sim_frames[ii] = sim_frames[ii + 1];
+   }
+   sim_frame_count--;
+}
+
+/* PRIVATE sim_snapshot_check
+ *
+ * Notes:
+ *  +The master credits the slots when it leaves RS485_MASTER_AWAIT_SLOTS.
+ *   A collision garbles more than one slot, so those snapshots aren't
+ *   checked, the collision is already a failure.
+ */
+void sim_snapshot_check(void)
+{
+   uint32_t ii;
+
+   if((sim_last_state == RS485_MASTER_AWAIT_SLOTS)&&(master_state != RS485_MASTER_AWAIT_SLOTS))
+   {
+      if(sim_counting)
+      {
+         sim_counts.snapshots++;
+      }
+      for(ii=0; ii<sim_slaves; ii++)
+      {
+         sim_counts.credited += (rs485_master_slots_heard >> ii) & 0x01;
+      }
+
+      if((sim_snapshot_collided == 0)&&(rs485_master_slots_heard != sim_snapshot_sent))
+      {
+         if(sim_counts.miscredited < 5)
+         {
+            printf("snapshot at %.6f s sent slots 0x%08x, master heard 0x%08x\n",
+                   hal_host_now_ns() / 1e9, sim_snapshot_sent, rs485_master_slots_heard);
+         }
+         sim_counts.miscredited++;
+      }
+   }
+
+   sim_last_state = master_state;
+}
+
+/* PRIVATE sim_run_until
+ *
+ * Notes:
+ *  +The main loop, one rs485_master_spin() and full_duplex_usart_dma_spin()
+ *   every SIM_SPIN_NS, with the responses put on the bus as they finish.
+ *  +Sends the unique ID queries of the unique ID run.
+ */
+void sim_run_until(uint64_t end_ns)
+{
+   uint64_t next;
+
+   while(hal_host_now_ns() < end_ns)
+   {
+      next = hal_host_now_ns() + SIM_SPIN_NS;
+      if((sim_frame_count > 0)&&(sim_frames[0].end < next))
+      {
+         next = sim_frames[0].end;
+      }
+      hal_host_run_until(next);
+
+      if((sim_frame_count > 0)&&((hal_host_now_ns() + SIM_CYCLE_NS) >= sim_frames[0].end))
+      {
+         sim_deliver();
+      }
+
+      rs485_master_spin();
+      full_duplex_usart_dma_spin();
+      sim_snapshot_check();
+
+      if((sim_querying)&&(hal_host_now_ns() >= sim_next_query_ns)&&
+         (rs485_master_query_unique_id(RS485_ADDRESS_CONFIGURATION) == RS485_SB_SUCCESS))
+      {
+         sim_counts.queries++;
+         sim_next_query_ns = hal_host_now_ns() + SIM_QUERY_NS;
+      }
+   }
+}
+
+/* PRIVATE sim_table_totals
+ *
+ * Notes:
+ *  +Sums the master's counters over the live slaves.
+ */
+void sim_table_totals(uint32_t *responses, uint32_t *timeouts, uint32_t *max_p99_usec)
+{
+   const rs485_slave_entry_t *entry;
+   uint32_t ii;
+
+   *responses = 0;
+   *timeouts = 0;
+   *max_p99_usec = 0;
+   for(ii=0; ii<sim_slaves; ii++)
+   {
+      entry = rs485_master_get_slave(RS485_MASTER_FIRST_SLAVE_ADDRESS + ii);
+      *responses += entry->responses;
+      *timeouts += entry->timeouts;
+      if((entry->p99_x16 >> RS485_MASTER_P99_FRAC_BITS) > *max_p99_usec)
+      {
+         *max_p99_usec = entry->p99_x16 >> RS485_MASTER_P99_FRAC_BITS;
+      }
+   }
+}
+
+/* PRIVATE sim_run
+ *
+ * Notes:
+ *  +One run from reset, mode is one of SIM_STOP_AND_WAIT, SIM_PIPELINED,
+ *   SIM_SNAPSHOT or SIM_UNIQUE_ID.
+ */
+sim_counts_t sim_run(uint8_t mode, uint32_t hz, double seconds)
+{
+   uint32_t responses0, timeouts0;
+   uint32_t responses1, timeouts1;
+   uint32_t p99;
+   uint32_t ii;
+   uint32_t seed;
+
+   seed = sim_seed;
+   hal_host_reset();
+   hal_host_set_usart_sink(&sim_usart_sink);
+   gpcb_initialize(&sim_rx, sim_rx_packets, 4);
+   gpcb_initialize(&sim_link, sim_link_packets, 4);
+   memset(&sim_counts, 0, sizeof(sim_counts));
+   memset(sim_passed, 0, sim_sequence);
+   sim_sequence = 0;
+   memset(sim_ids_passed, 0, sizeof(sim_ids_passed));
+   sim_querying = 0;
+   sim_frame_count = 0;
+   sim_counting = 0;
+   sim_answering = 1;
+   sim_last_state = RS485_MASTER_INIT;
+   for(ii=0; ii<RS485_MASTER_MAX_SLAVES; ii++)
+   {
+      sim_phase_ns[ii] = sim_random() % SIM_TICK_NS;
+   }
+
+   trace_init();
+   event_init();
+   full_duplex_usart_dma_init(NULL);
+   master_state = RS485_MASTER_INIT;
+   rs485_sensor_bus_init_master();
+   rs485_master_set_pipelined(mode != SIM_STOP_AND_WAIT);
+
+   /* A reset clears the last run's snapshots, rs485_sensor_bus_init_master()
+    * doesn't.
+    */
+   rs485_master_set_snapshot_rate(0, 0);
+
+   sim_run_until(SIM_SETTLE_NS / 2);
+   for(ii=0; ii<sim_slaves; ii++)
+   {
+      rs485_master_set_poll_rate(RS485_MASTER_FIRST_SLAVE_ADDRESS + ii, (uint16_t)hz);
+   }
+   if(mode == SIM_SNAPSHOT)
+   {
+      rs485_master_set_snapshot_rate((uint16_t)sim_snapshot_hz, (uint16_t)sim_slot_usec);
+   }
+   sim_run_until(SIM_SETTLE_NS);
+
+   sim_table_totals(&responses0, &timeouts0, &p99);
+   sim_counting = 1;
+   sim_querying = (mode == SIM_UNIQUE_ID);
+   sim_next_query_ns = hal_host_now_ns();
+   sim_run_until(SIM_SETTLE_NS + (uint64_t)(seconds * 1e9));
+   sim_counting = 0;
+   sim_querying = 0;
+   sim_table_totals(&responses1, &timeouts1, &(sim_counts.max_p99_usec));
+   sim_counts.responses = responses1 - responses0;
+   sim_counts.timeouts = timeouts1 - timeouts0;
+
+   /* The last responses still get checked. */
+   sim_run_until(hal_host_now_ns() + 1000000ULL);
+   sim_answering = 0;
+   sim_run_until(hal_host_now_ns() + SIM_DRAIN_NS);
+   sim_table_totals(&(sim_counts.total_responses), &(sim_counts.total_timeouts), &p99);
+   sim_counts.forward_drops = rs485_master_forward_drops();
+
+   /* Every mode sees the same bus. */
+   sim_seed = seed;
+
+   return sim_counts;
+}
+
+/* PRIVATE sim_check_counts
+ *
+ * Notes:
+ *  +The checks every run has to pass, returns the failures.
+ */
+uint32_t sim_check_counts(const char *name, const sim_counts_t *c, double seconds)
+{
+   uint32_t failures = 0;
+
+   /* Credited slots count as responses too. */
+   if(c->total_responses != (c->good + c->credited))
+   {
+      printf("FAIL %s counted %u responses for %u good ones\n", name, c->total_responses, c->good + c->credited);
+      failures++;
+   }
+   if(c->total_timeouts < c->corrupt)
+   {
+      printf("FAIL %s counted %u misses for %u corrupt responses\n", name, c->total_timeouts, c->corrupt);
+      failures++;
+   }
+
+   if((c->infos_wrong != 0)||(c->infos_repeated != 0)||(c->link_garbled != 0))
+   {
+      printf("FAIL %s passed upstream %u responses never sent, %u again, %u garbled\n",
+             name, c->infos_wrong, c->infos_repeated, c->link_garbled);
+      failures++;
+   }
+   /* Both kinds of answer share the forward packets. */
+   if((c->infos_out + c->ids_out + c->forward_drops) != (c->infos_in + c->ids_in))
+   {
+      printf("FAIL %s passed %u answers upstream and dropped %u of %u\n",
+             name, c->infos_out + c->ids_out, c->forward_drops, c->infos_in + c->ids_in);
+      failures++;
+   }
+
+   /* One more for a probe spacing straddling the start of the window. */
+   if(c->probes > (uint32_t)((seconds * 1000.0) / RS485_MASTER_PROBE_SPACING_MSEC) + 1)
+   {
+      printf("FAIL %s probed absent addresses %u times\n", name, c->probes);
+      failures++;
+   }
+
+   return failures;
+}
+
+/* PRIVATE sim_p99_sample
+ *
+ * Notes:
+ *  +Feeds one turnaround, offset plus the run's turnaround and jitter, and
+ *   returns the estimate it was measured against.
+ */
+uint32_t sim_p99_sample(uint32_t offset_usec, uint32_t *above)
+{
+   rs485_slave_entry_t *entry;
+   uint32_t p99_usec;
+   uint32_t sample_usec;
+
+   entry = &(rs485_slave_table[0]);
+   p99_usec = entry->p99_x16 >> RS485_MASTER_P99_FRAC_BITS;
+   sample_usec = offset_usec + (sim_turnaround_ns / 1000) + (sim_random() % ((sim_jitter_ns / 1000) + 1));
+   if(sample_usec > p99_usec)
+   {
+      (*above)++;
+   }
+   rs485_master_record_turnaround(RS485_MASTER_FIRST_SLAVE_ADDRESS, sample_usec);
+
+   return entry->p99_x16 >> RS485_MASTER_P99_FRAC_BITS;
+}
+
+/* PRIVATE sim_check_p99
+ *
+ * Notes:
+ *  +rs485_master_record_turnaround() on its own, fed the run's turnarounds.
+ *   The estimate has to come down from a first sample four times the
+ *   largest within SIM_P99_SETTLE samples, and again after
+ *   SIM_P99_STEP_SAMPLES SIM_P99_STEP_USEC slower, and then have about 1% of
+ *   the samples above it.  Returns the failures.
+ */
+uint32_t sim_check_p99(void)
+{
+   uint32_t failures = 0;
+   uint32_t largest_usec;
+   uint32_t settle;
+   uint32_t settle_step;
+   uint32_t above = 0;
+   uint32_t seed;
+   uint32_t ii;
+   double sum = 0.0;
+
+   seed = sim_seed;
+   largest_usec = (sim_turnaround_ns + sim_jitter_ns) / 1000;
+   rs485_master_clear_latency(RS485_MASTER_FIRST_SLAVE_ADDRESS);
+
+   rs485_master_record_turnaround(RS485_MASTER_FIRST_SLAVE_ADDRESS, 4 * largest_usec);
+   settle = 0;
+   while((settle < SIM_P99_SAMPLES)&&(sim_p99_sample(0, &above) > 2 * largest_usec))
+   {
+      settle++;
+   }
+
+   for(ii=0; ii<SIM_P99_STEP_SAMPLES; ii++)
+   {
+      sim_p99_sample(SIM_P99_STEP_USEC, &above);
+   }
+   settle_step = 0;
+   while((settle_step < SIM_P99_SAMPLES)&&(sim_p99_sample(0, &above) > 2 * largest_usec))
+   {
+      settle_step++;
+   }
+
+   above = 0;
+   for(ii=0; ii<SIM_P99_SAMPLES; ii++)
+   {
+      sum += sim_p99_sample(0, &above);
+   }
+
+   printf("\np99 estimate %.1f usec on average for turnarounds up to %u usec, %.2f%% above it, "
+          "%u samples to settle from %u usec, %u after %u usec slower\n",
+          sum / SIM_P99_SAMPLES, largest_usec, (100.0 * above) / SIM_P99_SAMPLES, settle, 4 * largest_usec,
+          settle_step, SIM_P99_STEP_USEC);
+
+   if(settle > SIM_P99_SETTLE)
+   {
+      printf("FAIL p99 took %u samples to come down from a far off first sample\n", settle);
+      failures++;
+   }
+   if(settle_step > SIM_P99_SETTLE)
+   {
+      printf("FAIL p99 took %u samples to come down after a slow spell\n", settle_step);
+      failures++;
+   }
+   if((above < (SIM_P99_SAMPLES / 400))||(above > (SIM_P99_SAMPLES / 30)))
+   {
+      printf("FAIL p99 has %.2f%% of the samples above it\n", (100.0 * above) / SIM_P99_SAMPLES);
+      failures++;
+   }
+
+   rs485_master_clear_latency(RS485_MASTER_FIRST_SLAVE_ADDRESS);
+   sim_seed = seed;
+
+   return failures;
+}
+
+/* PRIVATE sim_sweep
+ *
+ * Notes:
+ *  +Pipelined polling for every number of slaves, returns the failures.
+ */
+uint32_t sim_sweep(uint32_t hz, double seconds)
+{
+   sim_counts_t c;
+   char name[32];
+   uint32_t failures = 0;
+
+   printf("slaves   trans/s   per slave   bus use  probes/s  probe time  timeouts\n");
+
+   for(sim_slaves=1; sim_slaves<=RS485_MASTER_MAX_SLAVES; sim_slaves++)
+   {
+      c = sim_run(SIM_PIPELINED, hz, seconds);
+      printf("%6u  %8.0f  %10.0f   %5.1f%%  %8.0f  %9.1f%%  %8u\n",
+             sim_slaves, c.responses / seconds, c.responses / (seconds * sim_slaves),
+             (100.0 * c.bus_bytes * SIM_BYTE_NS) / (seconds * 1e9), c.probes / seconds,
+             (100.0 * c.probes * (RS485_MASTER_PROBE_TIMEOUT_MSEC + (RS485_MASTER_DELAY_TIME_USEC / 1000.0))) / (seconds * 1000.0),
+             c.timeouts);
+
+      snprintf(name, sizeof(name), "%u slaves", sim_slaves);
+      failures += sim_check_counts(name, &c, seconds);
+   }
+
+   return failures;
+}
+
+int main(int argc, char *argv[])
+{
+   const char *names[SIM_RUNS] = {"stop-and-wait", "pipelined", "snapshots", "unique IDs"};
+   sim_counts_t c[SIM_RUNS];
+   double seconds = 1.0;
+   uint32_t hz = RS485_SENSOR_BUS_SM_HZ;
+   uint32_t failures = 0;
+   uint8_t sweep = 0;
+   uint32_t missing;
+   uint32_t ii;
+   uint8_t mode;
+   int opt;
+
+   while((opt = getopt(argc, argv, "n:at:r:l:j:e:S:w:u:s:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'n':
+            sim_slaves = (uint32_t)atoi(optarg);
+            break;
+         case 'a':
+            sweep = 1;
+            break;
+         case 't':
+            seconds = atof(optarg);
+            break;
+         case 'r':
+            hz = (uint32_t)atoi(optarg);
+            break;
+         case 'l':
+            sim_turnaround_ns = (uint32_t)(atof(optarg) * 1000.0);
+            break;
+         case 'j':
+            sim_jitter_ns = (uint32_t)(atof(optarg) * 1000.0);
+            break;
+         case 'e':
+            sim_error_ppm = (uint32_t)atoi(optarg);
+            break;
+         case 'S':
+            sim_snapshot_hz = (uint32_t)atoi(optarg);
+            break;
+         case 'w':
+            sim_slot_usec = (uint32_t)atoi(optarg);
+            break;
+         case 'u':
+            sim_unassigned = (uint32_t)atoi(optarg);
+            break;
+         case 's':
+            sim_seed = (uint32_t)strtoul(optarg, NULL, 0);
+            if(sim_seed == 0)
+            {
+               sim_seed = 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-n slaves] [-a] [-t seconds] [-r hz] [-l usec] [-j usec] [-e ppm] [-S hz] [-w usec] [-u slaves] [-s seed]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   if((sim_slaves < 1)||(sim_slaves > RS485_MASTER_MAX_SLAVES)||(hz < 1)||(hz > RS485_SENSOR_BUS_SM_HZ)||(seconds <= 0.0)||
+      (sim_snapshot_hz < 1)||(sim_snapshot_hz > RS485_SENSOR_BUS_SM_HZ)||(sim_slot_usec > 0xFFFF)||
+      (sim_unassigned > RS485_MASTER_MAX_SLAVES))
+   {
+      fprintf(stderr, "1 to %u slaves, 1 to %u Hz\n", RS485_MASTER_MAX_SLAVES, RS485_SENSOR_BUS_SM_HZ);
+      return 1;
+   }
+
+   for(ii=0; ii<sim_unassigned; ii++)
+   {
+      sim_unique_ids[ii][0] = 0x00360000UL + ii;
+      sim_unique_ids[ii][1] = 0x4B4D5331UL ^ (ii << 8);
+      sim_unique_ids[ii][2] = 0x20260000UL | ii;
+   }
+
+   if(sweep)
+   {
+      printf("%u baud, turnaround %.1f-%.1f usec, %u ppm corrupt, %u Hz each asked, pipelined\n\n",
+             RS485_SENSOR_BUS_BAUD, sim_turnaround_ns / 1000.0,
+             (sim_turnaround_ns + sim_jitter_ns) / 1000.0, sim_error_ppm, hz);
+      failures = sim_sweep(hz, seconds);
+      return (failures == 0) ? 0 : 2;
+   }
+
+   printf("%u slaves at %u baud, turnaround %.1f-%.1f usec, %u ppm corrupt, %u Hz each asked\n\n",
+          sim_slaves, RS485_SENSOR_BUS_BAUD, sim_turnaround_ns / 1000.0,
+          (sim_turnaround_ns + sim_jitter_ns) / 1000.0, sim_error_ppm, hz);
+   printf("mode            trans/s   bus use  timeouts  p99 usec   | run: good  counted  corrupt  misses  upstream  dropped\n");
+
+   for(mode=0; mode<SIM_RUNS; mode++)
+   {
+      c[mode] = sim_run(mode, hz, seconds);
+      printf("%-14s %8.0f   %5.1f%%  %8u  %8u   |  %9u  %7u  %7u  %6u  %8u  %7u\n",
+             names[mode], c[mode].responses / seconds,
+             (100.0 * c[mode].bus_bytes * SIM_BYTE_NS) / (seconds * 1e9),
+             c[mode].timeouts, c[mode].max_p99_usec,
+             c[mode].good, c[mode].total_responses, c[mode].corrupt, c[mode].total_timeouts,
+             c[mode].infos_out, c[mode].forward_drops);
+
+      failures += sim_check_counts(names[mode], &(c[mode]), seconds);
+   }
+
+   if(c[SIM_STOP_AND_WAIT].responses != 0)
+   {
+      printf("\npipelined is %.2fx stop-and-wait\n", (double)c[SIM_PIPELINED].responses / c[SIM_STOP_AND_WAIT].responses);
+   }
+
+   printf("\n%u snapshots/s, slot %u usec, %.0f slot responses/s, %u collisions, %u snapshots credited wrong\n",
+          sim_snapshot_hz, ((sim_slot_usec / RS485_MASTER_TICK_USEC) < RS485_TDMA_MIN_SLOT_TICKS) ?
+          (RS485_TDMA_MIN_SLOT_TICKS * RS485_MASTER_TICK_USEC) : ((sim_slot_usec / RS485_MASTER_TICK_USEC) * RS485_MASTER_TICK_USEC),
+          c[SIM_SNAPSHOT].slots / seconds, c[SIM_SNAPSHOT].collisions, c[SIM_SNAPSHOT].miscredited);
+   if(c[SIM_SNAPSHOT].snapshots == 0)
+   {
+      printf("FAIL no snapshot finished in the window\n");
+      failures++;
+   }
+   if(c[SIM_SNAPSHOT].collisions != 0)
+   {
+      printf("FAIL slot responses collided\n");
+      failures++;
+   }
+   if(c[SIM_SNAPSHOT].miscredited != 0)
+   {
+      printf("FAIL slots credited to the wrong slaves\n");
+      failures++;
+   }
+
+   missing = 0;
+   for(ii=0; ii<sim_unassigned; ii++)
+   {
+      missing += (sim_ids_passed[ii] == 0);
+   }
+   printf("\n%u unassigned slaves, %u unique ID queries, %u answers reached the master intact, %u passed upstream\n",
+          sim_unassigned, c[SIM_UNIQUE_ID].queries, c[SIM_UNIQUE_ID].ids_in, c[SIM_UNIQUE_ID].ids_out);
+   if(missing != 0)
+   {
+      printf("FAIL %u unique IDs never passed upstream\n", missing);
+      failures++;
+   }
+   if((c[SIM_UNIQUE_ID].ids_repeated != 0)||(c[SIM_UNIQUE_ID].ids_wrong != 0))
+   {
+      printf("FAIL %u unique IDs passed upstream again, %u that were never sent\n",
+             c[SIM_UNIQUE_ID].ids_repeated, c[SIM_UNIQUE_ID].ids_wrong);
+      failures++;
+   }
+
+   failures += sim_check_p99();
+
+   return (failures == 0) ? 0 : 2;
+}
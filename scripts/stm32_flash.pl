@@ -3,13 +3,19 @@
 use Net::Telnet;
 use Cwd 'abs_path';
 
+# One image goes to the start of flash.  Images with addresses are written one
+# after the other, each erasing only the sectors it covers, so flash between
+# them (the flash_kv store) is kept.
 my $numArgs = $#ARGV + 1;
-if($numArgs != 1) {
-    die( "Usage ./stm32_flash.pl [main.bin] \n");
+my @images;
+if($numArgs == 1) {
+    @images = ($ARGV[0], "0x08000000");
+} elsif(($numArgs > 0) && (($numArgs % 2) == 0)) {
+    @images = @ARGV;
+} else {
+    die( "Usage ./stm32_flash.pl [main.bin] | [image address]...\n");
 }
 
-my $file = abs_path($ARGV[0]);
-
 my $ip = "127.0.0.1";   # localhost
 my $port = 4444;
 
@@ -23,7 +29,10 @@ $telnet->open($ip);
 
 print $telnet->cmd('reset halt');
 print $telnet->cmd('flash probe 0');
-print $telnet->cmd('flash write_image erase '.$file.' 0x08000000');
+for(my $ii = 0; $ii < $#images; $ii += 2) {
+    my $file = abs_path($images[$ii]);
+    print $telnet->cmd('flash write_image erase '.$file.' '.$images[$ii + 1]);
+}
 print $telnet->cmd('reset');
 print $telnet->cmd('exit');
 
@@ -0,0 +1,429 @@
+/**
+ * @file sw_timer_test.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief sw_timer.c's list on a simulated microsecond counter, checked
+ * against the ordering in sw_timer.h.
+ *
+ * The port here is a 32 bit counter stepped one microsecond at a time with a
+ * compare that latches on a match, or straight away when it's armed in the
+ * past, the way sw_timer_hal.c's forced compare does.  The interrupt is
+ * serviced as soon as it's pending and unmasked, and never inside itself.
+ * A callback that takes time moves the counter while the interrupt runs.
+ *
+ * Runs:
+ *
+ *    errors    Delays and periods over SW_TIMER_MAX_DELAY_US and a NULL
+ *              callback are refused and nothing starts.
+ *    order     Timers started, restarted and stopped at random, from the
+ *              main loop and from callbacks, one-shot and periodic.  Every
+ *              expiry has to fire at its microsecond, timers due at the same
+ *              microsecond in the order they went into the list, periodic
+ *              ones on their grid, and stopped ones never.  Run twice, the
+ *              second time across the counter wrapping.
+ *    overrun   A periodic callback that runs for 3.5 periods fires once late
+ *              and carries on a period later, never back to back.
+ *
+ * sw_timer_test [-s seed]
+ *
+ *    -s   Seed for the random starts and stops, 1 by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sw_timer.h"
+#include "host_test.h"
+
+#define TEST_TIMERS            48
+#define TEST_RUN_US            3000000
+
+/* Delays are multiples of this so plenty of timers share a microsecond. */
+#define TEST_GRAIN_US          50
+
+/* The simulated counter and compare. */
+uint32_t test_now = 0;
+uint32_t test_compare = 0;
+uint8_t test_compare_armed = 0;
+uint8_t test_pending = 0;
+uint8_t test_locked = 0;
+uint8_t test_in_interrupt = 0;
+uint32_t test_nested_locks = 0;
+
+/* What each timer should do next, kept alongside sw_timer.c's list. */
+sw_timer_t test_timers[TEST_TIMERS];
+uint8_t test_running[TEST_TIMERS];
+uint32_t test_expected[TEST_TIMERS];
+uint32_t test_order[TEST_TIMERS];          /* When it went into the list. */
+uint32_t test_inserts = 0;
+
+/* Fires so far at test_now, to check ties. */
+uint32_t test_last_fire_us = 0;
+uint32_t test_last_order = 0;
+uint8_t test_fired_now = 0;
+
+uint32_t test_fires = 0;
+uint32_t test_ties = 0;
+uint32_t test_seed = 1;
+
+/* The overrun run's timer. */
+sw_timer_t test_overrun_timer;
+uint32_t test_overrun_fires[16];
+uint32_t test_overrun_count = 0;
+
+/* xorshift32, the same run every time. */
+uint32_t test_random(void)
+{
+   test_seed ^= test_seed << 13;
+   test_seed ^= test_seed >> 17;
+   test_seed ^= test_seed << 5;
+   return test_seed;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_init(void)
+{
+   test_compare_armed = 0;
+   test_pending = 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t sw_timer_port_now(void)
+{
+   return test_now;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_arm(uint32_t expires_us)
+{
+   test_check(test_locked, "port", "armed without the lock", expires_us);
+
+   test_compare = expires_us;
+   test_compare_armed = 1;
+   if((int32_t)(expires_us - test_now) <= 0)
+   {
+      test_pending = 1;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t sw_timer_port_lock(void)
+{
+   uint32_t key = test_locked;
+
+   if(test_locked)
+   {
+      test_nested_locks++;
+   }
+   test_locked = 1;
+
+   return key;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_unlock(uint32_t key)
+{
+   test_locked = (uint8_t)key;
+}
+
+/* PRIVATE test_service
+ *
+ * Notes:
+ *  +The compare interrupt, if it's pending and allowed to run.  Anything
+ *   that comes due while it runs is pending again when it returns.
+ */
+void test_service(void)
+{
+   while((test_pending)&&(test_locked == 0)&&(test_in_interrupt == 0))
+   {
+      test_pending = 0;
+      test_in_interrupt = 1;
+      sw_timer_expire();
+      test_in_interrupt = 0;
+   }
+}
+
+/* PRIVATE test_tick
+ *
+ * Notes:
+ *  +One microsecond, the compare latches if it matches.
+ */
+void test_tick(void)
+{
+   test_now++;
+   if((test_compare_armed)&&(test_now == test_compare))
+   {
+      test_pending = 1;
+   }
+   test_service();
+}
+
+void test_start_timer(uint8_t index, uint32_t delay_us, uint32_t period_us);
+void test_random_action(void);
+
+/* PRIVATE test_fired
+ *
+ * Notes:
+ *  +The callback for the order run, data is the timer's index.  Checks it
+ *   against what should be due, then sometimes starts or stops something
+ *   itself, the way callbacks do.
+ */
+void test_fired(uint32_t data)
+{
+   uint8_t index = (uint8_t)data;
+
+   test_fires++;
+
+   test_check(test_in_interrupt, "order", "callback outside the interrupt", index);
+   test_check(test_running[index], "order", "stopped timer fired", index);
+   test_check(test_now == test_expected[index], "order", "fired off its microsecond",
+              (double)(int32_t)(test_now - test_expected[index]));
+
+   if((test_fired_now)&&(test_last_fire_us == test_now))
+   {
+      test_ties++;
+      test_check(test_order[index] > test_last_order, "order", "tie fired out of start order", index);
+   }
+   test_fired_now = 1;
+   test_last_fire_us = test_now;
+   test_last_order = test_order[index];
+
+   /* A periodic timer went back into the list before its callback. */
+   if(test_timers[index].period_us != 0)
+   {
+      test_expected[index] += test_timers[index].period_us;
+      test_order[index] = ++test_inserts;
+   }
+   else
+   {
+      test_running[index] = 0;
+   }
+
+   if((test_random() % 4) == 0)
+   {
+      test_random_action();
+   }
+}
+
+void test_start_timer(uint8_t index, uint32_t delay_us, uint32_t period_us)
+{
+   uint8_t result;
+
+   result = sw_timer_start(&(test_timers[index]), delay_us, period_us, &test_fired, index);
+   test_check(result == SW_TIMER_SUCCESS, "order", "start refused", result);
+
+   test_running[index] = 1;
+   test_expected[index] = test_now + delay_us;
+   test_order[index] = ++test_inserts;
+}
+
+void test_stop_timer(uint8_t index)
+{
+   sw_timer_stop(&(test_timers[index]));
+   test_running[index] = 0;
+}
+
+/* PRIVATE test_random_action
+ *
+ * Notes:
+ *  +Starts (or restarts) a one-shot or periodic timer, or stops one.
+ *   Periodic timers are a third of the starts.  Delays from a callback can
+ *   be 0, which fires in the same interrupt.
+ */
+void test_random_action(void)
+{
+   uint8_t index = (uint8_t)(test_random() % TEST_TIMERS);
+   uint32_t kind = test_random() % 8;
+   uint32_t delay_us;
+   uint32_t period_us;
+
+   if(kind < 2)
+   {
+      test_stop_timer(index);
+      return;
+   }
+
+   delay_us = (test_random() % 200) * TEST_GRAIN_US;
+   if((delay_us == 0)&&(test_in_interrupt == 0))
+   {
+      delay_us = TEST_GRAIN_US;
+   }
+
+   period_us = 0;
+   if(kind < 4)
+   {
+      period_us = (1 + (test_random() % 40)) * TEST_GRAIN_US;
+   }
+
+   test_start_timer(index, delay_us, period_us);
+}
+
+void test_errors(void)
+{
+   sw_timer_t timer;
+
+   memset(&timer, 0, sizeof(timer));
+   sw_timer_init();
+
+   test_check(sw_timer_start(&timer, (uint32_t)SW_TIMER_MAX_DELAY_US + 1, 0, &test_fired, 0) == SW_TIMER_ERROR_DELAY,
+              "errors", "delay over the limit", 0);
+   test_check(sw_timer_start(&timer, 0, (uint32_t)SW_TIMER_MAX_DELAY_US + 1, &test_fired, 0) == SW_TIMER_ERROR_DELAY,
+              "errors", "period over the limit", 0);
+   test_check(sw_timer_start(&timer, 100, 0, NULL, 0) == SW_TIMER_ERROR_CALLBACK,
+              "errors", "no callback", 0);
+   test_check(timer.active == 0, "errors", "refused timer started", 0);
+   test_check(test_compare_armed == 0, "errors", "refused timer armed the compare", test_compare);
+
+   /* Stopping a timer that never ran does nothing. */
+   sw_timer_stop(&timer);
+   test_check(timer.active == 0, "errors", "stopped timer active", 0);
+
+   printf("errors   over the limit and NULL callback refused\n");
+}
+
+void test_order_run(uint32_t start_us, const char *label)
+{
+   uint32_t elapsed;
+   uint32_t starts;
+   uint8_t ii;
+
+   memset(test_timers, 0, sizeof(test_timers));
+   memset(test_running, 0, sizeof(test_running));
+   test_now = start_us;
+   test_inserts = 0;
+   test_fires = 0;
+   test_ties = 0;
+   test_fired_now = 0;
+   test_nested_locks = 0;
+   sw_timer_init();
+
+   starts = 0;
+   for(elapsed=0; elapsed<TEST_RUN_US; elapsed++)
+   {
+      if((test_random() % 64) == 0)
+      {
+         test_random_action();
+         starts++;
+      }
+
+      test_tick();
+
+      /* Nothing that was due is left over. */
+      for(ii=0; ii<TEST_TIMERS; ii++)
+      {
+         if((test_running[ii])&&((int32_t)(test_expected[ii] - test_now) <= 0))
+         {
+            test_check(0, "order", "timer didn't fire", ii);
+            test_running[ii] = 0;
+            test_stop_timer(ii);
+         }
+      }
+   }
+
+   test_check(test_nested_locks == 0, "order", "lock taken while held", test_nested_locks);
+   test_check(test_ties > 0, "order", "no ties to check", 0);
+
+   printf("order    %s, %u actions, %u fires, %u of them tied\n", label, starts, test_fires, test_ties);
+}
+
+void test_overrun_fired(uint32_t data)
+{
+   uint32_t ii;
+
+   if(test_overrun_count < 16)
+   {
+      test_overrun_fires[test_overrun_count] = test_now;
+   }
+   test_overrun_count++;
+
+   /* The third callback runs three and a half periods. */
+   if(test_overrun_count == 3)
+   {
+      for(ii=0; ii<(7 * data) / 2; ii++)
+      {
+         test_tick();
+      }
+   }
+}
+
+void test_overrun(void)
+{
+   uint32_t period = 1000;
+   uint32_t start;
+   uint32_t ii;
+   uint32_t expected[8];
+   uint8_t count = 0;
+
+   memset(&test_overrun_timer, 0, sizeof(test_overrun_timer));
+   test_now = 12345;
+   test_overrun_count = 0;
+   sw_timer_init();
+
+   start = test_now;
+   sw_timer_start(&test_overrun_timer, period, period, &test_overrun_fired, period);
+   while(test_now - start < 9 * period)
+   {
+      test_tick();
+   }
+
+   /* On the grid, then one late fire when the long callback returns, then a
+    * period on from there.
+    */
+   expected[count++] = start + period;
+   expected[count++] = start + (2 * period);
+   expected[count++] = start + (3 * period);
+   expected[count++] = start + (3 * period) + ((7 * period) / 2);
+   expected[count++] = expected[3] + period;
+   expected[count++] = expected[4] + period;
+
+   test_check(test_overrun_count == count, "overrun", "fires", test_overrun_count);
+   for(ii=0; (ii<count)&&(ii<test_overrun_count); ii++)
+   {
+      test_check(test_overrun_fires[ii] == expected[ii], "overrun", "fired at the wrong time",
+                 (double)(int32_t)(test_overrun_fires[ii] - expected[ii]));
+      if(ii > 0)
+      {
+         test_check(test_overrun_fires[ii] - test_overrun_fires[ii - 1] >= period, "overrun",
+                    "fired back to back", test_overrun_fires[ii] - test_overrun_fires[ii - 1]);
+      }
+   }
+
+   sw_timer_stop(&test_overrun_timer);
+
+   printf("overrun  %u fires over %u periods with one callback %u us long\n",
+          test_overrun_count, 9, (7 * period) / 2);
+}
+
+int main(int argc, char *argv[])
+{
+   int opt;
+
+   while((opt = getopt(argc, argv, "s:")) != -1)
+   {
+      switch(opt)
+      {
+         case 's':
+            test_seed = (uint32_t)strtoul(optarg, NULL, 0);
+            if(test_seed == 0)
+            {
+               test_seed = 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-s seed]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   test_errors();
+   test_order_run(0, "from 0");
+   test_order_run(0 - (TEST_RUN_US / 2), "across the wrap");
+   test_overrun();
+
+   return test_summary();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file tb6612_duty_bench.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Checks TB6612_duty_q15_to_ccr() against the old float duty
+ * conversion and counts the cycles each takes.
+ *
+ * The old TB6612_set_duty() clamped, rescaled to 0..1 and rounded with a
+ * double 0.5, so on the M4 (single precision FPU only) every call went
+ * through the soft-float double add and conversion.  The new path is
+ * integer.  Every Q15 duty is converted both ways, at the up counting period
+ * the old code used and the center-aligned one it uses now, and they must
+ * agree to a count.  Then each is timed over the whole range.
+ *
+ * A PC has a double precision FPU, so the difference here is the least it
+ * can be, the target's is larger.
+ *
+ * tb6612_duty_bench [-n rounds]
+ *
+ *    -n   Timed passes over all 65536 duties, 200 by default.
+ *
+ * Exits 0 if every duty agreed, 2 if one didn't.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC() __rdtsc()
+#else
+#define BENCH_TSC() 0ULL
+#endif
+
+#include "hardware_TB6612.h"
+
+#define BENCH_CORE_HZ   168000000UL
+
+/* Each conversion is a call, like TB6612_set_duty() is from the loop. */
+#define BENCH_CALL __attribute__((noinline))
+
+/* TB6612_set_duty() as it was, less the register write. */
+BENCH_CALL uint32_t bench_float_ccr(float duty, uint32_t period)
+{
+   if(duty > 1.0f)
+   {
+      duty = 1.0f;
+   }
+   if(duty < -1.0f)
+   {
+      duty = -1.0f;
+   }
+
+   duty = ((duty + 1.0f) / 2.0f);
+   return (uint16_t)(duty*period + 0.5);
+}
+
+/* TB6612_set_duty() as it is, less the register write. */
+BENCH_CALL uint32_t bench_wrapper_ccr(float duty, uint32_t period)
+{
+   if(duty > 1.0f)
+   {
+      duty = 1.0f;
+   }
+   if(duty < -1.0f)
+   {
+      duty = -1.0f;
+   }
+
+   return TB6612_duty_q15_to_ccr((int16_t)(duty * (float)TB6612_DUTY_Q15_MAX), period);
+}
+
+/* TB6612_set_duty_q15(), less the register write. */
+BENCH_CALL uint32_t bench_q15_ccr(int16_t duty, uint32_t period)
+{
+   return TB6612_duty_q15_to_ccr(duty, period);
+}
+
+uint32_t bench_check(uint32_t period)
+{
+   int32_t duty;
+   uint32_t ccr, ref, last = 0, bad = 0;
+
+   for(duty = -32768; duty <= 32767; duty++)
+   {
+      ccr = TB6612_duty_q15_to_ccr((int16_t)duty, period);
+      ref = bench_float_ccr((float)duty / 32768.0f, period);
+
+      if((ccr + 1 < ref)||(ccr > ref + 1)||(ccr < last)||(ccr > period))
+      {
+         if(bad == 0)
+         {
+            printf("period %u duty %d: q15 %u, float %u\n", period, duty, ccr, ref);
+         }
+         bad++;
+      }
+      last = ccr;
+   }
+
+   if((TB6612_duty_q15_to_ccr(-32768, period) != 0)||(TB6612_duty_q15_to_ccr(32767, period) != period))
+   {
+      printf("period %u: ends are %u and %u\n", period, TB6612_duty_q15_to_ccr(-32768, period), TB6612_duty_q15_to_ccr(32767, period));
+      bad++;
+   }
+
+   return bad;
+}
+
+int main(int argc, char *argv[])
+{
+   const uint32_t periods[] = {(BENCH_CORE_HZ / 24000) - 1, BENCH_CORE_HZ / (2 * TB6612_PWM_HZ)};
+   volatile uint32_t sink = 0;
+   volatile uint32_t period;
+   unsigned long long c0, c1;
+   double cyc_float, cyc_wrapper, cyc_q15, calls;
+   uint32_t rounds = 200;
+   uint32_t round, failures = 0;
+   int32_t duty;
+   uint8_t n;
+   int opt;
+
+   while((opt = getopt(argc, argv, "n:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'n':
+            rounds = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   for(n = 0; n < 2; n++)
+   {
+      failures += bench_check(periods[n]);
+   }
+   printf("q15 %s the float conversion to a count at periods %u and %u\n\n",
+          (failures == 0) ? "matches" : "DOESN'T match", periods[0], periods[1]);
+
+   /* Through a volatile so nothing is folded at compile time. */
+   period = periods[1];
+   calls = (double)rounds * 65536.0;
+
+   c0 = BENCH_TSC();
+   for(round = 0; round < rounds; round++)
+   {
+      for(duty = -32768; duty <= 32767; duty++)
+      {
+         sink += bench_float_ccr((float)duty * (1.0f / 32768.0f), period);
+      }
+   }
+   c1 = BENCH_TSC();
+   cyc_float = (double)(c1 - c0) / calls;
+
+   c0 = BENCH_TSC();
+   for(round = 0; round < rounds; round++)
+   {
+      for(duty = -32768; duty <= 32767; duty++)
+      {
+         sink += bench_wrapper_ccr((float)duty * (1.0f / 32768.0f), period);
+      }
+   }
+   c1 = BENCH_TSC();
+   cyc_wrapper = (double)(c1 - c0) / calls;
+
+   c0 = BENCH_TSC();
+   for(round = 0; round < rounds; round++)
+   {
+      for(duty = -32768; duty <= 32767; duty++)
+      {
+         sink += bench_q15_ccr((int16_t)duty, period);
+      }
+   }
+   c1 = BENCH_TSC();
+   cyc_q15 = (double)(c1 - c0) / calls;
+
+   printf("TSC cycles per call, including the loop\n");
+   printf("   old float with double rounding   %6.2f\n", cyc_float);
+   printf("   float wrapper over q15           %6.2f\n", cyc_wrapper);
+   printf("   q15                              %6.2f\n", cyc_q15);
+
+   if(failures > 0)
+   {
+      return 2;
+   }
+
+   return 0;
+}
@@ -0,0 +1,482 @@
+/**
+ * @file tilt_profile_sim.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Measures the tilt sweep the real step timer code produces.
+ *
+ * Runs tilt_stepper_motor_control.c on hal_host.c with the same mirror and
+ * home flag model as firmware_host, lets it home, then records every STEP
+ * edge while it sweeps.  Each sweep is resampled onto a fixed
+ * grid and differenced for velocity, acceleration and jerk, and compared
+ * against the S curve the stepper is meant to follow: trajectory_at() with
+ * TILT_STEPPER_SWEEP_RAMP over the sweep's angle and the period asked for,
+ * lined up with the sweep where it's halfway.  The first and last steps come
+ * a little into the ramps, so the period from edge to edge is a few ms
+ * short of the one asked for.  With r
+ * the ramp and c = 1 / (1 - r) its cruising speed over the average, its peaks
+ * are c*A/T, 1.5*c/r*A/T^2 and 6*c/r^2*A/T^3.  The shortest time between two
+ * steps gives each sweep's peak step rate, which always has to be within
+ * TILT_STEPPER_MAX_STEP_HZ.  Everything runs on the virtual clock so the
+ * numbers are exact and the same every run, which makes it usable as a check
+ * on profile changes.
+ *
+ * The angle is only ever within a microstep of the curve, and differencing
+ * that over a grid point or two makes acceleration and jerk mostly step
+ * noise.  Each is differenced over the shortest multiple of the grid where a
+ * microstep of error is no more than SIM_NOISE_SHARE of the reference's
+ * peak, and has to stay within -K of the reference's peak plus that noise.
+ *
+ * tilt_profile_sim [-n sweeps] [-m multiplier] [-a start_rad] [-r grid_ms]
+ *                  [-o csv] [-P period_s] [-E tolerance] [-D max_dev_rad]
+ *                  [-W max_dwell_ms] [-K shape_tolerance]
+ *
+ *    -n   Sweeps to measure, 4 by default.
+ *    -m   stepper_profile_multiplier, 1.0 by default, the sweep takes
+ *         TILT_STEPPER_SWEEP_S times this.  Below 1.0 it sweeps at 1.0, as
+ *         the firmware does.
+ *    -a   Where the mirror starts, 3.0 rad by default.
+ *    -r   Resampling grid, 1 ms by default (the stepper state machine's tick).
+ *    -o   Writes sweep, t, angle, reference, velocity, acceleration and jerk
+ *         for every grid point.
+ *    -P   Fails unless every sweep period is within -E (0.01 by default) of
+ *         this, as a fraction.
+ *    -D   Fails if any sweep strays further than this from the reference.
+ *    -W   Fails if any dwell between sweeps is longer than this.
+ *    -K   Peak acceleration and jerk allowed over the reference's, as a
+ *         fraction, 0.1 by default.
+ *
+ * Exits 0 if every check passed, 2 if one failed or the sweeps never came.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "hal.h"
+#include "debug.h"
+#include "event_scheduler.h"
+#include "trace.h"
+#include "tilt_stepper_motor_control.h"
+#include "trajectory.h"
+
+/* Homing takes a few seconds from the worst start, each sweep under two. */
+#define SIM_SLICE_NS       10000000ULL
+#define SIM_SETTLE_NS      30000000000ULL
+#define SIM_SWEEP_NS       10000000000ULL
+
+/* Step noise allowed in the acceleration and jerk, of the reference's peak. */
+#define SIM_NOISE_SHARE    0.1
+
+/* From tilt_stepper_motor_control.c and tilt_stepper_motor_profile.h. */
+extern tilt_stepper_states ts_state;
+extern uint32_t micro_steps_per_rev;
+extern float stepper_gear_ratio_num;
+extern float stepper_gear_ratio_den;
+extern float rad_per_micro_step;
+
+typedef struct {
+   uint64_t first;               /* Index into edge_ns. */
+   uint64_t count;
+   int8_t dir;
+} sweep_t;
+
+uint64_t *edge_ns = NULL;
+uint64_t edge_count = 0;
+uint64_t edge_size = 0;
+
+sweep_t *sweeps = NULL;
+uint32_t sweep_count = 0;
+uint32_t sweep_size = 0;
+
+int64_t mirror_steps = 0;
+float mirror_start_rad = 3.0f;
+
+float mirror_rad(void)
+{
+   return mirror_start_rad + (((float)mirror_steps / (float)micro_steps_per_rev) *
+                              (stepper_gear_ratio_den / stepper_gear_ratio_num) * TILT_STEPPER_TWO_PI);
+}
+
+uint8_t mirror_home_flag(void)
+{
+   float rad = mirror_rad();
+
+   while(rad > (TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad -= TILT_STEPPER_TWO_PI;
+   }
+   while(rad <= -(TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad += TILT_STEPPER_TWO_PI;
+   }
+
+   return (rad <= 0.0f);
+}
+
+void record_edge(int8_t dir, uint64_t ns)
+{
+   sweep_t *sweep = (sweep_count > 0) ? &(sweeps[sweep_count - 1]) : NULL;
+
+   if((sweep == NULL)||(sweep->dir != dir))
+   {
+      if(sweep_count == sweep_size)
+      {
+         sweep_size = (sweep_size == 0) ? 16 : (sweep_size * 2);
+         sweeps = realloc(sweeps, sweep_size * sizeof(sweep_t));
+      }
+      sweep = &(sweeps[sweep_count++]);
+      sweep->first = edge_count;
+      sweep->count = 0;
+      sweep->dir = dir;
+   }
+
+   if(edge_count == edge_size)
+   {
+      edge_size = (edge_size == 0) ? 65536 : (edge_size * 2);
+      edge_ns = realloc(edge_ns, edge_size * sizeof(uint64_t));
+   }
+   if((sweeps == NULL)||(edge_ns == NULL))
+   {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+   }
+
+   edge_ns[edge_count++] = ns;
+   sweep->count++;
+}
+
+void pin_watch(uint8_t pin, uint8_t level, uint64_t ns)
+{
+   uint8_t flag;
+   int8_t dir;
+
+   if(pin != HAL_PIN_TMC260_STEP)
+   {
+      return;
+   }
+
+   /* Steps on both edges, DIR low is CW, which counts down. */
+   dir = hal_gpio_read(HAL_PIN_TMC260_DIR) ? 1 : -1;
+   mirror_steps += dir;
+
+   /* Called from inside TIM5_IRQHandler, so this is the state it stepped in. */
+   if(ts_state == TILT_STEPPER_TILT_TABLE)
+   {
+      record_edge(dir, ns);
+   }
+
+   flag = mirror_home_flag();
+   if(flag != hal_gpio_read(HAL_PIN_TILT_HOME))
+   {
+      hal_host_gpio_input(HAL_PIN_TILT_HOME, flag);
+   }
+}
+
+/* Steps taken by t, linear between edges so the grid doesn't see every
+ * microstep as a spike.
+ */
+double sweep_steps_at(const sweep_t *sweep, double t_ns, uint64_t *hint)
+{
+   const uint64_t *ns = &(edge_ns[sweep->first]);
+   uint64_t i = *hint;
+
+   if(t_ns <= (double)ns[0])
+   {
+      return 0.0;
+   }
+   if(t_ns >= (double)ns[sweep->count - 1])
+   {
+      return (double)(sweep->count - 1);
+   }
+
+   while((i + 1 < sweep->count)&&((double)ns[i + 1] <= t_ns))
+   {
+      i++;
+   }
+   *hint = i;
+
+   return (double)i + ((t_ns - (double)ns[i]) / (double)(ns[i + 1] - ns[i]));
+}
+
+/* Grid points to difference over so an error of noise at each one makes
+ * no more than limit, with an error of weight * noise / (h^order) at h.
+ */
+uint32_t window_points(double weight, int order, double noise, double limit, double dt)
+{
+   uint32_t w = 1;
+
+   while(((weight * noise) / pow(w * dt, order)) > limit)
+   {
+      w++;
+   }
+
+   return w;
+}
+
+int main(int argc, char **argv)
+{
+   FILE *csv = NULL;
+   uint32_t wanted = 4;
+   float multiplier = 1.0f;
+   double grid_ms = 1.0;
+   double want_period = 0.0;
+   double tolerance = 0.01;
+   double max_dev = 0.0;
+   double max_dwell = 0.0;
+   double shape_tolerance = 0.1;
+   double cruise;
+   uint64_t deadline;
+   uint32_t failures = 0;
+   uint32_t s;
+   int opt;
+
+   while((opt = getopt(argc, argv, "n:m:a:r:o:P:E:D:W:K:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'n':
+            wanted = (uint32_t)atoi(optarg);
+            break;
+         case 'm':
+            multiplier = (float)atof(optarg);
+            break;
+         case 'a':
+            mirror_start_rad = (float)atof(optarg);
+            break;
+         case 'r':
+            grid_ms = atof(optarg);
+            break;
+         case 'o':
+            csv = fopen(optarg, "w");
+            if(csv == NULL)
+            {
+               perror(optarg);
+               return 1;
+            }
+            break;
+         case 'P':
+            want_period = atof(optarg);
+            break;
+         case 'E':
+            tolerance = atof(optarg);
+            break;
+         case 'D':
+            max_dev = atof(optarg);
+            break;
+         case 'W':
+            max_dwell = atof(optarg);
+            break;
+         case 'K':
+            shape_tolerance = atof(optarg);
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-n sweeps] [-m multiplier] [-a start_rad] [-r grid_ms] [-o csv]\n"
+                    "          [-P period_s] [-E tolerance] [-D max_dev_rad] [-W max_dwell_ms] [-K shape_tolerance]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   if((wanted < 1)||(grid_ms <= 0.0))
+   {
+      fprintf(stderr, "need at least one sweep and a grid above 0 ms\n");
+      return 1;
+   }
+
+   hal_host_reset();
+   hal_host_set_pin_watch(&pin_watch);
+   hal_host_gpio_input(HAL_PIN_TILT_HOME, mirror_home_flag());
+   hal_host_gpio_input(HAL_PIN_HOKUYO_SYNC, 1);
+
+   debug_init();
+   trace_init();
+   event_init();
+   tilt_stepper_motor_init();
+   multiplier = tilt_stepper_motor_set_profile_multiplier(multiplier);
+
+   /* A sweep is only finished once the next one has started. */
+   deadline = SIM_SETTLE_NS + (uint64_t)(wanted * SIM_SWEEP_NS * ((multiplier > 1.0f) ? multiplier : 1.0f));
+   while((sweep_count <= wanted)&&(hal_host_now_ns() < deadline))
+   {
+      hal_host_run_until(hal_host_now_ns() + SIM_SLICE_NS);
+   }
+
+   if(sweep_count <= wanted)
+   {
+      printf("only %u of %u sweeps in %.1f s, state %u\n",
+             (sweep_count > 0) ? (sweep_count - 1) : 0, wanted, hal_host_now_ns() / 1e9, ts_state);
+      return 2;
+   }
+
+   cruise = 1.0 / (1.0 - TILT_STEPPER_SWEEP_RAMP);
+   printf("profile  %.6f rad a step, multiplier %.3f, ramps %.1f%% of a sweep, %.3f ms grid\n",
+          rad_per_micro_step, multiplier, 100.0 * TILT_STEPPER_SWEEP_RAMP, grid_ms);
+   printf("sweep dir   steps    angle    period   dwell      max dev   rms dev   "
+          "peak vel (ref)      peak acc (ref)  over   peak jerk (ref)  over   steps/s\n");
+
+   if(csv != NULL)
+   {
+      fprintf(csv, "sweep,t_s,angle_rad,ref_rad,vel_rad_s,acc_rad_s2,jerk_rad_s3\n");
+   }
+
+   for(s = 0; s < wanted; s++)
+   {
+      const sweep_t *sweep = &(sweeps[s]);
+      uint64_t start_ns = edge_ns[sweep->first];
+      uint64_t end_ns = edge_ns[sweep->first + sweep->count - 1];
+      uint64_t next_ns = edge_ns[sweeps[s + 1].first];
+      double period = (end_ns - start_ns) / 1e9;
+      double dwell_ms = (next_ns - end_ns) / 1e6;
+      double angle = (sweep->count - 1) * (double)rad_per_micro_step;
+      double dt = grid_ms / 1e3;
+      uint32_t points = (uint32_t)(period / dt) + 1;
+      double asked = multiplier * TILT_STEPPER_SWEEP_S;
+      double ref_start = ((edge_ns[sweep->first + (sweep->count / 2)] - start_ns) / 1e9) - (asked / 2.0);
+      double vel_ref = cruise * angle / asked;
+      double acc_ref = (1.5 * cruise / TILT_STEPPER_SWEEP_RAMP) * angle / (asked * asked);
+      double jerk_ref = (6.0 * cruise / (TILT_STEPPER_SWEEP_RAMP * TILT_STEPPER_SWEEP_RAMP)) * angle / (asked * asked * asked);
+      uint32_t wa = window_points(4.0, 2, rad_per_micro_step, SIM_NOISE_SHARE * acc_ref, dt);
+      uint32_t wj = window_points(6.0 / 2.0, 3, rad_per_micro_step, SIM_NOISE_SHARE * jerk_ref, dt);
+      uint32_t margin = 2 * wj;
+      trajectory_t trj;
+      trajectory_point_t pt;
+      double *pos;
+      double dev_max = 0.0;
+      double dev_sum = 0.0;
+      double vel_peak = 0.0;
+      double acc_peak = 0.0;
+      double jerk_peak = 0.0;
+      double step_hz;
+      uint64_t shortest_ns = 0;
+      uint64_t hint = 0;
+      uint64_t e;
+      uint32_t k;
+
+      if((sweep->count < 2)||(points < 5))
+      {
+         printf("%5u  too short to measure (%llu steps)\n", s, (unsigned long long)sweep->count);
+         failures++;
+         continue;
+      }
+
+      for(e = sweep->first + 1; e < sweep->first + sweep->count; e++)
+      {
+         if((shortest_ns == 0)||(edge_ns[e] - edge_ns[e - 1] < shortest_ns))
+         {
+            shortest_ns = edge_ns[e] - edge_ns[e - 1];
+         }
+      }
+      step_hz = 1e9 / (double)shortest_ns;
+
+      /* One way only, held at the far end after it. */
+      trajectory_init_sweep(&trj, 0.0f, (float)angle, (float)asked, 1e6f);
+      trajectory_set_ramp(&trj, TILT_STEPPER_SWEEP_RAMP);
+
+      /* Enough points past each end so the differences reach the ends, the
+       * mirror is standing still there.
+       */
+      pos = malloc((points + (2 * margin)) * sizeof(double));
+      if(pos == NULL)
+      {
+         fprintf(stderr, "out of memory\n");
+         return 1;
+      }
+      for(k = 0; k < points + (2 * margin); k++)
+      {
+         double t_ns = start_ns + (((double)k - (double)margin) * dt * 1e9);
+
+         pos[k] = sweep_steps_at(sweep, t_ns, &hint) * rad_per_micro_step;
+      }
+
+      for(k = 0; k < points; k++)
+      {
+         double *p = &(pos[k + margin]);
+         double ha = wa * dt;
+         double hj = wj * dt;
+         double vel = (p[1] - p[-1]) / (2.0 * dt);
+         double acc = (p[wa] - (2.0 * p[0]) + p[-(int32_t)wa]) / (ha * ha);
+         double jerk = (p[2 * wj] - (2.0 * p[wj]) + (2.0 * p[-(int32_t)wj]) - p[-2 * (int32_t)wj]) / (2.0 * hj * hj * hj);
+         double ref;
+         double dev;
+
+         if((k * dt) < ref_start)
+         {
+            ref = 0.0;
+         }
+         else
+         {
+            trajectory_at(&trj, (float)((k * dt) - ref_start), &pt);
+            ref = pt.pos;
+         }
+         dev = fabs(p[0] - ref);
+
+         dev_max = (dev > dev_max) ? dev : dev_max;
+         dev_sum += dev * dev;
+         vel_peak = (fabs(vel) > vel_peak) ? fabs(vel) : vel_peak;
+         acc_peak = (fabs(acc) > acc_peak) ? fabs(acc) : acc_peak;
+         jerk_peak = (fabs(jerk) > jerk_peak) ? fabs(jerk) : jerk_peak;
+
+         if(csv != NULL)
+         {
+            fprintf(csv, "%u,%.6f,%.6f,%.6f,%.4f,%.3f,%.1f\n", s, k * dt,
+                    sweep->dir * p[0], sweep->dir * ref, sweep->dir * vel, sweep->dir * acc, sweep->dir * jerk);
+         }
+      }
+      free(pos);
+
+      printf("%5u %4s %7llu  %7.4f  %7.4f  %6.2f ms  %8.5f  %8.5f  %7.3f (%7.3f)  %6.2f (%6.2f) %3u ms  %7.1f (%7.1f) %3u ms  %7.0f\n",
+             s, (sweep->dir > 0) ? "CCW" : "CW", (unsigned long long)(sweep->count), angle, period, dwell_ms,
+             dev_max, sqrt(dev_sum / points),
+             vel_peak, vel_ref,
+             acc_peak, acc_ref, (uint32_t)(2.0 * wa * grid_ms + 0.5),
+             jerk_peak, jerk_ref, (uint32_t)(4.0 * wj * grid_ms + 0.5), step_hz);
+
+      if(acc_peak > (acc_ref * (1.0 + shape_tolerance)) + ((4.0 * rad_per_micro_step) / pow(wa * dt, 2)))
+      {
+         printf("      FAIL acceleration %.2f rad/s^2, reference %.2f rad/s^2\n", acc_peak, acc_ref);
+         failures++;
+      }
+      if(jerk_peak > (jerk_ref * (1.0 + shape_tolerance)) + ((3.0 * rad_per_micro_step) / pow(wj * dt, 3)))
+      {
+         printf("      FAIL jerk %.1f rad/s^3, reference %.1f rad/s^3\n", jerk_peak, jerk_ref);
+         failures++;
+      }
+
+      if((want_period > 0.0)&&(fabs(period - want_period) > (tolerance * want_period)))
+      {
+         printf("      FAIL period %.4f s, wanted %.4f s +/- %.1f%%\n", period, want_period, tolerance * 100.0);
+         failures++;
+      }
+      if((max_dev > 0.0)&&(dev_max > max_dev))
+      {
+         printf("      FAIL deviation %.5f rad, limit %.5f rad\n", dev_max, max_dev);
+         failures++;
+      }
+      if(step_hz > TILT_STEPPER_MAX_STEP_HZ * 1.0001)
+      {
+         printf("      FAIL %.0f steps/s, limit %d\n", step_hz, TILT_STEPPER_MAX_STEP_HZ);
+         failures++;
+      }
+      if((max_dwell > 0.0)&&(dwell_ms > max_dwell))
+      {
+         printf("      FAIL dwell %.2f ms, limit %.2f ms\n", dwell_ms, max_dwell);
+         failures++;
+      }
+   }
+
+   printf("watchdog %u resets\n", hal_host_watchdog_resets());
+   if(hal_host_watchdog_resets() != 0)
+   {
+      failures++;
+   }
+
+   if(csv != NULL)
+   {
+      fclose(csv);
+   }
+
+   printf("%s\n", (failures == 0) ? "PASS" : "FAIL");
+
+   return (failures == 0) ? 0 : 2;
+}
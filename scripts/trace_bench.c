@@ -0,0 +1,403 @@
+/**
+ * @file trace_bench.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Checks trace.c's ring and drain and counts the cycles TRACE() adds
+ * to each event.
+ *
+ * The HAL calls trace_write() makes are stubbed down to what they are on the
+ * target, a PRIMASK save and restore and a CYCCNT load, so the time here is
+ * the ring's own.  The packet builder and the TX queue are stubbed too, the
+ * drain hands them the records and whether the queue takes them is up to the
+ * test.
+ *
+ * Checks:
+ *
+ *    Records come back from the drain in order, six to a packet, with their
+ *    ids, arguments and rising timestamps.
+ *
+ *    A full ring drops and counts, the count goes out with the next packet
+ *    and is cleared.  A full TX queue leaves the records in the ring and
+ *    keeps the count for the next try.
+ *
+ *    trace_snapshot() returns the newest ring full, oldest first, sent or
+ *    not.
+ *
+ * Then TRACE() is timed writing into a ring with room and into a full one,
+ * against an empty call taking the same arguments.  The difference is the
+ * cost per event.  A PC does each of those instructions in less time than
+ * the M4, so the counts are the least the target's can be.
+ *
+ * trace_bench [-n events]
+ *
+ *    -n   Events per timed pass, 10000000 by default.
+ *
+ * Exits with test_summary(), see host_test.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC() __rdtsc()
+#else
+#define BENCH_TSC() 0ULL
+#endif
+
+#include "trace.h"
+#include "full_duplex_usart_dma.h"
+#include "host_test.h"
+
+#define BENCH_CALL __attribute__((noinline))
+
+#define BENCH_MAX_RECORDS      (4 * TRACE_RING_SIZE)
+
+/* From trace.c. */
+extern volatile uint32_t trace_head;
+extern volatile uint32_t trace_tail;
+extern volatile uint32_t trace_dropped;
+
+/* The stubbed core. */
+volatile uint32_t bench_primask = 0;
+volatile uint32_t bench_cyccnt = 0;
+
+/* What the drain sent. */
+trace_record_t bench_sent[BENCH_MAX_RECORDS];
+uint32_t bench_sent_count = 0;
+uint32_t bench_packets = 0;
+uint32_t bench_largest_packet = 0;
+uint32_t bench_dropped_sent = 0;
+uint8_t bench_queue_full = 0;
+
+FDUD_TxQueueCallback bench_callbacks[TRACE_TX_PACKETS];
+uint32_t bench_callback_data[TRACE_TX_PACKETS];
+uint32_t bench_queued = 0;
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_cycles_init(void)
+{
+   bench_cyccnt = 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t hal_cycles(void)
+{
+   return bench_cyccnt++;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t hal_irq_save(void)
+{
+   uint32_t key = bench_primask;
+
+   bench_primask = 1;
+
+   return key;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_irq_restore(uint32_t key)
+{
+   bench_primask = key;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t hal_millis(void)
+{
+   return bench_cyccnt / (HAL_HOST_CORE_HZ / 1000);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_trace(GenericPacket *gp, uint32_t ms, uint32_t cycles, uint16_t dropped,
+                               const uint8_t *records, uint8_t count)
+{
+   if(bench_queue_full)
+   {
+      return GP_SUCCESS;
+   }
+
+   if(bench_sent_count + count <= BENCH_MAX_RECORDS)
+   {
+      memcpy(&(bench_sent[bench_sent_count]), records, count * sizeof(trace_record_t));
+      bench_sent_count += count;
+   }
+   bench_packets++;
+   if(count > bench_largest_packet)
+   {
+      bench_largest_packet = count;
+   }
+   bench_dropped_sent += dropped;
+
+   return GP_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t full_duplex_usart_dma_add_to_queue(GenericPacket *gp_ptr, FDUD_TxQueueCallback callback_func, uint32_t callback_data)
+{
+   if((bench_queue_full)||(bench_queued >= TRACE_TX_PACKETS))
+   {
+      return FDUD_FAIL;
+   }
+
+   bench_callbacks[bench_queued] = callback_func;
+   bench_callback_data[bench_queued] = callback_data;
+   bench_queued++;
+
+   return FDUD_SUCCESS;
+}
+
+/* PRIVATE bench_send_all
+ *
+ * Notes:
+ *  +Drains until the ring is empty, sending each batch of packets the way
+ *   the TX DMA would.
+ */
+void bench_send_all(void)
+{
+   uint32_t ii;
+
+   do
+   {
+      trace_drain();
+      for(ii=0; ii<bench_queued; ii++)
+      {
+         bench_callbacks[ii](bench_callback_data[ii]);
+      }
+      bench_queued = 0;
+   } while(trace_head != trace_tail);
+}
+
+void bench_start(void)
+{
+   trace_init();
+   bench_sent_count = 0;
+   bench_packets = 0;
+   bench_largest_packet = 0;
+   bench_dropped_sent = 0;
+   bench_queue_full = 0;
+   bench_queued = 0;
+}
+
+/* The event each write i is checked against. */
+uint8_t bench_id(uint32_t i)
+{
+   return (uint8_t)(i % TRACE_NUM_IDS);
+}
+
+uint8_t bench_arg8(uint32_t i)
+{
+   return (uint8_t)(i * 7);
+}
+
+uint16_t bench_arg16(uint32_t i)
+{
+   return (uint16_t)(i * 40503);
+}
+
+void bench_order(void)
+{
+   uint32_t ii, bad = 0;
+   uint32_t writes = (5 * TRACE_RING_SIZE) / 2;
+
+   bench_start();
+
+   /* In batches smaller than the ring, drained between. */
+   for(ii=0; ii<writes; ii++)
+   {
+      TRACE(bench_id(ii), bench_arg8(ii), bench_arg16(ii));
+      if((ii % 100) == 99)
+      {
+         bench_send_all();
+      }
+   }
+   bench_send_all();
+
+   test_check(bench_sent_count == writes, "order", "records sent", bench_sent_count);
+   for(ii=0; (ii<bench_sent_count)&&(ii<writes); ii++)
+   {
+      if((bench_sent[ii].id != bench_id(ii))||(bench_sent[ii].arg8 != bench_arg8(ii))||
+         (bench_sent[ii].arg16 != bench_arg16(ii))||((ii > 0)&&(bench_sent[ii].cycles <= bench_sent[ii - 1].cycles)))
+      {
+         bad++;
+      }
+   }
+   test_check(bad == 0, "order", "records out of order or wrong", bad);
+   test_check(bench_largest_packet == TRACE_RECORDS_PER_PACKET, "order", "largest packet", bench_largest_packet);
+   test_check(bench_dropped_sent == 0, "order", "dropped with room", bench_dropped_sent);
+
+   printf("order    %u records in %u packets, %u bad\n", bench_sent_count, bench_packets, bad);
+}
+
+void bench_full(void)
+{
+   uint32_t ii, bad = 0;
+   uint32_t extra = 37;
+
+   bench_start();
+
+   for(ii=0; ii<TRACE_RING_SIZE + extra; ii++)
+   {
+      TRACE(bench_id(ii), bench_arg8(ii), bench_arg16(ii));
+   }
+   test_check(trace_dropped == extra, "full", "dropped count", trace_dropped);
+
+   /* The queue turns the packets away, nothing moves and the count stays. */
+   bench_queue_full = 1;
+   trace_drain();
+   test_check(trace_head - trace_tail == TRACE_RING_SIZE, "full", "records gone with the queue full",
+               trace_head - trace_tail);
+   test_check(trace_dropped == extra, "full", "dropped count lost with the queue full", trace_dropped);
+
+   bench_queue_full = 0;
+   bench_send_all();
+   test_check(bench_sent_count == TRACE_RING_SIZE, "full", "records sent", bench_sent_count);
+   test_check(bench_dropped_sent == extra, "full", "dropped count sent", bench_dropped_sent);
+   test_check(trace_dropped == 0, "full", "dropped count left", trace_dropped);
+
+   /* The first ring full made it, the rest were dropped. */
+   for(ii=0; ii<bench_sent_count; ii++)
+   {
+      if((bench_sent[ii].id != bench_id(ii))||(bench_sent[ii].arg16 != bench_arg16(ii)))
+      {
+         bad++;
+      }
+   }
+   test_check(bad == 0, "full", "wrong records kept", bad);
+
+   printf("full     %u dropped and sent as %u, %u records kept\n", extra, bench_dropped_sent, bench_sent_count);
+}
+
+void bench_snapshot(void)
+{
+   trace_record_t records[TRACE_RING_SIZE];
+   uint32_t count, ii, bad = 0;
+   uint32_t writes = TRACE_RING_SIZE + 100;
+
+   bench_start();
+
+   count = trace_snapshot(records, TRACE_RING_SIZE);
+   test_check(count == 0, "snapshot", "records before any write", count);
+
+   /* Sent as they go, so the ring laps what it already sent. */
+   for(ii=0; ii<writes; ii++)
+   {
+      TRACE(bench_id(ii), bench_arg8(ii), bench_arg16(ii));
+      bench_send_all();
+   }
+
+   count = trace_snapshot(records, 10);
+   test_check(count == 10, "snapshot", "records with a max of 10", count);
+   for(ii=0; ii<count; ii++)
+   {
+      if(records[ii].arg16 != bench_arg16(writes - 10 + ii))
+      {
+         bad++;
+      }
+   }
+
+   count = trace_snapshot(records, TRACE_RING_SIZE);
+   test_check(count == TRACE_RING_SIZE, "snapshot", "records in a full ring", count);
+   for(ii=0; ii<count; ii++)
+   {
+      if(records[ii].arg16 != bench_arg16(writes - TRACE_RING_SIZE + ii))
+      {
+         bad++;
+      }
+   }
+   test_check(bad == 0, "snapshot", "wrong records", bad);
+
+   printf("snapshot newest %u of %u writes, %u bad\n", count, writes, bad);
+}
+
+/* Takes what TRACE() takes and does nothing. */
+BENCH_CALL void bench_empty(uint8_t id, uint8_t arg8, uint16_t arg16)
+{
+   __asm__ volatile("" ::: "memory");
+}
+
+void bench_time(uint32_t events)
+{
+   unsigned long long c0, c1;
+   double cyc_empty, cyc_room, cyc_full;
+   uint32_t ii;
+
+   c0 = BENCH_TSC();
+   for(ii=0; ii<events; ii++)
+   {
+      bench_empty(bench_id(ii), (uint8_t)ii, (uint16_t)ii);
+   }
+   c1 = BENCH_TSC();
+   cyc_empty = (double)(c1 - c0) / events;
+
+   /* Emptied every ring full, like the drain would, so every write lands. */
+   bench_start();
+   c0 = BENCH_TSC();
+   for(ii=0; ii<events; ii++)
+   {
+      TRACE(bench_id(ii), (uint8_t)ii, (uint16_t)ii);
+      if((ii & (TRACE_RING_SIZE - 1)) == (TRACE_RING_SIZE - 1))
+      {
+         trace_tail = trace_head;
+      }
+   }
+   c1 = BENCH_TSC();
+   cyc_room = (double)(c1 - c0) / events;
+   test_check(trace_dropped == 0, "time", "dropped with room", trace_dropped);
+
+   bench_start();
+   for(ii=0; ii<TRACE_RING_SIZE; ii++)
+   {
+      TRACE(0, 0, 0);
+   }
+   c0 = BENCH_TSC();
+   for(ii=0; ii<events; ii++)
+   {
+      TRACE(bench_id(ii), (uint8_t)ii, (uint16_t)ii);
+   }
+   c1 = BENCH_TSC();
+   cyc_full = (double)(c1 - c0) / events;
+   test_check(trace_dropped == events, "time", "dropped when full", trace_dropped);
+
+   printf("\nTSC cycles per event, including the loop\n");
+   printf("   empty call                       %6.2f\n", cyc_empty);
+   printf("   TRACE() with room                %6.2f  (+%.2f)\n", cyc_room, cyc_room - cyc_empty);
+   printf("   TRACE() into a full ring         %6.2f  (+%.2f)\n", cyc_full, cyc_full - cyc_empty);
+}
+
+int main(int argc, char *argv[])
+{
+   uint32_t events = 10000000;
+   int opt;
+
+   while((opt = getopt(argc, argv, "n:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'n':
+            events = (uint32_t)strtoul(optarg, NULL, 0);
+            if(events == 0)
+            {
+               events = 1;
+            }
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-n events]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   printf("%d record ring, %d records per packet, %d packets in flight\n\n",
+          TRACE_RING_SIZE, TRACE_RECORDS_PER_PACKET, TRACE_TX_PACKETS);
+
+   bench_order();
+   bench_full();
+   bench_snapshot();
+   bench_time(events);
+
+   return test_summary();
+}
@@ -0,0 +1,180 @@
+/**
+ * @file trace_decode.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Host side decoder for UNIVERSAL_TRACE packets.
+ *
+ * Reads the raw byte stream from the board on stdin, for example
+ *
+ *    stty -F /dev/ttyUSB0 raw 115200; ./trace_decode < /dev/ttyUSB0
+ *
+ * and prints the trace as a timeline in milliseconds since boot.  Anything
+ * that isn't a trace packet is skipped.  Build with "make trace_decode".
+ *
+ * Records are timestamped with the 32 bit cycle counter, which wraps every
+ * 25s at 168MHz.  Each packet carries ms_counter and the cycle counter from
+ * when it was built, and records are placed back from there.  That holds as
+ * long as a record goes out within one wrap of being written.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "generic_packet.h"
+#include "gp_circular_buffer.h"
+#include "gp_proj_universal.h"
+#include "gp_proj_local.h"
+
+#define TRACE_DECODE_QUEUE_SIZE    4
+
+/* trace.h pulls in the STM32 headers, so these are copies.  Keep them in
+ * sync with enum trace_ids, TRACE_RECORDS_PER_PACKET and the state enums.
+ */
+#define TRACE_NUM_IDS              4
+#define TRACE_RECORDS_PER_PACKET   6
+#define TRACE_RECORD_BYTES         8
+
+const char *trace_decode_names[TRACE_NUM_IDS] =
+{
+   "tilt_state",
+   "rs485_master_state",
+   "fdud_packet_reset",
+   "tx_callback_mismatch"
+};
+
+#define TRACE_DECODE_TILT_STATES   9
+const char *trace_decode_tilt_states[TRACE_DECODE_TILT_STATES] =
+{
+   "INITIALIZE",
+   "HOME",
+   "HOLD",
+   "FIND_POS",
+   "TILT_TABLE",
+   "TEST_CW",
+   "TEST_CCW",
+   "TEST_DELAY",
+   "ERROR"
+};
+
+#define TRACE_DECODE_RS485_STATES  9
+const char *trace_decode_rs485_states[TRACE_DECODE_RS485_STATES] =
+{
+   "INIT",
+   "FIND_ATTACHED_DEVICES",
+   "QUERY_DEVICE",
+   "AWAIT_RESPONSE",
+   "AWAIT_SLOTS",
+   "AWAIT_CONFIG",
+   "DELAY",
+   "IDLE",
+   "ERROR"
+};
+
+GenericPacketCircularBuffer trace_decode_gpcb;
+GenericPacket trace_decode_queue[TRACE_DECODE_QUEUE_SIZE];
+
+/* Used Internally */
+void trace_decode_print(GenericPacket *gp, double cycles_per_ms);
+const char *trace_decode_state(const char **names, uint32_t num_names, uint32_t state);
+
+int main(int argc, char *argv[])
+{
+   double core_mhz;
+   int c;
+
+   /* SystemCoreClock on the board, 168MHz unless told otherwise. */
+   core_mhz = (argc > 1) ? atof(argv[1]) : 168.0;
+   if(core_mhz <= 0.0)
+   {
+      fprintf(stderr, "usage: %s [core clock MHz] < stream\n", argv[0]);
+      return 1;
+   }
+
+   gpcb_initialize(&trace_decode_gpcb, trace_decode_queue, TRACE_DECODE_QUEUE_SIZE);
+
+   while((c = getchar()) != EOF)
+   {
+      gpcb_receive_byte((uint8_t)c, &trace_decode_gpcb);
+
+      while(gpcb_increment_tail(&trace_decode_gpcb) == GP_CIRC_BUFFER_SUCCESS)
+      {
+         trace_decode_print(&(trace_decode_gpcb.gpcb[trace_decode_gpcb.gpcb_tail]), core_mhz * 1000.0);
+      }
+   }
+
+   return 0;
+}
+
+/* PRIVATE trace_decode_print
+ *
+ * Notes:
+ *  +Prints one line per record in a UNIVERSAL_TRACE packet, skips anything
+ *   else.
+ *  +Records are little endian: cycles (4), id (1), arg8 (1), arg16 (2).
+ */
+void trace_decode_print(GenericPacket *gp, double cycles_per_ms)
+{
+   uint8_t records[TRACE_RECORDS_PER_PACKET * TRACE_RECORD_BYTES];
+   uint32_t packet_ms, packet_cycles, cycles;
+   uint16_t dropped, arg16;
+   uint8_t count, id, arg8;
+   const uint8_t *r;
+   double ms;
+   uint8_t ii;
+
+   if((gp->gp[GP_LOC_PROJ_ID] != GP_PROJ_UNIVERSAL)||(gp->gp[GP_LOC_PROJ_SPEC] != UNIVERSAL_TRACE))
+   {
+      return;
+   }
+
+   if(extract_universal_trace(gp, &packet_ms, &packet_cycles, &dropped, records, &count) != GP_SUCCESS)
+   {
+      return;
+   }
+
+   if(dropped != 0)
+   {
+      printf("%12.3f  *** %u records dropped (ring full)\n", (double)packet_ms, dropped);
+   }
+
+   for(ii=0; (ii<count)&&(ii<TRACE_RECORDS_PER_PACKET); ii++)
+   {
+      r = &(records[ii * TRACE_RECORD_BYTES]);
+      cycles = r[0] | (r[1] << 8) | (r[2] << 16) | ((uint32_t)r[3] << 24);
+      id = r[4];
+      arg8 = r[5];
+      arg16 = r[6] | (r[7] << 8);
+
+      /* Unsigned subtraction handles the counter wrapping in between. */
+      ms = packet_ms - ((uint32_t)(packet_cycles - cycles) / cycles_per_ms);
+
+      switch(id)
+      {
+         case 0:
+            printf("%12.3f  %-22s %s -> %s\n", ms, trace_decode_names[id],
+                   trace_decode_state(trace_decode_tilt_states, TRACE_DECODE_TILT_STATES, arg16),
+                   trace_decode_state(trace_decode_tilt_states, TRACE_DECODE_TILT_STATES, arg8));
+            break;
+         case 1:
+            printf("%12.3f  %-22s %s -> %s\n", ms, trace_decode_names[id],
+                   trace_decode_state(trace_decode_rs485_states, TRACE_DECODE_RS485_STATES, arg16),
+                   trace_decode_state(trace_decode_rs485_states, TRACE_DECODE_RS485_STATES, arg8));
+            break;
+         default:
+            printf("%12.3f  %-22s %u %u\n", ms,
+                   (id < TRACE_NUM_IDS) ? trace_decode_names[id] : "?", arg8, arg16);
+            break;
+      }
+   }
+}
+
+/* PRIVATE trace_decode_state
+ *
+ * Notes:
+ *  +State name, or "?" for anything past the end of the table.
+ */
+const char *trace_decode_state(const char **names, uint32_t num_names, uint32_t state)
+{
+   return (state < num_names) ? names[state] : "?";
+}
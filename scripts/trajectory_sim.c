@@ -0,0 +1,466 @@
+/**
+ * @file trajectory_sim.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Tracking error of the brushed and the stepper axis following the
+ * same trajectory.c sweep.
+ *
+ * Brushed is motor_control_run_pid() with the tilt defaults and feed-forward
+ * on motor_control_sim's motor, run at 1 ms off trajectory_advance() the way
+ * tilt_motor_control.c does.  Stepper is tilt_stepper_motor_control.c itself
+ * on hal_host.c, homed first with the same mirror and flag model as
+ * tilt_profile_sim.  Both are measured against trajectory_at() from when
+ * their state machine started the sweep, brushed every 1 ms sample and
+ * stepper every 0.1 ms, over two full cycles after the first sweep.
+ *
+ * The periods don't have to be a whole number of milliseconds, which the old
+ * tables couldn't do.  The stepper never sweeps faster than the old table's
+ * TILT_STEPPER_SWEEP_S, so it isn't run at shorter periods.  Either axis
+ * sweeping at anything but the period asked for, the "swept" column, fails.
+ *
+ * trajectory_sim [-P period_s]... [-B max_brushed_rms_rad]
+ *                [-S max_stepper_err_rad] [-o csv]
+ *
+ *    -P   Sweep period to run, any number of times.  TILT_STEPPER_SWEEP_S,
+ *         1.0, 0.6543 and 1.5 s by default.
+ *    -B   Fails if the brushed axis tracks worse than this RMS, 0.01 rad by
+ *         default.
+ *    -S   Fails if the stepper is ever further than this from the sweep,
+ *         0.001 rad (about 19 microsteps) by default.
+ *    -o   Writes backend, period, t, reference and position for every
+ *         sample.
+ *
+ * Exits 0 if every check passed, 2 if one failed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "hal.h"
+#include "debug.h"
+#include "event_scheduler.h"
+#include "trace.h"
+#include "tilt_stepper_motor_control.h"
+#include "motor_control.h"
+#include "trajectory.h"
+
+#define SIM_MAX_PERIODS    16
+#define SIM_LOOP_HZ        1000.0
+#define SIM_CYCLES         2
+
+/* Swept against asked for, as a fraction. */
+#define SIM_PERIOD_TOLERANCE  1e-4
+
+/* Brushed, the same motor as motor_control_sim.c. */
+#define SIM_DT_S           10e-6
+#define SIM_SUBSTEPS       100
+#define MOTOR_VOLTS        12.0
+#define MOTOR_OHMS         2.0
+#define MOTOR_KT           0.01
+#define MOTOR_J            5.0e-6
+#define MOTOR_B            1.0e-6
+#define GEAR_RATIO         (24.0 * 74.0 / 16.0)
+#define GEAR_EFFICIENCY    0.8
+#define LOAD_J             2.0e-3
+#define LOAD_COULOMB       0.05
+#define ENCODER_QCPR       (4.0 * 25.0)
+#define COUNTS_PER_RAD     ((ENCODER_QCPR * GEAR_RATIO) / (2.0 * M_PI))
+#define MODEL_KV           ((MOTOR_KT * GEAR_RATIO) / MOTOR_VOLTS)
+#define MODEL_KA           ((MOTOR_OHMS * (MOTOR_J + (LOAD_J / (GEAR_RATIO * GEAR_RATIO * GEAR_EFFICIENCY))) * GEAR_RATIO) / (MOTOR_KT * MOTOR_VOLTS))
+
+/* Stepper, homing takes a few seconds from the worst start. */
+#define SIM_SAMPLE_NS      100000ULL
+#define SIM_TICK_NS        1000000ULL
+#define SIM_HOME_NS        30000000000ULL
+
+/* From tilt_stepper_motor_control.c and tilt_stepper_motor_profile.h. */
+extern tilt_stepper_states ts_state;
+extern volatile int32_t steps_from_home;
+extern trajectory_t tilt_stepper_trajectory;
+extern uint32_t micro_steps_per_rev;
+extern float stepper_gear_ratio_num;
+extern float stepper_gear_ratio_den;
+extern float rad_per_micro_step;
+
+typedef struct {
+   double period_s;         /* What the axis actually swept at. */
+   double max_err_rad;
+   double rms_err_rad;
+   double peak_vel;
+   uint8_t ok;
+} result_t;
+
+typedef struct {
+   double w;
+   double theta;
+} motor_t;
+
+FILE *csv = NULL;
+int64_t mirror_steps = 0;
+
+void motor_step(motor_t *m, double duty, double dt)
+{
+   double amps, torque, load, j;
+
+   amps = ((duty * MOTOR_VOLTS) - (MOTOR_KT * m->w)) / MOTOR_OHMS;
+   torque = (MOTOR_KT * amps) - (MOTOR_B * m->w);
+
+   load = LOAD_COULOMB / (GEAR_RATIO * GEAR_EFFICIENCY);
+   if(fabs(m->w) < 1e-3)
+   {
+      if(fabs(torque) <= load)
+      {
+         m->w = 0.0;
+         return;
+      }
+      load = (torque > 0.0) ? load : -load;
+   }
+   else
+   {
+      load = (m->w > 0.0) ? load : -load;
+   }
+
+   j = MOTOR_J + (LOAD_J / (GEAR_RATIO * GEAR_RATIO * GEAR_EFFICIENCY));
+   m->w += ((torque - load) / j) * dt;
+   m->theta += (m->w / GEAR_RATIO) * dt;
+}
+
+void tally(result_t *r, double *sum, uint32_t *n, double err, double vel)
+{
+   *sum += err * err;
+   (*n)++;
+   if(fabs(err) > r->max_err_rad)
+   {
+      r->max_err_rad = fabs(err);
+   }
+   if(fabs(vel) > r->peak_vel)
+   {
+      r->peak_vel = fabs(vel);
+   }
+}
+
+/* tilt_motor_control.c's TILT_INITIALIZE and TILT_TABLE, on the model. */
+result_t run_brushed(double period)
+{
+   motor_control_pid_t mcp;
+   trajectory_t trj;
+   trajectory_point_t pt;
+   motor_t m = {0.0, -M_PI / 2.0};
+   result_t r;
+   double sum = 0.0, err;
+   uint32_t k, s, n = 0;
+   uint32_t skip = (uint32_t)ceil(period * SIM_LOOP_HZ);
+   uint32_t samples = skip + (uint32_t)ceil(2.0 * SIM_CYCLES * period * SIM_LOOP_HZ);
+   int32_t counts;
+
+   memset(&r, 0, sizeof(r));
+   r.ok = 1;
+   r.period_s = period;
+
+   motor_control_init_pid(&mcp);
+   motor_control_set_ff_gains(&mcp, MODEL_KV, MODEL_KA, 0.1f);
+   if(trajectory_init_sweep(&trj, -M_PI / 2.0, M_PI / 2.0, (float)period, 0.0f) != TRAJECTORY_SUCCESS)
+   {
+      r.ok = 0;
+      return r;
+   }
+
+   for(k = 1; k <= samples; k++)
+   {
+      trajectory_advance(&trj, 1.0f / SIM_LOOP_HZ, &pt);
+
+      counts = (int32_t)floor(m.theta * COUNTS_PER_RAD);
+      mcp.cmd = pt.pos;
+      mcp.msr = (float)(counts / COUNTS_PER_RAD);
+      mcp.ff_vel = pt.vel;
+      mcp.ff_acc = pt.acc;
+      motor_control_run_pid(&mcp);
+
+      /* The command is for now, so is the error. */
+      err = m.theta - pt.pos;
+      if(k > skip)
+      {
+         tally(&r, &sum, &n, err, pt.vel);
+      }
+      if(csv != NULL)
+      {
+         fprintf(csv, "brushed,%.4f,%.4f,%.6f,%.6f\n", period, k / SIM_LOOP_HZ, pt.pos, m.theta);
+      }
+
+      for(s = 0; s < SIM_SUBSTEPS; s++)
+      {
+         motor_step(&m, mcp.out, SIM_DT_S);
+      }
+   }
+
+   r.rms_err_rad = (n > 0) ? sqrt(sum / n) : 0.0;
+
+   return r;
+}
+
+float mirror_rad(void)
+{
+   return 3.0f + (((float)mirror_steps / (float)micro_steps_per_rev) *
+                  (stepper_gear_ratio_den / stepper_gear_ratio_num) * TILT_STEPPER_TWO_PI);
+}
+
+uint8_t mirror_home_flag(void)
+{
+   float rad = mirror_rad();
+
+   while(rad > (TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad -= TILT_STEPPER_TWO_PI;
+   }
+   while(rad <= -(TILT_STEPPER_TWO_PI / 2.0f))
+   {
+      rad += TILT_STEPPER_TWO_PI;
+   }
+
+   return (rad <= 0.0f);
+}
+
+void pin_watch(uint8_t pin, uint8_t level, uint64_t ns)
+{
+   uint8_t flag;
+
+   if(pin != HAL_PIN_TMC260_STEP)
+   {
+      return;
+   }
+
+   mirror_steps += hal_gpio_read(HAL_PIN_TMC260_DIR) ? 1 : -1;
+
+   flag = mirror_home_flag();
+   if(flag != hal_gpio_read(HAL_PIN_TILT_HOME))
+   {
+      hal_host_gpio_input(HAL_PIN_TILT_HOME, flag);
+   }
+}
+
+/* Runs the clock on until the stepper is tilting, from wherever it is. */
+uint8_t stepper_wait_tilting(void)
+{
+   uint64_t give_up = hal_host_now_ns() + SIM_HOME_NS;
+
+   while(ts_state != TILT_STEPPER_TILT_TABLE)
+   {
+      if(hal_host_now_ns() > give_up)
+      {
+         printf("stepper never started tilting, state %u\n", ts_state);
+         return 0;
+      }
+      hal_host_run_until(hal_host_now_ns() + SIM_SAMPLE_NS);
+   }
+
+   return 1;
+}
+
+/* tilt_stepper_motor_control.c, already tilting, given a new period the way
+ * MOTOR_SET_TILT_MULTIPLIER does it.  Stops, rehomes and tilts again.
+ */
+result_t run_stepper(double period)
+{
+   trajectory_point_t pt;
+   result_t r;
+   uint64_t now, tick_ns;
+   uint64_t samples, skip, k;
+   double sum = 0.0, t, pos;
+   uint32_t n = 0;
+
+   memset(&r, 0, sizeof(r));
+   r.ok = 1;
+
+   tilt_stepper_motor_stop();
+   tilt_stepper_motor_set_profile_multiplier((float)(period / TILT_STEPPER_SWEEP_S));
+   tilt_stepper_motor_tilt();
+   hal_host_run_until(hal_host_now_ns() + SIM_TICK_NS);
+
+   if(!stepper_wait_tilting())
+   {
+      r.ok = 0;
+      return r;
+   }
+
+   /* The first tick tilting sets the sweep up, measured against that from
+    * there on.
+    */
+   hal_host_run_until(hal_host_now_ns() + SIM_TICK_NS);
+   period = tilt_stepper_trajectory.period;
+   r.period_s = period;
+   skip = (uint64_t)(period * 1e9) / SIM_SAMPLE_NS;
+
+   /* TIM11 ticks every 1 ms from time 0, sample halfway between samples so
+    * never on one.
+    */
+   now = ((hal_host_now_ns() / SIM_TICK_NS) * SIM_TICK_NS) + (SIM_SAMPLE_NS / 2);
+   samples = skip + (uint64_t)((2.0 * SIM_CYCLES * period * 1e9) / SIM_SAMPLE_NS);
+
+   for(k = 0; k < samples; k++)
+   {
+      now += SIM_SAMPLE_NS;
+      hal_host_run_until(now);
+
+      if(ts_state != TILT_STEPPER_TILT_TABLE)
+      {
+         printf("stepper left the sweep, state %u\n", ts_state);
+         r.ok = 0;
+         return r;
+      }
+
+      /* The last tick moved the trajectory on to where the next one is, so
+       * now is one tick back plus the time since.
+       */
+      tick_ns = now % SIM_TICK_NS;
+      t = tilt_stepper_trajectory.t - (1.0 / SIM_LOOP_HZ) + (tick_ns / 1e9);
+      trajectory_at(&tilt_stepper_trajectory, (float)t, &pt);
+      pos = steps_from_home * (double)rad_per_micro_step;
+
+      if(k >= skip)
+      {
+         tally(&r, &sum, &n, pos - pt.pos, pt.vel);
+      }
+      if(csv != NULL)
+      {
+         fprintf(csv, "stepper,%.4f,%.4f,%.6f,%.6f\n", period, (k * SIM_SAMPLE_NS) / 1e9, pt.pos, pos);
+      }
+   }
+
+   r.rms_err_rad = (n > 0) ? sqrt(sum / n) : 0.0;
+
+   return r;
+}
+
+uint32_t report(const char *backend, double period, result_t r, double rms_limit, double max_limit)
+{
+   uint32_t failures = 0;
+
+   printf("%8.4f  %-8s %8.4f %8.3f  %10.6f  %10.6f\n", period, backend, r.period_s, r.peak_vel, r.max_err_rad, r.rms_err_rad);
+
+   if(!r.ok)
+   {
+      failures++;
+   }
+   else if(fabs(r.period_s - period) > (SIM_PERIOD_TOLERANCE * period))
+   {
+      printf("          FAIL swept at %.6f s, asked for %.6f s\n", r.period_s, period);
+      failures++;
+   }
+   if((rms_limit > 0.0)&&(r.rms_err_rad > rms_limit))
+   {
+      printf("          FAIL rms %.6f rad, limit %.6f rad\n", r.rms_err_rad, rms_limit);
+      failures++;
+   }
+   if((max_limit > 0.0)&&(r.max_err_rad > max_limit))
+   {
+      printf("          FAIL max %.6f rad, limit %.6f rad\n", r.max_err_rad, max_limit);
+      failures++;
+   }
+
+   return failures;
+}
+
+int main(int argc, char **argv)
+{
+   double periods[SIM_MAX_PERIODS] = {TILT_STEPPER_SWEEP_S, 1.0, 0.6543, 1.5};
+   uint32_t num_periods = 4;
+   uint8_t periods_given = 0;
+   double brushed_rms = 0.01;
+   double stepper_max = 0.001;
+   uint32_t failures = 0;
+   uint32_t p;
+   int opt;
+
+   while((opt = getopt(argc, argv, "P:B:S:o:")) != -1)
+   {
+      switch(opt)
+      {
+         case 'P':
+            if(!periods_given)
+            {
+               num_periods = 0;
+               periods_given = 1;
+            }
+            if(num_periods == SIM_MAX_PERIODS)
+            {
+               fprintf(stderr, "at most %u periods\n", SIM_MAX_PERIODS);
+               return 1;
+            }
+            periods[num_periods++] = atof(optarg);
+            break;
+         case 'B':
+            brushed_rms = atof(optarg);
+            break;
+         case 'S':
+            stepper_max = atof(optarg);
+            break;
+         case 'o':
+            csv = fopen(optarg, "w");
+            if(csv == NULL)
+            {
+               perror(optarg);
+               return 1;
+            }
+            fprintf(csv, "backend,period_s,t_s,ref_rad,pos_rad\n");
+            break;
+         default:
+            fprintf(stderr, "usage: %s [-P period_s]... [-B max_brushed_rms_rad] [-S max_stepper_err_rad] [-o csv]\n", argv[0]);
+            return 1;
+      }
+   }
+
+   for(p = 0; p < num_periods; p++)
+   {
+      if(!(periods[p] > 0.0))
+      {
+         fprintf(stderr, "periods have to be more than 0 s\n");
+         return 1;
+      }
+   }
+
+   /* The stepper from reset, it homes and starts tilting by itself. */
+   hal_host_reset();
+   hal_host_set_pin_watch(&pin_watch);
+   hal_host_gpio_input(HAL_PIN_TILT_HOME, mirror_home_flag());
+   hal_host_gpio_input(HAL_PIN_HOKUYO_SYNC, 1);
+
+   debug_init();
+   trace_init();
+   event_init();
+   tilt_stepper_motor_init();
+   if(!stepper_wait_tilting())
+   {
+      return 2;
+   }
+
+   printf("period s  backend    swept  peak vel     max err     rms err\n");
+
+   for(p = 0; p < num_periods; p++)
+   {
+      failures += report("brushed", periods[p], run_brushed(periods[p]), brushed_rms, 0.0);
+      if(periods[p] < (TILT_STEPPER_SWEEP_S * (1.0 - SIM_PERIOD_TOLERANCE)))
+      {
+         printf("%8.4f  stepper  not run, %.4f s is its shortest sweep\n", periods[p], TILT_STEPPER_SWEEP_S);
+         continue;
+      }
+      failures += report("stepper", periods[p], run_stepper(periods[p]), 0.0, stepper_max);
+   }
+
+   printf("stepper watchdog %u resets\n", hal_host_watchdog_resets());
+   if(hal_host_watchdog_resets() != 0)
+   {
+      failures++;
+   }
+
+   if(csv != NULL)
+   {
+      fclose(csv);
+   }
+
+   printf("%s\n", (failures == 0) ? "PASS" : "FAIL");
+
+   return (failures == 0) ? 0 : 2;
+}
@@ -12,8 +12,6 @@
 #include "TMC260.h"
 #include "debug.h"
 
-#include "systick.h"
-
 #include "full_duplex_usart_dma.h"
 #include "generic_packet.h"
 #include "gp_proj_universal.h"
@@ -69,68 +67,19 @@ void TMC260_initialize(void)
  */
 void TMC260_init_gpio(void)
 {
-   GPIO_InitTypeDef GPIO_InitStructure;
-   EXTI_InitTypeDef EXTI_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
-   /* Enable clock for SYSCFG */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
-
 #ifdef TOS_100_DEV_BOARD
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_2;
+   hal_gpio_init(HAL_PIN_TMC260_EN, HAL_GPIO_OUTPUT);
 #else
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_1 | GPIO_Pin_2;
-#endif
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_13;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-#ifndef TOS_100_DEV_BOARD
    /* Enable is now an input... */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
+   hal_gpio_init(HAL_PIN_TMC260_EN, HAL_GPIO_INPUT);
 #endif
-
-   /** @todo Make PC2 an EXTI so that we can easily catch and handle a stall condition. */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_2;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-   SYSCFG_EXTILineConfig(EXTI_PortSourceGPIOC, EXTI_PinSource2);
-
-   EXTI_InitStructure.EXTI_Line = EXTI_Line2;
-   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-   EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
-   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-   EXTI_Init(&EXTI_InitStructure);
+   hal_gpio_init(HAL_PIN_TMC260_DIR, HAL_GPIO_OUTPUT);
+   hal_gpio_init(HAL_PIN_TMC260_STEP, HAL_GPIO_OUTPUT);
+   hal_gpio_init(HAL_PIN_TMC260_CSN, HAL_GPIO_OUTPUT);
 
    /** @todo Need to set the interrupt priority properly for stall guard. */
-   NVIC_InitStructure.NVIC_IRQChannel = EXTI2_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-
-
+   hal_gpio_init(HAL_PIN_TMC260_SG, HAL_GPIO_INPUT);
+   hal_exti_init(HAL_PIN_TMC260_SG, HAL_EXTI_RISING, 0x0F, 0x0F);
 }
 
 /**
@@ -142,7 +91,7 @@ void TMC260_init_gpio(void)
  */
 void EXTI2_IRQHandler(void)
 {
-   if(EXTI_GetITStatus(EXTI_Line2) != RESET)
+   if(hal_exti_pending(HAL_PIN_TMC260_SG))
    {
       /**
        * @todo Need to actually implement stall guard functionality here.  Maybe
@@ -150,7 +99,7 @@ void EXTI2_IRQHandler(void)
        */
       debug_output_toggle(DEBUG_LED_RED);
 
-      EXTI_ClearITPendingBit(EXTI_Line2);
+      hal_exti_clear(HAL_PIN_TMC260_SG);
    }
 }
 
@@ -174,57 +123,8 @@ void EXTI2_IRQHandler(void)
  */
 void TMC260_init_spi(void)
 {
-   SPI_InitTypeDef  SPI_InitStructure;
-   GPIO_InitTypeDef GPIO_InitStructure;
-   /* NVIC_InitTypeDef NVIC_InitStructure; */
-
-   /* Peripheral Clock Enable -------------------------------------------------*/
-   /* Enable the SPI clock */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_SPI1, ENABLE);
-
-   /* Enable GPIO clocks */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
-
-   /* Connect SPI pins to AF5 */
-   GPIO_PinAFConfig(GPIOA, GPIO_PinSource5, GPIO_AF_SPI1);
-   GPIO_PinAFConfig(GPIOA, GPIO_PinSource6, GPIO_AF_SPI1);
-   GPIO_PinAFConfig(GPIOA, GPIO_PinSource7, GPIO_AF_SPI1);
-
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_DOWN;
-
-   /* SPI SCK pin configuration */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-   /* SPI  MISO pin configuration */
-   GPIO_InitStructure.GPIO_Pin =  GPIO_Pin_6;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-   /* SPI  MOSI pin configuration */
-   GPIO_InitStructure.GPIO_Pin =  GPIO_Pin_7;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-   /* SPI Chip Select was already configured in TMC260_init_gpio */
-
-   /* SPI configuration -------------------------------------------------------*/
-   SPI_I2S_DeInit(SPI1);
-   SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
-   SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
-   SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
-   SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;  /* I think this should be SPI_CPOL_High...but it does something when Low. */
-   SPI_InitStructure.SPI_CPHA = SPI_CPHA_2Edge; /* I think this should be SPI_CPHA_2Edge */
-   SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
-   SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_256;
-   SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
-   SPI_InitStructure.SPI_CRCPolynomial = 7;
-   SPI_Init(SPI1, &SPI_InitStructure);
-
-   /* Enable the SPI peripheral */
-   SPI_Cmd(SPI1, ENABLE);
-
+   /* SPI1, chip select was already configured in TMC260_init_gpio */
+   hal_spi_init(HAL_SPI_TMC260);
 }
 
 
@@ -241,8 +141,7 @@ void TMC260_init_spi(void)
 uint8_t TMC260_spi_write_byte(uint8_t byte)
 {
 
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_TXE) == RESET);
-   SPI_I2S_SendData(SPI1, (uint16_t)byte);
+   hal_spi_write(HAL_SPI_TMC260, byte);
 
    return TMC260_SUCCESS;
 }
@@ -259,13 +158,7 @@ uint8_t TMC260_spi_write_byte(uint8_t byte)
  */
 uint8_t TMC260_spi_read_byte(uint8_t *byte)
 {
-   uint16_t tmpval;
-
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_TXE) == RESET);
-   SPI_I2S_SendData(SPI1, (uint16_t)0x00);
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_RXNE) == RESET);
-   tmpval = SPI_I2S_ReceiveData(SPI1);
-   *byte = (uint8_t)(tmpval & 0xFF);
+   *byte = hal_spi_transfer(HAL_SPI_TMC260, 0x00);
 
    return TMC260_SUCCESS;
 }
@@ -283,14 +176,7 @@ uint8_t TMC260_spi_read_byte(uint8_t *byte)
  */
 uint8_t TMC260_spi_write_read_byte(uint8_t write_byte, uint8_t *read_byte)
 {
-   uint16_t tmpval;
-
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_TXE) == RESET);
-   SPI_I2S_SendData(SPI1, (uint16_t)write_byte);
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_RXNE) == RESET);
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_BSY) == SET);
-   tmpval = SPI_I2S_ReceiveData(SPI1);
-   *read_byte = (uint8_t)(tmpval & 0xFF);
+   *read_byte = hal_spi_transfer(HAL_SPI_TMC260, write_byte);
 
    return TMC260_SUCCESS;
 }
@@ -314,7 +200,6 @@ uint8_t TMC260_spi_write_datagram(uint32_t datagram)
    uint8_t retval;
    uint32_t sdatagram;
    uint8_t byte1, byte2, byte3;
-   uint8_t ii;
 
    sdatagram = (datagram<<8);
    byte1 = (sdatagram>>24)&0xFF;
@@ -322,14 +207,11 @@ uint8_t TMC260_spi_write_datagram(uint32_t datagram)
    byte3 = (sdatagram>>8)&0xFF;
 
 
-   /* TEMP */
-   Delay(TMC260_SPI_DELAY_COUNT);
+   hal_delay_ns(TMC260_SPI_CSN_SETUP_NS);
 
+   hal_gpio_clear(HAL_PIN_TMC260_CSN);
 
-   GPIO_ResetBits(GPIOC, GPIO_Pin_13);
-
-   /* TEMP */
-   Delay(TMC260_SPI_DELAY_COUNT);
+   hal_delay_ns(TMC260_SPI_CSN_SETUP_NS);
 
 
    /** @todo Is there any way to really check the retval here?  Not sure it
@@ -343,18 +225,12 @@ uint8_t TMC260_spi_write_datagram(uint32_t datagram)
    /* retval = TMC260_spi_write_byte(0x00); */
    /* retval = TMC260_spi_write_byte(0x55); */
 
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_BSY) == SET);
-   for(ii=0; ii<8; ii++)
-   {
-      Delay(TMC260_SPI_DELAY_COUNT);
-   }
+   hal_spi_wait_idle(HAL_SPI_TMC260);
+   hal_delay_ns(TMC260_SPI_CSN_HOLD_NS);
 
-   GPIO_SetBits(GPIOC, GPIO_Pin_13);
+   hal_gpio_set(HAL_PIN_TMC260_CSN);
 
-   for(ii=0; ii<8; ii++)
-   {
-      Delay(TMC260_SPI_DELAY_COUNT);
-   }
+   hal_delay_ns(TMC260_SPI_CSN_HOLD_NS);
 
 
    return TMC260_SUCCESS;
@@ -440,7 +316,6 @@ uint8_t TMC260_spi_read_write_datagram(uint32_t write_datagram, uint32_t *read_d
    uint32_t sdatagram, t1, t2, t3;
    uint8_t byte1, byte2, byte3;
    uint8_t rb1, rb2, rb3;
-   uint8_t ii;
 
    GenericPacket packet1, packet2, packet3;
 
@@ -449,14 +324,11 @@ uint8_t TMC260_spi_read_write_datagram(uint32_t write_datagram, uint32_t *read_d
    byte2 = (sdatagram>>16)&0xFF;
    byte3 = (sdatagram>>8)&0xFF;
 
-   /* TEMP */
-   Delay(TMC260_SPI_DELAY_COUNT);
-
+   hal_delay_ns(TMC260_SPI_CSN_SETUP_NS);
 
-   GPIO_ResetBits(GPIOC, GPIO_Pin_13);
+   hal_gpio_clear(HAL_PIN_TMC260_CSN);
 
-   /* TEMP */
-   Delay(TMC260_SPI_DELAY_COUNT);
+   hal_delay_ns(TMC260_SPI_CSN_SETUP_NS);
 
 
    /** @todo Is there any way to really check the retval here?  Not sure it
@@ -484,20 +356,12 @@ uint8_t TMC260_spi_read_write_datagram(uint32_t write_datagram, uint32_t *read_d
    create_universal_byte(&packet3, rb3);
    full_duplex_usart_dma_add_to_queue(&packet3, NULL, 0);
 
-   while(SPI_I2S_GetFlagStatus(SPI1, SPI_FLAG_BSY) == SET);
-   /* TEMP */
-   for(ii=0; ii<8; ii++)
-   {
-      Delay(TMC260_SPI_DELAY_COUNT);
-   }
+   hal_spi_wait_idle(HAL_SPI_TMC260);
+   hal_delay_ns(TMC260_SPI_CSN_HOLD_NS);
 
-   GPIO_SetBits(GPIOC, GPIO_Pin_13);
+   hal_gpio_set(HAL_PIN_TMC260_CSN);
 
-   /* TEMP */
-   for(ii=0; ii<8; ii++)
-   {
-      Delay(TMC260_SPI_DELAY_COUNT);
-   }
+   hal_delay_ns(TMC260_SPI_CSN_HOLD_NS);
 
    return TMC260_SUCCESS;
 }
@@ -802,27 +666,27 @@ uint8_t TMC260_send_default_regs(void)
 void TMC260_enable(void)
 {
 #ifdef TOS_100_DEV_BOARD
-   GPIO_ResetBits(GPIOA, GPIO_Pin_0);
+   hal_gpio_clear(HAL_PIN_TMC260_EN);
 #endif
 }
 
 void TMC260_disable(void)
 {
 #ifdef TOS_100_DEV_BOARD
-   GPIO_SetBits(GPIOA, GPIO_Pin_0);
+   hal_gpio_set(HAL_PIN_TMC260_EN);
 #endif
 }
 
 void TMC260_dir_CW(void)
 {
    /* CCW looking in on the pinion. Rotating LIDAR radians Increasing. */
-   GPIO_ResetBits(GPIOA, GPIO_Pin_1);
+   hal_gpio_clear(HAL_PIN_TMC260_DIR);
 }
 
 void TMC260_dir_CCW(void)
 {
    /* CW looking in on the pinion. Rotating LIDAR radians Decreasing. */
-   GPIO_SetBits(GPIOA, GPIO_Pin_1);
+   hal_gpio_set(HAL_PIN_TMC260_DIR);
 }
 
 
@@ -835,13 +699,13 @@ void TMC260_step(void)
     *       edge active.
     *
     */
-   if(GPIO_ReadInputDataBit(GPIOA, GPIO_Pin_2) == Bit_SET)
+   if(hal_gpio_read(HAL_PIN_TMC260_STEP))
    {
-      GPIO_ResetBits(GPIOA, GPIO_Pin_2);
+      hal_gpio_clear(HAL_PIN_TMC260_STEP);
    }
    else
    {
-      GPIO_SetBits(GPIOA, GPIO_Pin_2);
+      hal_gpio_set(HAL_PIN_TMC260_STEP);
    }
 }
 
@@ -3,94 +3,137 @@
  * @author Andrew K. Walker
  * @date 07 JUN 2017
  * @brief Analog input functions.
+ *
+ * Readings arrive by DMA from timer triggered scans (analog_input_stm32.c)
+ * and are oversampled and filtered here, so reading a channel is just a load.
+ * Nothing in here touches hardware and the filter builds on a PC too.
  */
 #include "analog_input.h"
 
-#include "debug.h"
+#define ANALOG_INPUT_BLOCK_LENGTH  (ANALOG_INPUT_OVERSAMPLE * ANALOG_INPUT_NUM_CHANNELS)
+
+/* Both halves, the DMA writes one while the other is filtered.  Has to stay
+ * out of CCM, the DMA can't reach it.
+ */
+uint16_t analog_input_dma_buffer[2 * ANALOG_INPUT_BLOCK_LENGTH];
+
+/* Smoothed values scaled up by 2^ANALOG_INPUT_SMOOTH_SHIFT so the low pass
+ * doesn't lose the low bits.
+ */
+uint32_t analog_input_state[ANALOG_INPUT_NUM_CHANNELS];
+volatile uint16_t analog_input_latest[ANALOG_INPUT_NUM_CHANNELS];
+volatile uint32_t analog_input_outputs = 0;
 
 uint8_t analog_input_initialized = 0;
 
+/* Used Internally */
+uint16_t analog_input_decimate(const uint16_t *scans, uint8_t channel);
+
 
 /* Public Function - Doxygen documentation is in the header. */
 void analog_input_init(void)
 {
-   GPIO_InitTypeDef GPIO_InitStructure; //Variable used to setup the GPIO pins
-   DMA_InitTypeDef DMA_InitStructure; //Variable used to setup the DMA
-   ADC_InitTypeDef ADC_InitStructure; //Variable used to setup the ADC
-   ADC_CommonInitTypeDef ADC_CommonInitStructure;
-
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
-
-   GPIO_StructInit(&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_4 | GPIO_Pin_5;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-   /* I think you can also hook up the battery voltage internally to the ADC. I
-      need to look into that and add the capability here.
-   */
-
-   /* ADC Common Init */
-   ADC_CommonInitStructure.ADC_Mode = ADC_Mode_Independent;
-   ADC_CommonInitStructure.ADC_Prescaler = ADC_Prescaler_Div8;
-   ADC_CommonInitStructure.ADC_DMAAccessMode = ADC_DMAAccessMode_Disabled;
-   ADC_CommonInitStructure.ADC_TwoSamplingDelay = ADC_TwoSamplingDelay_12Cycles;
-   ADC_CommonInit(&ADC_CommonInitStructure);
-
-   /* Init ADC1 Specific Stuff */
-   ADC_InitStructure.ADC_Resolution = ADC_Resolution_12b;
-   ADC_InitStructure.ADC_ScanConvMode = DISABLE;
-   ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;
-   ADC_InitStructure.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_None;
-   ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T2_TRGO; /* Actually...a don't care... */
-   ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
-   ADC_InitStructure.ADC_NbrOfConversion = 1;
-   ADC_Init(ADC1, &ADC_InitStructure); //Initialise ADC1
-
-   ADC_Cmd(ADC1, ENABLE); //Enable ADC1
-
-   /* Need to calibrate the ADC??? */
+   analog_input_filter_reset();
 
-   analog_input_initialized = 1;
+   analog_input_port_init(analog_input_dma_buffer, 2 * ANALOG_INPUT_BLOCK_LENGTH);
 
+   analog_input_initialized = 1;
 }
 
 
 /* Public Function - Doxygen documentation included in the header. */
 uint8_t analog_input_read(float *vc14, float *vc15)
 {
-   uint16_t c14, c15;
+   if((!analog_input_initialized)||(analog_input_outputs == 0))
+   {
+      *vc14 = -9.99;
+      *vc15 = -9.99;
+      return ANALOG_INPUT_ERROR_NOT_READY;
+   }
 
-   /* VDD = 2.935 Volts on discovery card. */
+   *vc14 = ((float)analog_input_latest[ANALOG_INPUT_VC14] / (float)ANALOG_INPUT_FULL_SCALE) * ANALOG_INPUT_VREF;
+   *vc15 = ((float)analog_input_latest[ANALOG_INPUT_VC15] / (float)ANALOG_INPUT_FULL_SCALE) * ANALOG_INPUT_VREF;
 
-   if(analog_input_initialized)
+   return ANALOG_INPUT_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header. */
+uint16_t analog_input_get(uint8_t channel)
+{
+   if(channel >= ANALOG_INPUT_NUM_CHANNELS)
    {
-      ADC_RegularChannelConfig(ADC1, ADC_Channel_14, 1, ADC_SampleTime_28Cycles);
-      // Start the conversion
-      ADC_SoftwareStartConv(ADC1);
-      // Wait until conversion completion
-      while(ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET);
-      // Get the conversion value
-      c14 = ADC_GetConversionValue(ADC1);
-
-      ADC_RegularChannelConfig(ADC1, ADC_Channel_15, 1, ADC_SampleTime_28Cycles);
-      // Start the conversion
-      ADC_SoftwareStartConv(ADC1);
-      // Wait until conversion completion
-      while(ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET);
-      // Get the conversion value
-      c15 = ADC_GetConversionValue(ADC1);
-
-      *vc14 = ((float)c14 / (float)4096) * 2.935f;
-      *vc15 = ((float)c15 / (float)4096) * 2.935f;
+      return 0;
    }
-   else
+
+   return analog_input_latest[channel];
+}
+
+/* Public Function - Doxygen documentation is in the header. */
+uint32_t analog_input_count(void)
+{
+   return analog_input_outputs;
+}
+
+/* Public Function - Doxygen documentation is in the header. */
+void analog_input_filter(const uint16_t *scans)
+{
+   uint32_t x;
+   uint8_t ch;
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
    {
-      *vc14 = -9.99;
-      *vc15 = -9.99;
+      x = analog_input_decimate(scans, ch);
+
+      if(analog_input_outputs == 0)
+      {
+         /* Start where the input is rather than climbing up from zero. */
+         analog_input_state[ch] = x << ANALOG_INPUT_SMOOTH_SHIFT;
+      }
+      else
+      {
+         /* Wraps when x is below the output, and wraps back. */
+         analog_input_state[ch] += x - (analog_input_state[ch] >> ANALOG_INPUT_SMOOTH_SHIFT);
+      }
+
+      analog_input_latest[ch] = (uint16_t)(analog_input_state[ch] >> ANALOG_INPUT_SMOOTH_SHIFT);
    }
 
-   return 0;
+   analog_input_outputs++;
+}
+
+/* Public Function - Doxygen documentation is in the header. */
+void analog_input_filter_reset(void)
+{
+   uint8_t ch;
+
+   analog_input_outputs = 0;
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      analog_input_state[ch] = 0;
+      analog_input_latest[ch] = 0;
+   }
 }
 
+/* PRIVATE analog_input_decimate
+ *
+ * Notes:
+ *  +Sums one channel over the block and scales the sum to 16 bits.  Up to
+ *   16x oversampling every bit of the sum fits and it shifts up, past that
+ *   the lowest bits go.
+ */
+uint16_t analog_input_decimate(const uint16_t *scans, uint8_t channel)
+{
+   uint32_t sum = 0;
+   uint32_t ii;
+
+   for(ii=channel; ii<ANALOG_INPUT_BLOCK_LENGTH; ii+=ANALOG_INPUT_NUM_CHANNELS)
+   {
+      sum += scans[ii];
+   }
+
+#if ((ANALOG_INPUT_ADC_BITS + ANALOG_INPUT_OVERSAMPLE_SHIFT) <= 16)
+   return (uint16_t)(sum << (16 - ANALOG_INPUT_ADC_BITS - ANALOG_INPUT_OVERSAMPLE_SHIFT));
+#else
+   return (uint16_t)(sum >> (ANALOG_INPUT_ADC_BITS + ANALOG_INPUT_OVERSAMPLE_SHIFT - 16));
+#endif
+}
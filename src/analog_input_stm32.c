@@ -0,0 +1,159 @@
+/**
+ * @file analog_input_stm32.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief STM32F4 port for the analog inputs.
+ *
+ * TIM8 TRGO starts a scan of every channel on ADC1 ANALOG_INPUT_SCAN_HZ times
+ * a second and DMA2 Stream 0 moves each reading into a circular buffer.  The
+ * half and full transfer interrupts hand the block that just filled to
+ * analog_input_filter() and analog_telemetry_block().  The CPU never starts or
+ * waits on a conversion.
+ */
+
+#include "analog_input.h"
+#include "analog_telemetry.h"
+#include "stm32f4xx_conf.h"
+
+#include "profile.h"
+
+typedef struct {
+   uint8_t adc_channel;
+   uint16_t pin;
+} analog_input_pin_t;
+
+/* Same order as enum analog_input_channels, all on GPIOC. */
+const analog_input_pin_t analog_input_pins[ANALOG_INPUT_NUM_CHANNELS] =
+{
+   {ADC_Channel_14, GPIO_Pin_4},
+   {ADC_Channel_15, GPIO_Pin_5}
+};
+
+uint16_t *analog_input_port_buffer;
+uint32_t analog_input_port_half;
+
+/* Public Function - Doxygen documentation is in the header file. */
+void analog_input_port_init(uint16_t *buffer, uint32_t length)
+{
+   GPIO_InitTypeDef GPIO_InitStructure;
+   DMA_InitTypeDef DMA_InitStructure;
+   ADC_InitTypeDef ADC_InitStructure;
+   ADC_CommonInitTypeDef ADC_CommonInitStructure;
+   TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+   NVIC_InitTypeDef NVIC_InitStructure;
+   uint8_t ch;
+
+   analog_input_port_buffer = buffer;
+   analog_input_port_half = length / 2;
+
+   RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1 | RCC_APB2Periph_TIM8, ENABLE);
+   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC | RCC_AHB1Periph_DMA2, ENABLE);
+
+   GPIO_StructInit(&GPIO_InitStructure);
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      GPIO_InitStructure.GPIO_Pin |= analog_input_pins[ch].pin;
+   }
+   GPIO_Init(GPIOC, &GPIO_InitStructure);
+
+   /* ADC1 is on DMA2 Stream 0 Channel 0. */
+   DMA_DeInit(DMA2_Stream0);
+   DMA_InitStructure.DMA_Channel = DMA_Channel_0;
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&(ADC1->DR);
+   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)buffer;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+   DMA_InitStructure.DMA_BufferSize = length;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_HalfFull;
+   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+   DMA_Init(DMA2_Stream0, &DMA_InitStructure);
+
+   /* A block has a millisecond to be filtered before its half is written
+    * again, below the state machines is fine.
+    */
+   NVIC_InitStructure.NVIC_IRQChannel = DMA2_Stream0_IRQn;
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x02;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+
+   DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_HTIF0 | DMA_IT_TCIF0);
+   DMA_ITConfig(DMA2_Stream0, DMA_IT_HT | DMA_IT_TC, ENABLE);
+   DMA_Cmd(DMA2_Stream0, ENABLE);
+
+   /* ADC Common Init */
+   ADC_CommonInitStructure.ADC_Mode = ADC_Mode_Independent;
+   ADC_CommonInitStructure.ADC_Prescaler = ADC_Prescaler_Div8;
+   ADC_CommonInitStructure.ADC_DMAAccessMode = ADC_DMAAccessMode_Disabled;
+   ADC_CommonInitStructure.ADC_TwoSamplingDelay = ADC_TwoSamplingDelay_12Cycles;
+   ADC_CommonInit(&ADC_CommonInitStructure);
+
+   /* One scan of every channel per trigger, 40 ADC clocks a channel at
+    * 10.5 MHz.
+    */
+   ADC_InitStructure.ADC_Resolution = ADC_Resolution_12b;
+   ADC_InitStructure.ADC_ScanConvMode = ENABLE;
+   ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;
+   ADC_InitStructure.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_Rising;
+   ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T8_TRGO;
+   ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
+   ADC_InitStructure.ADC_NbrOfConversion = ANALOG_INPUT_NUM_CHANNELS;
+   ADC_Init(ADC1, &ADC_InitStructure);
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      ADC_RegularChannelConfig(ADC1, analog_input_pins[ch].adc_channel, ch + 1, ADC_SampleTime_28Cycles);
+   }
+
+   ADC_DMARequestAfterLastTransferCmd(ADC1, ENABLE);
+   ADC_DMACmd(ADC1, ENABLE);
+   ADC_Cmd(ADC1, ENABLE);
+
+   /* TIM8 on APB2 runs at SystemCoreClock, an update every scan. */
+   TIM_TimeBaseStructure.TIM_Prescaler = 0;
+   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+   TIM_TimeBaseStructure.TIM_Period = (SystemCoreClock / ANALOG_INPUT_SCAN_HZ) - 1;
+   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+   TIM_TimeBaseInit(TIM8, &TIM_TimeBaseStructure);
+   TIM_SelectOutputTrigger(TIM8, TIM_TRGOSource_Update);
+
+   TIM_Cmd(TIM8, ENABLE);
+}
+
+/**
+ * @fn void DMA2_Stream0_IRQHandler(void)
+ * @brief Half of the ADC buffer is full, filter it and add it to the
+ * telemetry windows.
+ *
+ * @param None
+ * @return None
+ */
+void DMA2_Stream0_IRQHandler(void)
+{
+   PROFILE_ENTER();
+
+   if(DMA_GetITStatus(DMA2_Stream0, DMA_IT_HTIF0) == SET)
+   {
+      DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_HTIF0);
+      analog_input_filter(analog_input_port_buffer);
+      analog_telemetry_block(analog_input_port_buffer);
+   }
+
+   if(DMA_GetITStatus(DMA2_Stream0, DMA_IT_TCIF0) == SET)
+   {
+      DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_TCIF0);
+      analog_input_filter(&(analog_input_port_buffer[analog_input_port_half]));
+      analog_telemetry_block(&(analog_input_port_buffer[analog_input_port_half]));
+   }
+
+   PROFILE_EXIT(PROFILE_ID_DMA2_STREAM0);
+}
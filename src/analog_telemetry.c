@@ -0,0 +1,362 @@
+/**
+ * @file analog_telemetry.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Min, max, mean and RMS windows and threshold alerts on the analog
+ * inputs.
+ *
+ * Runs in the analog input DMA interrupt on every block, so the main loop
+ * never handles single readings.  It gets two events instead, one per window
+ * and one per alert change, and picks up the results from here.  Nothing in
+ * here touches hardware and it builds on a PC too.
+ */
+#include <math.h>
+
+#include "analog_telemetry.h"
+#include "event_scheduler.h"
+
+#define ANALOG_TELEMETRY_BLOCK_LENGTH  (ANALOG_INPUT_OVERSAMPLE * ANALOG_INPUT_NUM_CHANNELS)
+
+/* Readings go from ANALOG_INPUT_ADC_BITS to a 16 bit fraction of full scale. */
+#define ANALOG_TELEMETRY_SCALE_SHIFT   (16 - ANALOG_INPUT_ADC_BITS)
+
+#if ((2 * ANALOG_INPUT_ADC_BITS + ANALOG_INPUT_OVERSAMPLE_SHIFT) > 32)
+#error "ANALOG_INPUT_OVERSAMPLE_SHIFT overflows the 32 bit block sum of squares."
+#endif
+
+typedef struct {
+   uint32_t sum;
+   uint64_t sum_squares;
+   uint32_t samples;
+   uint16_t min;           /* Raw readings. */
+   uint16_t max;
+   uint8_t alert;
+} analog_telemetry_totals_t;
+
+typedef struct {
+   uint16_t low;
+   uint16_t high;
+   uint16_t extreme;       /* Furthest past the threshold so far. */
+   uint32_t blocks;        /* Blocks since it tripped. */
+   analog_telemetry_alert_t latest;
+   volatile uint32_t changes;
+   uint32_t taken;         /* Main loop side, changes it has handed out. */
+} analog_telemetry_channel_t;
+
+/* The running totals are only touched by the interrupt.  Complete windows are
+ * latched into analog_telemetry_latched and analog_telemetry_windows counts
+ * them, the readers use it to notice a window landing mid copy.
+ */
+analog_telemetry_totals_t analog_telemetry_running[ANALOG_INPUT_NUM_CHANNELS];
+analog_telemetry_totals_t analog_telemetry_latched[ANALOG_INPUT_NUM_CHANNELS];
+volatile uint32_t analog_telemetry_windows = 0;
+
+analog_telemetry_channel_t analog_telemetry_channels[ANALOG_INPUT_NUM_CHANNELS];
+
+volatile uint32_t analog_telemetry_window_blocks;
+uint32_t analog_telemetry_block_count = 0;
+
+/* Used Internally */
+void analog_telemetry_totals_clear(analog_telemetry_totals_t *totals);
+void analog_telemetry_check(uint8_t channel, uint16_t value);
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+void analog_telemetry_init(void)
+{
+   uint8_t ch;
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      analog_telemetry_totals_clear(&(analog_telemetry_running[ch]));
+      analog_telemetry_totals_clear(&(analog_telemetry_latched[ch]));
+
+      analog_telemetry_channels[ch].low = 0;
+      analog_telemetry_channels[ch].high = 0xFFFF;
+      analog_telemetry_channels[ch].extreme = 0;
+      analog_telemetry_channels[ch].blocks = 0;
+      analog_telemetry_channels[ch].latest.state = ANALOG_TELEMETRY_ALERT_NONE;
+      analog_telemetry_channels[ch].latest.previous = ANALOG_TELEMETRY_ALERT_NONE;
+      analog_telemetry_channels[ch].latest.value = 0;
+      analog_telemetry_channels[ch].latest.blocks = 0;
+      analog_telemetry_channels[ch].latest.count = 0;
+      analog_telemetry_channels[ch].changes = 0;
+      analog_telemetry_channels[ch].taken = 0;
+   }
+
+   analog_telemetry_windows = 0;
+   analog_telemetry_block_count = 0;
+   analog_telemetry_set_window(ANALOG_TELEMETRY_WINDOW_MS);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t analog_telemetry_set_window(uint32_t window_ms)
+{
+   uint32_t blocks;
+
+   if((window_ms == 0)||(window_ms > ANALOG_TELEMETRY_MAX_WINDOW_MS))
+   {
+      return ANALOG_TELEMETRY_ERROR_WINDOW;
+   }
+
+   blocks = (window_ms * ANALOG_INPUT_OUTPUT_HZ) / 1000;
+   if(blocks == 0)
+   {
+      blocks = 1;
+   }
+
+   analog_telemetry_window_blocks = blocks;
+
+   return ANALOG_TELEMETRY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t analog_telemetry_set_alert(uint8_t channel, uint16_t low, uint16_t high)
+{
+   if(channel >= ANALOG_INPUT_NUM_CHANNELS)
+   {
+      return ANALOG_TELEMETRY_ERROR_CHANNEL;
+   }
+
+   analog_telemetry_channels[channel].low = low;
+   analog_telemetry_channels[channel].high = high;
+
+   return ANALOG_TELEMETRY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t analog_telemetry_window(uint8_t channel, analog_telemetry_window_t *window)
+{
+   analog_telemetry_totals_t totals;
+   uint32_t number;
+   float rms;
+
+   if(channel >= ANALOG_INPUT_NUM_CHANNELS)
+   {
+      return ANALOG_TELEMETRY_ERROR_CHANNEL;
+   }
+
+   /* The interrupt latches a whole window at once, so if the count didn't
+    * move the copy is all from one window.
+    */
+   do
+   {
+      number = analog_telemetry_windows;
+      totals = analog_telemetry_latched[channel];
+   } while(number != analog_telemetry_windows);
+
+   if((number == 0)||(totals.samples == 0))
+   {
+      return ANALOG_TELEMETRY_ERROR_NOT_READY;
+   }
+
+   window->number = number;
+   window->samples = totals.samples;
+   window->min = totals.min << ANALOG_TELEMETRY_SCALE_SHIFT;
+   window->max = totals.max << ANALOG_TELEMETRY_SCALE_SHIFT;
+   window->mean = (uint16_t)(((uint64_t)totals.sum << ANALOG_TELEMETRY_SCALE_SHIFT) / totals.samples);
+
+   rms = sqrtf((float)totals.sum_squares / (float)totals.samples) * (float)(1 << ANALOG_TELEMETRY_SCALE_SHIFT);
+   window->rms = (rms > 65535.0f) ? 0xFFFF : (uint16_t)(rms + 0.5f);
+
+   window->alert = totals.alert;
+
+   return ANALOG_TELEMETRY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t analog_telemetry_alert(uint8_t channel, analog_telemetry_alert_t *alert)
+{
+   analog_telemetry_channel_t *tc;
+   uint32_t changes;
+
+   if(channel >= ANALOG_INPUT_NUM_CHANNELS)
+   {
+      return ANALOG_TELEMETRY_ERROR_CHANNEL;
+   }
+
+   tc = &(analog_telemetry_channels[channel]);
+
+   /* Same idea as the windows, retry if a change lands mid copy. */
+   do
+   {
+      changes = tc->changes;
+      *alert = tc->latest;
+   } while(changes != tc->changes);
+
+   if(changes == tc->taken)
+   {
+      return ANALOG_TELEMETRY_ERROR_NOT_READY;
+   }
+
+   tc->taken = changes;
+
+   return ANALOG_TELEMETRY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void analog_telemetry_block(const uint16_t *scans)
+{
+   analog_telemetry_totals_t *run;
+   uint32_t sum, sum_squares, x;
+   uint16_t min, max;
+   uint32_t ii;
+   uint8_t ch;
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      sum = 0;
+      sum_squares = 0;
+      min = 0xFFFF;
+      max = 0;
+
+      for(ii=ch; ii<ANALOG_TELEMETRY_BLOCK_LENGTH; ii+=ANALOG_INPUT_NUM_CHANNELS)
+      {
+         x = scans[ii];
+         if(x < min)
+         {
+            min = x;
+         }
+         if(x > max)
+         {
+            max = x;
+         }
+         sum += x;
+         sum_squares += x * x;
+      }
+
+      run = &(analog_telemetry_running[ch]);
+      if(min < run->min)
+      {
+         run->min = min;
+      }
+      if(max > run->max)
+      {
+         run->max = max;
+      }
+      run->sum += sum;
+      run->sum_squares += sum_squares;
+      run->samples += ANALOG_INPUT_OVERSAMPLE;
+
+      /* Same value analog_input_filter() gets before its smoothing. */
+      analog_telemetry_check(ch, (uint16_t)((sum << ANALOG_TELEMETRY_SCALE_SHIFT) >> ANALOG_INPUT_OVERSAMPLE_SHIFT));
+
+      if(analog_telemetry_channels[ch].latest.state != ANALOG_TELEMETRY_ALERT_NONE)
+      {
+         run->alert = 1;
+      }
+   }
+
+   analog_telemetry_block_count++;
+   if(analog_telemetry_block_count >= analog_telemetry_window_blocks)
+   {
+      for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+      {
+         analog_telemetry_latched[ch] = analog_telemetry_running[ch];
+         analog_telemetry_totals_clear(&(analog_telemetry_running[ch]));
+      }
+
+      analog_telemetry_block_count = 0;
+      analog_telemetry_windows++;
+      event_post(EVENT_ANALOG_WINDOW);
+   }
+}
+
+/* PRIVATE analog_telemetry_totals_clear
+ *
+ * Notes:
+ *  +Empty totals, min starts high so the first reading replaces it.
+ */
+void analog_telemetry_totals_clear(analog_telemetry_totals_t *totals)
+{
+   totals->sum = 0;
+   totals->sum_squares = 0;
+   totals->samples = 0;
+   totals->min = 0xFFFF;
+   totals->max = 0;
+   totals->alert = 0;
+}
+
+/* PRIVATE analog_telemetry_check
+ *
+ * Notes:
+ *  +Threshold state machine for one channel, once per block.
+ *  +Trips on the first block past a threshold and clears on the first block
+ *   back ANALOG_TELEMETRY_HYSTERESIS inside it, each posts EVENT_ANALOG_ALERT.
+ *  +The hysteresis is clamped at the ends of the range so a threshold close
+ *   to 0 or 65535 can still clear.
+ */
+void analog_telemetry_check(uint8_t channel, uint16_t value)
+{
+   analog_telemetry_channel_t *tc = &(analog_telemetry_channels[channel]);
+   uint8_t state = tc->latest.state;
+   uint32_t limit;
+
+   if(state == ANALOG_TELEMETRY_ALERT_NONE)
+   {
+      if((tc->low != 0)&&(value < tc->low))
+      {
+         state = ANALOG_TELEMETRY_ALERT_LOW;
+      }
+      else if((tc->high != 0xFFFF)&&(value > tc->high))
+      {
+         state = ANALOG_TELEMETRY_ALERT_HIGH;
+      }
+      else
+      {
+         return;
+      }
+
+      tc->extreme = value;
+      tc->blocks = 1;
+
+      tc->latest.previous = ANALOG_TELEMETRY_ALERT_NONE;
+      tc->latest.state = state;
+      tc->latest.value = value;
+      tc->latest.blocks = 0;
+      tc->latest.count++;
+   }
+   else
+   {
+      if(state == ANALOG_TELEMETRY_ALERT_LOW)
+      {
+         if(value < tc->extreme)
+         {
+            tc->extreme = value;
+         }
+
+         limit = (uint32_t)tc->low + ANALOG_TELEMETRY_HYSTERESIS;
+         if(limit > 0xFFFF)
+         {
+            limit = 0xFFFF;
+         }
+         if(value < limit)
+         {
+            tc->blocks++;
+            return;
+         }
+      }
+      else
+      {
+         if(value > tc->extreme)
+         {
+            tc->extreme = value;
+         }
+
+         limit = (tc->high > ANALOG_TELEMETRY_HYSTERESIS) ? (tc->high - ANALOG_TELEMETRY_HYSTERESIS) : 0;
+         if(value > limit)
+         {
+            tc->blocks++;
+            return;
+         }
+      }
+
+      tc->latest.previous = state;
+      tc->latest.state = ANALOG_TELEMETRY_ALERT_NONE;
+      tc->latest.value = tc->extreme;
+      tc->latest.blocks = tc->blocks;
+   }
+
+   tc->changes++;
+   event_post(EVENT_ANALOG_ALERT);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file crash_dump.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Fault handler crash dump, kept over the reset and uploaded at boot.
+ *
+ * The fault handlers used to spin until the watchdog reset the board, and
+ * whatever went wrong went with it.  Now they save the stacked registers, the
+ * fault status registers, the top of the stack and the newest trace records
+ * to RAM the startup code leaves alone, and reset straight away.  The next
+ * boot sends it as UNIVERSAL_CRASH packets and scripts/crash_decode.c
+ * symbolizes it against main.elf.
+ */
+
+#include <stddef.h>
+
+#include "crash_dump.h"
+#include "full_duplex_usart_dma.h"
+#include "memory_sections.h"
+
+/* Where a stacked pointer can be read without faulting again. */
+#define CRASH_DUMP_SRAM_START     0x20000000UL
+#define CRASH_DUMP_SRAM_END       0x20020000UL
+#define CRASH_DUMP_CCM_START      0x10000000UL
+#define CRASH_DUMP_CCM_END        0x10010000UL
+
+/* EXC_RETURN bits, and the xPSR bit set when the frame was realigned. */
+#define CRASH_DUMP_EXC_PSP        0x04
+#define CRASH_DUMP_EXC_NO_FPU     0x10
+#define CRASH_DUMP_XPSR_ALIGN     0x200
+
+#define CRASH_DUMP_FRAME_BYTES    32
+#define CRASH_DUMP_FPU_BYTES      72
+
+NOINIT crash_dump_t crash_dump;
+
+/* Only the fault path runs on this, CRASH_DUMP_ENTRY() moves MSP to the top
+ * of it.  8 byte aligned for the calling convention.
+ */
+uint32_t crash_dump_fault_stack[CRASH_DUMP_FAULT_STACK_BYTES / 4] __attribute__((aligned(8), used));
+
+/* SRAM, TX DMA reads them directly. */
+GenericPacket crash_dump_packets[CRASH_DUMP_CHUNKS];
+
+/* Used Internally */
+uint8_t crash_dump_readable(uint32_t address, uint32_t bytes);
+uint32_t crash_dump_sum(const crash_dump_t *dump);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void crash_dump_init(void)
+{
+   SCB->SHCSR |= (SCB_SHCSR_MEMFAULTENA_Msk | SCB_SHCSR_BUSFAULTENA_Msk | SCB_SHCSR_USGFAULTENA_Msk);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void crash_dump_capture(const uint32_t *frame, uint32_t exc_return, const uint32_t *callee, uint32_t fault)
+{
+   uint32_t sp;
+   uint32_t ii;
+
+   /* Not a dump until the checksum is in. */
+   crash_dump.magic = 0;
+   crash_dump.length = sizeof(crash_dump_t);
+   crash_dump.fault = fault;
+   crash_dump.flags = 0;
+   crash_dump.exc_return = exc_return;
+   crash_dump.ms = hal_millis();
+   crash_dump.cycles = hal_cycles();
+
+   for(ii=4; ii<12; ii++)
+   {
+      crash_dump.r[ii] = callee[ii - 4];
+   }
+
+   if(exc_return & CRASH_DUMP_EXC_PSP)
+   {
+      crash_dump.flags |= CRASH_DUMP_FLAG_PSP;
+   }
+
+   /* A fault while stacking (an overflow, say) leaves the frame pointer
+    * somewhere it can't be read.
+    */
+   sp = (uint32_t)frame;
+   if(crash_dump_readable(sp, CRASH_DUMP_FRAME_BYTES))
+   {
+      crash_dump.flags |= CRASH_DUMP_FLAG_FRAME;
+      crash_dump.r[0] = frame[0];
+      crash_dump.r[1] = frame[1];
+      crash_dump.r[2] = frame[2];
+      crash_dump.r[3] = frame[3];
+      crash_dump.r[12] = frame[4];
+      crash_dump.lr = frame[5];
+      crash_dump.pc = frame[6];
+      crash_dump.xpsr = frame[7];
+
+      sp += CRASH_DUMP_FRAME_BYTES;
+      if(!(exc_return & CRASH_DUMP_EXC_NO_FPU))
+      {
+         crash_dump.flags |= CRASH_DUMP_FLAG_FPU_FRAME;
+         sp += CRASH_DUMP_FPU_BYTES;
+      }
+      if(crash_dump.xpsr & CRASH_DUMP_XPSR_ALIGN)
+      {
+         sp += 4;
+      }
+   }
+   else
+   {
+      for(ii=0; ii<4; ii++)
+      {
+         crash_dump.r[ii] = 0;
+      }
+      crash_dump.r[12] = 0;
+      crash_dump.lr = 0;
+      crash_dump.pc = 0;
+      crash_dump.xpsr = 0;
+   }
+   crash_dump.sp = sp;
+
+   crash_dump.cfsr = SCB->CFSR;
+   crash_dump.hfsr = SCB->HFSR;
+   crash_dump.mmfar = SCB->MMFAR;
+   crash_dump.bfar = SCB->BFAR;
+   crash_dump.shcsr = SCB->SHCSR;
+
+   for(ii=0; (ii<CRASH_DUMP_STACK_WORDS)&&(crash_dump_readable(sp + (ii * 4), 4)); ii++)
+   {
+      crash_dump.stack[ii] = ((const uint32_t *)sp)[ii];
+   }
+   crash_dump.stack_words = ii;
+
+   crash_dump.trace_count = trace_snapshot(crash_dump.trace, CRASH_DUMP_TRACE_RECORDS);
+
+   crash_dump.magic = CRASH_DUMP_MAGIC;
+   crash_dump.checksum = crash_dump_sum(&crash_dump);
+
+   /* Out of the write buffer before the reset. */
+   __DSB();
+   NVIC_SystemReset();
+
+   while(1)
+   {
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t crash_dump_report(void)
+{
+   uint32_t offset;
+   uint32_t length;
+   uint8_t retval = CRASH_DUMP_SUCCESS;
+   uint8_t ii;
+
+   if((crash_dump.magic != CRASH_DUMP_MAGIC)||(crash_dump.length != sizeof(crash_dump_t))||
+      (crash_dump.checksum != crash_dump_sum(&crash_dump)))
+   {
+      crash_dump.magic = 0;
+      return CRASH_DUMP_NONE;
+   }
+
+   /* The packets are copies, so the dump can go as soon as they're built. */
+   for(ii=0; ii<CRASH_DUMP_CHUNKS; ii++)
+   {
+      offset = ii * CRASH_DUMP_CHUNK_BYTES;
+      length = sizeof(crash_dump_t) - offset;
+      if(length > CRASH_DUMP_CHUNK_BYTES)
+      {
+         length = CRASH_DUMP_CHUNK_BYTES;
+      }
+
+      create_universal_crash(&(crash_dump_packets[ii]), (uint16_t)offset, (uint16_t)sizeof(crash_dump_t),
+                             ((const uint8_t *)&crash_dump) + offset, (uint8_t)length);
+      if(full_duplex_usart_dma_add_to_queue(&(crash_dump_packets[ii]), NULL, 0) != FDUD_SUCCESS)
+      {
+         retval = CRASH_DUMP_ERROR_QUEUE;
+         break;
+      }
+   }
+
+   crash_dump.magic = 0;
+
+   return retval;
+}
+
+/* PRIVATE crash_dump_readable
+ *
+ * Notes:
+ *  +1 if bytes from address are all in SRAM or all in CCM.  Anything else
+ *   (flash, peripherals, nowhere) isn't worth a second fault to look at.
+ */
+uint8_t crash_dump_readable(uint32_t address, uint32_t bytes)
+{
+   if((address & 0x03) != 0)
+   {
+      return 0;
+   }
+
+   if((address >= CRASH_DUMP_SRAM_START)&&(address <= (CRASH_DUMP_SRAM_END - bytes)))
+   {
+      return 1;
+   }
+
+   if((address >= CRASH_DUMP_CCM_START)&&(address <= (CRASH_DUMP_CCM_END - bytes)))
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
+/* PRIVATE crash_dump_sum
+ *
+ * Notes:
+ *  +Sum of every word up to the checksum, enough to tell a dump from RAM
+ *   that powered up with the magic number in it by chance.
+ */
+uint32_t crash_dump_sum(const crash_dump_t *dump)
+{
+   const uint32_t *word = (const uint32_t *)dump;
+   uint32_t sum = 0;
+   uint32_t ii;
+
+   for(ii=0; ii<(offsetof(crash_dump_t, checksum) / 4); ii++)
+   {
+      sum += word[ii];
+   }
+
+   return sum;
+}
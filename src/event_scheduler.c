@@ -0,0 +1,137 @@
+/**
+ * @file event_scheduler.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Event driven main loop.
+ *
+ * Interrupts post event bits and the main loop runs the matching handlers,
+ * then sleeps until the next interrupt instead of spinning.  Work gets picked
+ * up as soon as the interrupt that caused it returns rather than whenever the
+ * spin comes back around, and the core is asleep the rest of the time.
+ */
+
+#include "event_scheduler.h"
+
+volatile uint32_t event_pending = 0;
+EventHandler event_handlers[EVENT_MAX_EVENTS];
+EventHandler event_idle_handler = NULL;
+
+/* Idle accounting in SysTick counts (core clock cycles). */
+uint32_t event_idle_cycles = 0;
+uint32_t event_window_start = 0;
+uint8_t event_idle_pct = 0;
+
+/* Used Internally */
+void event_sleep(void);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void event_init(void)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<EVENT_MAX_EVENTS; ii++)
+   {
+      event_handlers[ii] = NULL;
+   }
+
+   event_idle_handler = NULL;
+
+   event_pending = 0;
+   event_idle_cycles = 0;
+   event_idle_pct = 0;
+   event_window_start = hal_sleep_cycles();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t event_register(uint32_t event, EventHandler handler)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<EVENT_MAX_EVENTS; ii++)
+   {
+      if(event == (1UL << ii))
+      {
+         event_handlers[ii] = handler;
+         return EVENT_SUCCESS;
+      }
+   }
+
+   return EVENT_ERROR_BAD_EVENT;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void event_post(uint32_t events)
+{
+   hal_atomic_or(&event_pending, events);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void event_dispatch(void)
+{
+   uint32_t events;
+   uint8_t ii;
+
+   events = hal_atomic_take(&event_pending);
+   while(events != 0)
+   {
+      for(ii=0; ii<EVENT_MAX_EVENTS; ii++)
+      {
+         if((events & (1UL << ii))&&(event_handlers[ii] != NULL))
+         {
+            event_handlers[ii]();
+         }
+      }
+      events = hal_atomic_take(&event_pending);
+   }
+
+   if(event_idle_handler != NULL)
+   {
+      event_idle_handler();
+   }
+
+   event_sleep();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void event_set_idle(EventHandler handler)
+{
+   event_idle_handler = handler;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t event_idle_percent(void)
+{
+   return event_idle_pct;
+}
+
+/* PRIVATE event_sleep
+ *
+ * Notes:
+ *  +Interrupts are masked between the last check and WFI so an event posted
+ *   in that gap still wakes us.  WFI returns on a pending interrupt even when
+ *   it is masked, and the handler runs as soon as they are unmasked.
+ */
+void event_sleep(void)
+{
+   uint32_t start;
+   uint32_t now;
+   uint32_t window;
+
+   hal_irq_disable();
+   if(event_pending == 0)
+   {
+      start = hal_sleep_cycles();
+      hal_wait_for_interrupt();
+      event_idle_cycles += hal_sleep_cycles() - start;
+   }
+   hal_irq_enable();
+
+   now = hal_sleep_cycles();
+   window = now - event_window_start;
+   if(window >= ((SystemCoreClock / 1000) * EVENT_IDLE_WINDOW_MS))
+   {
+      event_idle_pct = (uint8_t)(((uint64_t)event_idle_cycles * 100) / window);
+      event_idle_cycles = 0;
+      event_window_start = now;
+   }
+}
@@ -0,0 +1,392 @@
+/**
+ * @file flash_kv.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Wear leveled key/value store in on-chip flash.
+ *
+ * Small settings like the RS485 slave address and calibration values live
+ * here so they survive a reflash of the application ("make program" leaves
+ * the store's sectors alone) and don't need a build per board.  The store is
+ * an append only log over two sectors (see flash_kv.h for the layout).  Only
+ * the port functions touch the hardware, so this file also builds on a PC
+ * against a RAM backed flash.
+ *
+ * Only flash_kv_init() erases.  An erase stalls every flash read for a few
+ * hundred milliseconds, longer than the window watchdog allows once it is
+ * running, so writes only ever program words.
+ */
+
+#include "flash_kv.h"
+
+/* Salt for the record check so a value/key pair of all zeros isn't valid. */
+#define FLASH_KV_CHECK_SALT   0x5A5A
+
+uint8_t flash_kv_initialized = 0;
+uint8_t flash_kv_active = 0;
+uint32_t flash_kv_next_record = 0;
+
+/* Used Internally */
+uint16_t flash_kv_check(uint16_t key, uint32_t value);
+uint8_t flash_kv_record_get(uint8_t sector, uint32_t record, uint16_t *key, uint32_t *value);
+uint8_t flash_kv_record_blank(uint8_t sector, uint32_t record);
+uint32_t flash_kv_find_end(uint8_t sector);
+uint8_t flash_kv_lookup(uint8_t sector, uint32_t end, uint16_t key, uint32_t *value);
+uint8_t flash_kv_append(uint8_t sector, uint32_t *next, uint16_t key, uint32_t value);
+uint8_t flash_kv_sector_blank(uint8_t sector);
+uint8_t flash_kv_format(void);
+uint8_t flash_kv_move(uint16_t key, uint32_t value);
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_init(void)
+{
+   uint32_t state[2];
+   uint32_t generation[2];
+   uint8_t other;
+   uint8_t retval;
+
+   flash_kv_initialized = 0;
+
+   state[0] = flash_kv_port_sector(0)[0];
+   state[1] = flash_kv_port_sector(1)[0];
+   generation[0] = flash_kv_port_sector(0)[1];
+   generation[1] = flash_kv_port_sector(1)[1];
+
+   if((state[0] == FLASH_KV_SECTOR_ACTIVE)&&(state[1] == FLASH_KV_SECTOR_ACTIVE))
+   {
+      /* A move finished but the old sector wasn't erased yet. */
+      flash_kv_active = (generation[1] > generation[0]) ? 1 : 0;
+   }
+   else if(state[0] == FLASH_KV_SECTOR_ACTIVE)
+   {
+      flash_kv_active = 0;
+   }
+   else if(state[1] == FLASH_KV_SECTOR_ACTIVE)
+   {
+      flash_kv_active = 1;
+   }
+   else
+   {
+      retval = flash_kv_format();
+      if(retval != FLASH_KV_SUCCESS)
+      {
+         return retval;
+      }
+   }
+
+   /* Anything left in the other sector is an unfinished or finished move,
+    * or an erase a reset cut short.  Blank it so the next move doesn't have
+    * to.
+    */
+   other = 1 - flash_kv_active;
+   if(flash_kv_sector_blank(other) == 0)
+   {
+      retval = flash_kv_port_erase(other);
+      if(retval != FLASH_KV_SUCCESS)
+      {
+         return retval;
+      }
+   }
+
+   flash_kv_next_record = flash_kv_find_end(flash_kv_active);
+   flash_kv_initialized = 1;
+
+   return FLASH_KV_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_read(uint16_t key, uint32_t *value)
+{
+   if(flash_kv_initialized == 0)
+   {
+      return FLASH_KV_ERROR_INIT;
+   }
+
+   if(key == FLASH_KV_KEY_INVALID)
+   {
+      return FLASH_KV_ERROR_KEY;
+   }
+
+   return flash_kv_lookup(flash_kv_active, flash_kv_next_record, key, value);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_write(uint16_t key, uint32_t value)
+{
+   uint32_t current;
+
+   if(flash_kv_initialized == 0)
+   {
+      return FLASH_KV_ERROR_INIT;
+   }
+
+   if(key == FLASH_KV_KEY_INVALID)
+   {
+      return FLASH_KV_ERROR_KEY;
+   }
+
+   if((flash_kv_lookup(flash_kv_active, flash_kv_next_record, key, &current) == FLASH_KV_SUCCESS)&&(current == value))
+   {
+      return FLASH_KV_SUCCESS;
+   }
+
+   if(flash_kv_next_record < FLASH_KV_SECTOR_RECORDS)
+   {
+      return flash_kv_append(flash_kv_active, &flash_kv_next_record, key, value);
+   }
+
+   return flash_kv_move(key, value);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t flash_kv_generation(void)
+{
+   return flash_kv_port_sector(flash_kv_active)[1];
+}
+
+/* PRIVATE flash_kv_check
+ *
+ * Notes:
+ *  +Folds the key and value into the lower half of the key word.
+ */
+uint16_t flash_kv_check(uint16_t key, uint32_t value)
+{
+   return (uint16_t)(key ^ (value & 0xFFFF) ^ (value >> 16) ^ FLASH_KV_CHECK_SALT);
+}
+
+/* PRIVATE flash_kv_record_get
+ *
+ * Notes:
+ *  +Returns 1 for a complete record.  A record whose key word is blank or
+ *   doesn't check was cut short by a reset and is skipped.
+ */
+uint8_t flash_kv_record_get(uint8_t sector, uint32_t record, uint16_t *key, uint32_t *value)
+{
+   const volatile uint32_t *words;
+   uint32_t key_word;
+
+   words = flash_kv_port_sector(sector) + FLASH_KV_HEADER_WORDS + (record * FLASH_KV_RECORD_WORDS);
+   *value = words[0];
+   key_word = words[1];
+
+   if(key_word == 0xFFFFFFFF)
+   {
+      return 0;
+   }
+
+   *key = (uint16_t)(key_word >> 16);
+
+   return ((uint16_t)(key_word & 0xFFFF) == flash_kv_check(*key, *value)) ? 1 : 0;
+}
+
+/* PRIVATE flash_kv_record_blank
+ *
+ * Notes:
+ *  +Records are written in order so the first blank one ends the log.
+ */
+uint8_t flash_kv_record_blank(uint8_t sector, uint32_t record)
+{
+   const volatile uint32_t *words;
+
+   words = flash_kv_port_sector(sector) + FLASH_KV_HEADER_WORDS + (record * FLASH_KV_RECORD_WORDS);
+
+   return ((words[0] == 0xFFFFFFFF)&&(words[1] == 0xFFFFFFFF)) ? 1 : 0;
+}
+
+/* PRIVATE flash_kv_find_end
+ *
+ * Notes:
+ *  +Returns FLASH_KV_SECTOR_RECORDS for a full sector.
+ */
+uint32_t flash_kv_find_end(uint8_t sector)
+{
+   uint32_t record;
+
+   for(record=0; record<FLASH_KV_SECTOR_RECORDS; record++)
+   {
+      if(flash_kv_record_blank(sector, record))
+      {
+         break;
+      }
+   }
+
+   return record;
+}
+
+/* PRIVATE flash_kv_lookup
+ *
+ * Notes:
+ *  +Searches from the end so the newest record wins.
+ */
+uint8_t flash_kv_lookup(uint8_t sector, uint32_t end, uint16_t key, uint32_t *value)
+{
+   uint32_t record;
+   uint16_t record_key;
+   uint32_t record_value;
+
+   record = end;
+   while(record > 0)
+   {
+      record--;
+      if((flash_kv_record_get(sector, record, &record_key, &record_value))&&(record_key == key))
+      {
+         *value = record_value;
+         return FLASH_KV_SUCCESS;
+      }
+   }
+
+   return FLASH_KV_ERROR_NOT_FOUND;
+}
+
+/* PRIVATE flash_kv_append
+ *
+ * Notes:
+ *  +The value goes first and the key word last, so a record only counts
+ *   once it is all there.
+ *  +A failed record still uses up its slot.
+ */
+uint8_t flash_kv_append(uint8_t sector, uint32_t *next, uint16_t key, uint32_t value)
+{
+   uint32_t word;
+   uint8_t retval;
+
+   if(*next >= FLASH_KV_SECTOR_RECORDS)
+   {
+      return FLASH_KV_ERROR_FULL;
+   }
+
+   word = FLASH_KV_HEADER_WORDS + (*next * FLASH_KV_RECORD_WORDS);
+   (*next)++;
+
+   retval = flash_kv_port_program(sector, word, value);
+   if(retval == FLASH_KV_SUCCESS)
+   {
+      retval = flash_kv_port_program(sector, word + 1, ((uint32_t)key << 16) | flash_kv_check(key, value));
+   }
+
+   return retval;
+}
+
+/* PRIVATE flash_kv_sector_blank
+ *
+ * Notes:
+ *  +A reset during an erase can leave a sector that looks erased in word 0
+ *   only, so the whole sector is checked before it is reused.
+ */
+uint8_t flash_kv_sector_blank(uint8_t sector)
+{
+   const volatile uint32_t *words;
+   uint32_t ii;
+
+   words = flash_kv_port_sector(sector);
+   for(ii=0; ii<FLASH_KV_SECTOR_WORDS; ii++)
+   {
+      if(words[ii] != 0xFFFFFFFF)
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/* PRIVATE flash_kv_format
+ *
+ * Notes:
+ *  +Only used when neither sector is active, i.e. a new part.
+ */
+uint8_t flash_kv_format(void)
+{
+   uint8_t retval;
+
+   flash_kv_active = 0;
+
+   if(flash_kv_sector_blank(0) == 0)
+   {
+      retval = flash_kv_port_erase(0);
+      if(retval != FLASH_KV_SUCCESS)
+      {
+         return retval;
+      }
+   }
+
+   retval = flash_kv_port_program(0, 1, 0);
+   if(retval == FLASH_KV_SUCCESS)
+   {
+      retval = flash_kv_port_program(0, 0, FLASH_KV_SECTOR_ACTIVE);
+   }
+
+   return retval;
+}
+
+/* PRIVATE flash_kv_move
+ *
+ * Notes:
+ *  +Copies the newest record of every key except the one being written to
+ *   the other sector, adds the new record and only then marks the new
+ *   sector active.  Until that point a reset leaves the old sector intact.
+ *  +Walking the old log newest first means a key is copied the first time it
+ *   is seen and skipped once it is in the new sector.
+ *  +Never erases.  The other sector has to be blank already, which it is
+ *   after flash_kv_init() and until the first move.  The old sector stays
+ *   active with the lower generation until the next flash_kv_init() erases
+ *   it.
+ */
+uint8_t flash_kv_move(uint16_t key, uint32_t value)
+{
+   uint8_t old_sector, new_sector;
+   uint32_t record;
+   uint32_t next;
+   uint16_t record_key;
+   uint32_t record_value;
+   uint32_t copied_value;
+   uint8_t retval;
+
+   old_sector = flash_kv_active;
+   new_sector = 1 - flash_kv_active;
+
+   if(flash_kv_sector_blank(new_sector) == 0)
+   {
+      /* Already moved once since boot, or a failed move left records. */
+      return FLASH_KV_ERROR_FULL;
+   }
+
+   retval = flash_kv_port_program(new_sector, 0, FLASH_KV_SECTOR_RECEIVING);
+   if(retval == FLASH_KV_SUCCESS)
+   {
+      retval = flash_kv_port_program(new_sector, 1, flash_kv_port_sector(old_sector)[1] + 1);
+   }
+
+   next = 0;
+   record = flash_kv_next_record;
+   while((record > 0)&&(retval == FLASH_KV_SUCCESS))
+   {
+      record--;
+      if((flash_kv_record_get(old_sector, record, &record_key, &record_value))&&
+         (record_key != key)&&
+         (flash_kv_lookup(new_sector, next, record_key, &copied_value) == FLASH_KV_ERROR_NOT_FOUND))
+      {
+         retval = flash_kv_append(new_sector, &next, record_key, record_value);
+      }
+   }
+
+   if(retval == FLASH_KV_SUCCESS)
+   {
+      retval = flash_kv_append(new_sector, &next, key, value);
+   }
+
+   if(retval == FLASH_KV_SUCCESS)
+   {
+      retval = flash_kv_port_program(new_sector, 0, FLASH_KV_SECTOR_ACTIVE);
+   }
+
+   if(retval != FLASH_KV_SUCCESS)
+   {
+      /* The old sector is still good, flash_kv_init() erases the new one. */
+      return retval;
+   }
+
+   flash_kv_active = new_sector;
+   flash_kv_next_record = next;
+
+   return FLASH_KV_SUCCESS;
+}
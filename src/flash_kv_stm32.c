@@ -0,0 +1,82 @@
+/**
+ * @file flash_kv_stm32.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief STM32F4 flash port for the key/value store.
+ *
+ * The store uses the two 16KB sectors right after the vector table (sectors
+ * 1 and 2).  STM32F417IG_FLASH.ld keeps code out of them and "make program"
+ * writes the vector table and the code as two images around them, so the
+ * store survives a reflash.  main.bin pads over the gap, flashing that one
+ * wipes the store.
+ */
+
+#include "flash_kv.h"
+#include "stm32f4xx.h"
+
+#define FLASH_KV_SECTOR0_BASE   0x08004000
+#define FLASH_KV_SECTOR1_BASE   0x08008000
+
+#if (FLASH_KV_SECTOR_WORDS != (16384 / 4))
+#error "FLASH_KV_SECTOR_WORDS must match the 16KB STM32F4 sectors 1 and 2."
+#endif
+
+/* Used Internally */
+uint8_t flash_kv_port_status(FLASH_Status status);
+
+/* Public Function - Doxygen documentation is in the header file. */
+const volatile uint32_t *flash_kv_port_sector(uint8_t sector)
+{
+   return (const volatile uint32_t *)((sector == 0) ? FLASH_KV_SECTOR0_BASE : FLASH_KV_SECTOR1_BASE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_port_erase(uint8_t sector)
+{
+   FLASH_Status status;
+
+   FLASH_Unlock();
+   FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR |
+                   FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+
+   /* 2.7V to 3.6V, erases 32 bits at a time. */
+   status = FLASH_EraseSector((sector == 0) ? FLASH_Sector_1 : FLASH_Sector_2, VoltageRange_3);
+
+   FLASH_Lock();
+
+   return flash_kv_port_status(status);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t flash_kv_port_program(uint8_t sector, uint32_t word, uint32_t value)
+{
+   FLASH_Status status;
+   uint32_t address;
+
+   if(word >= FLASH_KV_SECTOR_WORDS)
+   {
+      return FLASH_KV_ERROR_FLASH;
+   }
+
+   address = ((sector == 0) ? FLASH_KV_SECTOR0_BASE : FLASH_KV_SECTOR1_BASE) + (word * 4);
+
+   FLASH_Unlock();
+   FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR |
+                   FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+
+   status = FLASH_ProgramWord(address, value);
+
+   FLASH_Lock();
+
+   return flash_kv_port_status(status);
+}
+
+/* PRIVATE flash_kv_port_status
+ *
+ * Notes:
+ *  +Maps the StdPeriph flash status onto the store's return codes.
+ */
+uint8_t flash_kv_port_status(FLASH_Status status)
+{
+   return (status == FLASH_COMPLETE) ? FLASH_KV_SUCCESS : FLASH_KV_ERROR_FLASH;
+}
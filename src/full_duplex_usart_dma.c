@@ -37,6 +37,11 @@
 #include "circular_buffer.h"
 
 #include "debug.h"
+#include "event_scheduler.h"
+#include "profile.h"
+#include "trace.h"
+#include "memory_sections.h"
+#include "watchdog.h"
 
 
 /* Private Defines */
@@ -50,7 +55,8 @@ uint8_t full_duplex_usart_dma_tx_buffer[FDUD_TX_DMA_SIZE];
 
 uint8_t full_duplex_usart_dma_rx_buffer[FDUD_RX_DMA_SIZE];
 circular_buffer_t cb_fdud_dma_rx;
-uint8_t full_duplex_usart_ram_rx_buffer[FDUD_RX_RAM_SIZE];
+/* Only the CPU touches these, the DMA buffers above have to stay in SRAM. */
+CCM_BSS uint8_t full_duplex_usart_ram_rx_buffer[FDUD_RX_RAM_SIZE];
 circular_buffer_t cb_fdud_ram_rx;
 
 
@@ -59,7 +65,10 @@ FDUD_TxQueue_CB_Struct fdud_txq_cb;
 volatile uint8_t fdud_txq_cb_mutex = 0;
 
 
-GenericPacket fdud_rx[FDUD_RX_QUEUE_SIZE];
+/* Parsed into by the CPU and never sent, TX DMA reads straight out of
+ * queued packets so those can't go in CCM.
+ */
+CCM_BSS GenericPacket fdud_rx[FDUD_RX_QUEUE_SIZE];
 GenericPacketCircularBuffer fdud_rx_gpcb;
 
 
@@ -80,7 +89,7 @@ void full_duplex_usart_dma_communications_init(void);
 void full_duplex_usart_dma_write(void);
 void full_duplex_usart_dma_init_state_machine(void);
 void reset_received_bytes_sending(uint32_t cb_data);
-void full_duplex_usart_dma_service_rx(void);
+RAMFUNC void full_duplex_usart_dma_service_rx(void);
 uint8_t full_duplex_usart_dma_get_rx_packet(void);
 void full_duplex_usart_dma_service_tx(void);
 void full_duplex_usart_dma_service(void);
@@ -104,9 +113,13 @@ uint8_t full_duplex_usart_dma_up(void)
  */
 void full_duplex_usart_dma_spin(void)
 {
+   PROFILE_ENTER();
+
    full_duplex_usart_dma_service_rx();
    full_duplex_usart_dma_get_rx_packet();
    full_duplex_usart_dma_service_tx();
+
+   PROFILE_EXIT(PROFILE_ID_FDUD_SPIN);
 }
 
 
@@ -163,6 +176,13 @@ uint8_t full_duplex_usart_dma_init(GenericPacketCallback gp_handler)
    /* GPIO_SetBits(GPIOD, LED_PIN_RED); */
    full_duplex_usart_dma_initialized = 1;
 
+   /* Every packet started is a beat, and the TX complete interrupt idles it
+    * when the queue runs dry.  A chain that stops part way (fdud_txq_cb_mutex
+    * stuck at 1) starves the watchdog.
+    */
+   watchdog_register(WATCHDOG_TASK_FDUD_TX, WATCHDOG_FDUD_TX_DEADLINE_MS);
+   watchdog_idle(WATCHDOG_TASK_FDUD_TX);
+
    /* Put something in the outgoing queue to see if it is working. */
    create_universal_ack(&gp_debug_out);
    full_duplex_usart_dma_add_to_queue(&gp_debug_out, NULL, 0);
@@ -175,10 +195,9 @@ uint8_t full_duplex_usart_dma_init(GenericPacketCallback gp_handler)
 
 void TIM8_BRK_TIM12_IRQHandler(void)
 {
-   GenericPacket packet_query;
-   uint8_t retval;
+   PROFILE_ENTER_TIMER(PROFILE_ID_TIM12, HAL_TIMER_LINK_SERVICE);
 
-   if(TIM_GetITStatus(TIM12, TIM_IT_Update) != RESET)
+   if(hal_timer_update_pending(HAL_TIMER_LINK_SERVICE))
    {
       /* See if we can service the circular buffer in here!
        *
@@ -192,49 +211,25 @@ void TIM8_BRK_TIM12_IRQHandler(void)
          packet_reset_timer++;
       }
 
-      TIM_ClearITPendingBit(TIM12, TIM_IT_Update);
+      hal_timer_update_clear(HAL_TIMER_LINK_SERVICE);
    }
 
+   PROFILE_EXIT(PROFILE_ID_TIM12);
 }
 
 
 void full_duplex_usart_dma_init_state_machine(void)
 {
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
-   NVIC_InitTypeDef   NVIC_InitStructure;
-
    uint32_t TimerPeriod = 0;
    uint16_t pscale = 0;
 
-   /* Turn the timer clock on! */
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM12, ENABLE);
-
    /* TIM12 on APB1 runs at SystemCoreClock/2.  The factor of 2 in the denominator
     * in this case is because APB1 runs at half of SystemCoreClock.
     */
    pscale = 1;
    TimerPeriod = (SystemCoreClock / (FULL_DUPLEX_USART_SM_HZ * (pscale+1) * 2)) - 1;
 
-   /* Time Base configuration */
-   TIM_TimeBaseStructure.TIM_Prescaler = pscale;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-   TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
-   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
-
-   TIM_TimeBaseInit(TIM12, &TIM_TimeBaseStructure);
-
-   /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM8_BRK_TIM12_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x01;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-   TIM_ITConfig(TIM12, TIM_IT_Update, ENABLE);
-
-   TIM_Cmd(TIM12, ENABLE);
-
+   hal_timer_init(HAL_TIMER_LINK_SERVICE, pscale, TimerPeriod, 0x00, 0x01);
 }
 
 
@@ -250,9 +245,10 @@ void full_duplex_usart_dma_service(void)
    uint8_t retval;
    uint16_t dma_head;
    uint8_t rx_byte;
+   uint8_t rx_moved = 0;
 
 
-   dma_head = (cb_fdud_dma_rx.cb_size - DMA2_Stream5->NDTR);
+   dma_head = hal_usart_dma_rx_head(HAL_USART_LINK);
    retval = cb_set_head_dma(&cb_fdud_dma_rx, dma_head);
    if(retval == CB_SUCCESS)
    {
@@ -261,10 +257,17 @@ void full_duplex_usart_dma_service(void)
          if(retval == CB_SUCCESS)
          {
             retval = cb_add_byte(&cb_fdud_ram_rx, rx_byte);
+            rx_moved = 1;
          }
       }while(retval == CB_SUCCESS);
    }
 
+   /* The main loop also needs a kick to time out a half received packet. */
+   if((rx_moved)||((packet_reset_active)&&(packet_reset_timer > PACKET_RESET_TIMOUT)))
+   {
+      event_post(EVENT_FDUD_RX);
+   }
+
 }
 
 
@@ -306,10 +309,12 @@ uint8_t full_duplex_usart_dma_add_to_queue(GenericPacket *gp_ptr, FDUD_TxQueueCa
       fdud_txq_cb.fdud_txqs_ptr[temp_head].cb = callback_func;
       fdud_txq_cb.fdud_txqs_ptr[temp_head].cb_data = callback_data;
       /* Make sure all memory has been written... */
-      asm("DSB");
+      hal_memory_barrier();
       /* Now as the very last thing...increment head... */
       fdud_txq_cb.head = temp_head;
 
+      event_post(EVENT_FDUD_TX);
+
       return FDUD_SUCCESS;
    }
    else
@@ -330,8 +335,10 @@ uint8_t full_duplex_usart_dma_add_to_queue(GenericPacket *gp_ptr, FDUD_TxQueueCa
  *  +I used to have a timer interrupt that just moved DMA bytes into a RAM
  *   buffer and then subsequently packetized it.  Maybe this can be a single
  *   step?
+ *  +Runs from RAM, as does gp_receive.o (see STM32F417IG_FLASH.ld), since
+ *   every received byte goes through here.
  */
-void full_duplex_usart_dma_service_rx(void)
+RAMFUNC void full_duplex_usart_dma_service_rx(void)
 {
    uint16_t dma_head;
    uint8_t retval_gpcb;
@@ -366,6 +373,7 @@ void full_duplex_usart_dma_service_rx(void)
       if((packet_reset_active)&&(packet_reset_timer > PACKET_RESET_TIMOUT))
       {
          /* Reset the packet so that we can catch the next one. */
+         TRACE(TRACE_ID_FDUD_PACKET_RESET, 0, packet_reset_timer);
          retval = gp_receive_byte(0x00, GP_CONTROL_INITIALIZE, &(fdud_rx_gpcb.gpcb[fdud_rx_gpcb.gpcb_head_temp]));
          packet_reset_active = 0;
          packet_reset_timer = 0;
@@ -462,108 +470,13 @@ uint8_t full_duplex_usart_dma_get_rx_packet(void)
  */
 void full_duplex_usart_dma_communications_init(void)
 {
-   USART_InitTypeDef USART_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-   GPIO_InitTypeDef  GPIO_InitStructure;
-   DMA_InitTypeDef  DMA_InitStructure;
-
-   uint8_t retval;
-
-   /* Enable DMA Clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
-   /* Enable the USART Clock */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE);
-
-   /* Enable GPIO clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
-   /* Connect PXx to USARTx_Tx*/
-   GPIO_PinAFConfig(GPIOB, GPIO_PinSource6, GPIO_AF_USART1);
-   /* Connect PXx to USARTx_Rx*/
-   GPIO_PinAFConfig(GPIOB, GPIO_PinSource7, GPIO_AF_USART1);
-   /* Configure USART Tx as alternate function */
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_Init(GPIOB, &GPIO_InitStructure);
-   /* Configure USART Rx as alternate function  */
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
-   GPIO_Init(GPIOB, &GPIO_InitStructure);
-
-   USART_InitStructure.USART_BaudRate = 3000000;
-   USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-   USART_InitStructure.USART_StopBits = USART_StopBits_1;
-   USART_InitStructure.USART_Parity = USART_Parity_No;
-   USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-   USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
-
-   USART_OverSampling8Cmd(USART1, ENABLE);
-
-   /* USART configuration */
-   USART_Init(USART1, &USART_InitStructure);
-
-   /* Set up DMA Here!!!! */
-   /* Configure TX DMA */
-   DMA_DeInit(DMA2_Stream7);
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART1->DR));
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(full_duplex_usart_dma_tx_buffer);
-   DMA_InitStructure.DMA_Channel = DMA_Channel_4;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)full_duplex_usart_dma_tx_buffer;
-   DMA_Init(DMA2_Stream7, &DMA_InitStructure);
-   /* Configure RX DMA */
-   DMA_DeInit(DMA2_Stream5);
-   DMA_InitStructure.DMA_Channel = DMA_Channel_4;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)full_duplex_usart_dma_rx_buffer;
-   /* DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(full_duplex_usart_dma_rx_buffer); */
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)FDUD_RX_DMA_SIZE;
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART1->DR));
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_Init(DMA2_Stream5, &DMA_InitStructure);
-   /* Enable the USART Rx DMA request */
-   USART_DMACmd(USART1, USART_DMAReq_Rx, ENABLE);
-   /* Enable the DMA RX Stream */
-   DMA_Cmd(DMA2_Stream5, ENABLE);
-
-   /* Enable USART */
-   USART_Cmd(USART1, ENABLE);
-
-   /* Use DMA TC interrupt to know when a packet has been sent. This way we can
-    * notify the source of the packet that the memory can be free'd for use
-    * in building another packet.
+   /* 3 MBaud, 8N1.  TX DMA is pointed at each packet as it goes out, RX DMA
+    * runs circular into full_duplex_usart_dma_rx_buffer.  The TX complete
+    * interrupt lets the originator of a packet know the memory can be used
+    * to build another one.
     */
-   NVIC_InitStructure.NVIC_IRQChannel = DMA2_Stream7_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
-   NVIC_Init(&NVIC_InitStructure);
-
-   /* We won't enable this until we transmit a packet. */
-   DMA_ITConfig(DMA2_Stream7, DMA_IT_TC, DISABLE);
-
-
+   hal_usart_dma_init(HAL_USART_LINK, 3000000, full_duplex_usart_dma_rx_buffer,
+                      (uint16_t)FDUD_RX_DMA_SIZE, 1, 0);
 }
 
 
@@ -576,25 +489,15 @@ void full_duplex_usart_dma_communications_init(void)
  */
 void DMA2_Stream7_IRQHandler(void)
 {
-   if(DMA_GetITStatus(DMA2_Stream7, DMA_IT_TCIF7) != RESET)
+   PROFILE_ENTER();
+
+   if(hal_usart_dma_tx_complete(HAL_USART_LINK))
    {
-      /* I believe this condition should already be met...or we woudln't
-       * be here. */
-      while (DMA_GetFlagStatus(DMA2_Stream7, DMA_FLAG_TCIF7)==RESET);
       /* DMA has done it's job...but the last byte may not have been sent via
-       * the USART hardware.  We might not need to poll for it here...but it
-       * is quick and keeps us on the safe side.
+       * the USART hardware.  Wait for it and disable everything, we will turn
+       * it back on when we are ready to send the next packet.
        */
-      while (USART_GetFlagStatus(USART1, USART_FLAG_TC)==RESET);
-
-
-      /* Disable everything, we will turn it back on when we are ready to send
-       * the next packet.
-       */
-      /* Disable the DMA */
-      DMA_Cmd(DMA2_Stream7, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART1, USART_DMAReq_Tx, DISABLE);
+      hal_usart_dma_tx_stop(HAL_USART_LINK);
 
       /* Put code to notify the orignator that the packet has been sent here! */
       if(fdud_txq_cb.fdud_txqs_ptr[fdud_txq_cb.tail].cb != NULL)
@@ -610,7 +513,7 @@ void DMA2_Stream7_IRQHandler(void)
        * function, we need to have already cleared this bit.  Calling that
        * function will result in a new TC interrupt being set.
        */
-      DMA_ClearITPendingBit(DMA2_Stream7, DMA_IT_TCIF7);
+      hal_usart_dma_tx_clear(HAL_USART_LINK);
 
       /* Increment the tail */
       if(fdud_txq_cb.head != fdud_txq_cb.tail)
@@ -630,10 +533,13 @@ void DMA2_Stream7_IRQHandler(void)
       {
          /* It is now safe for the main program to kick off another transfer. */
          fdud_txq_cb_mutex = 0;
+         watchdog_idle(WATCHDOG_TASK_FDUD_TX);
       }
 
 
    }
+
+   PROFILE_EXIT(PROFILE_ID_DMA2_STREAM7);
 }
 
 
@@ -645,41 +551,9 @@ void full_duplex_usart_dma_write(void)
        * until all previous transmits are complete...  If we do...I guess
        * we'll chop off the last part of that packet.
        */
-      /* /\* If a transmit was already underway, you wouldn't need to do this. */
-      /*  * However, if one isn't, we would hang checking the flags below... */
-      /*  * So...just do this to be safe. */
-      /*  *\/ */
-      /* /\* Enable USART DMA TX Requsts *\/ */
-      /* USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE); */
-      /* /\* Enable the DMA *\/ */
-      /* DMA_Cmd(DMA2_Stream7, ENABLE); */
-
-      /* /\* /\\* Wait for any previous transfer to complete. *\\/ *\/ */
-      /* while (USART_GetFlagStatus(USART1, USART_FLAG_TC)==RESET); */
-      /* while (DMA_GetFlagStatus(DMA2_Stream7, DMA_FLAG_TCIF7)==RESET); */
-
-      /* Disable the DMA */
-      DMA_Cmd(DMA2_Stream7, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART1, USART_DMAReq_Tx, DISABLE);
-
-      /* Clear DMA Transfer Complete Flags */
-      DMA_ClearFlag(DMA2_Stream7, DMA_FLAG_TCIF7);
-      /* Clear USART Transfer Complete Flags */
-      USART_ClearFlag(USART1, USART_FLAG_TC);
-
-      /* Set the length of data to transmit. */
-      DMA2_Stream7->NDTR = fdud_txq_cb.fdud_txqs_ptr[fdud_txq_cb.tail].gp_ptr->packet_length;
-      /* Set the pointer to the data. */
-      DMA2_Stream7->M0AR = (uint32_t)(fdud_txq_cb.fdud_txqs_ptr[fdud_txq_cb.tail].gp_ptr->gp);
-
-      /* Enable Transmit Complete Interrupt */
-      DMA_ITConfig(DMA2_Stream7, DMA_IT_TC, ENABLE);
-
-
-      /* Enable USART DMA TX Requsts */
-      USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
-      /* Enable the DMA */
-      DMA_Cmd(DMA2_Stream7, ENABLE);
+      watchdog_heartbeat(WATCHDOG_TASK_FDUD_TX);
+      hal_usart_dma_tx_start(HAL_USART_LINK,
+                             fdud_txq_cb.fdud_txqs_ptr[fdud_txq_cb.tail].gp_ptr->gp,
+                             fdud_txq_cb.fdud_txqs_ptr[fdud_txq_cb.tail].gp_ptr->packet_length);
    }
 }
@@ -0,0 +1,716 @@
+/**
+ * @file gp_proj_local.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Packets this firmware uses that stm32f4_generic_packet doesn't have
+ * yet.
+ *
+ * See gp_proj_local.h.  The framing is generic_packet.c's,
+ *
+ *    start, project id, project spec, payload length, payload..., checksum
+ *
+ * with the checksum the 8 bit sum from the project id to the end of the
+ * payload.
+ */
+
+#include <string.h>
+
+#include "gp_proj_local.h"
+
+#define GP_LOCAL_START_BYTE   0xA5
+
+/* Used Internally */
+typedef struct {
+   GenericPacket *gp;
+   uint16_t length;
+   uint8_t overflow;
+} gp_local_writer_t;
+
+typedef struct {
+   const GenericPacket *gp;
+   uint16_t offset;
+} gp_local_reader_t;
+
+void gp_local_begin(gp_local_writer_t *w, GenericPacket *gp, uint8_t proj_id, uint8_t proj_spec);
+void gp_local_put_bytes(gp_local_writer_t *w, const uint8_t *bytes, uint16_t length);
+void gp_local_put_u8(gp_local_writer_t *w, uint8_t value);
+void gp_local_put_u16(gp_local_writer_t *w, uint16_t value);
+void gp_local_put_u32(gp_local_writer_t *w, uint32_t value);
+uint8_t gp_local_finish(gp_local_writer_t *w);
+uint8_t gp_local_open(gp_local_reader_t *r, const GenericPacket *gp, uint8_t proj_id, uint8_t proj_spec, uint16_t min_length);
+uint16_t gp_local_payload_length(const GenericPacket *gp);
+uint8_t gp_local_get_u8(gp_local_reader_t *r);
+uint16_t gp_local_get_u16(gp_local_reader_t *r);
+uint32_t gp_local_get_u32(gp_local_reader_t *r);
+
+
+/* ************************************************************* */
+/* * GP_PROJ_UNIVERSAL                                         * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_query_profile(GenericPacket *gp, uint8_t clear)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_QUERY_PROFILE);
+   gp_local_put_u8(&w, clear);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_query_profile(GenericPacket *gp, uint8_t *clear)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_QUERY_PROFILE, 1);
+   if(retval == GP_SUCCESS)
+   {
+      *clear = gp_local_get_u8(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_profile(GenericPacket *gp, uint8_t id, uint32_t count, uint32_t min_cycles,
+                                 uint32_t max_cycles, uint32_t mean_cycles, uint32_t max_latency,
+                                 uint32_t load_ppm, const uint16_t *hist, uint8_t bins)
+{
+   gp_local_writer_t w;
+   uint8_t ii;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_RESP_PROFILE);
+   gp_local_put_u8(&w, id);
+   gp_local_put_u32(&w, count);
+   gp_local_put_u32(&w, min_cycles);
+   gp_local_put_u32(&w, max_cycles);
+   gp_local_put_u32(&w, mean_cycles);
+   gp_local_put_u32(&w, max_latency);
+   gp_local_put_u32(&w, load_ppm);
+   gp_local_put_u8(&w, bins);
+   for(ii=0; ii<bins; ii++)
+   {
+      gp_local_put_u16(&w, hist[ii]);
+   }
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_profile(GenericPacket *gp, uint8_t *id, uint32_t *count, uint32_t *min_cycles,
+                                  uint32_t *max_cycles, uint32_t *mean_cycles, uint32_t *max_latency,
+                                  uint32_t *load_ppm, uint16_t *hist, uint8_t bins)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+   uint8_t sent, ii;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_RESP_PROFILE, 26);
+   if(retval == GP_SUCCESS)
+   {
+      *id = gp_local_get_u8(&r);
+      *count = gp_local_get_u32(&r);
+      *min_cycles = gp_local_get_u32(&r);
+      *max_cycles = gp_local_get_u32(&r);
+      *mean_cycles = gp_local_get_u32(&r);
+      *max_latency = gp_local_get_u32(&r);
+      *load_ppm = gp_local_get_u32(&r);
+      sent = gp_local_get_u8(&r);
+      if(gp_local_payload_length(gp) < (26 + (2 * (uint16_t)sent)))
+      {
+         return GP_LOCAL_ERROR_LENGTH;
+      }
+
+      /* Bins the sender had and the caller doesn't are dropped, the other
+       * way round they're zero.
+       */
+      for(ii=0; ii<bins; ii++)
+      {
+         hist[ii] = (ii < sent) ? gp_local_get_u16(&r) : 0;
+      }
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_query_stack(GenericPacket *gp)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_QUERY_STACK);
+   return gp_local_finish(&w);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_stack(GenericPacket *gp, uint32_t used, uint32_t size, uint32_t budget)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_RESP_STACK);
+   gp_local_put_u32(&w, used);
+   gp_local_put_u32(&w, size);
+   gp_local_put_u32(&w, budget);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_stack(GenericPacket *gp, uint32_t *used, uint32_t *size, uint32_t *budget)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_RESP_STACK, 12);
+   if(retval == GP_SUCCESS)
+   {
+      *used = gp_local_get_u32(&r);
+      *size = gp_local_get_u32(&r);
+      *budget = gp_local_get_u32(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_trace(GenericPacket *gp, uint32_t ms, uint32_t cycles, uint16_t dropped,
+                               const uint8_t *records, uint8_t count)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_TRACE);
+   gp_local_put_u32(&w, ms);
+   gp_local_put_u32(&w, cycles);
+   gp_local_put_u16(&w, dropped);
+   gp_local_put_u8(&w, count);
+   /* Already little endian, trace_record_t is copied as the M4 laid it out. */
+   gp_local_put_bytes(&w, records, (uint16_t)count * GP_LOCAL_TRACE_RECORD_BYTES);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_trace(GenericPacket *gp, uint32_t *ms, uint32_t *cycles, uint16_t *dropped,
+                                uint8_t *records, uint8_t *count)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_TRACE, 11);
+   if(retval == GP_SUCCESS)
+   {
+      *ms = gp_local_get_u32(&r);
+      *cycles = gp_local_get_u32(&r);
+      *dropped = gp_local_get_u16(&r);
+      *count = gp_local_get_u8(&r);
+      if(gp_local_payload_length(gp) < (11 + ((uint16_t)*count * GP_LOCAL_TRACE_RECORD_BYTES)))
+      {
+         return GP_LOCAL_ERROR_LENGTH;
+      }
+      memcpy(records, &(gp->gp[GP_LOC_DATA_START + r.offset]), (uint16_t)*count * GP_LOCAL_TRACE_RECORD_BYTES);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_watchdog(GenericPacket *gp, uint8_t task, uint32_t deadline_ms,
+                                  uint32_t silent_ms, uint32_t uptime_ms)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_WATCHDOG);
+   gp_local_put_u8(&w, task);
+   gp_local_put_u32(&w, deadline_ms);
+   gp_local_put_u32(&w, silent_ms);
+   gp_local_put_u32(&w, uptime_ms);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_watchdog(GenericPacket *gp, uint8_t *task, uint32_t *deadline_ms,
+                                   uint32_t *silent_ms, uint32_t *uptime_ms)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_WATCHDOG, 13);
+   if(retval == GP_SUCCESS)
+   {
+      *task = gp_local_get_u8(&r);
+      *deadline_ms = gp_local_get_u32(&r);
+      *silent_ms = gp_local_get_u32(&r);
+      *uptime_ms = gp_local_get_u32(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_universal_crash(GenericPacket *gp, uint16_t offset, uint16_t total,
+                               const uint8_t *data, uint8_t length)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_CRASH);
+   gp_local_put_u16(&w, offset);
+   gp_local_put_u16(&w, total);
+   gp_local_put_bytes(&w, data, length);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_universal_crash(GenericPacket *gp, uint16_t *offset, uint16_t *total,
+                                uint8_t *data, uint8_t *length)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_UNIVERSAL, UNIVERSAL_CRASH, 4);
+   if(retval == GP_SUCCESS)
+   {
+      *offset = gp_local_get_u16(&r);
+      *total = gp_local_get_u16(&r);
+      *length = (uint8_t)(gp_local_payload_length(gp) - 4);
+      memcpy(data, &(gp->gp[GP_LOC_DATA_START + r.offset]), *length);
+   }
+   return retval;
+}
+
+
+/* ************************************************************* */
+/* * GP_PROJ_THERMAL                                           * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_thermal_lepton_compressed_line(GenericPacket *gp, const uint8_t *data, uint16_t length)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_THERMAL, THERMAL_LEPTON_COMPRESSED_LINE);
+   gp_local_put_bytes(&w, data, length);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_thermal_lepton_compressed_line(GenericPacket *gp, uint8_t *data, uint16_t *length)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_THERMAL, THERMAL_LEPTON_COMPRESSED_LINE, 1);
+   if(retval == GP_SUCCESS)
+   {
+      *length = gp_local_payload_length(gp);
+      memcpy(data, &(gp->gp[GP_LOC_DATA_START]), *length);
+   }
+   return retval;
+}
+
+
+/* ************************************************************* */
+/* * GP_PROJ_ANALOG                                            * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_analog_window(GenericPacket *gp, uint8_t channel, uint32_t number, uint16_t min,
+                             uint16_t max, uint16_t mean, uint16_t rms, uint8_t alert)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_ANALOG, ANALOG_WINDOW);
+   gp_local_put_u8(&w, channel);
+   gp_local_put_u32(&w, number);
+   gp_local_put_u16(&w, min);
+   gp_local_put_u16(&w, max);
+   gp_local_put_u16(&w, mean);
+   gp_local_put_u16(&w, rms);
+   gp_local_put_u8(&w, alert);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_analog_window(GenericPacket *gp, uint8_t *channel, uint32_t *number, uint16_t *min,
+                              uint16_t *max, uint16_t *mean, uint16_t *rms, uint8_t *alert)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_ANALOG, ANALOG_WINDOW, 14);
+   if(retval == GP_SUCCESS)
+   {
+      *channel = gp_local_get_u8(&r);
+      *number = gp_local_get_u32(&r);
+      *min = gp_local_get_u16(&r);
+      *max = gp_local_get_u16(&r);
+      *mean = gp_local_get_u16(&r);
+      *rms = gp_local_get_u16(&r);
+      *alert = gp_local_get_u8(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_analog_alert(GenericPacket *gp, uint8_t channel, uint8_t state, uint8_t previous,
+                            uint16_t value, uint32_t blocks, uint32_t count)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_ANALOG, ANALOG_ALERT);
+   gp_local_put_u8(&w, channel);
+   gp_local_put_u8(&w, state);
+   gp_local_put_u8(&w, previous);
+   gp_local_put_u16(&w, value);
+   gp_local_put_u32(&w, blocks);
+   gp_local_put_u32(&w, count);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_analog_alert(GenericPacket *gp, uint8_t *channel, uint8_t *state, uint8_t *previous,
+                             uint16_t *value, uint32_t *blocks, uint32_t *count)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_ANALOG, ANALOG_ALERT, 13);
+   if(retval == GP_SUCCESS)
+   {
+      *channel = gp_local_get_u8(&r);
+      *state = gp_local_get_u8(&r);
+      *previous = gp_local_get_u8(&r);
+      *value = gp_local_get_u16(&r);
+      *blocks = gp_local_get_u32(&r);
+      *count = gp_local_get_u32(&r);
+   }
+   return retval;
+}
+
+
+/* ************************************************************* */
+/* * GP_PROJ_MOTOR                                             * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_motor_query_pid(GenericPacket *gp)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_MOTOR, MOTOR_QUERY_PID);
+   return gp_local_finish(&w);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_motor_autotune(GenericPacket *gp)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_MOTOR, MOTOR_AUTOTUNE);
+   return gp_local_finish(&w);
+}
+
+
+/* ************************************************************* */
+/* * GP_PROJ_RS485_SB                                          * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_query_latency(GenericPacket *gp, uint8_t address)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_QUERY_LATENCY);
+   gp_local_put_u8(&w, address);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_query_latency(GenericPacket *gp, uint8_t *address)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_QUERY_LATENCY, 1);
+   if(retval == GP_SUCCESS)
+   {
+      *address = gp_local_get_u8(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_resp_latency(GenericPacket *gp, uint8_t address, uint32_t p99_usec,
+                                  uint32_t timeout_usec, const uint16_t *hist, uint8_t bins)
+{
+   gp_local_writer_t w;
+   uint8_t ii;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_RESP_LATENCY);
+   gp_local_put_u8(&w, address);
+   gp_local_put_u32(&w, p99_usec);
+   gp_local_put_u32(&w, timeout_usec);
+   gp_local_put_u8(&w, bins);
+   for(ii=0; ii<bins; ii++)
+   {
+      gp_local_put_u16(&w, hist[ii]);
+   }
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_resp_latency(GenericPacket *gp, uint8_t *address, uint32_t *p99_usec,
+                                   uint32_t *timeout_usec, uint16_t *hist, uint8_t bins)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+   uint8_t sent, ii;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_RESP_LATENCY, 10);
+   if(retval == GP_SUCCESS)
+   {
+      *address = gp_local_get_u8(&r);
+      *p99_usec = gp_local_get_u32(&r);
+      *timeout_usec = gp_local_get_u32(&r);
+      sent = gp_local_get_u8(&r);
+      if(gp_local_payload_length(gp) < (10 + (2 * (uint16_t)sent)))
+      {
+         return GP_LOCAL_ERROR_LENGTH;
+      }
+      for(ii=0; ii<bins; ii++)
+      {
+         hist[ii] = (ii < sent) ? gp_local_get_u16(&r) : 0;
+      }
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_query_unique_id(GenericPacket *gp, uint8_t address)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_QUERY_UNIQUE_ID);
+   gp_local_put_u8(&w, address);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_query_unique_id(GenericPacket *gp, uint8_t *address)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_QUERY_UNIQUE_ID, 1);
+   if(retval == GP_SUCCESS)
+   {
+      *address = gp_local_get_u8(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_resp_unique_id(GenericPacket *gp, uint8_t address, const uint32_t *unique_id)
+{
+   gp_local_writer_t w;
+   uint8_t ii;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_RESP_UNIQUE_ID);
+   gp_local_put_u8(&w, address);
+   for(ii=0; ii<GP_LOCAL_UNIQUE_ID_WORDS; ii++)
+   {
+      gp_local_put_u32(&w, unique_id[ii]);
+   }
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_resp_unique_id(GenericPacket *gp, uint8_t *address, uint32_t *unique_id)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+   uint8_t ii;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_RESP_UNIQUE_ID, 1 + (4 * GP_LOCAL_UNIQUE_ID_WORDS));
+   if(retval == GP_SUCCESS)
+   {
+      *address = gp_local_get_u8(&r);
+      for(ii=0; ii<GP_LOCAL_UNIQUE_ID_WORDS; ii++)
+      {
+         unique_id[ii] = gp_local_get_u32(&r);
+      }
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_set_address(GenericPacket *gp, const uint32_t *unique_id, uint8_t address)
+{
+   gp_local_writer_t w;
+   uint8_t ii;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_SET_ADDRESS);
+   for(ii=0; ii<GP_LOCAL_UNIQUE_ID_WORDS; ii++)
+   {
+      gp_local_put_u32(&w, unique_id[ii]);
+   }
+   gp_local_put_u8(&w, address);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_set_address(GenericPacket *gp, uint32_t *unique_id, uint8_t *address)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+   uint8_t ii;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_SET_ADDRESS, (4 * GP_LOCAL_UNIQUE_ID_WORDS) + 1);
+   if(retval == GP_SUCCESS)
+   {
+      for(ii=0; ii<GP_LOCAL_UNIQUE_ID_WORDS; ii++)
+      {
+         unique_id[ii] = gp_local_get_u32(&r);
+      }
+      *address = gp_local_get_u8(&r);
+   }
+   return retval;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t create_rs485_sync_sample(GenericPacket *gp, uint16_t slot_usec)
+{
+   gp_local_writer_t w;
+
+   gp_local_begin(&w, gp, GP_PROJ_RS485_SB, RS485_SYNC_SAMPLE);
+   gp_local_put_u16(&w, slot_usec);
+   return gp_local_finish(&w);
+}
+
+uint8_t extract_rs485_sync_sample(GenericPacket *gp, uint16_t *slot_usec)
+{
+   gp_local_reader_t r;
+   uint8_t retval;
+
+   retval = gp_local_open(&r, gp, GP_PROJ_RS485_SB, RS485_SYNC_SAMPLE, 2);
+   if(retval == GP_SUCCESS)
+   {
+      *slot_usec = gp_local_get_u16(&r);
+   }
+   return retval;
+}
+
+
+/* ************************************************************* */
+/* * Packing                                                   * */
+/* ************************************************************* */
+/* PRIVATE gp_local_begin
+ *
+ * Notes:
+ *  +Starts a packet, the payload follows with the gp_local_put_*() calls.
+ */
+void gp_local_begin(gp_local_writer_t *w, GenericPacket *gp, uint8_t proj_id, uint8_t proj_spec)
+{
+   w->gp = gp;
+   w->length = 0;
+   w->overflow = 0;
+
+   gp->gp[0] = GP_LOCAL_START_BYTE;
+   gp->gp[GP_LOC_PROJ_ID] = proj_id;
+   gp->gp[GP_LOC_PROJ_SPEC] = proj_spec;
+}
+
+/* PRIVATE gp_local_put_bytes
+ *
+ * Notes:
+ *  +Appends to the payload.  One that would overflow marks the writer and
+ *   gp_local_finish() fails.
+ */
+void gp_local_put_bytes(gp_local_writer_t *w, const uint8_t *bytes, uint16_t length)
+{
+   if((uint32_t)w->length + length > GP_LOCAL_MAX_PAYLOAD)
+   {
+      w->overflow = 1;
+      return;
+   }
+
+   memcpy(&(w->gp->gp[GP_LOC_DATA_START + w->length]), bytes, length);
+   w->length += length;
+}
+
+void gp_local_put_u8(gp_local_writer_t *w, uint8_t value)
+{
+   gp_local_put_bytes(w, &value, 1);
+}
+
+void gp_local_put_u16(gp_local_writer_t *w, uint16_t value)
+{
+   uint8_t bytes[2];
+
+   bytes[0] = (uint8_t)value;
+   bytes[1] = (uint8_t)(value >> 8);
+   gp_local_put_bytes(w, bytes, 2);
+}
+
+void gp_local_put_u32(gp_local_writer_t *w, uint32_t value)
+{
+   uint8_t bytes[4];
+
+   bytes[0] = (uint8_t)value;
+   bytes[1] = (uint8_t)(value >> 8);
+   bytes[2] = (uint8_t)(value >> 16);
+   bytes[3] = (uint8_t)(value >> 24);
+   gp_local_put_bytes(w, bytes, 4);
+}
+
+/* PRIVATE gp_local_finish
+ *
+ * Notes:
+ *  +Writes the length and checksum.  An overflowed packet is left empty so
+ *   nothing half written can be sent by mistake.
+ */
+uint8_t gp_local_finish(gp_local_writer_t *w)
+{
+   uint8_t sum = 0;
+   uint16_t ii;
+
+   if(w->overflow)
+   {
+      w->gp->packet_length = 0;
+      return GP_LOCAL_ERROR_LENGTH;
+   }
+
+   w->gp->gp[GP_LOC_DATA_START - 1] = (uint8_t)w->length;
+   for(ii=GP_LOC_PROJ_ID; ii<(GP_LOC_DATA_START + w->length); ii++)
+   {
+      sum += w->gp->gp[ii];
+   }
+   w->gp->gp[GP_LOC_DATA_START + w->length] = sum;
+   w->gp->packet_length = GP_LOC_DATA_START + w->length + 1;
+
+   return GP_SUCCESS;
+}
+
+/* PRIVATE gp_local_open
+ *
+ * Notes:
+ *  +Checks the ids and that the payload is at least min_length long.
+ */
+uint8_t gp_local_open(gp_local_reader_t *r, const GenericPacket *gp, uint8_t proj_id, uint8_t proj_spec, uint16_t min_length)
+{
+   r->gp = gp;
+   r->offset = 0;
+
+   if((gp->gp[GP_LOC_PROJ_ID] != proj_id)||(gp->gp[GP_LOC_PROJ_SPEC] != proj_spec))
+   {
+      return GP_LOCAL_ERROR_TYPE;
+   }
+   if(gp_local_payload_length(gp) < min_length)
+   {
+      return GP_LOCAL_ERROR_LENGTH;
+   }
+
+   return GP_SUCCESS;
+}
+
+uint16_t gp_local_payload_length(const GenericPacket *gp)
+{
+   return gp->gp[GP_LOC_DATA_START - 1];
+}
+
+uint8_t gp_local_get_u8(gp_local_reader_t *r)
+{
+   return r->gp->gp[GP_LOC_DATA_START + r->offset++];
+}
+
+uint16_t gp_local_get_u16(gp_local_reader_t *r)
+{
+   uint16_t value;
+
+   value = (uint16_t)gp_local_get_u8(r);
+   value |= (uint16_t)gp_local_get_u8(r) << 8;
+   return value;
+}
+
+uint32_t gp_local_get_u32(gp_local_reader_t *r)
+{
+   uint32_t value;
+
+   value = (uint32_t)gp_local_get_u16(r);
+   value |= (uint32_t)gp_local_get_u16(r) << 16;
+   return value;
+}
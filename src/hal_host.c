@@ -0,0 +1,1157 @@
+/**
+ * @file hal_host.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief PC side of hal.h, see hal_host.h.
+ *
+ * Virtual time is counted in core clock cycles so every timer clock divides
+ * it exactly.  Each peripheral knows when it next needs attention, moving
+ * time forward steps from one of those to the next and runs whatever
+ * interrupts they raise.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hal.h"
+
+#define HAL_HOST_NEVER            UINT64_MAX
+#define HAL_HOST_NO_IRQ           0xFF
+#define HAL_HOST_NO_PRIORITY      0xFFFF
+
+/* SPI1 SCK is APB2/256, 8 bits a byte. */
+#define HAL_HOST_SPI_BYTE_CYCLES  (8 * 256)
+
+/* One WWDG count at 20507.8125 Hz. */
+#define HAL_HOST_WWDG_CYCLES      8192
+
+/* A handler that runs this many times in a row without time moving isn't
+ * clearing its interrupt.  The board would hang, the simulation stops.
+ */
+#define HAL_HOST_RUNAWAY          1000000
+
+/* Weak, so only the handlers that are linked in get called. */
+void TIM5_IRQHandler(void) __attribute__((weak));
+void TIM1_TRG_COM_TIM11_IRQHandler(void) __attribute__((weak));
+void TIM8_BRK_TIM12_IRQHandler(void) __attribute__((weak));
+void DMA2_Stream7_IRQHandler(void) __attribute__((weak));
+void EXTI0_IRQHandler(void) __attribute__((weak));
+void EXTI1_IRQHandler(void) __attribute__((weak));
+void EXTI2_IRQHandler(void) __attribute__((weak));
+void EXTI15_10_IRQHandler(void) __attribute__((weak));
+void TIM1_BRK_TIM9_IRQHandler(void) __attribute__((weak));
+void TIM1_UP_TIM10_IRQHandler(void) __attribute__((weak));
+void TIM2_IRQHandler(void) __attribute__((weak));
+void DMA1_Stream6_IRQHandler(void) __attribute__((weak));
+void DMA2_Stream6_IRQHandler(void) __attribute__((weak));
+void USART2_IRQHandler(void) __attribute__((weak));
+void USART6_IRQHandler(void) __attribute__((weak));
+
+typedef void (*hal_host_handler)(void);
+
+hal_host_handler const hal_host_handlers[HAL_HOST_NUM_IRQS] =
+{
+   TIM5_IRQHandler,
+   TIM1_TRG_COM_TIM11_IRQHandler,
+   TIM8_BRK_TIM12_IRQHandler,
+   DMA2_Stream7_IRQHandler,
+   EXTI0_IRQHandler,
+   EXTI1_IRQHandler,
+   EXTI2_IRQHandler,
+   EXTI15_10_IRQHandler,
+   TIM1_BRK_TIM9_IRQHandler,
+   TIM1_UP_TIM10_IRQHandler,
+   TIM2_IRQHandler,
+   DMA1_Stream6_IRQHandler,
+   DMA2_Stream6_IRQHandler,
+   USART2_IRQHandler,
+   USART6_IRQHandler
+};
+
+typedef struct {
+   uint8_t clk_div;              /* Core cycles per timer clock. */
+   uint8_t bits;
+   uint8_t irq;
+} hal_host_timer_hw_t;
+
+const hal_host_timer_hw_t hal_host_timer_hw[HAL_NUM_TIMERS] =
+{
+   {2, 32, HAL_HOST_IRQ_TIM5},
+   {1, 16, HAL_HOST_IRQ_TIM11},
+   {2, 16, HAL_HOST_IRQ_TIM12},
+   {1, 16, HAL_HOST_IRQ_TIM9},
+   {1, 16, HAL_HOST_IRQ_TIM10},
+   {2, 32, HAL_HOST_IRQ_TIM2}
+};
+
+/* EXTI interrupt for each pin's line. */
+const uint8_t hal_host_pin_irq[HAL_NUM_PINS] =
+{
+   HAL_HOST_NO_IRQ,              /* PD12 */
+   HAL_HOST_NO_IRQ,              /* PD13 */
+   HAL_HOST_NO_IRQ,              /* PD14 */
+   HAL_HOST_NO_IRQ,              /* PD15 */
+   HAL_HOST_IRQ_EXTI0,           /* PA0 */
+   HAL_HOST_IRQ_EXTI1,           /* PA1 */
+   HAL_HOST_IRQ_EXTI2,           /* PA2 */
+   HAL_HOST_IRQ_EXTI15_10,       /* PC13 */
+   HAL_HOST_IRQ_EXTI2,           /* PC2 */
+#ifdef TOS_100_DEV_BOARD
+   HAL_HOST_IRQ_EXTI1,           /* PC1 */
+#else
+   HAL_HOST_IRQ_EXTI0,           /* PC0 */
+#endif
+   HAL_HOST_IRQ_EXTI15_10,       /* PB12 */
+   HAL_HOST_NO_IRQ,              /* PD7 */
+   HAL_HOST_NO_IRQ               /* PC8 */
+};
+
+typedef struct {
+   uint8_t tx_irq;               /* TX DMA stream. */
+   uint8_t idle_irq;
+} hal_host_usart_hw_t;
+
+const hal_host_usart_hw_t hal_host_usart_hw[HAL_NUM_USARTS] =
+{
+   {HAL_HOST_IRQ_DMA2_STREAM7, HAL_HOST_NO_IRQ},
+   {HAL_HOST_IRQ_DMA1_STREAM6, HAL_HOST_IRQ_USART2},
+   {HAL_HOST_IRQ_DMA2_STREAM6, HAL_HOST_IRQ_USART6}
+};
+
+typedef struct {
+   uint8_t running;
+   uint8_t enabled;
+   uint8_t update;               /* Update interrupt flag. */
+   uint8_t update_ie;
+   uint8_t compare_flag;         /* Channel 1 compare interrupt flag. */
+   uint8_t compare_ie;
+   uint32_t prescaler;
+   uint32_t period;
+   uint32_t compare;
+   uint32_t count;               /* Counter at base. */
+   uint64_t base;                /* On a timer clock edge. */
+   uint64_t next_update;
+   uint64_t next_compare;
+} hal_host_timer_t;
+
+typedef struct {
+   uint8_t level;
+   uint8_t mode;
+   uint8_t driven;               /* Set from outside, pull ups don't apply. */
+   uint8_t edge;                 /* EXTI edges, 0 for none. */
+   uint8_t pending;
+} hal_host_pin_t;
+
+typedef struct {
+   uint8_t running;
+   uint32_t baud;
+   uint8_t *rx_buffer;
+   uint16_t rx_size;
+   uint16_t rx_head;
+   const uint8_t *tx_data;
+   uint16_t tx_length;
+   uint8_t tx_busy;
+   uint8_t tx_done;              /* DMA transfer complete flag. */
+   uint8_t tx_interrupt;
+   uint64_t tx_done_at;
+   uint8_t idle;                 /* Idle line flag. */
+   uint8_t idle_ie;
+   uint64_t idle_at;
+} hal_host_usart_t;
+
+typedef struct {
+   uint8_t running;
+   uint8_t window;
+   uint8_t reload;
+   uint8_t count;                /* Counter at base. */
+   uint64_t base;
+   uint32_t resets;
+} hal_host_watchdog_t;
+
+uint32_t SystemCoreClock = HAL_HOST_CORE_HZ;
+
+uint64_t hal_host_now = 0;
+uint8_t hal_host_masked = 0;
+uint8_t hal_host_in_handler = 0;
+
+hal_host_timer_t hal_host_timers[HAL_NUM_TIMERS];
+hal_host_pin_t hal_host_pins[HAL_NUM_PINS];
+hal_host_usart_t hal_host_usarts[HAL_NUM_USARTS];
+uint64_t hal_host_spi_busy_until[HAL_NUM_SPIS];
+hal_host_watchdog_t hal_host_wwdg;
+uint32_t hal_host_unique_id[HAL_UNIQUE_ID_WORDS];
+
+uint16_t hal_host_priority[HAL_HOST_NUM_IRQS];
+uint32_t hal_host_irq_counts[HAL_HOST_NUM_IRQS];
+
+hal_host_pin_watch hal_host_watch = NULL;
+hal_host_spi_device hal_host_device = NULL;
+hal_host_usart_sink hal_host_sink = NULL;
+
+/* Used Internally */
+void hal_host_advance_to(uint64_t target);
+uint64_t hal_host_next_event(void);
+void hal_host_fire_due(void);
+void hal_host_service(void);
+uint8_t hal_host_irq_asserted(uint8_t irq);
+void hal_host_set_priority(uint8_t irq, uint8_t priority, uint8_t subpriority);
+uint64_t hal_host_timer_tick(uint8_t timer);
+uint64_t hal_host_timer_mask(uint8_t timer);
+void hal_host_timer_sync(uint8_t timer);
+void hal_host_timer_schedule(uint8_t timer);
+void hal_host_pin_level(uint8_t pin, uint8_t level);
+uint64_t hal_host_watchdog_reset_at(void);
+void hal_host_watchdog_reset(void);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_reset(void)
+{
+   uint8_t ii;
+
+   hal_host_now = 0;
+   hal_host_masked = 0;
+   hal_host_in_handler = 0;
+
+   memset(hal_host_timers, 0, sizeof(hal_host_timers));
+   memset(hal_host_pins, 0, sizeof(hal_host_pins));
+   memset(hal_host_usarts, 0, sizeof(hal_host_usarts));
+   memset(hal_host_spi_busy_until, 0, sizeof(hal_host_spi_busy_until));
+   memset(&hal_host_wwdg, 0, sizeof(hal_host_wwdg));
+   memset(hal_host_irq_counts, 0, sizeof(hal_host_irq_counts));
+   memset(hal_host_unique_id, 0, sizeof(hal_host_unique_id));
+
+   for(ii=0; ii<HAL_NUM_TIMERS; ii++)
+   {
+      hal_host_timers[ii].next_update = HAL_HOST_NEVER;
+      hal_host_timers[ii].next_compare = HAL_HOST_NEVER;
+   }
+
+   for(ii=0; ii<HAL_NUM_USARTS; ii++)
+   {
+      hal_host_usarts[ii].idle_at = HAL_HOST_NEVER;
+   }
+
+   for(ii=0; ii<HAL_HOST_NUM_IRQS; ii++)
+   {
+      hal_host_priority[ii] = HAL_HOST_NO_PRIORITY;
+   }
+
+   hal_host_watch = NULL;
+   hal_host_device = NULL;
+   hal_host_sink = NULL;
+
+   SystemCoreClock = HAL_HOST_CORE_HZ;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint64_t hal_host_now_ns(void)
+{
+   return (hal_host_now * 1000) / (HAL_HOST_CORE_HZ / 1000000);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_run_until(uint64_t ns)
+{
+   hal_host_advance_to((ns * (HAL_HOST_CORE_HZ / 1000000)) / 1000);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_gpio_input(uint8_t pin, uint8_t level)
+{
+   hal_host_pin_t *p = &(hal_host_pins[pin]);
+
+   level = (level != 0);
+   p->driven = 1;
+   if(level == p->level)
+   {
+      return;
+   }
+
+   p->level = level;
+   if(((level)&&(p->edge & HAL_EXTI_RISING))||((!level)&&(p->edge & HAL_EXTI_FALLING)))
+   {
+      p->pending = 1;
+      hal_host_service();
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint16_t hal_host_usart_rx(uint8_t usart, const uint8_t *data, uint16_t length)
+{
+   hal_host_usart_t *u = &(hal_host_usarts[usart]);
+   uint16_t ii;
+
+   if(!u->running)
+   {
+      return 0;
+   }
+
+   for(ii=0; ii<length; ii++)
+   {
+      u->rx_buffer[u->rx_head] = data[ii];
+      u->rx_head++;
+      if(u->rx_head >= u->rx_size)
+      {
+         u->rx_head = 0;
+      }
+   }
+
+   /* 8N1 is 10 bits a byte. */
+   if(length > 0)
+   {
+      u->idle_at = hal_host_now + ((10 * (uint64_t)HAL_HOST_CORE_HZ) / u->baud);
+   }
+
+   return length;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_set_pin_watch(hal_host_pin_watch watch)
+{
+   hal_host_watch = watch;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_set_spi_device(hal_host_spi_device device)
+{
+   hal_host_device = device;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_set_usart_sink(hal_host_usart_sink sink)
+{
+   hal_host_sink = sink;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_host_set_unique_id(const uint32_t *words)
+{
+   memcpy(hal_host_unique_id, words, sizeof(hal_host_unique_id));
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t hal_host_irq_count(uint8_t irq)
+{
+   return hal_host_irq_counts[irq];
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t hal_host_watchdog_resets(void)
+{
+   return hal_host_wwdg.resets;
+}
+
+/* ************************************************************* */
+/* * Init Functions                                            * */
+/* ************************************************************* */
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_timer_init(uint8_t timer, uint16_t prescaler, uint32_t period, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_timer_t *t = &(hal_host_timers[timer]);
+
+   t->running = 1;
+   t->enabled = 1;
+   t->prescaler = prescaler;
+   t->period = period;
+   t->count = 0;
+   t->base = hal_host_now;
+   /* TIM_TimeBaseInit() sets UG to load the prescaler, which raises the
+    * update flag, so the first interrupt comes straight away.
+    */
+   t->update = 1;
+   t->update_ie = 1;
+   hal_host_timer_schedule(timer);
+
+   hal_host_set_priority(hal_host_timer_hw[timer].irq, priority, subpriority);
+   hal_host_service();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_timer_compare_init(uint8_t timer, uint16_t prescaler, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_timer_t *t = &(hal_host_timers[timer]);
+
+   t->running = 1;
+   t->enabled = 1;
+   t->prescaler = prescaler;
+   t->period = (uint32_t)hal_host_timer_mask(timer);
+   t->count = 0;
+   t->base = hal_host_now;
+   t->update = 1;
+   t->update_ie = 0;
+   t->compare = 0;
+   t->compare_flag = 0;
+   t->compare_ie = 1;
+   hal_host_timer_schedule(timer);
+
+   hal_host_set_priority(hal_host_timer_hw[timer].irq, priority, subpriority);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_gpio_init(uint8_t pin, uint8_t mode)
+{
+   hal_host_pin_t *p = &(hal_host_pins[pin]);
+
+   p->mode = mode;
+   if((mode == HAL_GPIO_INPUT_PULLUP)&&(!p->driven))
+   {
+      p->level = 1;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_exti_init(uint8_t pin, uint8_t edge, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_pins[pin].edge = edge;
+   hal_host_pins[pin].pending = 0;
+
+   if(hal_host_pin_irq[pin] != HAL_HOST_NO_IRQ)
+   {
+      hal_host_set_priority(hal_host_pin_irq[pin], priority, subpriority);
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_spi_init(uint8_t spi)
+{
+   hal_host_spi_busy_until[spi] = hal_host_now;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_usart_dma_init(uint8_t usart, uint32_t baud, uint8_t *rx_buffer, uint16_t rx_size, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_usart_t *u = &(hal_host_usarts[usart]);
+
+   memset(u, 0, sizeof(hal_host_usart_t));
+   u->running = 1;
+   u->baud = baud;
+   u->rx_buffer = rx_buffer;
+   u->rx_size = rx_size;
+   u->idle_at = HAL_HOST_NEVER;
+
+   hal_host_set_priority(hal_host_usart_hw[usart].tx_irq, priority, subpriority);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_usart_idle_init(uint8_t usart, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_usarts[usart].idle_ie = 1;
+   hal_host_set_priority(hal_host_usart_hw[usart].idle_irq, priority, subpriority);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_watchdog_init(uint8_t window, uint8_t count)
+{
+   hal_host_wwdg.running = 1;
+   hal_host_wwdg.window = window & 0x7F;
+   hal_host_wwdg.reload = count & 0x7F;
+   hal_host_wwdg.count = count & 0x7F;
+   hal_host_wwdg.base = hal_host_now;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_cycles_init(void)
+{
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_unique_id(uint32_t *words)
+{
+   memcpy(words, hal_host_unique_id, sizeof(hal_host_unique_id));
+}
+
+/* ************************************************************* */
+/* * Timers                                                    * */
+/* ************************************************************* */
+void hal_timer_set_period(uint8_t timer, uint32_t period)
+{
+   hal_host_timer_sync(timer);
+   hal_host_timers[timer].period = period;
+   hal_host_timer_schedule(timer);
+}
+
+void hal_timer_enable(uint8_t timer)
+{
+   hal_host_timer_t *t = &(hal_host_timers[timer]);
+
+   if(!t->enabled)
+   {
+      t->enabled = 1;
+      t->base = hal_host_now;
+      hal_host_timer_schedule(timer);
+   }
+}
+
+void hal_timer_disable(uint8_t timer)
+{
+   hal_host_timer_sync(timer);
+   hal_host_timers[timer].enabled = 0;
+   hal_host_timer_schedule(timer);
+}
+
+uint8_t hal_timer_update_pending(uint8_t timer)
+{
+   return hal_host_timers[timer].update;
+}
+
+void hal_timer_update_clear(uint8_t timer)
+{
+   hal_host_timers[timer].update = 0;
+}
+
+uint32_t hal_timer_update_cycles(uint8_t timer)
+{
+   hal_host_timer_sync(timer);
+
+   return (uint32_t)((hal_host_timers[timer].count * hal_host_timer_tick(timer)) + (hal_host_now - hal_host_timers[timer].base));
+}
+
+uint32_t hal_timer_count(uint8_t timer)
+{
+   hal_host_timer_sync(timer);
+
+   return hal_host_timers[timer].count;
+}
+
+void hal_timer_compare_set(uint8_t timer, uint32_t compare)
+{
+   hal_host_timer_sync(timer);
+   hal_host_timers[timer].compare = compare;
+   hal_host_timer_schedule(timer);
+}
+
+void hal_timer_compare_force(uint8_t timer)
+{
+   hal_host_timers[timer].compare_flag = 1;
+   hal_host_service();
+}
+
+uint8_t hal_timer_compare_pending(uint8_t timer)
+{
+   return hal_host_timers[timer].compare_flag;
+}
+
+void hal_timer_compare_clear(uint8_t timer)
+{
+   hal_host_timers[timer].compare_flag = 0;
+}
+
+/* ************************************************************* */
+/* * GPIO and EXTI                                             * */
+/* ************************************************************* */
+void hal_gpio_set(uint8_t pin)
+{
+   hal_host_pin_level(pin, 1);
+}
+
+void hal_gpio_clear(uint8_t pin)
+{
+   hal_host_pin_level(pin, 0);
+}
+
+uint8_t hal_gpio_read(uint8_t pin)
+{
+   return hal_host_pins[pin].level;
+}
+
+uint8_t hal_exti_pending(uint8_t pin)
+{
+   return hal_host_pins[pin].pending;
+}
+
+void hal_exti_clear(uint8_t pin)
+{
+   hal_host_pins[pin].pending = 0;
+}
+
+/* ************************************************************* */
+/* * SPI                                                       * */
+/* ************************************************************* */
+void hal_spi_write(uint8_t spi, uint8_t byte)
+{
+   hal_spi_transfer(spi, byte);
+}
+
+uint8_t hal_spi_transfer(uint8_t spi, uint8_t byte)
+{
+   uint8_t miso = 0xFF;
+
+   hal_spi_wait_idle(spi);
+   if(hal_host_device != NULL)
+   {
+      miso = hal_host_device(spi, byte);
+   }
+
+   hal_host_spi_busy_until[spi] = hal_host_now + HAL_HOST_SPI_BYTE_CYCLES;
+   hal_spi_wait_idle(spi);
+
+   return miso;
+}
+
+void hal_spi_wait_idle(uint8_t spi)
+{
+   hal_host_advance_to(hal_host_spi_busy_until[spi]);
+}
+
+/* ************************************************************* */
+/* * USART with DMA                                            * */
+/* ************************************************************* */
+uint16_t hal_usart_dma_rx_head(uint8_t usart)
+{
+   return hal_host_usarts[usart].rx_head;
+}
+
+void hal_usart_dma_tx_start(uint8_t usart, const uint8_t *data, uint16_t length)
+{
+   hal_host_usart_t *u = &(hal_host_usarts[usart]);
+
+   u->tx_data = data;
+   u->tx_length = length;
+   u->tx_done = 0;
+   u->tx_interrupt = 1;
+   u->tx_busy = 1;
+   /* 8N1 is 10 bits a byte. */
+   u->tx_done_at = hal_host_now + (((uint64_t)length * 10 * HAL_HOST_CORE_HZ) / u->baud);
+}
+
+uint8_t hal_usart_dma_tx_complete(uint8_t usart)
+{
+   return hal_host_usarts[usart].tx_done;
+}
+
+void hal_usart_dma_tx_stop(uint8_t usart)
+{
+   hal_host_usart_t *u = &(hal_host_usarts[usart]);
+
+   if(u->tx_busy)
+   {
+      hal_host_advance_to(u->tx_done_at);
+   }
+}
+
+void hal_usart_dma_tx_clear(uint8_t usart)
+{
+   hal_host_usarts[usart].tx_done = 0;
+}
+
+uint8_t hal_usart_idle_pending(uint8_t usart)
+{
+   return hal_host_usarts[usart].idle;
+}
+
+void hal_usart_idle_clear(uint8_t usart)
+{
+   hal_host_usarts[usart].idle = 0;
+}
+
+/* ************************************************************* */
+/* * Watchdog                                                  * */
+/* ************************************************************* */
+uint8_t hal_watchdog_count(void)
+{
+   uint64_t counts;
+
+   counts = (hal_host_now - hal_host_wwdg.base) / HAL_HOST_WWDG_CYCLES;
+   if(counts > hal_host_wwdg.count)
+   {
+      return 0;
+   }
+
+   return (uint8_t)(hal_host_wwdg.count - counts);
+}
+
+void hal_watchdog_refresh(uint8_t count)
+{
+   if(!hal_host_wwdg.running)
+   {
+      return;
+   }
+
+   /* Refreshing too early resets as well. */
+   if(hal_watchdog_count() > hal_host_wwdg.window)
+   {
+      hal_host_wwdg.resets++;
+   }
+
+   hal_host_wwdg.count = count & 0x7F;
+   hal_host_wwdg.base = hal_host_now;
+}
+
+/* ************************************************************* */
+/* * Core                                                      * */
+/* ************************************************************* */
+void hal_irq_disable(void)
+{
+   hal_host_masked = 1;
+}
+
+void hal_irq_enable(void)
+{
+   hal_host_masked = 0;
+   hal_host_service();
+}
+
+uint32_t hal_irq_save(void)
+{
+   uint32_t key = hal_host_masked;
+
+   hal_host_masked = 1;
+
+   return key;
+}
+
+void hal_irq_restore(uint32_t key)
+{
+   hal_host_masked = (uint8_t)key;
+   hal_host_service();
+}
+
+uint32_t hal_atomic_or(volatile uint32_t *word, uint32_t bits)
+{
+   uint32_t old = *word;
+
+   *word = old | bits;
+
+   return old;
+}
+
+uint32_t hal_atomic_take(volatile uint32_t *word)
+{
+   uint32_t old = *word;
+
+   *word = 0;
+
+   return old;
+}
+
+void hal_memory_barrier(void)
+{
+}
+
+void hal_wait_for_interrupt(void)
+{
+   uint64_t next;
+   uint8_t ii;
+
+   for(ii=0; ii<HAL_HOST_NUM_IRQS; ii++)
+   {
+      if(hal_host_irq_asserted(ii))
+      {
+         return;
+      }
+   }
+
+   /* With nothing scheduled the board would sleep forever, a millisecond
+    * gives the harness a chance to inject something.
+    */
+   next = hal_host_next_event();
+   if(next == HAL_HOST_NEVER)
+   {
+      next = hal_host_now + (HAL_HOST_CORE_HZ / 1000);
+   }
+
+   hal_host_advance_to(next);
+}
+
+uint32_t hal_cycles(void)
+{
+   return (uint32_t)hal_host_now;
+}
+
+uint32_t hal_sleep_cycles(void)
+{
+   return (uint32_t)hal_host_now;
+}
+
+uint32_t hal_millis(void)
+{
+   return (uint32_t)(hal_host_now / (HAL_HOST_CORE_HZ / 1000));
+}
+
+void hal_delay_ns(uint32_t ns)
+{
+   hal_host_advance_to(hal_host_now + ((((uint64_t)ns * (HAL_HOST_CORE_HZ / 1000000)) + 999) / 1000));
+}
+
+/* PRIVATE hal_host_advance_to
+ *
+ * Notes:
+ *  +Moves time to target a peripheral event at a time.  Interrupts only run
+ *   if they're unmasked and no handler is already running.
+ */
+void hal_host_advance_to(uint64_t target)
+{
+   uint64_t next;
+
+   next = hal_host_next_event();
+   while(next <= target)
+   {
+      if(next > hal_host_now)
+      {
+         hal_host_now = next;
+      }
+      hal_host_fire_due();
+      hal_host_service();
+      next = hal_host_next_event();
+   }
+
+   if(target > hal_host_now)
+   {
+      hal_host_now = target;
+   }
+   hal_host_service();
+}
+
+/* PRIVATE hal_host_next_event
+ *
+ * Notes:
+ *  +Soonest time any peripheral needs attention.
+ */
+uint64_t hal_host_next_event(void)
+{
+   uint64_t next = HAL_HOST_NEVER;
+   uint64_t at;
+   uint8_t ii;
+
+   for(ii=0; ii<HAL_NUM_TIMERS; ii++)
+   {
+      if(hal_host_timers[ii].next_update < next)
+      {
+         next = hal_host_timers[ii].next_update;
+      }
+      if(hal_host_timers[ii].next_compare < next)
+      {
+         next = hal_host_timers[ii].next_compare;
+      }
+   }
+
+   for(ii=0; ii<HAL_NUM_USARTS; ii++)
+   {
+      if((hal_host_usarts[ii].tx_busy)&&(hal_host_usarts[ii].tx_done_at < next))
+      {
+         next = hal_host_usarts[ii].tx_done_at;
+      }
+      if(hal_host_usarts[ii].idle_at < next)
+      {
+         next = hal_host_usarts[ii].idle_at;
+      }
+   }
+
+   at = hal_host_watchdog_reset_at();
+   if(at < next)
+   {
+      next = at;
+   }
+
+   return next;
+}
+
+/* PRIVATE hal_host_fire_due
+ *
+ * Notes:
+ *  +Updates every peripheral whose event time has come.
+ */
+void hal_host_fire_due(void)
+{
+   hal_host_timer_t *t;
+   hal_host_usart_t *u;
+   uint8_t ii;
+
+   for(ii=0; ii<HAL_NUM_TIMERS; ii++)
+   {
+      t = &(hal_host_timers[ii]);
+      if(t->next_update <= hal_host_now)
+      {
+         t->base = t->next_update;
+         t->count = 0;
+         t->update = 1;
+         hal_host_timer_schedule(ii);
+      }
+      if(t->next_compare <= hal_host_now)
+      {
+         t->compare_flag = 1;
+         hal_host_timer_sync(ii);
+         hal_host_timer_schedule(ii);
+      }
+   }
+
+   for(ii=0; ii<HAL_NUM_USARTS; ii++)
+   {
+      u = &(hal_host_usarts[ii]);
+      if((u->tx_busy)&&(u->tx_done_at <= hal_host_now))
+      {
+         u->tx_busy = 0;
+         u->tx_done = 1;
+         if(hal_host_sink != NULL)
+         {
+            hal_host_sink(ii, u->tx_data, u->tx_length, hal_host_now_ns());
+         }
+      }
+      if(u->idle_at <= hal_host_now)
+      {
+         u->idle = 1;
+         u->idle_at = HAL_HOST_NEVER;
+      }
+   }
+
+   if(hal_host_watchdog_reset_at() <= hal_host_now)
+   {
+      hal_host_watchdog_reset();
+   }
+}
+
+/* PRIVATE hal_host_service
+ *
+ * Notes:
+ *  +Runs pending interrupts, highest priority first, until none are left.
+ */
+void hal_host_service(void)
+{
+   uint64_t last_now = HAL_HOST_NEVER;
+   uint32_t runs = 0;
+   uint16_t best_priority;
+   uint8_t best;
+   uint8_t ii;
+
+   if((hal_host_masked)||(hal_host_in_handler))
+   {
+      return;
+   }
+
+   for(;;)
+   {
+      best = HAL_HOST_NO_IRQ;
+      best_priority = HAL_HOST_NO_PRIORITY;
+      for(ii=0; ii<HAL_HOST_NUM_IRQS; ii++)
+      {
+         if((hal_host_irq_asserted(ii))&&((best == HAL_HOST_NO_IRQ)||(hal_host_priority[ii] < best_priority)))
+         {
+            best = ii;
+            best_priority = hal_host_priority[ii];
+         }
+      }
+
+      if(best == HAL_HOST_NO_IRQ)
+      {
+         return;
+      }
+
+      if(hal_host_now == last_now)
+      {
+         runs++;
+         if(runs > HAL_HOST_RUNAWAY)
+         {
+            fprintf(stderr, "hal_host: interrupt %u never cleared\n", best);
+            abort();
+         }
+      }
+      else
+      {
+         last_now = hal_host_now;
+         runs = 0;
+      }
+
+      hal_host_irq_counts[best]++;
+      hal_host_in_handler = 1;
+      hal_host_handlers[best]();
+      hal_host_in_handler = 0;
+   }
+}
+
+/* PRIVATE hal_host_irq_asserted
+ *
+ * Notes:
+ *  +Whether a peripheral is requesting an interrupt that has a handler.
+ *   Interrupts that were never set up stay off, as if disabled in the NVIC.
+ */
+uint8_t hal_host_irq_asserted(uint8_t irq)
+{
+   hal_host_timer_t *t;
+   hal_host_usart_t *u;
+   uint8_t ii;
+
+   if((hal_host_handlers[irq] == NULL)||(hal_host_priority[irq] == HAL_HOST_NO_PRIORITY))
+   {
+      return 0;
+   }
+
+   for(ii=0; ii<HAL_NUM_TIMERS; ii++)
+   {
+      t = &(hal_host_timers[ii]);
+      if((hal_host_timer_hw[ii].irq == irq)&&(t->running)&&
+         (((t->update_ie)&&(t->update))||((t->compare_ie)&&(t->compare_flag))))
+      {
+         return 1;
+      }
+   }
+
+   for(ii=0; ii<HAL_NUM_PINS; ii++)
+   {
+      if((hal_host_pin_irq[ii] == irq)&&(hal_host_pins[ii].edge)&&(hal_host_pins[ii].pending))
+      {
+         return 1;
+      }
+   }
+
+   for(ii=0; ii<HAL_NUM_USARTS; ii++)
+   {
+      u = &(hal_host_usarts[ii]);
+      if((hal_host_usart_hw[ii].tx_irq == irq)&&(u->tx_interrupt)&&(u->tx_done))
+      {
+         return 1;
+      }
+      if((hal_host_usart_hw[ii].idle_irq == irq)&&(u->idle_ie)&&(u->idle))
+      {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/* PRIVATE hal_host_set_priority
+ *
+ * Notes:
+ *  +Lower runs first, like the NVIC.
+ */
+void hal_host_set_priority(uint8_t irq, uint8_t priority, uint8_t subpriority)
+{
+   hal_host_priority[irq] = ((uint16_t)(priority & 0x0F) << 4) | (subpriority & 0x0F);
+}
+
+/* PRIVATE hal_host_timer_tick
+ *
+ * Notes:
+ *  +Core cycles per counter tick.
+ */
+uint64_t hal_host_timer_tick(uint8_t timer)
+{
+   return (uint64_t)hal_host_timer_hw[timer].clk_div * (hal_host_timers[timer].prescaler + 1);
+}
+
+/* PRIVATE hal_host_timer_mask
+ *
+ * Notes:
+ *  +Largest count, the counter wraps after it.
+ */
+uint64_t hal_host_timer_mask(uint8_t timer)
+{
+   return (hal_host_timer_hw[timer].bits == 32) ? 0xFFFFFFFFULL : 0xFFFFULL;
+}
+
+/* PRIVATE hal_host_timer_sync
+ *
+ * Notes:
+ *  +Brings count and base up to now, before anything about the timer changes.
+ */
+void hal_host_timer_sync(uint8_t timer)
+{
+   hal_host_timer_t *t = &(hal_host_timers[timer]);
+   uint64_t ticks;
+   uint64_t mask;
+
+   if(!t->enabled)
+   {
+      return;
+   }
+
+   mask = hal_host_timer_mask(timer);
+   ticks = (hal_host_now - t->base) / hal_host_timer_tick(timer);
+   t->count = (uint32_t)((t->count + ticks) & mask);
+   t->base += ticks * hal_host_timer_tick(timer);
+}
+
+/* PRIVATE hal_host_timer_schedule
+ *
+ * Notes:
+ *  +Works out the next update from count and base.
+ *  +No preload, so a period written below the count doesn't update until the
+ *   counter has gone all the way round, same as the real timer.
+ *  +Compares only on timers that free run over their whole range
+ *   (hal_timer_compare_init()).  A compare equal to the count matches next
+ *   time round.
+ */
+void hal_host_timer_schedule(uint8_t timer)
+{
+   hal_host_timer_t *t = &(hal_host_timers[timer]);
+   uint64_t ticks;
+   uint64_t max;
+
+   if((!t->running)||(!t->enabled))
+   {
+      t->next_update = HAL_HOST_NEVER;
+      t->next_compare = HAL_HOST_NEVER;
+      return;
+   }
+
+   max = hal_host_timer_mask(timer);
+   if(t->compare_ie)
+   {
+      ticks = ((uint64_t)t->compare - t->count) & max;
+      if(ticks == 0)
+      {
+         ticks = max + 1;
+      }
+      t->next_compare = t->base + (ticks * hal_host_timer_tick(timer));
+   }
+   else
+   {
+      t->next_compare = HAL_HOST_NEVER;
+   }
+
+   if(t->count <= t->period)
+   {
+      ticks = (uint64_t)t->period - t->count + 1;
+   }
+   else
+   {
+      ticks = (max - t->count + 1) + (uint64_t)t->period + 1;
+   }
+
+   t->next_update = t->base + (ticks * hal_host_timer_tick(timer));
+}
+
+/* PRIVATE hal_host_pin_level
+ *
+ * Notes:
+ *  +Output pin change, passed on to the watch callback.
+ */
+void hal_host_pin_level(uint8_t pin, uint8_t level)
+{
+   if(hal_host_pins[pin].level != level)
+   {
+      hal_host_pins[pin].level = level;
+      if(hal_host_watch != NULL)
+      {
+         hal_host_watch(pin, level, hal_host_now_ns());
+      }
+   }
+}
+
+/* PRIVATE hal_host_watchdog_reset_at
+ *
+ * Notes:
+ *  +When the counter drops below 0x40.
+ */
+uint64_t hal_host_watchdog_reset_at(void)
+{
+   if((!hal_host_wwdg.running)||(hal_host_wwdg.count < 0x40))
+   {
+      return HAL_HOST_NEVER;
+   }
+
+   return hal_host_wwdg.base + ((uint64_t)(hal_host_wwdg.count - 0x3F) * HAL_HOST_WWDG_CYCLES);
+}
+
+/* PRIVATE hal_host_watchdog_reset
+ *
+ * Notes:
+ *  +Counts the reset and carries on from the starting count.
+ */
+void hal_host_watchdog_reset(void)
+{
+   hal_host_wwdg.resets++;
+   hal_host_wwdg.count = hal_host_wwdg.reload;
+   hal_host_wwdg.base = hal_host_now;
+}
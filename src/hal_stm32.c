@@ -0,0 +1,404 @@
+/**
+ * @file hal_stm32.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief STM32F4 init side of hal.h.
+ *
+ * Which peripheral, pin, clock and interrupt each hal.h name means on this
+ * board.  The per-call functions are inline in hal_stm32.h.
+ */
+
+#include "hal.h"
+
+typedef struct {
+   uint8_t apb;                  /* 1 or 2 */
+   uint32_t rcc;
+   uint8_t irq;
+} hal_stm32_timer_init_t;
+
+typedef struct {
+   uint32_t rcc;
+   uint8_t port_source;
+   uint8_t pin_source;
+   uint8_t irq;                  /* EXTI interrupt for the pin's line. */
+} hal_stm32_pin_init_t;
+
+typedef struct {
+   GPIO_TypeDef *port;
+   uint32_t rcc;
+   uint8_t pin_source;
+} hal_stm32_af_pin_t;
+
+typedef struct {
+   uint8_t apb;                  /* 1 or 2 */
+   uint32_t rcc;
+   uint32_t dma_rcc;
+   uint8_t af;
+   uint32_t dma_channel;
+   hal_stm32_af_pin_t tx;
+   hal_stm32_af_pin_t rx;
+   uint8_t tx_irq;               /* TX DMA stream interrupt. */
+   uint8_t irq;                  /* USART interrupt, idle line. */
+} hal_stm32_usart_init_t;
+
+const hal_stm32_timer_init_t hal_stm32_timer_inits[HAL_NUM_TIMERS] =
+{
+   {1, RCC_APB1Periph_TIM5, TIM5_IRQn},
+   {2, RCC_APB2Periph_TIM11, TIM1_TRG_COM_TIM11_IRQn},
+   {1, RCC_APB1Periph_TIM12, TIM8_BRK_TIM12_IRQn},
+   {2, RCC_APB2Periph_TIM9, TIM1_BRK_TIM9_IRQn},
+   {2, RCC_APB2Periph_TIM10, TIM1_UP_TIM10_IRQn},
+   {1, RCC_APB1Periph_TIM2, TIM2_IRQn}
+};
+
+const hal_stm32_pin_init_t hal_stm32_pin_inits[HAL_NUM_PINS] =
+{
+   {RCC_AHB1Periph_GPIOD, EXTI_PortSourceGPIOD, EXTI_PinSource12, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOD, EXTI_PortSourceGPIOD, EXTI_PinSource13, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOD, EXTI_PortSourceGPIOD, EXTI_PinSource14, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOD, EXTI_PortSourceGPIOD, EXTI_PinSource15, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOA, EXTI_PortSourceGPIOA, EXTI_PinSource0, EXTI0_IRQn},
+   {RCC_AHB1Periph_GPIOA, EXTI_PortSourceGPIOA, EXTI_PinSource1, EXTI1_IRQn},
+   {RCC_AHB1Periph_GPIOA, EXTI_PortSourceGPIOA, EXTI_PinSource2, EXTI2_IRQn},
+   {RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource13, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource2, EXTI2_IRQn},
+#ifdef TOS_100_DEV_BOARD
+   {RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource1, EXTI1_IRQn},
+#else
+   {RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource0, EXTI0_IRQn},
+#endif
+   {RCC_AHB1Periph_GPIOB, EXTI_PortSourceGPIOB, EXTI_PinSource12, EXTI15_10_IRQn},
+   {RCC_AHB1Periph_GPIOD, EXTI_PortSourceGPIOD, EXTI_PinSource7, EXTI9_5_IRQn},
+   {RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource8, EXTI9_5_IRQn}
+};
+
+/* The RS485 master sends on PA2 rather than PD5 to stay off the red LED. */
+const hal_stm32_usart_init_t hal_stm32_usart_inits[HAL_NUM_USARTS] =
+{
+   {2, RCC_APB2Periph_USART1, RCC_AHB1Periph_DMA2, GPIO_AF_USART1, DMA_Channel_4,
+    {GPIOB, RCC_AHB1Periph_GPIOB, GPIO_PinSource6}, {GPIOB, RCC_AHB1Periph_GPIOB, GPIO_PinSource7},
+    DMA2_Stream7_IRQn, USART1_IRQn},
+   {1, RCC_APB1Periph_USART2, RCC_AHB1Periph_DMA1, GPIO_AF_USART2, DMA_Channel_4,
+    {GPIOA, RCC_AHB1Periph_GPIOA, GPIO_PinSource2}, {GPIOD, RCC_AHB1Periph_GPIOD, GPIO_PinSource6},
+    DMA1_Stream6_IRQn, USART2_IRQn},
+   {2, RCC_APB2Periph_USART6, RCC_AHB1Periph_DMA2, GPIO_AF_USART6, DMA_Channel_5,
+    {GPIOC, RCC_AHB1Periph_GPIOC, GPIO_PinSource6}, {GPIOC, RCC_AHB1Periph_GPIOC, GPIO_PinSource7},
+    DMA2_Stream6_IRQn, USART6_IRQn}
+};
+
+uint16_t hal_stm32_usart_rx_size[HAL_NUM_USARTS];
+
+/* Used Internally */
+void hal_stm32_nvic_init(uint8_t irq, uint8_t priority, uint8_t subpriority);
+void hal_stm32_timer_clock(uint8_t timer);
+void hal_stm32_af_pin_init(const hal_stm32_af_pin_t *pin, uint8_t af);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_timer_init(uint8_t timer, uint16_t prescaler, uint32_t period, uint8_t priority, uint8_t subpriority)
+{
+   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
+
+   hal_stm32_timer_clock(timer);
+
+   TIM_TimeBaseStructure.TIM_Prescaler = prescaler;
+   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+   TIM_TimeBaseStructure.TIM_Period = period;
+   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+   TIM_TimeBaseInit(hal_stm32_timers[timer], &TIM_TimeBaseStructure);
+
+   hal_stm32_nvic_init(hal_stm32_timer_inits[timer].irq, priority, subpriority);
+
+   TIM_ITConfig(hal_stm32_timers[timer], TIM_IT_Update, ENABLE);
+   TIM_Cmd(hal_stm32_timers[timer], ENABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_timer_compare_init(uint8_t timer, uint16_t prescaler, uint8_t priority, uint8_t subpriority)
+{
+   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
+   TIM_OCInitTypeDef  TIM_OCInitStructure;
+
+   hal_stm32_timer_clock(timer);
+
+   TIM_TimeBaseStructure.TIM_Prescaler = prescaler;
+   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+   /* Only TIM2 and TIM5 are 32 bit. */
+   if((hal_stm32_timers[timer] == TIM2)||(hal_stm32_timers[timer] == TIM5))
+   {
+      TIM_TimeBaseStructure.TIM_Period = 0xFFFFFFFF;
+   }
+   else
+   {
+      TIM_TimeBaseStructure.TIM_Period = 0xFFFF;
+   }
+   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+   TIM_TimeBaseInit(hal_stm32_timers[timer], &TIM_TimeBaseStructure);
+
+   /* Compare only, no output. */
+   TIM_OCStructInit(&TIM_OCInitStructure);
+   TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+   TIM_OC1Init(hal_stm32_timers[timer], &TIM_OCInitStructure);
+   TIM_OC1PreloadConfig(hal_stm32_timers[timer], TIM_OCPreload_Disable);
+
+   hal_stm32_nvic_init(hal_stm32_timer_inits[timer].irq, priority, subpriority);
+
+   TIM_ClearITPendingBit(hal_stm32_timers[timer], TIM_IT_CC1);
+   TIM_ITConfig(hal_stm32_timers[timer], TIM_IT_CC1, ENABLE);
+   TIM_Cmd(hal_stm32_timers[timer], ENABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_gpio_init(uint8_t pin, uint8_t mode)
+{
+   GPIO_InitTypeDef GPIO_InitStructure;
+
+   RCC_AHB1PeriphClockCmd(hal_stm32_pin_inits[pin].rcc, ENABLE);
+
+   GPIO_InitStructure.GPIO_Pin = hal_stm32_pins[pin].pin;
+   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+   if(mode == HAL_GPIO_OUTPUT)
+   {
+      GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+      GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+   }
+   else
+   {
+      GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+      GPIO_InitStructure.GPIO_PuPd = (mode == HAL_GPIO_INPUT_PULLUP) ? GPIO_PuPd_UP : GPIO_PuPd_NOPULL;
+   }
+   GPIO_Init(hal_stm32_pins[pin].port, &GPIO_InitStructure);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_exti_init(uint8_t pin, uint8_t edge, uint8_t priority, uint8_t subpriority)
+{
+   EXTI_InitTypeDef EXTI_InitStructure;
+
+   RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+   SYSCFG_EXTILineConfig(hal_stm32_pin_inits[pin].port_source, hal_stm32_pin_inits[pin].pin_source);
+
+   EXTI_InitStructure.EXTI_Line = hal_stm32_pins[pin].pin;
+   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+   if(edge == HAL_EXTI_BOTH)
+   {
+      EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+   }
+   else if(edge == HAL_EXTI_RISING)
+   {
+      EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+   }
+   else
+   {
+      EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
+   }
+   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+   EXTI_Init(&EXTI_InitStructure);
+
+   hal_stm32_nvic_init(hal_stm32_pin_inits[pin].irq, priority, subpriority);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_spi_init(uint8_t spi)
+{
+   SPI_InitTypeDef  SPI_InitStructure;
+   GPIO_InitTypeDef GPIO_InitStructure;
+
+   /* Only the TMC260 so far.  Its internal oscillator is 15MHz and Trinamic
+    * want SCK under 0.9*15MHz/2, /256 is well clear of that.
+    */
+   RCC_APB2PeriphClockCmd(RCC_APB2Periph_SPI1, ENABLE);
+   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
+
+   GPIO_PinAFConfig(GPIOA, GPIO_PinSource5, GPIO_AF_SPI1);
+   GPIO_PinAFConfig(GPIOA, GPIO_PinSource6, GPIO_AF_SPI1);
+   GPIO_PinAFConfig(GPIOA, GPIO_PinSource7, GPIO_AF_SPI1);
+
+   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7;
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+   GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_DOWN;
+   GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+   SPI_I2S_DeInit(hal_stm32_spis[spi]);
+   SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
+   SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
+   SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
+   SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;
+   SPI_InitStructure.SPI_CPHA = SPI_CPHA_2Edge;
+   SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
+   SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_256;
+   SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
+   SPI_InitStructure.SPI_CRCPolynomial = 7;
+   SPI_Init(hal_stm32_spis[spi], &SPI_InitStructure);
+
+   SPI_Cmd(hal_stm32_spis[spi], ENABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_usart_dma_init(uint8_t usart, uint32_t baud, uint8_t *rx_buffer, uint16_t rx_size, uint8_t priority, uint8_t subpriority)
+{
+   USART_InitTypeDef USART_InitStructure;
+   DMA_InitTypeDef  DMA_InitStructure;
+   const hal_stm32_usart_t *u = &(hal_stm32_usarts[usart]);
+   const hal_stm32_usart_init_t *init = &(hal_stm32_usart_inits[usart]);
+
+   hal_stm32_usart_rx_size[usart] = rx_size;
+
+   RCC_AHB1PeriphClockCmd(init->dma_rcc, ENABLE);
+   if(init->apb == 1)
+   {
+      RCC_APB1PeriphClockCmd(init->rcc, ENABLE);
+   }
+   else
+   {
+      RCC_APB2PeriphClockCmd(init->rcc, ENABLE);
+   }
+
+   hal_stm32_af_pin_init(&(init->tx), init->af);
+   hal_stm32_af_pin_init(&(init->rx), init->af);
+
+   USART_InitStructure.USART_BaudRate = baud;
+   USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+   USART_InitStructure.USART_StopBits = USART_StopBits_1;
+   USART_InitStructure.USART_Parity = USART_Parity_No;
+   USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+   USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
+   USART_OverSampling8Cmd(u->usart, ENABLE);
+   USART_Init(u->usart, &USART_InitStructure);
+
+   /* TX, the address and length are filled in per packet. */
+   DMA_DeInit(u->tx_stream);
+   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
+   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)(&(u->usart->DR));
+   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+   DMA_InitStructure.DMA_BufferSize = 1;
+   DMA_InitStructure.DMA_Channel = init->dma_channel;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rx_buffer;
+   DMA_Init(u->tx_stream, &DMA_InitStructure);
+
+   /* RX, circular into rx_buffer. */
+   DMA_DeInit(u->rx_stream);
+   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rx_buffer;
+   DMA_InitStructure.DMA_BufferSize = rx_size;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
+   DMA_Init(u->rx_stream, &DMA_InitStructure);
+   USART_DMACmd(u->usart, USART_DMAReq_Rx, ENABLE);
+   DMA_Cmd(u->rx_stream, ENABLE);
+
+   USART_Cmd(u->usart, ENABLE);
+
+   /* TX complete tells the sender it can have the memory (or the bus) back.
+    * Enabled per packet by hal_usart_dma_tx_start().
+    */
+   hal_stm32_nvic_init(init->tx_irq, priority, subpriority);
+   DMA_ITConfig(u->tx_stream, DMA_IT_TC, DISABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_usart_idle_init(uint8_t usart, uint8_t priority, uint8_t subpriority)
+{
+   hal_stm32_nvic_init(hal_stm32_usart_inits[usart].irq, priority, subpriority);
+   USART_ITConfig(hal_stm32_usarts[usart].usart, USART_IT_IDLE, ENABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_watchdog_init(uint8_t window, uint8_t count)
+{
+   RCC_APB1PeriphClockCmd(RCC_APB1Periph_WWDG, ENABLE);
+
+   /* WWDG_Prescaler_1 will count at 20507.8125 Hz */
+   WWDG_SetPrescaler(WWDG_Prescaler_1);
+   WWDG_SetWindowValue(window);
+
+   /* Has to start above 0x40 or it resets straight away. */
+   WWDG_Enable(count);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_cycles_init(void)
+{
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void hal_unique_id(uint32_t *words)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<HAL_UNIQUE_ID_WORDS; ii++)
+   {
+      words[ii] = ((const uint32_t *)HAL_STM32_UNIQUE_ID_BASE)[ii];
+   }
+}
+
+/* PRIVATE hal_stm32_nvic_init
+ *
+ * Notes:
+ *  +Enables an interrupt at the given priority.
+ */
+void hal_stm32_nvic_init(uint8_t irq, uint8_t priority, uint8_t subpriority)
+{
+   NVIC_InitTypeDef NVIC_InitStructure;
+
+   NVIC_InitStructure.NVIC_IRQChannel = irq;
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = priority;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = subpriority;
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+}
+
+/* PRIVATE hal_stm32_timer_clock
+ *
+ * Notes:
+ *  +Turns on a timer's bus clock.
+ */
+void hal_stm32_timer_clock(uint8_t timer)
+{
+   const hal_stm32_timer_init_t *init = &(hal_stm32_timer_inits[timer]);
+
+   if(init->apb == 1)
+   {
+      RCC_APB1PeriphClockCmd(init->rcc, ENABLE);
+   }
+   else
+   {
+      RCC_APB2PeriphClockCmd(init->rcc, ENABLE);
+   }
+}
+
+/* PRIVATE hal_stm32_af_pin_init
+ *
+ * Notes:
+ *  +Hands a pin to a peripheral, push-pull with a pull up.
+ */
+void hal_stm32_af_pin_init(const hal_stm32_af_pin_t *pin, uint8_t af)
+{
+   GPIO_InitTypeDef  GPIO_InitStructure;
+
+   RCC_AHB1PeriphClockCmd(pin->rcc, ENABLE);
+   GPIO_PinAFConfig(pin->port, pin->pin_source, af);
+
+   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+   GPIO_InitStructure.GPIO_Pin = (uint16_t)(1 << pin->pin_source);
+   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+   GPIO_Init(pin->port, &GPIO_InitStructure);
+}
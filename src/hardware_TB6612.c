@@ -4,6 +4,13 @@
 uint8_t TB6612_initialized = 0;
 uint16_t TIM1_Period = 0;
 
+/* Where TB6612_set_duty_q15() puts the compare value, CCR1 itself or the
+ * word DMA copies into it.  Until the timer is set up that's somewhere
+ * harmless.
+ */
+volatile uint32_t TB6612_dma_ccr = 0;
+volatile uint32_t *TB6612_ccr = &TB6612_dma_ccr;
+
 void TB6612_initialize(void)
 {
 
@@ -65,8 +72,6 @@ void TB6612_set_duty(float duty)
     *        -1.0 = full CCW PWM
     *         1.0 = full CW PWM
     */
-   uint16_t ccr_val;
-
    if(duty > 1.0f)
    {
       duty = 1.0f;
@@ -76,10 +81,48 @@ void TB6612_set_duty(float duty)
       duty = -1.0f;
    }
 
-   duty = ((duty + 1.0f) / 2.0f);
-   ccr_val = (uint16_t)(duty*TIM1_Period + 0.5);
+   /* Single precision only, the rest is integer. */
+   TB6612_set_duty_q15((int16_t)(duty * (float)TB6612_DUTY_Q15_MAX));
+}
+
+void TB6612_set_duty_q15(int16_t duty)
+{
+   *TB6612_ccr = TB6612_duty_q15_to_ccr(duty, TIM1_Period);
+}
 
-   TIM1->CCR1 = ccr_val;
+void TB6612_enable_duty_dma(void)
+{
+   DMA_InitTypeDef DMA_InitStructure;
+
+   TB6612_dma_ccr = TIM1->CCR1;
+
+   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+
+   /* DMA2 Stream3 Channel6 is TIM1_CH1.  One word, over and over, on every
+    * compare match.  CCR1 is preloaded so it only lands at the next update.
+    */
+   DMA_DeInit(DMA2_Stream3);
+   DMA_InitStructure.DMA_Channel = DMA_Channel_6;
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&(TIM1->CCR1);
+   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)&TB6612_dma_ccr;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+   DMA_InitStructure.DMA_BufferSize = 1;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Disable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+   DMA_Init(DMA2_Stream3, &DMA_InitStructure);
+   DMA_Cmd(DMA2_Stream3, ENABLE);
+
+   TIM_DMACmd(TIM1, TIM_DMA_CC1, ENABLE);
+
+   TB6612_ccr = &TB6612_dma_ccr;
 }
 
 void TB6612_init_complimentary_pwm(void)
@@ -115,22 +158,26 @@ void TB6612_init_complimentary_pwm(void)
 
    /* Compute the value to be set in ARR register to generate signal frequency
       at 24.0 Khz... Assumes Prescaler of 0...and that the Period didn't roll.
-      Timer1 is a 16bit timer.... So 168000000/24000 = 7000...check!
+      Timer1 is a 16bit timer.... Counting up and down it's twice through
+      ARR a period, so 168000000/(2*24000) = 3500...check!
    */
-   TimerPeriod = (SystemCoreClock / 24000) - 1;
+   TimerPeriod = TB6612_PWM_PERIOD;
    TIM1_Period = TimerPeriod;
+   TB6612_ccr = (volatile uint32_t *)&(TIM1->CCR1);
 
    /* Compute CCR1 value to generate a duty cycle at 50% for channel 1 */
    Channel1Pulse = (uint16_t) (((uint32_t) 50 * (TimerPeriod - 1)) / 100);
 
    /* Time Base configuration */
    TIM_TimeBaseStructure.TIM_Prescaler = 0;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_CenterAligned1;
    TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+   /* Update at one end of the count only, once a period. */
+   TIM_TimeBaseStructure.TIM_RepetitionCounter = 1;
 
    TIM_TimeBaseInit(TIM1, &TIM_TimeBaseStructure);
+   TIM_ARRPreloadConfig(TIM1, ENABLE);
 
    /* Channel 1, 2 and 3 Configuration in PWM mode */
    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM2;
@@ -142,6 +189,7 @@ void TB6612_init_complimentary_pwm(void)
    TIM_OCInitStructure.TIM_OCIdleState = TIM_OCIdleState_Set;
    TIM_OCInitStructure.TIM_OCNIdleState = TIM_OCIdleState_Reset;
    TIM_OC1Init(TIM1, &TIM_OCInitStructure);
+   TIM_OC1PreloadConfig(TIM1, TIM_OCPreload_Enable);
 
    /* Automatic Output enable, Break, dead time and lock configuration*/
    TIM_BDTRInitStructure.TIM_OSSRState = TIM_OSSRState_Enable;
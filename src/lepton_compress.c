@@ -0,0 +1,359 @@
+/**
+ * @file lepton_compress.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Lossless Lepton VoSPI line codec.
+ *
+ * Raw Lepton lines are 80 pixels of 14 bits sent as 16 bit words, and
+ * neighbouring pixels are strongly correlated.  Predicting each pixel from
+ * its neighbours and Rice coding the residual typically shrinks a line to
+ * well under half of its 164 bytes, which leaves room on the shared USART
+ * for the tilt telemetry.  Everything is integer math on one line at a time
+ * so it fits between VoSPI reads on the M4 and builds unchanged on a PC.
+ */
+
+
+#include "lepton_compress.h"
+#include <stdlib.h>
+
+typedef struct {
+   uint8_t *buf;
+   uint16_t size;
+   uint16_t pos;
+   uint32_t acc;
+   uint8_t bits;
+   uint8_t overflow;
+} lepton_bit_writer_t;
+
+typedef struct {
+   const uint8_t *buf;
+   uint16_t size;
+   uint16_t pos;
+   uint32_t acc;
+   uint8_t bits;
+   uint8_t truncated;
+} lepton_bit_reader_t;
+
+/* Used Internally */
+uint16_t lepton_compress_pixel(const uint8_t *line, uint8_t ii);
+uint16_t lepton_compress_predict(uint8_t mode, const uint16_t *cur, const uint16_t *up, uint8_t ii);
+void lepton_compress_put_bits(lepton_bit_writer_t *bw, uint32_t value, uint8_t num_bits);
+void lepton_compress_flush_bits(lepton_bit_writer_t *bw);
+uint32_t lepton_compress_get_bits(lepton_bit_reader_t *br, uint8_t num_bits);
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t lepton_compress_line(const uint8_t *line, const uint8_t *prev, uint8_t *out, uint16_t out_max, uint16_t *out_len)
+{
+   uint16_t cur[LEPTON_LINE_PIXELS];
+   uint16_t up[LEPTON_LINE_PIXELS];
+   uint32_t sums[LEPTON_PRED_COUNT];
+   uint8_t num_modes;
+   uint8_t mode, best_mode;
+   uint8_t k;
+   uint8_t ii;
+   uint16_t residual;
+   uint16_t mapped;
+   uint16_t q;
+   lepton_bit_writer_t bw;
+
+   *out_len = 0;
+
+   if(out_max < LEPTON_COMPRESS_HEADER_BYTES)
+   {
+      return LEPTON_COMPRESS_ERROR_OVERFLOW;
+   }
+
+   for(ii=0; ii<LEPTON_LINE_PIXELS; ii++)
+   {
+      cur[ii] = lepton_compress_pixel(line, ii);
+      up[ii] = (prev != NULL) ? lepton_compress_pixel(prev, ii) : 0;
+   }
+
+   /* Without a previous line only the left neighbour is available. */
+   num_modes = (prev != NULL) ? LEPTON_PRED_COUNT : 1;
+
+   for(mode=0; mode<num_modes; mode++)
+   {
+      sums[mode] = 0;
+      for(ii=0; ii<LEPTON_LINE_PIXELS; ii++)
+      {
+         residual = cur[ii] - lepton_compress_predict(mode, cur, up, ii);
+         sums[mode] += ((int16_t)residual >= 0) ? (uint32_t)residual << 1 : ((uint32_t)(uint16_t)(-residual) << 1) - 1;
+      }
+   }
+
+   best_mode = 0;
+   for(mode=1; mode<num_modes; mode++)
+   {
+      if(sums[mode] < sums[best_mode])
+      {
+         best_mode = mode;
+      }
+   }
+
+   /* Rice parameter close to log2 of the mean mapped residual. */
+   k = 0;
+   while((k < LEPTON_COMPRESS_RICE_KMAX) && (((uint32_t)LEPTON_LINE_PIXELS << (k+1)) <= sums[best_mode]))
+   {
+      k++;
+   }
+
+   for(ii=0; ii<LEPTON_LINE_HEADER_BYTES; ii++)
+   {
+      out[ii] = line[ii];
+   }
+   out[LEPTON_COMPRESS_LOC_MODE] = (best_mode << 4) | k;
+
+   bw.buf = out;
+   bw.size = (out_max < LEPTON_LINE_BYTES) ? out_max : LEPTON_LINE_BYTES;
+   bw.pos = LEPTON_COMPRESS_HEADER_BYTES;
+   bw.acc = 0;
+   bw.bits = 0;
+   bw.overflow = 0;
+
+   for(ii=0; (ii<LEPTON_LINE_PIXELS) && (bw.overflow == 0); ii++)
+   {
+      residual = cur[ii] - lepton_compress_predict(best_mode, cur, up, ii);
+      mapped = ((int16_t)residual >= 0) ? (residual << 1) : (((uint16_t)(-residual) << 1) - 1);
+
+      q = mapped >> k;
+      if(q < LEPTON_COMPRESS_RICE_QMAX)
+      {
+         /* q zeros, a terminating one, then k remainder bits. */
+         lepton_compress_put_bits(&bw, 1, q+1);
+         lepton_compress_put_bits(&bw, mapped & ((1 << k) - 1), k);
+      }
+      else
+      {
+         /* Escape: QMAX zeros then the mapped residual verbatim. */
+         lepton_compress_put_bits(&bw, 0, LEPTON_COMPRESS_RICE_QMAX);
+         lepton_compress_put_bits(&bw, mapped, 16);
+      }
+   }
+   lepton_compress_flush_bits(&bw);
+
+   if(bw.overflow)
+   {
+      /* Only report a true overflow if the caller gave us room for a raw line. */
+      return (out_max < LEPTON_LINE_BYTES) ? LEPTON_COMPRESS_ERROR_OVERFLOW : LEPTON_COMPRESS_ERROR_NO_GAIN;
+   }
+
+   if(bw.pos >= LEPTON_LINE_BYTES)
+   {
+      return LEPTON_COMPRESS_ERROR_NO_GAIN;
+   }
+
+   *out_len = bw.pos;
+
+   return LEPTON_COMPRESS_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t lepton_decompress_line(const uint8_t *in, uint16_t in_len, const uint8_t *prev, uint8_t *line)
+{
+   uint16_t cur[LEPTON_LINE_PIXELS];
+   uint16_t up[LEPTON_LINE_PIXELS];
+   uint8_t mode;
+   uint8_t k;
+   uint8_t ii;
+   uint16_t q;
+   uint16_t mapped;
+   uint16_t residual;
+   lepton_bit_reader_t br;
+
+   if(in_len < LEPTON_COMPRESS_HEADER_BYTES)
+   {
+      return LEPTON_COMPRESS_ERROR_TRUNCATED;
+   }
+
+   mode = in[LEPTON_COMPRESS_LOC_MODE] >> 4;
+   k = in[LEPTON_COMPRESS_LOC_MODE] & 0x0F;
+
+   if(mode >= LEPTON_PRED_COUNT)
+   {
+      return LEPTON_COMPRESS_ERROR_MODE;
+   }
+
+   if((mode != LEPTON_PRED_LEFT) && (prev == NULL))
+   {
+      return LEPTON_COMPRESS_ERROR_NO_PREV;
+   }
+
+   for(ii=0; ii<LEPTON_LINE_PIXELS; ii++)
+   {
+      up[ii] = (prev != NULL) ? lepton_compress_pixel(prev, ii) : 0;
+   }
+
+   br.buf = in;
+   br.size = in_len;
+   br.pos = LEPTON_COMPRESS_HEADER_BYTES;
+   br.acc = 0;
+   br.bits = 0;
+   br.truncated = 0;
+
+   for(ii=0; ii<LEPTON_LINE_PIXELS; ii++)
+   {
+      q = 0;
+      while((q < LEPTON_COMPRESS_RICE_QMAX) && (lepton_compress_get_bits(&br, 1) == 0) && (br.truncated == 0))
+      {
+         q++;
+      }
+
+      if(q < LEPTON_COMPRESS_RICE_QMAX)
+      {
+         mapped = (q << k) | lepton_compress_get_bits(&br, k);
+      }
+      else
+      {
+         mapped = lepton_compress_get_bits(&br, 16);
+      }
+
+      if(br.truncated)
+      {
+         return LEPTON_COMPRESS_ERROR_TRUNCATED;
+      }
+
+      residual = (mapped & 0x01) ? (uint16_t)(-(int32_t)((mapped + 1) >> 1)) : (mapped >> 1);
+      cur[ii] = lepton_compress_predict(mode, cur, up, ii) + residual;
+   }
+
+   for(ii=0; ii<LEPTON_LINE_HEADER_BYTES; ii++)
+   {
+      line[ii] = in[ii];
+   }
+   for(ii=0; ii<LEPTON_LINE_PIXELS; ii++)
+   {
+      line[LEPTON_LINE_HEADER_BYTES + 2*ii] = (cur[ii] >> 8) & 0xFF;
+      line[LEPTON_LINE_HEADER_BYTES + 2*ii + 1] = cur[ii] & 0xFF;
+   }
+
+   return LEPTON_COMPRESS_SUCCESS;
+}
+
+/* PRIVATE lepton_compress_pixel
+ *
+ * Notes:
+ *  +VoSPI pixels are big endian after the 4 byte ID/CRC header.
+ */
+uint16_t lepton_compress_pixel(const uint8_t *line, uint8_t ii)
+{
+   return ((uint16_t)line[LEPTON_LINE_HEADER_BYTES + 2*ii] << 8) | line[LEPTON_LINE_HEADER_BYTES + 2*ii + 1];
+}
+
+/* PRIVATE lepton_compress_predict
+ *
+ * Notes:
+ *  +The first pixel of a line has no left neighbour so it falls back to the
+ *   pixel above, which is 0 when there is no previous line.
+ *  +Only pixels before ii in cur are read so the decoder can use this as it
+ *   rebuilds the line.
+ */
+uint16_t lepton_compress_predict(uint8_t mode, const uint16_t *cur, const uint16_t *up, uint8_t ii)
+{
+   uint16_t a, b, c;
+
+   b = up[ii];
+   if(ii == 0)
+   {
+      return b;
+   }
+   a = cur[ii-1];
+   c = up[ii-1];
+
+   switch(mode)
+   {
+      case LEPTON_PRED_UP:
+         return b;
+      case LEPTON_PRED_AVG:
+         return (uint16_t)(((uint32_t)a + b) >> 1);
+      case LEPTON_PRED_MED:
+         if(c >= ((a > b) ? a : b))
+         {
+            return (a < b) ? a : b;
+         }
+         else if(c <= ((a < b) ? a : b))
+         {
+            return (a > b) ? a : b;
+         }
+         return a + b - c;
+      case LEPTON_PRED_LEFT:
+      default:
+         return a;
+   }
+}
+
+/* PRIVATE lepton_compress_put_bits
+ *
+ * Notes:
+ *  +num_bits must be 16 or less so the 32 bit accumulator never overflows.
+ */
+void lepton_compress_put_bits(lepton_bit_writer_t *bw, uint32_t value, uint8_t num_bits)
+{
+   if(num_bits == 0)
+   {
+      return;
+   }
+
+   bw->acc = (bw->acc << num_bits) | (value & ((1UL << num_bits) - 1));
+   bw->bits += num_bits;
+
+   while(bw->bits >= 8)
+   {
+      bw->bits -= 8;
+      if(bw->pos < bw->size)
+      {
+         bw->buf[bw->pos++] = (uint8_t)(bw->acc >> bw->bits);
+      }
+      else
+      {
+         bw->overflow = 1;
+      }
+   }
+}
+
+/* PRIVATE lepton_compress_flush_bits
+ *
+ * Notes:
+ *  +Pads the last partial byte with zeros.
+ */
+void lepton_compress_flush_bits(lepton_bit_writer_t *bw)
+{
+   if(bw->bits > 0)
+   {
+      lepton_compress_put_bits(bw, 0, 8 - bw->bits);
+   }
+}
+
+/* PRIVATE lepton_compress_get_bits
+ *
+ * Notes:
+ *  +Sets truncated and returns zeros once the input runs out.
+ */
+uint32_t lepton_compress_get_bits(lepton_bit_reader_t *br, uint8_t num_bits)
+{
+   uint32_t value;
+
+   if(num_bits == 0)
+   {
+      return 0;
+   }
+
+   while(br->bits < num_bits)
+   {
+      if(br->pos < br->size)
+      {
+         br->acc = (br->acc << 8) | br->buf[br->pos++];
+      }
+      else
+      {
+         br->acc = br->acc << 8;
+         br->truncated = 1;
+      }
+      br->bits += 8;
+   }
+
+   br->bits -= num_bits;
+   value = (br->acc >> br->bits) & ((1UL << num_bits) - 1);
+
+   return value;
+}
@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include "hardware_STM32F407G_DISC1.h"
 #include "lepton_functions.h"
+#include "lepton_compress.h"
 #include "systick.h"
 #include "debug.h"
 
@@ -17,6 +18,9 @@
 
 #define VOSPI_ALL_IMAGE_FRAME_BYTES (VOSPI_NUM_FRAMES_IN_IMAGE*VOSPI_FRAME_SIZE)
 
+/* Set to 0 to send every line raw with create_thermal_lepton_frame(). */
+#define VOSPI_COMPRESS_LINES (1)
+
 
 /** @todo This function should use the new circular_buffer.c code that has
  *  been added and debugged when I get time.
@@ -42,7 +46,7 @@ int print_image_binary_j;
 uint8_t lepton_phase_offset = 0;
 uint8_t lepton_image_timeout = 0;
 
-extern uint32_t ms_counter;
+extern volatile uint32_t ms_counter;
 
 void lepton_print_image_binary_background(void)
 {
@@ -116,6 +120,9 @@ void lepton_transfer(void)
 
    GenericPacket thermal_packet;
 
+   uint8_t compressed_line[VOSPI_FRAME_SIZE];
+   uint16_t compressed_len;
+
    static uint16_t image_num = 0;
 
    /* GPIO_SetBits(GPIOD, LED_PIN_ORANGE); */
@@ -173,7 +180,25 @@ void lepton_transfer(void)
       for(ii=0; ii<VOSPI_NUM_FRAMES_IN_IMAGE; ii++)
       {
          vospi_ptr = get_next_vospi_ptr();
-         retval =  create_thermal_lepton_frame(vospi_ptr, &(frame[ii]));
+
+         /* Lines that don't shrink (noise, telemetry) still go out raw.  The
+          * previous line is the raw one so the host can always rebuild it
+          * from what it has already decoded. */
+         retval = LEPTON_COMPRESS_ERROR_NO_GAIN;
+         if(VOSPI_COMPRESS_LINES)
+         {
+            retval = lepton_compress_line(frame[ii].data, (ii > 0) ? frame[ii-1].data : NULL,
+                                          compressed_line, VOSPI_FRAME_SIZE, &compressed_len);
+         }
+
+         if(retval == LEPTON_COMPRESS_SUCCESS)
+         {
+            retval = create_thermal_lepton_compressed_line(vospi_ptr, compressed_line, compressed_len);
+         }
+         else
+         {
+            retval = create_thermal_lepton_frame(vospi_ptr, &(frame[ii]));
+         }
          increment_vospi_head();
          write_vospi();
       }
@@ -19,6 +19,7 @@
 #include "pushbutton.h"
 #include "debug.h"
 #include "analog_input.h"
+#include "analog_telemetry.h"
 
 /** @todo All references to the hardware_STM32F407G_DISC1.h header should go
  *  away soon.
@@ -38,8 +39,17 @@
 #include "gp_proj_motor.h"
 #include "gp_proj_analog.h"
 #include "gp_proj_universal.h"
+#include "gp_proj_local.h"
 
 #include "rs485_sensor_bus.h"
+#include "flash_kv.h"
+#include "event_scheduler.h"
+#include "profile.h"
+#include "trace.h"
+#include "sw_timer.h"
+#include "stack_monitor.h"
+#include "watchdog.h"
+#include "crash_dump.h"
 
 
 /* Private typedef -----------------------------------------------------------*/
@@ -61,7 +71,33 @@ extern volatile uint8_t tilt_stepper_motor_send_angle;
 volatile uint8_t cts_pos_packet = 1;
 #define POS_PACKET_CALLBACK_NUM 0x04
 
+GenericPacket gp_pos_rad;
+
+/* One window and one alert packet per channel can be queued at a time, the
+ * callback numbers are the base plus the channel.
+ */
+#define ANALOG_WINDOW_CALLBACK_NUM 0x10
+#define ANALOG_ALERT_CALLBACK_NUM  0x20
+GenericPacket gp_analog_window[ANALOG_INPUT_NUM_CHANNELS];
+GenericPacket gp_analog_alert[ANALOG_INPUT_NUM_CHANNELS];
+volatile uint8_t cts_analog_window[ANALOG_INPUT_NUM_CHANNELS];
+volatile uint8_t cts_analog_alert[ANALOG_INPUT_NUM_CHANNELS];
+
+/* Battery brown out alert, a sag of 1/8 below where the first window found
+ * it unless FLASH_KV_KEY_BATTERY_ALERT says otherwise.
+ */
+#define BATTERY_CHANNEL ANALOG_INPUT_VC15
+uint8_t main_battery_alert_set = 0;
+
+#define HEARTBEAT_PERIOD_US 50000
+sw_timer_t main_heartbeat_timer;
+
 void main_packet_send_callback(uint32_t packet_num);
+void main_send_tilt_angle(void);
+void main_heartbeat(uint32_t data);
+void main_send_analog_window(void);
+void main_send_analog_alert(void);
+void main_battery_alert_init(void);
 FDUD_TxQueueCallback gpcbs_main_queue_callback = &main_packet_send_callback;
 
 
@@ -70,8 +106,139 @@ void main_packet_send_callback(uint32_t packet_num)
    if(packet_num == POS_PACKET_CALLBACK_NUM)
    {
       cts_pos_packet = 1;
+
+      /* A sync pulse may have come in while the last angle was going out. */
+      if(tilt_stepper_motor_send_angle)
+      {
+         event_post(EVENT_TILT_SYNC);
+      }
+   }
+   else if((packet_num >= ANALOG_WINDOW_CALLBACK_NUM)&&(packet_num < (ANALOG_WINDOW_CALLBACK_NUM + ANALOG_INPUT_NUM_CHANNELS)))
+   {
+      cts_analog_window[packet_num - ANALOG_WINDOW_CALLBACK_NUM] = 1;
+   }
+   else if((packet_num >= ANALOG_ALERT_CALLBACK_NUM)&&(packet_num < (ANALOG_ALERT_CALLBACK_NUM + ANALOG_INPUT_NUM_CHANNELS)))
+   {
+      cts_analog_alert[packet_num - ANALOG_ALERT_CALLBACK_NUM] = 1;
+
+      /* An alert may have changed while the last one was going out. */
+      event_post(EVENT_ANALOG_ALERT);
+   }
+
+}
+
+
+/* main_send_tilt_angle
+ *
+ * Notes:
+ *  +EVENT_TILT_SYNC handler, sends the angle latched at the Hokuyo sync.
+ *  +If the previous angle packet is still queued this waits for
+ *   main_packet_send_callback() to post the event again.
+ */
+void main_send_tilt_angle(void)
+{
+   float pos_rad;
+   uint32_t pos_ts;
+
+   if((tilt_stepper_motor_send_angle)&&(cts_pos_packet))
+   {
+      tilt_stepper_motor_pos(&pos_rad, &pos_ts);
+      /* create_motor_resp_position(&gp_pos_rad, pos_rad); */
+      create_motor_resp_position_ts(&gp_pos_rad, pos_rad, pos_ts);
+      cts_pos_packet = 0;
+      full_duplex_usart_dma_add_to_queue(&gp_pos_rad, gpcbs_main_queue_callback, POS_PACKET_CALLBACK_NUM);
+      tilt_stepper_motor_send_angle = 0;
+   }
+}
+
+/* main_send_analog_window
+ *
+ * Notes:
+ *  +EVENT_ANALOG_WINDOW handler, one packet per channel with the window that
+ *   just completed.
+ *  +A channel whose last window packet is still queued skips this one, the
+ *   gap shows up in the window numbers.
+ */
+void main_send_analog_window(void)
+{
+   analog_telemetry_window_t window;
+   uint8_t ch;
+
+   main_battery_alert_init();
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      if((cts_analog_window[ch])&&(analog_telemetry_window(ch, &window) == ANALOG_TELEMETRY_SUCCESS))
+      {
+         create_analog_window(&(gp_analog_window[ch]), ch, window.number, window.min, window.max, window.mean, window.rms, window.alert);
+         cts_analog_window[ch] = 0;
+         full_duplex_usart_dma_add_to_queue(&(gp_analog_window[ch]), gpcbs_main_queue_callback, ANALOG_WINDOW_CALLBACK_NUM + ch);
+      }
+   }
+}
+
+/* main_send_analog_alert
+ *
+ * Notes:
+ *  +EVENT_ANALOG_ALERT handler, sends each channel's alert change as soon as
+ *   the DMA interrupt sees it.
+ *  +If the previous alert packet is still queued the change is left in
+ *   analog_telemetry and main_packet_send_callback() posts the event again.
+ */
+void main_send_analog_alert(void)
+{
+   analog_telemetry_alert_t alert;
+   uint8_t ch;
+
+   for(ch=0; ch<ANALOG_INPUT_NUM_CHANNELS; ch++)
+   {
+      if((cts_analog_alert[ch])&&(analog_telemetry_alert(ch, &alert) == ANALOG_TELEMETRY_SUCCESS))
+      {
+         create_analog_alert(&(gp_analog_alert[ch]), ch, alert.state, alert.previous, alert.value, alert.blocks, alert.count);
+         cts_analog_alert[ch] = 0;
+         full_duplex_usart_dma_add_to_queue(&(gp_analog_alert[ch]), gpcbs_main_queue_callback, ANALOG_ALERT_CALLBACK_NUM + ch);
+      }
+   }
+}
+
+/* main_battery_alert_init
+ *
+ * Notes:
+ *  +Sets the battery thresholds once, from FLASH_KV_KEY_BATTERY_ALERT (high
+ *   threshold in the top half word, low in the bottom) if it's there.
+ *  +Otherwise waits for the first window and alerts on a sag of 1/8 below its
+ *   mean, there's no fixed voltage that suits every battery and divider.
+ */
+void main_battery_alert_init(void)
+{
+   analog_telemetry_window_t window;
+   uint32_t stored;
+
+   if(main_battery_alert_set)
+   {
+      return;
    }
 
+   if(flash_kv_read(FLASH_KV_KEY_BATTERY_ALERT, &stored) == FLASH_KV_SUCCESS)
+   {
+      analog_telemetry_set_alert(BATTERY_CHANNEL, (uint16_t)(stored & 0xFFFF), (uint16_t)(stored >> 16));
+      main_battery_alert_set = 1;
+   }
+   else if(analog_telemetry_window(BATTERY_CHANNEL, &window) == ANALOG_TELEMETRY_SUCCESS)
+   {
+      analog_telemetry_set_alert(BATTERY_CHANNEL, window.mean - (window.mean >> 3), 0xFFFF);
+      main_battery_alert_set = 1;
+   }
+}
+
+/* main_heartbeat
+ *
+ * Notes:
+ *  +Software timer callback, blinks the green LED so we know we're alive.
+ */
+void main_heartbeat(uint32_t data)
+{
+   debug_output_toggle(DEBUG_LED_GREEN);
 }
 
 /**
@@ -94,15 +261,43 @@ int main(void)
 
 
    float vc14, vc15;
-   GenericPacket gp_porrst, gp_sftrst, gp_pinrst, gp_wwdgrst;
-   GenericPacket gp_pos_rad;
+   GenericPacket gp_porrst, gp_sftrst, gp_pinrst, gp_wwdgrst, gp_wwdg_reason;
+   watchdog_reason_t wwdg_reason;
 
    uint32_t pos_count, pos_ts;
    float pos_rad, prev_pos_rad;
+   uint8_t ii;
 
    /* SystemCoreClockUpdate(); */
 
+   /* Before anything else runs on the stack below main(). */
+   stack_monitor_init();
+
    debug_init();
+
+   /* Faults get their own handlers instead of all escalating to HardFault. */
+   crash_dump_init();
+
+   /* Settings in flash.  This may erase a sector, so it goes before anything
+    * time critical (or the watchdog) is running.
+    */
+   flash_kv_init();
+
+   /* Cycle counter for the PROFILE_* hooks, before any of them can run. */
+   profile_init();
+   trace_init();
+
+   /* Everything below may post events, so the table has to be ready first.
+    * The RS485 events only fire once their bus is initialized.
+    */
+   event_init();
+   event_register(EVENT_FDUD_RX, &full_duplex_usart_dma_spin);
+   event_register(EVENT_FDUD_TX, &full_duplex_usart_dma_spin);
+   event_register(EVENT_TILT_SYNC, &main_send_tilt_angle);
+   event_register(EVENT_RS485_MASTER, &rs485_master_spin);
+   event_register(EVENT_RS485_SLAVE, &rs485_slave_spin);
+   event_register(EVENT_ANALOG_ALERT, &main_send_analog_alert);
+   event_register(EVENT_ANALOG_WINDOW, &main_send_analog_window);
    /* init_usart_one(); */
    /* init_usart_one_dma(); */
 
@@ -112,6 +307,9 @@ int main(void)
    rx_packet_handler_init();
    full_duplex_usart_dma_init(rx_packet_handler_ptr);
 
+   /* Trace records go out over USART1 whenever the loop is otherwise idle. */
+   event_set_idle(&trace_drain);
+
    /* init_usart_three(); */
    /* pushbutton_init(); */
 
@@ -120,6 +318,19 @@ int main(void)
 
    systick_init();
 
+   sw_timer_init();
+   sw_timer_start(&main_heartbeat_timer, HEARTBEAT_PERIOD_US, HEARTBEAT_PERIOD_US, &main_heartbeat, 0);
+
+   /* Windows and alerts are fed from the analog input DMA interrupt, so
+    * they're ready before it starts.
+    */
+   for(ii=0; ii<ANALOG_INPUT_NUM_CHANNELS; ii++)
+   {
+      cts_analog_window[ii] = 1;
+      cts_analog_alert[ii] = 1;
+   }
+   analog_telemetry_init();
+   main_battery_alert_init();
    analog_input_init();
 
    /* Cannot RS485 and Tilt!!!! Pin A2 */
@@ -128,7 +339,11 @@ int main(void)
 
    tilt_stepper_motor_init();
 
-   /* Cannot RS485 and Tilt!!!! Pin A2 */
+   /* Cannot RS485 and Tilt!!!! Pin A2.  The TB6612 also drives PA1/PA2,
+    * the TMC260's DIR and STEP, so the brushed tilt motor stays off on this
+    * board and MOTOR_SET_PID/MOTOR_AUTOTUNE are answered with a
+    * RX_PACKET_HANDLER_NAK.
+    */
    /* tilt_motor_init(); */
 
 
@@ -139,11 +354,31 @@ int main(void)
 
 
 
-   /* Check why we came out of reset? */
+   /* Check why we came out of reset?  The record is taken either way, so
+    * one left by a reset that never happened isn't reported later.
+    */
+   if(watchdog_last_reason(&wwdg_reason) != WATCHDOG_SUCCESS)
+   {
+      wwdg_reason.magic = 0;
+   }
+
+   /* A fault resets through NVIC_SystemReset(), so its dump goes out ahead
+    * of the 0x2222 software reset packet.
+    */
+   crash_dump_report();
+
    if(RCC_GetFlagStatus(RCC_FLAG_WWDGRST) == SET)
    {
       create_universal_timestamp(&gp_wwdgrst, 0x1111);
       full_duplex_usart_dma_add_to_queue(&gp_wwdgrst, NULL, 0);
+
+      /* Which heartbeat stopped refreshing it, if it was one of them. */
+      if(wwdg_reason.magic == WATCHDOG_REASON_MAGIC)
+      {
+         create_universal_watchdog(&gp_wwdg_reason, (uint8_t)wwdg_reason.task, wwdg_reason.deadline_ms,
+                                   wwdg_reason.silent_ms, wwdg_reason.uptime_ms);
+         full_duplex_usart_dma_add_to_queue(&gp_wwdg_reason, NULL, 0);
+      }
    }
 
    if(RCC_GetFlagStatus(RCC_FLAG_SFTRST) == SET)
@@ -169,6 +404,11 @@ int main(void)
    /* Now clear all of the RCC flags.  Otherwise, they will continue to be set. */
    RCC_ClearFlag();
 
+   /* Every pass through the loop is a beat, it wakes at least as often as
+    * the heartbeat timer.
+    */
+   watchdog_register(WATCHDOG_TASK_MAIN, WATCHDOG_MAIN_DEADLINE_MS);
+
    while(1)
    {
 
@@ -190,29 +430,12 @@ int main(void)
 
 
 
-      /* rs485_master_spin(); */
-      /* rs485_slave_spin(); */
-      full_duplex_usart_dma_spin();
-
-      debug_output_toggle(DEBUG_LED_GREEN);
-
-
-      if(tilt_stepper_motor_send_angle)
-      {
-         if(cts_pos_packet)
-         {
-            tilt_stepper_motor_pos(&pos_rad, &pos_ts);
-            /* create_motor_resp_position(&gp_pos_rad, pos_rad); */
-            create_motor_resp_position_ts(&gp_pos_rad, pos_rad, pos_ts);
-            /**
-             * @todo Need to set up the callback function so that we don't
-             *       overwrite this packet with the next one.
-             */
-            cts_pos_packet = 0;
-            full_duplex_usart_dma_add_to_queue(&gp_pos_rad, gpcbs_main_queue_callback, POS_PACKET_CALLBACK_NUM);
-            tilt_stepper_motor_send_angle = 0;
-         }
-      }
+      /* USART1, RS485 and the tilt angle all run from their events now.
+       * This sleeps until an interrupt posts something.  The green LED is
+       * left to the heartbeat timer.
+       */
+      event_dispatch();
+      watchdog_heartbeat(WATCHDOG_TASK_MAIN);
 
       /* tilt_motor_get_angle(&pos_rad); */
       /* if(fabs(pos_rad - prev_pos_rad) > 0.03) */
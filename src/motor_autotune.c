@@ -0,0 +1,200 @@
+/**
+ * @file motor_autotune.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Relay feedback experiment for the ultimate gain and period, and
+ * PID gains from them.
+ *
+ * The caller runs it in place of the position controller, one sample a loop.
+ * Nothing in here touches hardware and it builds on a PC too.
+ */
+#include <math.h>
+
+#include "motor_autotune.h"
+
+#define MOTOR_AUTOTUNE_PI  3.14159265f
+
+/* Used Internally */
+void motor_autotune_cycle(motor_autotune_t *mat);
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t motor_autotune_start(motor_autotune_t *mat, float setpoint, float relay, float hysteresis, float limit, float dt)
+{
+   if((!(relay > 0.0f))||(relay > 1.0f)||(hysteresis < 0.0f)||(!(limit > hysteresis))||(!(dt > 0.0f)))
+   {
+      mat->state = MOTOR_AUTOTUNE_IDLE;
+      return MOTOR_AUTOTUNE_ERROR_PARAMETER;
+   }
+
+   mat->setpoint = setpoint;
+   mat->relay = relay;
+   mat->hysteresis = hysteresis;
+   mat->limit = limit;
+   mat->dt = dt;
+
+   /* out of 0 is how motor_autotune_run() knows it's the first sample. */
+   mat->out = 0.0f;
+   mat->ticks = 0;
+   mat->switch_ticks = 0;
+   mat->rise_ticks = 0;
+   mat->cycles = 0;
+   mat->high = setpoint;
+   mat->low = setpoint;
+   mat->period_sum = 0.0f;
+   mat->period_min = 0.0f;
+   mat->period_max = 0.0f;
+   mat->amplitude_sum = 0.0f;
+   mat->ku = 0.0f;
+   mat->pu = 0.0f;
+
+   mat->state = MOTOR_AUTOTUNE_RUNNING;
+
+   return MOTOR_AUTOTUNE_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+float motor_autotune_run(motor_autotune_t *mat, float msr)
+{
+   if(mat->state != MOTOR_AUTOTUNE_RUNNING)
+   {
+      return 0.0f;
+   }
+
+   mat->ticks++;
+
+   if(fabsf(msr - mat->setpoint) > mat->limit)
+   {
+      mat->state = MOTOR_AUTOTUNE_FAILED;
+      mat->out = 0.0f;
+      return 0.0f;
+   }
+
+   if(msr > mat->high)
+   {
+      mat->high = msr;
+   }
+   if(msr < mat->low)
+   {
+      mat->low = msr;
+   }
+
+   if(mat->out == 0.0f)
+   {
+      mat->out = (msr < mat->setpoint) ? mat->relay : -mat->relay;
+      mat->switch_ticks = mat->ticks;
+   }
+   else if((mat->out > 0.0f)&&(msr > (mat->setpoint + mat->hysteresis)))
+   {
+      mat->out = -mat->relay;
+      mat->switch_ticks = mat->ticks;
+      motor_autotune_cycle(mat);
+   }
+   else if((mat->out < 0.0f)&&(msr < (mat->setpoint - mat->hysteresis)))
+   {
+      mat->out = mat->relay;
+      mat->switch_ticks = mat->ticks;
+   }
+   else if(((float)(mat->ticks - mat->switch_ticks) * mat->dt) > MOTOR_AUTOTUNE_TIMEOUT_S)
+   {
+      mat->state = MOTOR_AUTOTUNE_FAILED;
+   }
+
+   if(mat->state != MOTOR_AUTOTUNE_RUNNING)
+   {
+      mat->out = 0.0f;
+   }
+
+   return mat->out;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t motor_autotune_gains(const motor_autotune_t *mat, uint8_t rule, float *p, float *i, float *d)
+{
+   float kp, ti, td;
+
+   if(mat->state != MOTOR_AUTOTUNE_DONE)
+   {
+      return MOTOR_AUTOTUNE_ERROR_NOT_DONE;
+   }
+
+   switch(rule)
+   {
+      case MOTOR_AUTOTUNE_ZIEGLER_NICHOLS:
+         kp = 0.6f * mat->ku;
+         ti = mat->pu / 2.0f;
+         td = mat->pu / 8.0f;
+         break;
+      case MOTOR_AUTOTUNE_SOME_OVERSHOOT:
+         kp = 0.33f * mat->ku;
+         ti = 0.8f * mat->pu;
+         td = mat->pu / 3.0f;
+         break;
+      case MOTOR_AUTOTUNE_NO_OVERSHOOT:
+         kp = 0.2f * mat->ku;
+         ti = 1.5f * mat->pu;
+         td = mat->pu / 3.0f;
+         break;
+      case MOTOR_AUTOTUNE_TYREUS_LUYBEN:
+         kp = 0.45f * mat->ku;
+         ti = 2.2f * mat->pu;
+         td = mat->pu / 6.3f;
+         break;
+      default:
+         return MOTOR_AUTOTUNE_ERROR_PARAMETER;
+   }
+
+   *p = kp;
+   *i = mat->dt / ti;
+   *d = td;
+
+   return MOTOR_AUTOTUNE_SUCCESS;
+}
+
+/* PRIVATE motor_autotune_cycle
+ *
+ * Notes:
+ *  +Called on every rising crossing, the relay has just gone negative.
+ *  +A cycle runs from one rising crossing to the next, so it takes in the
+ *   overshoot past the top just after it starts and the bottom.
+ *  +Finishes the experiment once MOTOR_AUTOTUNE_CYCLES have been measured.
+ */
+void motor_autotune_cycle(motor_autotune_t *mat)
+{
+   float period, a;
+
+   if(mat->cycles > MOTOR_AUTOTUNE_SETTLE_CYCLES)
+   {
+      period = (float)(mat->ticks - mat->rise_ticks) * mat->dt;
+      if((mat->period_sum == 0.0f)||(period < mat->period_min))
+      {
+         mat->period_min = period;
+      }
+      if(period > mat->period_max)
+      {
+         mat->period_max = period;
+      }
+      mat->period_sum += period;
+      mat->amplitude_sum += (mat->high - mat->low) / 2.0f;
+   }
+
+   mat->cycles++;
+   mat->rise_ticks = mat->ticks;
+   mat->high = mat->setpoint;
+   mat->low = mat->setpoint;
+
+   if(mat->cycles > (MOTOR_AUTOTUNE_SETTLE_CYCLES + MOTOR_AUTOTUNE_CYCLES))
+   {
+      mat->pu = mat->period_sum / MOTOR_AUTOTUNE_CYCLES;
+      a = mat->amplitude_sum / MOTOR_AUTOTUNE_CYCLES;
+
+      if(((mat->period_max - mat->period_min) > (0.25f * mat->pu))||(a <= mat->hysteresis))
+      {
+         mat->state = MOTOR_AUTOTUNE_FAILED;
+         return;
+      }
+
+      mat->ku = (4.0f * mat->relay) / (MOTOR_AUTOTUNE_PI * sqrtf((a * a) - (mat->hysteresis * mat->hysteresis)));
+      mat->state = MOTOR_AUTOTUNE_DONE;
+   }
+}
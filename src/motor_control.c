@@ -1,5 +1,36 @@
+/**
+ * @file motor_control.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief PID position controllers, floating and fixed point.
+ *
+ * Nothing in here touches hardware and it builds on a PC too.
+ */
+
 #include "motor_control.h"
 
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#define MC_QADD(a, b)   __qadd((a), (b))
+#define MC_QSUB(a, b)   __qsub((a), (b))
+#define MC_SSAT(a, n)   __ssat((a), (n))
+#else
+#define MC_QADD(a, b)   motor_control_sat64((int64_t)(a) + (int64_t)(b))
+#define MC_QSUB(a, b)   motor_control_sat64((int64_t)(a) - (int64_t)(b))
+#define MC_SSAT(a, n)   motor_control_ssat((a), (n))
+#endif
+
+#define MOVING_DERIVATIVE_ALPHA  (1.0f / (MOVING_DERIVATIVE_AVG_PTS + 1.0f))
+
+/* Branch free clamp for the bank loop. */
+#define MC_CLAMP(x, limit)  (((x) > (limit)) ? (limit) : (((x) < -(limit)) ? -(limit) : (x)))
+
+/* Used Internally */
+int32_t motor_control_sat64(int64_t x);
+int32_t motor_control_ssat(int32_t x, uint8_t bits);
+int32_t motor_control_mul_q(int32_t gain, int32_t x);
+
+
 uint8_t motor_control_init_pid(motor_control_pid_t *mcp)
 {
 
@@ -15,23 +46,31 @@ uint8_t motor_control_init_pid(motor_control_pid_t *mcp)
    mcp->pid_limits.d_upper_limit = 1.00f;
    mcp->pid_limits.d_lower_limit = -1.00f;
 
+   /* No feed-forward until someone measures the motor. */
+   mcp->aw = 0.10f;
+   mcp->kv = 0.0f;
+   mcp->ka = 0.0f;
+
    mcp->cmd = 0.0f;
    mcp->msr = 0.0f;
+   mcp->ff_vel = 0.0f;
+   mcp->ff_acc = 0.0f;
    mcp->dt  = 0.001f;
+   mcp->d_dt = mcp->d / mcp->dt;
 
    mcp->err = 0.0f;
    mcp->ierr = 0.0f;
+   mcp->derr = 0.0f;
    mcp->out = 0.0f;
 
-   return 0;
+   return MOTOR_CONTROL_SUCCESS;
 
 }
 
 uint8_t motor_control_run_pid(motor_control_pid_t *mcp)
 {
-   float pout, iout, dout;
-   static float prev_err;
-   static float deriv_err_avg = 0.0f;
+   float pout, iout, dout, out;
+   float prev_err;
 
    prev_err = mcp->err;
 
@@ -40,22 +79,21 @@ uint8_t motor_control_run_pid(motor_control_pid_t *mcp)
 
    if(mcp->d > 0.0001f)
    {
-      dout = ((mcp->err - prev_err) / mcp->dt) * mcp->d;
-      deriv_err_avg = (dout + (deriv_err_avg*MOVING_DERIVATIVE_AVG_PTS)) / (MOVING_DERIVATIVE_AVG_PTS + 1.0f);
-      if(deriv_err_avg >= mcp->pid_limits.d_upper_limit)
+      dout = (mcp->err - prev_err) * mcp->d_dt;
+      mcp->derr += (dout - mcp->derr) * MOVING_DERIVATIVE_ALPHA;
+      if(mcp->derr >= mcp->pid_limits.d_upper_limit)
       {
-         deriv_err_avg = mcp->pid_limits.d_upper_limit;
+         mcp->derr = mcp->pid_limits.d_upper_limit;
       }
-      if(deriv_err_avg <= mcp->pid_limits.d_lower_limit)
+      if(mcp->derr <= mcp->pid_limits.d_lower_limit)
       {
-         deriv_err_avg = mcp->pid_limits.d_lower_limit;
+         mcp->derr = mcp->pid_limits.d_lower_limit;
       }
    }
    else
    {
-      deriv_err_avg = 0.0f;
+      mcp->derr = 0.0f;
    }
-   mcp->derr = deriv_err_avg;
 
    iout = mcp->err * mcp->i + mcp->ierr;
    if(iout >= mcp->pid_limits.i_upper_limit)
@@ -66,9 +104,10 @@ uint8_t motor_control_run_pid(motor_control_pid_t *mcp)
    {
       iout = mcp->pid_limits.i_lower_limit;
    }
-   mcp->ierr = iout;
 
-   mcp->out = pout + iout + deriv_err_avg;
+   out = pout + iout + mcp->derr + (mcp->kv * mcp->ff_vel) + (mcp->ka * mcp->ff_acc);
+
+   mcp->out = out;
    if(mcp->out >= mcp->pid_limits.p_upper_limit)
    {
       mcp->out = mcp->pid_limits.p_upper_limit;
@@ -78,8 +117,11 @@ uint8_t motor_control_run_pid(motor_control_pid_t *mcp)
       mcp->out = mcp->pid_limits.p_lower_limit;
    }
 
+   /* Back-calculation, bleed off whatever the output clamp cut. */
+   mcp->ierr = iout + mcp->aw * (mcp->out - out);
 
-   return 0;
+
+   return MOTOR_CONTROL_SUCCESS;
 
 }
 
@@ -97,7 +139,7 @@ uint8_t motor_control_seed_integrator(motor_control_pid_t *mcp, float iseed)
       mcp->ierr = mcp->pid_limits.i_lower_limit;
    }
 
-   return 0;
+   return MOTOR_CONTROL_SUCCESS;
 
 }
 
@@ -108,6 +150,215 @@ uint8_t motor_control_set_pid_gains(motor_control_pid_t *mcp, float p, float i,
    mcp->p = p;
    mcp->i = i;
    mcp->d = d;
+   mcp->d_dt = d / mcp->dt;
+
+   return MOTOR_CONTROL_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t motor_control_set_ff_gains(motor_control_pid_t *mcp, float kv, float ka, float aw)
+{
+   mcp->kv = kv;
+   mcp->ka = ka;
+   mcp->aw = aw;
+
+   return MOTOR_CONTROL_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t motor_control_set_period(motor_control_pid_t *mcp, float dt)
+{
+   if(!(dt > 0.0f))
+   {
+      return MOTOR_CONTROL_ERROR_PERIOD;
+   }
+
+   mcp->dt = dt;
+   mcp->d_dt = mcp->d / dt;
+
+   return MOTOR_CONTROL_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void motor_control_init_q(motor_control_q_t *mcq)
+{
+   mcq->kp = 0;
+   mcq->ki = 0;
+   mcq->kd = 0;
+   mcq->kaw = 0;
+   mcq->kv = 0;
+   mcq->ka = 0;
+   mcq->i_limit = MOTOR_CONTROL_Q_OUT_MAX;
+   mcq->d_limit = MOTOR_CONTROL_Q_OUT_MAX;
+   mcq->d_shift = 5;
+
+   mcq->cmd = 0;
+   mcq->msr = 0;
+   mcq->ff_vel = 0;
+   mcq->ff_acc = 0;
+   mcq->err = 0;
+   mcq->ierr = 0;
+   mcq->derr = 0;
+   mcq->out = 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+int32_t motor_control_run_q(motor_control_q_t *mcq)
+{
+   int32_t e, de, u;
+
+   e = MC_QSUB(mcq->cmd, mcq->msr);
+   de = MC_QSUB(e, mcq->err);
+   mcq->err = e;
+
+   /* Single pole on the derivative, the same job the float version's
+    * average does.
+    */
+   mcq->derr += (motor_control_mul_q(mcq->kd, de) - mcq->derr) >> mcq->d_shift;
+   if(mcq->derr > mcq->d_limit)
+   {
+      mcq->derr = mcq->d_limit;
+   }
+   else if(mcq->derr < -mcq->d_limit)
+   {
+      mcq->derr = -mcq->d_limit;
+   }
+
+   mcq->ierr = MC_QADD(mcq->ierr, motor_control_mul_q(mcq->ki, e));
+   if(mcq->ierr > mcq->i_limit)
+   {
+      mcq->ierr = mcq->i_limit;
+   }
+   else if(mcq->ierr < -mcq->i_limit)
+   {
+      mcq->ierr = -mcq->i_limit;
+   }
+
+   u = motor_control_mul_q(mcq->kp, e);
+   u = MC_QADD(u, mcq->ierr);
+   u = MC_QADD(u, mcq->derr);
+   u = MC_QADD(u, motor_control_mul_q(mcq->kv, mcq->ff_vel));
+   u = MC_QADD(u, motor_control_mul_q(mcq->ka, mcq->ff_acc));
+
+   mcq->out = MC_SSAT(u, MOTOR_CONTROL_Q_OUT_BITS);
+
+   /* Back-calculation.  out - u can't overflow, they have the same sign. */
+   mcq->ierr = MC_QADD(mcq->ierr, motor_control_mul_q(mcq->kaw, mcq->out - u));
+
+   return mcq->out;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t motor_control_init_bank(motor_control_bank_t *mcb, uint8_t axes)
+{
+   uint8_t n;
+
+   if((axes == 0)||(axes > MOTOR_CONTROL_BANK_AXES))
+   {
+      return MOTOR_CONTROL_ERROR_AXES;
+   }
+
+   mcb->axes = axes;
+   mcb->d_shift = 5;
+
+   for(n = 0; n < MOTOR_CONTROL_BANK_AXES; n++)
+   {
+      mcb->kp[n] = 0;
+      mcb->ki[n] = 0;
+      mcb->kd[n] = 0;
+      mcb->kaw[n] = 0;
+      mcb->kv[n] = 0;
+      mcb->ka[n] = 0;
+      mcb->i_limit[n] = MOTOR_CONTROL_Q_OUT_MAX;
+      mcb->d_limit[n] = MOTOR_CONTROL_Q_OUT_MAX;
+
+      mcb->cmd[n] = 0;
+      mcb->msr[n] = 0;
+      mcb->ff_vel[n] = 0;
+      mcb->ff_acc[n] = 0;
+      mcb->err[n] = 0;
+      mcb->ierr[n] = 0;
+      mcb->derr[n] = 0;
+      mcb->out[n] = 0;
+   }
+
+   return MOTOR_CONTROL_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void motor_control_run_bank(motor_control_bank_t *mcb)
+{
+   uint32_t n, axes;
+   uint8_t d_shift;
+   int32_t e, de, d, i, u, out;
+
+   /* Locals so the compiler doesn't reload them for every axis. */
+   axes = mcb->axes;
+   d_shift = mcb->d_shift;
+
+   /* motor_control_run_q() step for step, keep the two in sync. */
+   for(n = 0; n < axes; n++)
+   {
+      e = MC_QSUB(mcb->cmd[n], mcb->msr[n]);
+      de = MC_QSUB(e, mcb->err[n]);
+      mcb->err[n] = e;
+
+      d = mcb->derr[n] + ((motor_control_mul_q(mcb->kd[n], de) - mcb->derr[n]) >> d_shift);
+      d = MC_CLAMP(d, mcb->d_limit[n]);
+      mcb->derr[n] = d;
+
+      i = MC_QADD(mcb->ierr[n], motor_control_mul_q(mcb->ki[n], e));
+      i = MC_CLAMP(i, mcb->i_limit[n]);
+
+      u = motor_control_mul_q(mcb->kp[n], e);
+      u = MC_QADD(u, i);
+      u = MC_QADD(u, d);
+      u = MC_QADD(u, motor_control_mul_q(mcb->kv[n], mcb->ff_vel[n]));
+      u = MC_QADD(u, motor_control_mul_q(mcb->ka[n], mcb->ff_acc[n]));
+
+      out = MC_SSAT(u, MOTOR_CONTROL_Q_OUT_BITS);
+      mcb->out[n] = out;
+
+      mcb->ierr[n] = MC_QADD(i, motor_control_mul_q(mcb->kaw[n], out - u));
+   }
+}
+
+/* PRIVATE motor_control_mul_q
+ *
+ * Notes:
+ *  +Q16.16 gain times an integer, saturated to 32 bits.  One SMULL and a
+ *   shift on the M4.
+ */
+int32_t motor_control_mul_q(int32_t gain, int32_t x)
+{
+   return motor_control_sat64(((int64_t)gain * (int64_t)x) >> MOTOR_CONTROL_Q_SHIFT);
+}
+
+/* PRIVATE motor_control_sat64
+ *
+ * Notes:
+ *  +Clamps to the int32_t range.  Selects rather than branches so the bank
+ *   loop still vectorizes with it inlined.
+ */
+int32_t motor_control_sat64(int64_t x)
+{
+   x = (x > INT32_MAX) ? INT32_MAX : x;
+   x = (x < INT32_MIN) ? INT32_MIN : x;
+
+   return (int32_t)x;
+}
+
+/* PRIVATE motor_control_ssat
+ *
+ * Notes:
+ *  +SSAT in C, clamps to a signed bits wide range.  Only used off the M4.
+ */
+int32_t motor_control_ssat(int32_t x, uint8_t bits)
+{
+   int32_t max = (int32_t)((1UL << (bits - 1)) - 1);
+
+   x = (x > max) ? max : x;
+   x = (x < (-max - 1)) ? (-max - 1) : x;
 
-   return 0;
+   return x;
 }
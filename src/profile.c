@@ -0,0 +1,204 @@
+/**
+ * @file profile.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief ISR and function profiling with the core cycle counter.
+ *
+ * The timer and DMA interrupts preempt one another, and toggling debug LEDs
+ * only shows that something ran.  The hooks in profile.h time each section in
+ * core clock cycles, keep what nested interrupts took out of it, and collect
+ * the results here until the host asks for them.
+ */
+
+#include "profile.h"
+#include "full_duplex_usart_dma.h"
+#include "memory_sections.h"
+
+CCM_BSS profile_entry_t profile_table[PROFILE_NUM_IDS];
+
+/* Cycles spent in nested sections, one slot per nesting level.  Level 0 is
+ * code that isn't inside any profiled section.
+ */
+CCM_BSS uint32_t profile_nested[PROFILE_MAX_DEPTH];
+uint8_t profile_depth = 0;
+
+uint32_t profile_start_ms = 0;
+
+/* SRAM, TX DMA reads them directly. */
+GenericPacket profile_packets[PROFILE_NUM_IDS];
+volatile uint8_t profile_dump_active = 0;
+uint8_t profile_dump_last = 0;
+
+/* Used Internally */
+void profile_dump_sent(uint32_t id);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void profile_init(void)
+{
+   hal_cycles_init();
+
+   profile_depth = 0;
+   profile_nested[0] = 0;
+
+   profile_clear();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void profile_clear(void)
+{
+   uint32_t primask;
+   uint8_t ii, jj;
+
+   primask = hal_irq_save();
+
+   for(ii=0; ii<PROFILE_NUM_IDS; ii++)
+   {
+      profile_table[ii].count = 0;
+      profile_table[ii].min_cycles = 0xFFFFFFFF;
+      profile_table[ii].max_cycles = 0;
+      profile_table[ii].total_cycles = 0;
+      profile_table[ii].max_latency_cycles = 0;
+      for(jj=0; jj<PROFILE_HIST_BINS; jj++)
+      {
+         profile_table[ii].hist[jj] = 0;
+      }
+   }
+   profile_start_ms = hal_millis();
+
+   hal_irq_restore(primask);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t profile_dump(void)
+{
+   profile_entry_t entry;
+   uint64_t elapsed_cycles;
+   uint32_t load_ppm;
+   uint32_t mean;
+   uint32_t primask;
+   uint8_t ii;
+   uint8_t queued;
+
+   if(profile_dump_active)
+   {
+      return 0;
+   }
+   profile_dump_active = 1;
+
+   elapsed_cycles = (uint64_t)(hal_millis() - profile_start_ms) * (SystemCoreClock / 1000);
+   queued = 0;
+
+   for(ii=0; ii<PROFILE_NUM_IDS; ii++)
+   {
+      /* Copy so an interrupt can't change the entry half way through. */
+      primask = hal_irq_save();
+      entry = profile_table[ii];
+      hal_irq_restore(primask);
+
+      mean = (entry.count != 0) ? (uint32_t)(entry.total_cycles / entry.count) : 0;
+      load_ppm = (elapsed_cycles != 0) ? (uint32_t)((entry.total_cycles * 1000000) / elapsed_cycles) : 0;
+
+      create_universal_profile(&(profile_packets[ii]), ii, entry.count,
+                               (entry.count != 0) ? entry.min_cycles : 0, entry.max_cycles, mean,
+                               entry.max_latency_cycles, load_ppm, entry.hist, PROFILE_HIST_BINS);
+      if(full_duplex_usart_dma_add_to_queue(&(profile_packets[ii]), &profile_dump_sent, ii) == FDUD_SUCCESS)
+      {
+         profile_dump_last = ii;
+         queued = 1;
+      }
+   }
+
+   if(queued == 0)
+   {
+      profile_dump_active = 0;
+   }
+
+   return queued;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t profile_enter(void)
+{
+   uint32_t primask;
+   uint32_t now;
+
+   primask = hal_irq_save();
+
+   if(profile_depth < (PROFILE_MAX_DEPTH - 1))
+   {
+      profile_depth++;
+   }
+   profile_nested[profile_depth] = 0;
+   now = hal_cycles();
+
+   hal_irq_restore(primask);
+
+   return now;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void profile_exit(uint8_t id, uint32_t start)
+{
+   profile_entry_t *entry;
+   uint32_t primask;
+   uint32_t elapsed;
+   uint32_t own;
+   uint8_t bin;
+
+   primask = hal_irq_save();
+
+   elapsed = hal_cycles() - start;
+   own = elapsed - profile_nested[profile_depth];
+   if(profile_depth > 0)
+   {
+      profile_depth--;
+   }
+   profile_nested[profile_depth] += elapsed;
+
+   entry = &(profile_table[id]);
+   entry->count++;
+   entry->total_cycles += own;
+   if(own < entry->min_cycles)
+   {
+      entry->min_cycles = own;
+   }
+   if(own > entry->max_cycles)
+   {
+      entry->max_cycles = own;
+   }
+
+   bin = 31 - __builtin_clz(own | 1);
+   if(bin >= PROFILE_HIST_BINS)
+   {
+      bin = PROFILE_HIST_BINS - 1;
+   }
+   if(entry->hist[bin] < 0xFFFF)
+   {
+      entry->hist[bin]++;
+   }
+
+   hal_irq_restore(primask);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void profile_latency(uint8_t id, uint32_t cycles)
+{
+   if(cycles > profile_table[id].max_latency_cycles)
+   {
+      profile_table[id].max_latency_cycles = cycles;
+   }
+}
+
+/* PRIVATE profile_dump_sent
+ *
+ * Notes:
+ *  +FDUD_TxQueueCallback for the dump packets, the packets can be reused
+ *   once the last one is out.
+ */
+void profile_dump_sent(uint32_t id)
+{
+   if(id == profile_dump_last)
+   {
+      profile_dump_active = 0;
+   }
+}
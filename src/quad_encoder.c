@@ -1,75 +1,209 @@
-#include <stdint.h>
-
-/* awalker - Should these files be named hardware_quadrature_encoder.c and
- *           hardware_quadrature_encoder.h since they actually set pins and
- *           choose the timer????
+/**
+ * @file quad_encoder.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Quadrature encoder position and velocity.
+ *
+ * Extends the 16 bit hardware counter (quad_encoder_stm32.c) to 32 bits and
+ * estimates velocity from edge timing.  Nothing in here touches hardware and
+ * it builds on a PC too.
  */
 
-#include "stm32f4xx_conf.h"
 #include "quad_encoder.h"
 
+/* Upper half of the count, changed only by quad_encoder_overflow().  Kept
+ * unsigned so it wraps rather than overflows a long way from home.
+ */
+volatile uint32_t quad_encoder_high = 0;
+volatile uint32_t quad_encoder_overflows = 0;
+
+int32_t quad_encoder_offset = 0;
+
+/* Last channel A edge, written by the capture interrupt.  The count goes up
+ * after the rest so readers can tell a copy was interrupted.
+ */
+volatile int32_t quad_encoder_edge_position = 0;
+volatile uint32_t quad_encoder_edge_ticks = 0;
+volatile uint32_t quad_encoder_edges = 0;
+
+/* Only quad_encoder_sample() touches these. */
+int32_t quad_encoder_sample_position = 0;
+uint32_t quad_encoder_sample_ticks = 0;
+uint32_t quad_encoder_sample_edges = 0;
+uint8_t quad_encoder_sample_valid = 0;
+volatile float quad_encoder_velocity = 0.0f;
 
 uint8_t quad_encoder_initialized = 0;
 
+/* Used Internally */
+int32_t quad_encoder_raw(void);
+
+
+/* Public Function - Doxygen documentation is in the header file. */
 void quad_encoder_init(void)
 {
-   GPIO_InitTypeDef GPIO_InitStructure;
+   quad_encoder_high = 0;
+   quad_encoder_overflows = 0;
+   quad_encoder_offset = 0;
+   quad_encoder_edges = 0;
+   quad_encoder_sample_edges = 0;
+   quad_encoder_sample_valid = 0;
+   quad_encoder_velocity = 0.0f;
 
-   // turn on the clocks for each of the ports needed
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
+   quad_encoder_port_init();
 
-   // now configure the pins themselves
-   // they are all going to be inputs with pullups
-   GPIO_StructInit (&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_4;
-   GPIO_Init (GPIOB, &GPIO_InitStructure);
+   quad_encoder_initialized = 1;
+}
 
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5;
-   GPIO_Init (GPIOB, &GPIO_InitStructure);
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_read_position(int32_t *position_counts)
+{
+   *position_counts = 0;
+   if(quad_encoder_initialized == 1)
+   {
+      *position_counts = quad_encoder_raw() + quad_encoder_offset;
+   }
+}
 
-   // Connect the pins to their Alternate Functions
-   GPIO_PinAFConfig (GPIOB, GPIO_PinSource4, GPIO_AF_TIM3);
-   GPIO_PinAFConfig (GPIOB, GPIO_PinSource5, GPIO_AF_TIM3);
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_set_position(int32_t position_counts)
+{
+   if(quad_encoder_initialized == 1)
+   {
+      quad_encoder_offset = position_counts - quad_encoder_raw();
+   }
+}
 
-   // Timer peripheral clock enable
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_sample(void)
+{
+   int32_t position;
+   uint32_t ticks, edges, now, elapsed, hz;
+   float bound;
 
-   // set them up as encoder inputs
-   // set both inputs to rising polarity to let it use both edges
-   TIM_EncoderInterfaceConfig(TIM3, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
-   TIM_SetAutoreload (TIM3, 0xFFFF);
+   if(quad_encoder_initialized != 1)
+   {
+      return;
+   }
 
-   // turn on the timer/counters
-   TIM_Cmd (TIM3, ENABLE);
+   hz = quad_encoder_port_tick_hz();
+   now = quad_encoder_port_ticks();
 
-   quad_encoder_initialized = 1;
+   do
+   {
+      edges = quad_encoder_edges;
+      position = quad_encoder_edge_position;
+      ticks = quad_encoder_edge_ticks;
+   } while(edges != quad_encoder_edges);
 
+   if(edges != quad_encoder_sample_edges)
+   {
+      /* Counts between the last edge before this sample and the last edge
+       * before the previous one, over the time between them.
+       */
+      elapsed = ticks - quad_encoder_sample_ticks;
+      if((quad_encoder_sample_valid)&&(elapsed != 0))
+      {
+         quad_encoder_velocity = ((float)(position - quad_encoder_sample_position) * (float)hz) / (float)elapsed;
+      }
+
+      quad_encoder_sample_position = position;
+      quad_encoder_sample_ticks = ticks;
+      quad_encoder_sample_edges = edges;
+      quad_encoder_sample_valid = 1;
+   }
+   else if(quad_encoder_sample_valid)
+   {
+      elapsed = now - quad_encoder_sample_ticks;
+      if(elapsed >= ((hz / 1000) * QUAD_ENCODER_STOP_MS))
+      {
+         /* Stopped.  The next edge only restarts the timing. */
+         quad_encoder_velocity = 0.0f;
+         quad_encoder_sample_valid = 0;
+      }
+      else if(elapsed != 0)
+      {
+         bound = ((float)QUAD_ENCODER_COUNTS_PER_LINE * (float)hz) / (float)elapsed;
+         if(quad_encoder_velocity > bound)
+         {
+            quad_encoder_velocity = bound;
+         }
+         else if(quad_encoder_velocity < -bound)
+         {
+            quad_encoder_velocity = -bound;
+         }
+      }
+   }
 }
 
-void quad_encoder_read_position(uint32_t *position_counts)
+/* Public Function - Doxygen documentation is in the header file. */
+float quad_encoder_read_velocity(void)
 {
+   return quad_encoder_velocity;
+}
 
-   *position_counts = 0x0000;
-   if(quad_encoder_initialized == 1)
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_overflow(uint16_t count)
+{
+   if(count < 0x8000)
+   {
+      quad_encoder_high += 0x10000;
+   }
+   else
    {
-      *position_counts = TIM_GetCounter(TIM3);
+      quad_encoder_high -= 0x10000;
    }
 
+   quad_encoder_overflows++;
 }
 
-void quad_encoder_set_position(uint32_t position_counts)
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_edge(uint16_t count, uint32_t ticks)
 {
+   int32_t now;
 
-   if(quad_encoder_initialized == 1)
+   /* The edge latched count a moment ago, within a few counts of now. */
+   now = quad_encoder_raw();
+
+   quad_encoder_edge_position = now + (int16_t)(count - (uint16_t)now);
+   quad_encoder_edge_ticks = ticks;
+   quad_encoder_edges++;
+}
+
+/* PRIVATE quad_encoder_raw
+ *
+ * Notes:
+ *  +32 bit count without the offset.
+ *  +Retries if the update interrupt ran part way through, so the upper and
+ *   lower halves always go together.
+ *  +If the update is still pending the interrupt can't run here (we're above
+ *   it or it's masked), so the wrap is accounted for the same way it would.
+ */
+int32_t quad_encoder_raw(void)
+{
+   uint32_t high, overflows;
+   uint16_t count;
+   uint8_t pending;
+
+   do
+   {
+      overflows = quad_encoder_overflows;
+      pending = quad_encoder_port_overflow_pending();
+      high = quad_encoder_high;
+      count = quad_encoder_port_count();
+   } while((overflows != quad_encoder_overflows)||(pending != quad_encoder_port_overflow_pending()));
+
+   if(pending)
    {
-      if(position_counts > 0xFFFF)
+      if(count < 0x8000)
       {
-         position_counts = 0xFFFF;
+         high += 0x10000;
+      }
+      else
+      {
+         high -= 0x10000;
       }
-
-      TIM_SetCounter(TIM3, position_counts);
    }
 
+   return (int32_t)(high + count);
 }
@@ -0,0 +1,132 @@
+/**
+ * @file quad_encoder_stm32.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief STM32F4 port for the quadrature encoder.
+ *
+ * TIM3 counts both edges of both channels on PB4 and PB5 in encoder mode.
+ * Its update interrupt reports each wrap of the 16 bit counter, and capture
+ * channel 1 latches the count on every rising edge of channel A, timestamped
+ * with the DWT cycle counter when the interrupt runs.
+ */
+
+#include "quad_encoder.h"
+#include "stm32f4xx_conf.h"
+
+#include "profile.h"
+
+/* Both inputs have to be steady for 8 samples at fDTS/32 (about 3us) to
+ * count.  Chatter right at the wrap can't stack two updates into one that
+ * way, and it's still far below the fastest edge rate.
+ */
+#define QUAD_ENCODER_IC_FILTER  0x0F
+
+/* Public Function - Doxygen documentation is in the header file. */
+void quad_encoder_port_init(void)
+{
+   GPIO_InitTypeDef GPIO_InitStructure;
+   TIM_ICInitTypeDef TIM_ICInitStructure;
+   NVIC_InitTypeDef NVIC_InitStructure;
+
+   // turn on the clocks for each of the ports needed
+   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
+
+   GPIO_StructInit(&GPIO_InitStructure);
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_4 | GPIO_Pin_5;
+   GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+   // Connect the pins to their Alternate Functions
+   GPIO_PinAFConfig(GPIOB, GPIO_PinSource4, GPIO_AF_TIM3);
+   GPIO_PinAFConfig(GPIOB, GPIO_PinSource5, GPIO_AF_TIM3);
+
+   // Timer peripheral clock enable
+   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+
+   /* Input filters first, the encoder setup below keeps them. */
+   TIM_ICStructInit(&TIM_ICInitStructure);
+   TIM_ICInitStructure.TIM_ICFilter = QUAD_ENCODER_IC_FILTER;
+   TIM_ICInitStructure.TIM_Channel = TIM_Channel_1;
+   TIM_ICInit(TIM3, &TIM_ICInitStructure);
+   TIM_ICInitStructure.TIM_Channel = TIM_Channel_2;
+   TIM_ICInit(TIM3, &TIM_ICInitStructure);
+
+   // set them up as encoder inputs
+   // set both inputs to rising polarity to let it use both edges
+   TIM_EncoderInterfaceConfig(TIM3, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
+   TIM_SetAutoreload(TIM3, 0xFFFF);
+   TIM_SetCounter(TIM3, 0);
+
+   /* Edge timestamps. */
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+   /* Above the loops that read the position, so a read mostly finds the
+    * wrap already accounted for, and short enough not to matter to them.
+    */
+   NVIC_InitStructure.NVIC_IRQChannel = TIM3_IRQn;
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+
+   TIM_ClearITPendingBit(TIM3, TIM_IT_Update | TIM_IT_CC1);
+   TIM_ITConfig(TIM3, TIM_IT_Update | TIM_IT_CC1, ENABLE);
+
+   // turn on the timer/counters
+   TIM_Cmd(TIM3, ENABLE);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint16_t quad_encoder_port_count(void)
+{
+   return (uint16_t)TIM3->CNT;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t quad_encoder_port_overflow_pending(void)
+{
+   return (TIM3->SR & TIM_SR_UIF) ? 1 : 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t quad_encoder_port_ticks(void)
+{
+   return DWT->CYCCNT;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t quad_encoder_port_tick_hz(void)
+{
+   return SystemCoreClock;
+}
+
+/**
+ * @fn void TIM3_IRQHandler(void)
+ * @brief Encoder counter wrapped, or channel A had a rising edge.
+ *
+ * @param None
+ * @return None
+ */
+void TIM3_IRQHandler(void)
+{
+   uint32_t ticks = DWT->CYCCNT;
+
+   PROFILE_ENTER();
+
+   /* Wrap first, quad_encoder_edge() needs the upper half right. */
+   if(TIM_GetITStatus(TIM3, TIM_IT_Update) == SET)
+   {
+      TIM_ClearITPendingBit(TIM3, TIM_IT_Update);
+      quad_encoder_overflow((uint16_t)TIM3->CNT);
+   }
+
+   if(TIM_GetITStatus(TIM3, TIM_IT_CC1) == SET)
+   {
+      /* Reading the capture clears the flag. */
+      quad_encoder_edge((uint16_t)TIM_GetCapture1(TIM3), ticks);
+   }
+
+   PROFILE_EXIT(PROFILE_ID_TIM3);
+}
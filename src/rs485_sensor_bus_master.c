@@ -9,12 +9,17 @@
  */
 
 
+#include "hal.h"
 #include "rs485_sensor_bus.h"
 #include "circular_buffer.h"
 
 #include "gp_circular_buffer.h"
 
 #include "full_duplex_usart_dma.h"
+#include "event_scheduler.h"
+#include "profile.h"
+#include "watchdog.h"
+#include "trace.h"
 
 /* Buffers for raw data dma send and receive. */
 /* This one is really just a place holder for initialization.  Probably don't
@@ -41,7 +46,91 @@ uint32_t rs485_master_state_timer = 0;
 
 volatile uint8_t response_received = 0;
 
-uint8_t current_slave_address = SLAVE_ADDRESS;
+uint8_t current_slave_address = RS485_MASTER_FIRST_SLAVE_ADDRESS;
+
+/* Live slave table and polling scheduler state. */
+rs485_slave_entry_t rs485_slave_table[RS485_MASTER_MAX_SLAVES];
+volatile uint32_t rs485_master_tick = 0;
+uint32_t rs485_master_timeout_ticks = RS485_MASTER_RESPONSE_TIMEOUT_TICKS;
+uint8_t rs485_master_discovery_index = 0;
+volatile uint8_t rs485_master_discovery_active = 0;
+uint32_t rs485_master_next_probe_tick = 0;
+
+/* Turnaround measurement, stamped in DMA1_Stream6_IRQHandler. */
+volatile uint8_t rs485_master_tx_done = 0;
+volatile uint32_t rs485_master_tx_done_cycles = 0;
+volatile uint32_t rs485_master_tx_done_tick = 0;
+volatile uint16_t rs485_master_tx_done_rx_head = 0;
+uint8_t rs485_master_first_byte_seen = 0;
+uint32_t rs485_master_byte_cycles = 0;
+uint32_t rs485_master_turnaround_usec = 0;
+
+/* The DMA reads the query after the state machine returns, so it can't live
+ * on the interrupt stack.
+ */
+GenericPacket rs485_master_query_packet;
+
+/* In pipelined mode a response counts as received once its bytes stop
+ * arriving (USART idle line) and the next query goes straight out.  The
+ * checksum and handling of that response then happen in rs485_master_spin()
+ * while the next exchange is on the bus.
+ */
+volatile uint8_t rs485_master_pipelined = 1;
+uint32_t rs485_master_frames_completed = 0;
+
+/* Pipelined exchanges whose response rs485_master_spin() hasn't checked yet,
+ * oldest first.  start and end are rs485_master_rx_bytes either side of the
+ * frame, the exchange is settled once rs485_master_rx_parsed gets to end.
+ * Queued by the idle line interrupt, emptied by the main loop.  The slave
+ * answered if a sensor info response to the master ended inside its frame,
+ * a snapshot's slot responses in between end before start.
+ */
+#define RS485_MASTER_CHECKS   (RS485_MASTER_MAX_SLAVES + 1)
+typedef struct {
+   uint8_t address;
+   uint32_t turnaround_usec;
+   uint32_t start;
+   uint32_t end;
+} rs485_master_check_t;
+rs485_master_check_t rs485_master_checks[RS485_MASTER_CHECKS];
+volatile uint8_t rs485_master_checks_head = 0;
+volatile uint8_t rs485_master_checks_tail = 0;
+volatile uint32_t rs485_master_rx_bytes = 0;   /* Moved to the RAM buffer. */
+uint32_t rs485_master_rx_parsed = 0;            /* Taken out of it by the parser. */
+uint32_t rs485_master_valid_end = 0;
+uint8_t rs485_master_response_valid = 0;
+
+/* Stop-and-wait, the idle line interrupt notes where the response frame
+ * ended.  Once the parser is past that without a valid response the frame
+ * was garbled and the exchange is a miss straight away, rather than after
+ * RS485_MASTER_RESPONSE_TIMEOUT_TICKS.
+ */
+volatile uint8_t rs485_master_frame_ended = 0;
+volatile uint32_t rs485_master_frame_end = 0;
+volatile uint8_t rs485_master_frame_garbled = 0;
+
+/* Broadcast snapshot (TDMA) state. */
+uint32_t rs485_master_snapshot_period_ticks = 0;
+uint32_t rs485_master_snapshot_next_tick = 0;
+uint32_t rs485_master_slot_ticks = RS485_TDMA_MIN_SLOT_TICKS;
+uint8_t rs485_master_num_slots = 0;
+volatile uint32_t rs485_master_slots_heard = 0;
+uint16_t rs485_master_slot_rx_head = 0;          /* RX DMA head at the last frame's end. */
+uint32_t rs485_master_snapshots = 0;
+
+/* Address assignment.  One unique ID query or set address command at a time,
+ * the packet stays put until the slots after it have passed.
+ */
+GenericPacket rs485_master_config_packet;
+volatile uint8_t rs485_master_config_pending = 0;
+uint8_t rs485_master_config_probe_address = 0;
+
+/* Answers passed upstream.  SRAM, TX DMA reads them directly, each one is
+ * busy until the link's TX complete callback.
+ */
+GenericPacket rs485_master_forward_packets[RS485_MASTER_FORWARD_PACKETS];
+volatile uint8_t rs485_master_forward_busy[RS485_MASTER_FORWARD_PACKETS];
+uint32_t rs485_master_forward_dropped = 0;
 
 GenericPacket gp_debug_master[20];
 uint8_t debug_master_ii = 0;
@@ -55,146 +144,1050 @@ void rs485_master_write_dma(uint8_t *data, uint32_t length);
 void rs485_master_process_rx_dma(void);
 void rs485_master_process_rx_ram(void);
 void rs485_master_handle_packets(void);
+void rs485_master_slave_table_init(void);
+uint8_t rs485_master_next_due_slave(uint8_t *address);
+void rs485_master_transaction_done(uint8_t address, uint8_t responded);
+uint32_t rs485_master_select_timeout(uint8_t address);
+uint32_t rs485_master_measure_turnaround(uint16_t rx_head);
+void rs485_master_record_turnaround(uint8_t address, uint32_t turnaround_usec);
+void rs485_master_send_query(void);
+void rs485_master_frame_complete(void);
+void rs485_master_check_responses(void);
+void rs485_master_send_snapshot(void);
+void rs485_master_slot_heard(void);
+void rs485_master_snapshot_done(void);
+GenericPacket * rs485_master_forward_get(uint8_t *index);
+void rs485_master_forward(uint8_t index);
+void rs485_master_forward_sent(uint32_t index);
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+void rs485_master_spin(void)
+{
+   PROFILE_ENTER();
+
+   rs485_master_process_rx_ram();
+   rs485_master_handle_packets();
+
+   PROFILE_EXIT(PROFILE_ID_RS485_MASTER_SPIN);
+}
+
+/**
+ *
+ * @fn TIM1_BRK_TIM9_IRQHandler
+ * @brief RS485 Master State Machine
+ *
+ * This function serves two purposes.
+ * - Move bytes from the DMA circular buffer to a RAM buffer in a timely fashion
+ * - Handle state related code for the RS485 master
+ *
+ * @param None
+ * @return None
+ *
+ */
+void TIM1_BRK_TIM9_IRQHandler(void)
+{
+   uint16_t rx_head;
+
+   PROFILE_ENTER_TIMER(PROFILE_ID_TIM9, HAL_TIMER_RS485_MASTER);
+
+   if(hal_timer_update_pending(HAL_TIMER_RS485_MASTER))
+   {
+
+      /* GPIO_SetBits(GPIOD, LED_PIN_ORANGE); */
+
+      rs485_master_state_timer++;
+      rs485_master_tick++;
+
+      /* A tick that isn't stuck in ERROR is a heartbeat, so the watchdog
+       * catches the timer stopping as well as the state machine wedging.
+       */
+      if(master_state != RS485_MASTER_ERROR)
+      {
+         watchdog_heartbeat(WATCHDOG_TASK_RS485);
+      }
+
+      /* Always move received data out of the dma buffer to be processed outside
+       * of the interrupt.  We don't want to take too long in here.
+       */
+      rs485_master_process_rx_dma();
+      /* rs485_master_process_rx_ram(); */
+      /* rs485_master_handle_packets(); */
+
+      switch(master_state)
+      {
+         case RS485_MASTER_INIT:
+            {
+               rs485_master_slave_table_init();
+               rs485_master_state_change(RS485_MASTER_FIND_ATTACHED_DEVICES, 1);
+            } /* RS485_MASTER_INIT */
+            break;
+         case RS485_MASTER_FIND_ATTACHED_DEVICES:
+            {
+               /* One address per pass.  Each probe comes back through
+                * AWAIT_RESPONSE and DELAY to here until the sweep is done.
+                */
+               if(rs485_master_discovery_index < RS485_MASTER_MAX_SLAVES)
+               {
+                  current_slave_address = RS485_MASTER_FIRST_SLAVE_ADDRESS + rs485_master_discovery_index;
+                  rs485_master_discovery_index++;
+                  rs485_master_timeout_ticks = rs485_master_select_timeout(current_slave_address);
+                  rs485_master_state_change(RS485_MASTER_QUERY_DEVICE, 1);
+               }
+               else
+               {
+                  rs485_master_discovery_active = 0;
+                  rs485_master_state_change(RS485_MASTER_IDLE, 1);
+               }
+            } /* RS485_MASTER_FIND_ATTACHED_DEVICES */
+            break;
+         case RS485_MASTER_QUERY_DEVICE:
+            {
+               rs485_master_send_query();
+            } /* RS485_MASTER_QUERY_DEVICE */
+            break;
+         case RS485_MASTER_AWAIT_RESPONSE:
+            {
+               /* Pipelined, a parse finishing now belongs to the previous
+                * exchange.  The idle line interrupt closes this one.
+                */
+               if((response_received)&&(rs485_master_pipelined == 0))
+               {
+                  if((rs485_master_tx_done)&&(rs485_master_first_byte_seen == 0))
+                  {
+                     /* Whole frame was parsed before this tick noticed it. */
+                     rs485_master_turnaround_usec = rs485_master_measure_turnaround(hal_usart_dma_rx_head(HAL_USART_RS485_MASTER));
+                  }
+                  rs485_master_record_turnaround(current_slave_address, rs485_master_turnaround_usec);
+                  rs485_master_transaction_done(current_slave_address, 1);
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+               else if((rs485_master_frame_garbled)&&(rs485_master_pipelined == 0))
+               {
+                  rs485_master_transaction_done(current_slave_address, 0);
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+               else if((rs485_master_tx_done)&&(rs485_master_first_byte_seen == 0))
+               {
+                  /* The slave's timeout only covers the turnaround.  Once it
+                   * starts talking the frame gets the full fixed timeout to
+                   * finish and be parsed.
+                   */
+                  rx_head = hal_usart_dma_rx_head(HAL_USART_RS485_MASTER);
+                  if(rx_head != rs485_master_tx_done_rx_head)
+                  {
+                     rs485_master_first_byte_seen = 1;
+                     rs485_master_turnaround_usec = rs485_master_measure_turnaround(rx_head);
+                     rs485_master_state_change(RS485_MASTER_AWAIT_RESPONSE, 1);
+                  }
+                  else if((rs485_master_tick - rs485_master_tx_done_tick) >= rs485_master_timeout_ticks)
+                  {
+                     rs485_master_transaction_done(current_slave_address, 0);
+                     rs485_master_state_change(RS485_MASTER_DELAY, 1);
+                  }
+               }
+               else if(rs485_master_state_timer >= RS485_MASTER_RESPONSE_TIMEOUT_TICKS)
+               {
+                  /* Query never left or the response never completed. */
+                  rs485_master_transaction_done(current_slave_address, 0);
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+
+            } /* RS485_MASTER_AWAIT_RESPONSE */
+            break;
+         case RS485_MASTER_AWAIT_SLOTS:
+            {
+               /* Slots are counted from the end of the broadcast.  The idle
+                * line interrupt marks each slave that answers.
+                */
+               if((rs485_master_tx_done)&&
+                  ((rs485_master_tick - rs485_master_tx_done_tick) >= ((rs485_master_num_slots + 1) * rs485_master_slot_ticks) + RS485_TDMA_GUARD_TICKS))
+               {
+                  rs485_master_snapshot_done();
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+               else if(rs485_master_state_timer >= RS485_MASTER_RESPONSE_TIMEOUT_TICKS)
+               {
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+            } /* RS485_MASTER_AWAIT_SLOTS */
+            break;
+         case RS485_MASTER_AWAIT_CONFIG:
+            {
+               /* Unique ID answers can come in any of the configuration slots. */
+               if(((rs485_master_tx_done)&&((rs485_master_tick - rs485_master_tx_done_tick) >= RS485_CONFIG_WAIT_TICKS))||
+                  (rs485_master_state_timer >= (RS485_CONFIG_WAIT_TICKS + RS485_MASTER_RESPONSE_TIMEOUT_TICKS)))
+               {
+                  if(rs485_master_config_probe_address != 0)
+                  {
+                     /* Look for the slave on its new address straight away. */
+                     rs485_slave_table[rs485_master_config_probe_address - RS485_MASTER_FIRST_SLAVE_ADDRESS].backoff_ticks = RS485_MASTER_BACKOFF_MIN_TICKS;
+                     rs485_slave_table[rs485_master_config_probe_address - RS485_MASTER_FIRST_SLAVE_ADDRESS].next_poll_tick = rs485_master_tick;
+                     rs485_master_next_probe_tick = rs485_master_tick;
+                     rs485_master_config_probe_address = 0;
+                  }
+                  rs485_master_config_pending = 0;
+                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+               }
+            } /* RS485_MASTER_AWAIT_CONFIG */
+            break;
+         case RS485_MASTER_DELAY:
+            {
+               if(rs485_master_state_timer >= RS485_MASTER_DELAY_TICKS)
+               {
+                  if(rs485_master_discovery_active)
+                  {
+                     rs485_master_state_change(RS485_MASTER_FIND_ATTACHED_DEVICES, 1);
+                  }
+                  else
+                  {
+                     rs485_master_state_change(RS485_MASTER_IDLE, 1);
+                  }
+               }
+            } /* RS485_MASTER_DELAY */
+            break;
+         case RS485_MASTER_IDLE:
+            {
+               if(rs485_master_discovery_active)
+               {
+                  rs485_master_state_change(RS485_MASTER_FIND_ATTACHED_DEVICES, 1);
+               }
+               else if(rs485_master_config_pending)
+               {
+                  rs485_master_write_dma(rs485_master_config_packet.gp, (rs485_master_config_packet.packet_length + GP_ALIGNMENT_PADDING));
+                  rs485_master_state_change(RS485_MASTER_AWAIT_CONFIG, 1);
+               }
+               else if((rs485_master_snapshot_period_ticks != 0)&&
+                       ((int32_t)(rs485_master_tick - rs485_master_snapshot_next_tick) >= 0))
+               {
+                  rs485_master_snapshot_next_tick += rs485_master_snapshot_period_ticks;
+                  if((int32_t)(rs485_master_tick - rs485_master_snapshot_next_tick) > 0)
+                  {
+                     rs485_master_snapshot_next_tick = rs485_master_tick + rs485_master_snapshot_period_ticks;
+                  }
+                  rs485_master_send_snapshot();
+               }
+               else if(rs485_master_next_due_slave(&current_slave_address))
+               {
+                  rs485_master_timeout_ticks = rs485_master_select_timeout(current_slave_address);
+                  rs485_master_send_query();
+               }
+            } /* RS_485_MASTER_IDLE */
+            break;
+         case RS485_MASTER_ERROR:
+            {
+            } /* RS_485_MASTER_ERROR */
+            break;
+         default:
+            {
+            } /* default */
+            break;
+      } /* switch(master_state) */
+
+      /* GPIO_ResetBits(GPIOD, LED_PIN_ORANGE); */
+
+      hal_timer_update_clear(HAL_TIMER_RS485_MASTER);
+   }
+
+   PROFILE_EXIT(PROFILE_ID_TIM9);
+}
+
+
+/**
+ *
+ * @fn void rs485_master_send_query(void)
+ * @brief Sends the sensor info query to current_slave_address.
+ *
+ * Must only be called from TIM1_BRK_TIM9_IRQHandler or USART2_IRQHandler,
+ * which share a preemption priority so they never interrupt each other.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_send_query(void)
+{
+   uint8_t retval;
+
+   retval = create_rs485_query_sensor_info(&rs485_master_query_packet, current_slave_address);
+   if(retval == GP_SUCCESS)
+   {
+      response_received = 0;
+      rs485_master_first_byte_seen = 0;
+      rs485_master_frame_ended = 0;
+      rs485_master_frame_garbled = 0;
+      rs485_master_write_dma(rs485_master_query_packet.gp, (rs485_master_query_packet.packet_length + GP_ALIGNMENT_PADDING));
+      rs485_master_state_change(RS485_MASTER_AWAIT_RESPONSE, 1);
+   }
+   else
+   {
+      rs485_master_state_change(RS485_MASTER_DELAY, 1);
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_frame_complete(void)
+ * @brief Frees the bus as soon as the response is on board.
+ *
+ * Called from the idle line interrupt in pipelined mode.  The slave already
+ * let go of the bus before its last stop bit left, so the next due query
+ * can go out right away.  Discovery, a pending configuration packet, a due
+ * snapshot and an empty schedule go back through the state machine as
+ * usual, otherwise back to back polls would never let them in.
+ *
+ * Nothing is known about the frame yet except that it ended, it may be
+ * noise or fail its checksum.  The exchange is queued for
+ * rs485_master_check_responses() to settle once the frame is parsed.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_frame_complete(void)
+{
+   rs485_master_check_t *check;
+   rs485_slave_entry_t *entry;
+   uint16_t received;
+   uint8_t next;
+
+   if(rs485_master_first_byte_seen == 0)
+   {
+      rs485_master_turnaround_usec = rs485_master_measure_turnaround(hal_usart_dma_rx_head(HAL_USART_RS485_MASTER));
+   }
+
+   /* The whole frame has to be counted before its end is noted. */
+   rs485_master_process_rx_dma();
+
+   /* A slave can only be waiting once.  A rediscovery probing it again drops
+    * the second result, the first one settles the slave.
+    */
+   entry = &(rs485_slave_table[current_slave_address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
+   next = (rs485_master_checks_head + 1) % RS485_MASTER_CHECKS;
+   if((entry->checking == 0)&&(next != rs485_master_checks_tail))
+   {
+      check = &(rs485_master_checks[rs485_master_checks_head]);
+      check->address = current_slave_address;
+      check->turnaround_usec = rs485_master_turnaround_usec;
+      /* The head wraps with the circular buffer. */
+      received = (hal_usart_dma_rx_head(HAL_USART_RS485_MASTER) + DMA_RX_BUFFER_SIZE -
+                  rs485_master_tx_done_rx_head) % DMA_RX_BUFFER_SIZE;
+      check->start = rs485_master_rx_bytes - received;
+      check->end = rs485_master_rx_bytes;
+      entry->checking = 1;
+      rs485_master_checks_head = next;
+   }
+   rs485_master_frames_completed++;
+
+   if((rs485_master_discovery_active == 0)&&(rs485_master_config_pending == 0)&&
+      ((rs485_master_snapshot_period_ticks == 0)||((int32_t)(rs485_master_tick - rs485_master_snapshot_next_tick) < 0))&&
+      (rs485_master_next_due_slave(&current_slave_address)))
+   {
+      rs485_master_timeout_ticks = rs485_master_select_timeout(current_slave_address);
+      rs485_master_send_query();
+   }
+   else
+   {
+      rs485_master_state_change(RS485_MASTER_DELAY, 1);
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_check_responses(void)
+ * @brief Settles pipelined exchanges whose frames have been parsed.
+ *
+ * Called from rs485_master_process_rx_ram() before every byte.  The parser
+ * can get to the end of a frame before the idle line interrupt queues it, so
+ * packets are handled as they complete and only their end is kept.  A sensor
+ * info response to the master ending within the frame means the slave
+ * answered, anything else counts as a miss.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_check_responses(void)
+{
+   rs485_master_check_t *check;
+   uint32_t primask;
+   uint8_t responded;
+
+   while((rs485_master_checks_tail != rs485_master_checks_head)&&
+         ((int32_t)(rs485_master_rx_parsed - rs485_master_checks[rs485_master_checks_tail].end) >= 0))
+   {
+      check = &(rs485_master_checks[rs485_master_checks_tail]);
+
+      /* Signed differences so the byte counts can wrap. */
+      responded = ((int32_t)(rs485_master_valid_end - check->start) > 0)&&
+                  ((int32_t)(check->end - rs485_master_valid_end) >= 0);
+
+      /* The slave table is shared with TIM9 and the idle line interrupt. */
+      primask = hal_irq_save();
+      if(responded)
+      {
+         rs485_master_record_turnaround(check->address, check->turnaround_usec);
+      }
+      rs485_master_transaction_done(check->address, responded);
+      rs485_slave_table[check->address - RS485_MASTER_FIRST_SLAVE_ADDRESS].checking = 0;
+      hal_irq_restore(primask);
+
+      rs485_master_checks_tail = (rs485_master_checks_tail + 1) % RS485_MASTER_CHECKS;
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_send_snapshot(void)
+ * @brief Broadcasts a sync/sample command to every slave.
+ *
+ * Only addresses up to the highest live slave get a slot, absent ones in
+ * between still cost their slot.  Nothing is sent if no slave is live.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_send_snapshot(void)
+{
+   uint8_t retval;
+   uint8_t ii;
+
+   rs485_master_num_slots = 0;
+   for(ii=0; ii<RS485_MASTER_MAX_SLAVES; ii++)
+   {
+      if(rs485_slave_table[ii].present)
+      {
+         rs485_master_num_slots = ii + 1;
+      }
+   }
+
+   if(rs485_master_num_slots == 0)
+   {
+      return;
+   }
+
+   retval = create_rs485_sync_sample(&rs485_master_query_packet, (uint16_t)(rs485_master_slot_ticks * RS485_MASTER_TICK_USEC));
+   if(retval == GP_SUCCESS)
+   {
+      rs485_master_slots_heard = 0;
+      rs485_master_snapshots++;
+      rs485_master_write_dma(rs485_master_query_packet.gp, (rs485_master_query_packet.packet_length + GP_ALIGNMENT_PADDING));
+      rs485_master_state_change(RS485_MASTER_AWAIT_SLOTS, 1);
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_slot_heard(void)
+ * @brief Credits the frame that just ended to the slot it was sent in.
+ *
+ * Called from the idle line interrupt, one character time after the frame's
+ * last byte.  The slave started sending at the beginning of its slot, up to
+ * a tick late, so the frame is credited by when it started: the time since
+ * the broadcast ended, less its bytes and the idle character.  Counting
+ * from the end instead would push a long frame into the next slot.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_slot_heard(void)
+{
+   uint32_t since_sync;
+   uint32_t frame_cycles;
+   uint32_t slot_cycles;
+   uint32_t slot;
+   uint16_t rx_head;
+
+   /* The head wraps with the circular buffer. */
+   rx_head = hal_usart_dma_rx_head(HAL_USART_RS485_MASTER);
+   frame_cycles = (((rx_head + DMA_RX_BUFFER_SIZE - rs485_master_slot_rx_head) % DMA_RX_BUFFER_SIZE) + 1) * rs485_master_byte_cycles;
+   rs485_master_slot_rx_head = rx_head;
+
+   since_sync = hal_cycles() - rs485_master_tx_done_cycles;
+   slot_cycles = rs485_master_slot_ticks * (SystemCoreClock / RS485_SENSOR_BUS_SM_HZ);
+   if(since_sync < (frame_cycles + slot_cycles))
+   {
+      return;
+   }
+
+   slot = ((since_sync - frame_cycles) / slot_cycles) - 1;
+   if(slot < rs485_master_num_slots)
+   {
+      rs485_master_slots_heard |= (1UL << slot);
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_snapshot_done(void)
+ * @brief Updates the slave table once every slot has passed.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_snapshot_done(void)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<rs485_master_num_slots; ii++)
+   {
+      if(rs485_slave_table[ii].present)
+      {
+         rs485_master_transaction_done(RS485_MASTER_FIRST_SLAVE_ADDRESS + ii, ((rs485_master_slots_heard >> ii) & 0x01));
+      }
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_master_state_change(rs485_slave_states new_state, uint8_t reset_timer)
+ * @brief
+ * @param new_state Must be of type rs485_master_states.
+ * @param reset_timer Anything other than 0 will result in the timer being reset
+ * going into the next state.
+ * @return None
+ *
+ */
+void rs485_master_state_change(rs485_master_states new_state, uint8_t reset_timer)
+{
+   if(reset_timer)
+   {
+      rs485_master_state_timer = 0;
+   }
+
+   TRACE(TRACE_ID_RS485_MASTER_STATE, new_state, master_state);
+   master_state = new_state;
+}
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t rs485_master_set_poll_rate(uint8_t address, uint16_t hz)
+{
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
+   {
+      return RS485_SB_BAD_ADDRESS;
+   }
+
+   if((hz == 0)||(hz > RS485_SENSOR_BUS_SM_HZ))
+   {
+      return RS485_SB_BAD_RATE;
+   }
+
+   rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS].poll_period_ticks = RS485_SENSOR_BUS_SM_HZ / hz;
+
+   return RS485_SB_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void rs485_master_set_pipelined(uint8_t enable)
+{
+   rs485_master_pipelined = (enable != 0);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t rs485_master_set_snapshot_rate(uint16_t hz, uint16_t slot_usec)
+{
+   uint32_t slot_ticks;
+
+   if(hz > RS485_SENSOR_BUS_SM_HZ)
+   {
+      return RS485_SB_BAD_RATE;
+   }
+
+   slot_ticks = slot_usec / RS485_MASTER_TICK_USEC;
+   if(slot_ticks < RS485_TDMA_MIN_SLOT_TICKS)
+   {
+      slot_ticks = RS485_TDMA_MIN_SLOT_TICKS;
+   }
+
+   rs485_master_slot_ticks = slot_ticks;
+   rs485_master_snapshot_next_tick = rs485_master_tick;
+   rs485_master_snapshot_period_ticks = (hz != 0) ? (RS485_SENSOR_BUS_SM_HZ / hz) : 0;
+
+   return RS485_SB_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t rs485_master_query_unique_id(uint8_t address)
+{
+   uint8_t retval;
+
+   if(rs485_master_config_pending)
+   {
+      return RS485_SB_BUSY;
+   }
+
+   retval = create_rs485_query_unique_id(&rs485_master_config_packet, address);
+   if(retval != GP_SUCCESS)
+   {
+      return RS485_SB_BAD_ADDRESS;
+   }
+
+   rs485_master_config_probe_address = 0;
+   rs485_master_config_pending = 1;
+
+   return RS485_SB_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t rs485_master_assign_address(const uint32_t *unique_id, uint8_t address)
+{
+   uint8_t retval;
+
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
+   {
+      return RS485_SB_BAD_ADDRESS;
+   }
+
+   if(rs485_master_config_pending)
+   {
+      return RS485_SB_BUSY;
+   }
+
+   retval = create_rs485_set_address(&rs485_master_config_packet, unique_id, address);
+   if(retval != GP_SUCCESS)
+   {
+      return RS485_SB_BAD_ADDRESS;
+   }
+
+   rs485_master_config_probe_address = address;
+   rs485_master_config_pending = 1;
+
+   return RS485_SB_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void rs485_master_rediscover(void)
+{
+   /* Don't yank the state out from under a transaction on the wire, IDLE and
+    * DELAY pick this up on their own.
+    */
+   rs485_master_discovery_index = 0;
+   rs485_master_discovery_active = 1;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t rs485_master_forward_drops(void)
+{
+   return rs485_master_forward_dropped;
+}
+
+
+/**
+ *
+ * @fn GenericPacket * rs485_master_forward_get(uint8_t *index)
+ * @brief Finds a free packet to pass an answer upstream in.
+ *
+ * Only the main loop builds answers, the TX complete callback only frees
+ * them, so a packet found free stays free until rs485_master_forward().
+ *
+ * @param index Set to the packet's index for rs485_master_forward().
+ * @return GenericPacket* The packet, NULL (and counted) if all are busy.
+ *
+ */
+GenericPacket * rs485_master_forward_get(uint8_t *index)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<RS485_MASTER_FORWARD_PACKETS; ii++)
+   {
+      if(rs485_master_forward_busy[ii] == 0)
+      {
+         *index = ii;
+         return &(rs485_master_forward_packets[ii]);
+      }
+   }
+
+   rs485_master_forward_dropped++;
+
+   return NULL;
+}
+
+
+/**
+ *
+ * @fn void rs485_master_forward(uint8_t index)
+ * @brief Queues a packet from rs485_master_forward_get() on the link.
+ * @param index From rs485_master_forward_get().
+ * @return None
+ *
+ */
+void rs485_master_forward(uint8_t index)
+{
+   rs485_master_forward_busy[index] = 1;
+   if(full_duplex_usart_dma_add_to_queue(&(rs485_master_forward_packets[index]), &rs485_master_forward_sent, index) != FDUD_SUCCESS)
+   {
+      rs485_master_forward_busy[index] = 0;
+      rs485_master_forward_dropped++;
+   }
+}
+
+
+/* PRIVATE rs485_master_forward_sent
+ *
+ * Notes:
+ *  +FDUD_TxQueueCallback for the forwarded answers, frees the packet.
+ */
+void rs485_master_forward_sent(uint32_t index)
+{
+   rs485_master_forward_busy[index] = 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+const rs485_slave_entry_t * rs485_master_get_slave(uint8_t address)
+{
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
+   {
+      return NULL;
+   }
+
+   return &(rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
+}
+
+
+/**
+ *
+ * @fn void rs485_master_slave_table_init(void)
+ * @brief Marks every address absent and arms the discovery sweep.
+ * @param None
+ * @return None
+ *
+ */
+void rs485_master_slave_table_init(void)
+{
+   uint8_t ii;
+
+   for(ii=0; ii<RS485_MASTER_MAX_SLAVES; ii++)
+   {
+      rs485_slave_table[ii].present = 0;
+      rs485_slave_table[ii].misses = 0;
+      rs485_slave_table[ii].checking = 0;
+      rs485_slave_table[ii].poll_period_ticks = RS485_SENSOR_BUS_SM_HZ / RS485_MASTER_DEFAULT_POLL_HZ;
+      rs485_slave_table[ii].backoff_ticks = RS485_MASTER_BACKOFF_MIN_TICKS;
+      rs485_slave_table[ii].next_poll_tick = rs485_master_tick;
+      rs485_slave_table[ii].responses = 0;
+      rs485_slave_table[ii].timeouts = 0;
+      rs485_master_clear_latency(RS485_MASTER_FIRST_SLAVE_ADDRESS + ii);
+   }
+
+   rs485_master_next_probe_tick = rs485_master_tick;
+   rs485_master_discovery_index = 0;
+   rs485_master_discovery_active = 1;
+}
+
+
+/**
+ *
+ * @fn uint8_t rs485_master_next_due_slave(uint8_t *address)
+ * @brief Picks the most overdue slave, live or absent.
+ *
+ * Absent addresses are only due once their back-off has expired, and only
+ * one of them per RS485_MASTER_PROBE_SPACING_TICKS.  Otherwise every address
+ * that comes due while a probe times out is more overdue than any live
+ * slave, and a bus with few slaves spends most of its time on probes.  A
+ * slave whose last response is still being checked isn't due.  Ties go to
+ * the lowest address.
+ *
+ * @param address Set to the slave to query next.
+ * @return 1 if a slave is due, 0 if the bus can stay idle.
+ *
+ */
+uint8_t rs485_master_next_due_slave(uint8_t *address)
+{
+   uint8_t ii;
+   uint8_t found = 0;
+   uint8_t probing;
+   int32_t late;
+   int32_t most_late = 0;
 
+   /* Signed differences so the tick counter can wrap. */
+   probing = ((int32_t)(rs485_master_tick - rs485_master_next_probe_tick) >= 0);
 
-/* Public Function - Doxygen documentation is in the header file. */
-void rs485_master_spin(void)
-{
-   rs485_master_process_rx_ram();
-   rs485_master_handle_packets();
+   for(ii=0; ii<RS485_MASTER_MAX_SLAVES; ii++)
+   {
+      late = (int32_t)(rs485_master_tick - rs485_slave_table[ii].next_poll_tick);
+      if((late >= 0)&&(rs485_slave_table[ii].checking == 0)&&((rs485_slave_table[ii].present)||(probing))&&
+         ((found == 0)||(late > most_late)))
+      {
+         most_late = late;
+         *address = RS485_MASTER_FIRST_SLAVE_ADDRESS + ii;
+         found = 1;
+      }
+   }
+
+   if((found)&&(rs485_slave_table[*address - RS485_MASTER_FIRST_SLAVE_ADDRESS].present == 0))
+   {
+      rs485_master_next_probe_tick = rs485_master_tick + RS485_MASTER_PROBE_SPACING_TICKS;
+   }
+
+   return found;
 }
 
+
 /**
  *
- * @fn TIM1_BRK_TIM9_IRQHandler
- * @brief RS485 Master State Machine
+ * @fn void rs485_master_transaction_done(uint8_t address, uint8_t responded)
+ * @brief Updates the slave table and schedules the next query to a slave.
  *
- * This function serves two purposes.
- * - Move bytes from the DMA circular buffer to a RAM buffer in a timely fashion
- * - Handle state related code for the RS485 master
+ * A live slave keeps its own poll period from the time it was due (not from
+ * now) so its rate doesn't drift with bus load.  A slave that misses
+ * RS485_MASTER_MAX_MISSES in a row, or an address that never answered,
+ * is re-probed at an exponentially growing interval.
  *
- * @param None
+ * @param address Slave that was queried.
+ * @param responded Non zero if a response arrived before the timeout.
  * @return None
  *
  */
-void TIM1_BRK_TIM9_IRQHandler(void)
+void rs485_master_transaction_done(uint8_t address, uint8_t responded)
 {
-   GenericPacket packet_query;
-   uint8_t retval;
+   rs485_slave_entry_t *entry;
 
-   if(TIM_GetITStatus(TIM9, TIM_IT_Update) != RESET)
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
    {
+      return;
+   }
 
-      /* GPIO_SetBits(GPIOD, LED_PIN_ORANGE); */
+   entry = &(rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
 
-      rs485_master_state_timer++;
+   if(responded)
+   {
+      entry->responses++;
+      entry->misses = 0;
+      entry->backoff_ticks = RS485_MASTER_BACKOFF_MIN_TICKS;
 
-      /* Always move received data out of the dma buffer to be processed outside
-       * of the interrupt.  We don't want to take too long in here.
-       */
-      rs485_master_process_rx_dma();
-      /* rs485_master_process_rx_ram(); */
-      /* rs485_master_handle_packets(); */
+      if(entry->present)
+      {
+         entry->next_poll_tick += entry->poll_period_ticks;
+         /* Don't try to catch up on a backlog, just start over from now. */
+         if((int32_t)(rs485_master_tick - entry->next_poll_tick) > (int32_t)entry->poll_period_ticks)
+         {
+            entry->next_poll_tick = rs485_master_tick;
+         }
+      }
+      else
+      {
+         entry->present = 1;
+         entry->next_poll_tick = rs485_master_tick + entry->poll_period_ticks;
+      }
+   }
+   else
+   {
+      entry->timeouts++;
+      if(entry->misses < 0xFF)
+      {
+         entry->misses++;
+      }
 
-      switch(master_state)
+      if((entry->present)&&(entry->misses < RS485_MASTER_MAX_MISSES))
       {
-         case RS485_MASTER_INIT:
-            {
-               rs485_master_state_change(RS485_MASTER_DELAY, 1);
-            } /* RS485_MASTER_INIT */
-            break;
-         case RS485_MASTER_FIND_ATTACHED_DEVICES:
-            {
+         entry->next_poll_tick = rs485_master_tick + entry->poll_period_ticks;
+      }
+      else
+      {
+         entry->present = 0;
+         entry->next_poll_tick = rs485_master_tick + entry->backoff_ticks;
+         entry->backoff_ticks = entry->backoff_ticks * 2;
+         if(entry->backoff_ticks > RS485_MASTER_BACKOFF_MAX_TICKS)
+         {
+            entry->backoff_ticks = RS485_MASTER_BACKOFF_MAX_TICKS;
+         }
+      }
+   }
+}
 
-            } /* RS485_MASTER_FIND_ATTACHED_DEVICES */
-            break;
-         case RS485_MASTER_QUERY_DEVICE:
-            {
-               if(current_slave_address == 0x01)
-               {
-                  current_slave_address = 0x02;
-               }
-               else
-               {
-                  current_slave_address = 0x01;
-               }
-               retval = create_rs485_query_sensor_info(&packet_query, current_slave_address);
-               if(retval == GP_SUCCESS)
-               {
-                  response_received = 0;
-                  rs485_master_write_dma(packet_query.gp, (packet_query.packet_length + GP_ALIGNMENT_PADDING));
-                  rs485_master_state_change(RS485_MASTER_AWAIT_RESPONSE, 1);
-               }
-               else
-               {
-                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
-               }
-            } /* RS485_MASTER_QUERY_DEVICE */
-            break;
-         case RS485_MASTER_AWAIT_RESPONSE:
-            {
-               if(rs485_master_state_timer >= RS485_MASTER_RESPONSE_TIMEOUT_TICKS)
-               {
-                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
-               }
 
-               if(response_received)
-               {
-                  rs485_master_state_change(RS485_MASTER_DELAY, 1);
+/* Public Function - Doxygen documentation is in the header file. */
+void rs485_master_clear_latency(uint8_t address)
+{
+   rs485_slave_entry_t *entry;
+   uint8_t ii;
 
-                  /* rs485_master_state_change(RS485_MASTER_QUERY_DEVICE, 1); */
-               }
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
+   {
+      return;
+   }
 
-            } /* RS485_MASTER_AWAIT_RESPONSE */
-            break;
-         case RS485_MASTER_DELAY:
-            {
-               if(rs485_master_state_timer >= RS485_MASTER_DELAY_TICKS)
-               {
-                  rs485_master_state_change(RS485_MASTER_QUERY_DEVICE, 1);
-               }
-            } /* RS485_MASTER_DELAY */
-            break;
-         case RS485_MASTER_IDLE:
-            {
-            } /* RS_485_MASTER_IDLE */
-            break;
-         case RS485_MASTER_ERROR:
-            {
-            } /* RS_485_MASTER_ERROR */
-            break;
-         default:
-            {
-            } /* default */
-            break;
-      } /* switch(master_state) */
+   entry = &(rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
 
-      /* GPIO_ResetBits(GPIOD, LED_PIN_ORANGE); */
+   entry->latency_samples = 0;
+   entry->timeout_ticks = 0;
+   entry->p99_x16 = 0;
+   entry->dev_x16 = 0;
+   for(ii=0; ii<RS485_MASTER_LATENCY_BINS; ii++)
+   {
+      entry->latency_hist[ii] = 0;
+   }
+}
+
+
+/**
+ *
+ * @fn uint32_t rs485_master_select_timeout(uint8_t address)
+ * @brief Picks the turnaround timeout for the next query.
+ *
+ * Absent addresses get the short probe timeout, live slaves their measured
+ * timeout once there is enough data, otherwise the fixed one.
+ *
+ * @param address Slave about to be queried.
+ * @return Timeout in state machine ticks, counted from transmit complete.
+ *
+ */
+uint32_t rs485_master_select_timeout(uint8_t address)
+{
+   rs485_slave_entry_t *entry;
+
+   entry = &(rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
+
+   if((entry->present == 0)||(rs485_master_discovery_active))
+   {
+      return RS485_MASTER_PROBE_TIMEOUT_TICKS;
+   }
 
-      TIM_ClearITPendingBit(TIM9, TIM_IT_Update);
+   if(entry->timeout_ticks != 0)
+   {
+      return entry->timeout_ticks;
    }
 
+   return RS485_MASTER_RESPONSE_TIMEOUT_TICKS;
 }
 
 
 /**
  *
- * @fn void rs485_master_state_change(rs485_slave_states new_state, uint8_t reset_timer)
- * @brief
- * @param new_state Must be of type rs485_master_states.
- * @param reset_timer Anything other than 0 will result in the timer being reset
- * going into the next state.
+ * @fn uint32_t rs485_master_measure_turnaround(uint16_t rx_head)
+ * @brief Measures the current slave's turnaround.
+ *
+ * The first byte isn't time stamped directly, we only notice it at the next
+ * state machine tick.  By then n bytes have arrived back to back, so the
+ * turnaround is at most the elapsed time minus n byte times.  That bound is
+ * exact when the frame is still arriving and at worst one tick high when the
+ * whole frame fit in between ticks, which errs towards a longer timeout.
+ *
+ * @param rx_head RX DMA head when the first byte was noticed.
+ * @return Turnaround in usec.
+ *
+ */
+uint32_t rs485_master_measure_turnaround(uint16_t rx_head)
+{
+   uint32_t elapsed;
+   uint32_t received;
+
+   elapsed = hal_cycles() - rs485_master_tx_done_cycles;
+   /* The head wraps with the circular buffer. */
+   received = (rx_head + DMA_RX_BUFFER_SIZE - rs485_master_tx_done_rx_head) % DMA_RX_BUFFER_SIZE;
+   if(elapsed > (received * rs485_master_byte_cycles))
+   {
+      elapsed = elapsed - (received * rs485_master_byte_cycles);
+   }
+   else
+   {
+      elapsed = 0;
+   }
+
+   return elapsed / (SystemCoreClock / 1000000);
+}
+
+
+/**
+ *
+ * @fn void rs485_master_record_turnaround(uint8_t address, uint32_t turnaround_usec)
+ * @brief Adds one turnaround measurement for a slave.
+ *
+ * Only called once the response has been checked, a frame that turns out to
+ * be noise doesn't count.
+ *
+ * @param address Slave that answered.
+ * @param turnaround_usec From rs485_master_measure_turnaround().
  * @return None
  *
  */
-void rs485_master_state_change(rs485_master_states new_state, uint8_t reset_timer)
+void rs485_master_record_turnaround(uint8_t address, uint32_t turnaround_usec)
 {
-   if(reset_timer)
+   rs485_slave_entry_t *entry;
+   uint32_t sample_x16;
+   uint32_t distance_x16;
+   uint32_t step_x16;
+   uint8_t bin;
+
+   if((address < RS485_MASTER_FIRST_SLAVE_ADDRESS)||(address >= (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
    {
-      rs485_master_state_timer = 0;
+      return;
    }
 
-   master_state = new_state;
+   entry = &(rs485_slave_table[address - RS485_MASTER_FIRST_SLAVE_ADDRESS]);
+
+   bin = 0;
+   while((bin < (RS485_MASTER_LATENCY_BINS - 1))&&((turnaround_usec >> (bin + 1)) != 0))
+   {
+      bin++;
+   }
+   if(entry->latency_hist[bin] < 0xFFFF)
+   {
+      entry->latency_hist[bin]++;
+   }
+
+   sample_x16 = turnaround_usec << RS485_MASTER_P99_FRAC_BITS;
+   if(entry->latency_samples == 0)
+   {
+      /* Start high, coming down is 99 times slower than going up. */
+      entry->p99_x16 = 2 * sample_x16;
+      entry->dev_x16 = sample_x16;
+   }
+   else
+   {
+      distance_x16 = (sample_x16 > entry->p99_x16) ? (sample_x16 - entry->p99_x16) : (entry->p99_x16 - sample_x16);
+      if(distance_x16 > entry->dev_x16)
+      {
+         entry->dev_x16 += (distance_x16 - entry->dev_x16) >> RS485_MASTER_P99_DEV_SHIFT;
+      }
+      else
+      {
+         entry->dev_x16 -= (entry->dev_x16 - distance_x16) >> RS485_MASTER_P99_DEV_SHIFT;
+      }
+
+      step_x16 = entry->dev_x16 >> RS485_MASTER_P99_STEP_SHIFT;
+      if(step_x16 < RS485_MASTER_P99_STEP)
+      {
+         step_x16 = RS485_MASTER_P99_STEP;
+      }
+
+      if(sample_x16 > entry->p99_x16)
+      {
+         entry->p99_x16 += 99 * step_x16;
+      }
+      else if(entry->p99_x16 >= step_x16)
+      {
+         entry->p99_x16 -= step_x16;
+      }
+      else
+      {
+         entry->p99_x16 = 0;
+      }
+   }
+   entry->latency_samples++;
+
+   if(entry->latency_samples >= RS485_MASTER_LATENCY_MIN_SAMPLES)
+   {
+      entry->timeout_ticks = ((RS485_MASTER_TIMEOUT_P99_MULT * (entry->p99_x16 >> RS485_MASTER_P99_FRAC_BITS)) / RS485_MASTER_TICK_USEC) + 1;
+      if(entry->timeout_ticks < RS485_MASTER_MIN_TIMEOUT_TICKS)
+      {
+         entry->timeout_ticks = RS485_MASTER_MIN_TIMEOUT_TICKS;
+      }
+      if(entry->timeout_ticks > RS485_MASTER_RESPONSE_TIMEOUT_TICKS)
+      {
+         entry->timeout_ticks = RS485_MASTER_RESPONSE_TIMEOUT_TICKS;
+      }
+   }
 }
 
 
@@ -238,9 +1231,22 @@ uint8_t rs485_sensor_bus_init_master(void)
    else
    {
 
+      /* Turnaround times are measured in core cycles.  One byte is 10 bits
+       * on the wire.
+       */
+      hal_cycles_init();
+      rs485_master_byte_cycles = (SystemCoreClock / RS485_SENSOR_BUS_BAUD) * 10;
+
+      for(retval=0; retval<RS485_MASTER_FORWARD_PACKETS; retval++)
+      {
+         rs485_master_forward_busy[retval] = 0;
+      }
+      rs485_master_forward_dropped = 0;
+
       /* Finish up! */
       rs485_sensor_bus_init_master_communications();
       rs485_sensor_bus_init_master_state_machine();
+      watchdog_register(WATCHDOG_TASK_RS485, WATCHDOG_RS485_DEADLINE_MS);
 
       /* /\* Everyone else should hold tight until this is set! *\/ */
       rs485_master_initialized = 1;
@@ -263,15 +1269,9 @@ uint8_t rs485_sensor_bus_init_master(void)
 void rs485_sensor_bus_init_master_state_machine(void)
 {
 
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
-   NVIC_InitTypeDef   NVIC_InitStructure;
-
    uint32_t TimerPeriod = 0;
    uint16_t pscale = 0;
 
-   /* Turn the timer clock on! */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM9, ENABLE);
-
    /* TIM9 on APB2 runs at SystemCoreClock. */
    pscale = 3;
    TimerPeriod = (SystemCoreClock / (RS485_SENSOR_BUS_SM_HZ * (pscale+1))) - 1;
@@ -282,26 +1282,8 @@ void rs485_sensor_bus_init_master_state_machine(void)
       TimerPeriod = 0xFFFF;
    }
 
-   /* Time Base configuration */
-   TIM_TimeBaseStructure.TIM_Prescaler = pscale;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-   TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
-   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
-
-   TIM_TimeBaseInit(TIM9, &TIM_TimeBaseStructure);
-
    /** @todo Determine appropriate interrupt priority here. */
-   /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM1_BRK_TIM9_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x01;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-   TIM_ITConfig(TIM9, TIM_IT_Update, ENABLE);
-
-   TIM_Cmd(TIM9, ENABLE);
+   hal_timer_init(HAL_TIMER_RS485_MASTER, pscale, TimerPeriod, 0x00, 0x01);
 
 }
 
@@ -313,7 +1295,7 @@ void rs485_sensor_bus_init_master_state_machine(void)
  *
  * The master is currently set up on the following hardware.
  * USART2
- *  - Tx  -> D5, DMA1 - Channel 4 - Stream 6    (Or A2 to avoid RED LED)
+ *  - Tx  -> A2, DMA1 - Channel 4 - Stream 6    (D5 is the RED LED)
  *  - Rx  -> D6, DMA1 - Channel 4 - Stream 5
  *  - T/R -> D7
  *
@@ -325,121 +1307,20 @@ void rs485_sensor_bus_init_master_communications(void)
 {
    /* Master RS485 is going to use:
     *  USART2
-    *  Tx  -> D5, DMA1 - Channel 4 - Stream 6    (Or A2 to avoid RED LED)
+    *  Tx  -> A2, DMA1 - Channel 4 - Stream 6    (D5 is the RED LED)
     *  Rx  -> D6, DMA1 - Channel 4 - Stream 5
     *  T/R -> D7
     */
-   USART_InitTypeDef USART_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-   GPIO_InitTypeDef  GPIO_InitStructure;
-   DMA_InitTypeDef  DMA_InitStructure;
-
-   uint8_t retval;
-
-   /* Enable DMA Clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE);
-   /* Enable the USART Clock */
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
-
-   /* Enable GPIO clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOD, ENABLE);
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
-
-   /* Set up GPIO for T/R line. */
-   GPIO_StructInit(&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-   GPIO_Init(GPIOD, &GPIO_InitStructure);
-
-   /* Connect PXx to USARTx_Tx*/
-   GPIO_PinAFConfig(GPIOA, GPIO_PinSource2, GPIO_AF_USART2);
-   /* Connect PXx to USARTx_Rx*/
-   GPIO_PinAFConfig(GPIOD, GPIO_PinSource6, GPIO_AF_USART2);
-   /* Configure USART Tx as alternate function */
-   GPIO_StructInit(&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_2;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-   /* Configure USART Rx as alternate function  */
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6;
-   GPIO_Init(GPIOD, &GPIO_InitStructure);
-
-
-   /* USART_InitStructure.USART_BaudRate = 115200; */
-   USART_InitStructure.USART_BaudRate = RS485_SENSOR_BUS_BAUD;
-   /* USART_InitStructure.USART_BaudRate = 1500000; */
-   USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-   USART_InitStructure.USART_StopBits = USART_StopBits_1;
-   USART_InitStructure.USART_Parity = USART_Parity_No;
-   USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-   USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
-
-   USART_OverSampling8Cmd(USART2, ENABLE);
-
-   /* USART configuration */
-   USART_Init(USART2, &USART_InitStructure);
-
-   /* Set up DMA Here!!!! */
-   /* Configure TX DMA */
-   DMA_DeInit(DMA1_Stream6);
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART2->DR));
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(rs485_master_dma_tx_buffer);;
-   DMA_InitStructure.DMA_Channel = DMA_Channel_4;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rs485_master_dma_tx_buffer;
-   DMA_Init(DMA1_Stream6, &DMA_InitStructure);
-   /* Configure RX DMA */
-   DMA_DeInit(DMA1_Stream5);
-   DMA_InitStructure.DMA_Channel = DMA_Channel_4;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rs485_master_dma_rx_buffer;
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(rs485_master_dma_rx_buffer);
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART2->DR));
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_Init(DMA1_Stream5, &DMA_InitStructure);
-   /* Enable the USART Rx DMA request */
-   USART_DMACmd(USART2, USART_DMAReq_Rx, ENABLE);
-   /* Enable the DMA RX Stream */
-   DMA_Cmd(DMA1_Stream5, ENABLE);
-
-   /* Enable USART */
-   USART_Cmd(USART2, ENABLE);
+   hal_gpio_init(HAL_PIN_RS485_MASTER_TR, HAL_GPIO_OUTPUT);
 
    /* Use DMA interrupt to flip the R/T line for RS485. */
-   NVIC_InitStructure.NVIC_IRQChannel = DMA1_Stream6_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
-   NVIC_Init(&NVIC_InitStructure);
-
-   DMA_ITConfig(DMA1_Stream6, DMA_IT_TC, DISABLE);
+   hal_usart_dma_init(HAL_USART_RS485_MASTER, RS485_SENSOR_BUS_BAUD, rs485_master_dma_rx_buffer,
+                      (uint16_t)sizeof(rs485_master_dma_rx_buffer), 1, 0);
 
+   /* Idle line closes pipelined exchanges and marks snapshot slots.  Same
+    * preemption priority as TIM9 so the two never interrupt each other.
+    */
+   hal_usart_idle_init(HAL_USART_RS485_MASTER, 0, 2);
 }
 
 
@@ -462,23 +1343,79 @@ void rs485_sensor_bus_init_master_communications(void)
  */
 void DMA1_Stream6_IRQHandler(void)
 {
-   if(DMA_GetITStatus(DMA1_Stream6, DMA_IT_TCIF6) != RESET)
+   PROFILE_ENTER();
+
+   if(hal_usart_dma_tx_complete(HAL_USART_RS485_MASTER))
    {
-      /* DMA is Done...we still need to wait for the last byte to exit the USART */
-      while (USART_GetFlagStatus(USART2, USART_FLAG_TC)==RESET);
-      while (DMA_GetFlagStatus(DMA1_Stream6, DMA_FLAG_TCIF6)==RESET);
+      /* DMA is Done...we still need to wait for the last byte to exit the
+       * USART.  Then the DMA and the USART DMA TX requests are turned off.
+       */
+      hal_usart_dma_tx_stop(HAL_USART_RS485_MASTER);
 
       /* Now put us in receive mode. */
       rs485_sensor_bus_master_rx();
 
-      /* Disable the DMA */
-      DMA_Cmd(DMA1_Stream6, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART2, USART_DMAReq_Tx, DISABLE);
+      /* Start of the slave's turnaround. */
+      rs485_master_tx_done_cycles = hal_cycles();
+      rs485_master_tx_done_tick = rs485_master_tick;
+      rs485_master_tx_done_rx_head = hal_usart_dma_rx_head(HAL_USART_RS485_MASTER);
+      rs485_master_slot_rx_head = rs485_master_tx_done_rx_head;
+      rs485_master_tx_done = 1;
+
+      hal_usart_dma_tx_clear(HAL_USART_RS485_MASTER);
+   }
+
+   PROFILE_EXIT(PROFILE_ID_DMA1_STREAM6);
+}
+
+
+/**
+ *
+ * @fn USART2_IRQHandler
+ * @brief Handles the idle line interrupt.
+ *
+ * The idle flag is set one character time after the last received byte.
+ * If that byte belongs to the response we are waiting for (anything arrived
+ * since our query finished) and pipelining is on, the exchange is done at
+ * the byte level and the next query is sent.  The response itself stays in
+ * the DMA/RAM buffers for rs485_master_spin() to check and dispatch.
+ * Stop-and-wait only notes where the frame ended, so a garbled response
+ * doesn't have to wait out the full timeout.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void USART2_IRQHandler(void)
+{
+   PROFILE_ENTER();
 
+   if(hal_usart_idle_pending(HAL_USART_RS485_MASTER))
+   {
+      hal_usart_idle_clear(HAL_USART_RS485_MASTER);
 
-      DMA_ClearITPendingBit(DMA1_Stream6, DMA_IT_TCIF6);
+      if((master_state == RS485_MASTER_AWAIT_RESPONSE)&&
+         (rs485_master_tx_done)&&(hal_usart_dma_rx_head(HAL_USART_RS485_MASTER) != rs485_master_tx_done_rx_head))
+      {
+         if(rs485_master_pipelined)
+         {
+            rs485_master_frame_complete();
+         }
+         else
+         {
+            /* The whole frame has to be counted before its end is noted. */
+            rs485_master_process_rx_dma();
+            rs485_master_frame_end = rs485_master_rx_bytes;
+            rs485_master_frame_ended = 1;
+         }
+      }
+      else if((master_state == RS485_MASTER_AWAIT_SLOTS)&&(rs485_master_tx_done))
+      {
+         rs485_master_slot_heard();
+      }
    }
+
+   PROFILE_EXIT(PROFILE_ID_USART2);
 }
 
 
@@ -494,7 +1431,7 @@ void rs485_sensor_bus_master_tx(void)
 {
    if(rs485_master_initialized)
    {
-      GPIO_SetBits(GPIOD, GPIO_Pin_7);
+      hal_gpio_set(HAL_PIN_RS485_MASTER_TR);
    }
 }
 
@@ -510,7 +1447,7 @@ void rs485_sensor_bus_master_rx(void)
 {
    if(rs485_master_initialized)
    {
-      GPIO_ResetBits(GPIOD, GPIO_Pin_7);
+      hal_gpio_clear(HAL_PIN_RS485_MASTER_TR);
    }
 }
 
@@ -529,32 +1466,12 @@ void rs485_master_write_dma(uint8_t *data, uint32_t length)
    if(rs485_master_initialized)
    {
 
-      /* Disable the DMA */
-      DMA_Cmd(DMA1_Stream6, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART2, USART_DMAReq_Tx, DISABLE);
-
-      /* Clear DMA Transfer Complete Flags */
-      DMA_ClearFlag(DMA1_Stream6, DMA_FLAG_TCIF6);
-      /* Clear USART Transfer Complete Flags */
-      USART_ClearFlag(USART2, USART_FLAG_TC);
-
       /* Make sure we are in transmit mode. */
       rs485_sensor_bus_master_tx();
+      rs485_master_tx_done = 0;
 
-
-      /* Enable the interrupt for RS485 R/T handling. */
-      DMA_ITConfig(DMA1_Stream6, DMA_IT_TC, ENABLE);
-
-      /* Set the length of data to transmit. */
-      DMA1_Stream6->NDTR = length;
-      /* Set the pointer to the data. */
-      DMA1_Stream6->M0AR = (uint32_t)data;
-
-      /* Enable USART DMA TX Requsts */
-      USART_DMACmd(USART2, USART_DMAReq_Tx, ENABLE);
-      /* Enable the DMA */
-      DMA_Cmd(DMA1_Stream6, ENABLE);
+      /* The transfer complete interrupt does the RS485 R/T handling. */
+      hal_usart_dma_tx_start(HAL_USART_RS485_MASTER, data, (uint16_t)length);
 
    }
 }
@@ -581,7 +1498,7 @@ void rs485_master_process_rx_dma(void)
    uint8_t rx_byte;
 
 
-   dma_head = (cb_master_dma_rx.cb_size - DMA1_Stream5->NDTR);
+   dma_head = hal_usart_dma_rx_head(HAL_USART_RS485_MASTER);
    retval = cb_set_head_dma(&cb_master_dma_rx, dma_head);
    if(retval == CB_SUCCESS)
    {
@@ -590,7 +1507,11 @@ void rs485_master_process_rx_dma(void)
          if(retval == CB_SUCCESS)
          {
             retval = cb_add_byte(&cb_master_ram_rx, rx_byte);
-
+            if(retval == CB_SUCCESS)
+            {
+               rs485_master_rx_bytes++;
+            }
+            event_post(EVENT_RS485_MASTER);
          }
       }while(retval == CB_SUCCESS);
    }
@@ -620,13 +1541,39 @@ void rs485_master_process_rx_ram(void)
    uint8_t rx_byte;
 
    do{
+      rs485_master_check_responses();
+
       retval = cb_get_byte(&cb_master_ram_rx, &rx_byte);
       if(retval == CB_SUCCESS)
       {
+         rs485_master_rx_parsed++;
          retval_gpcb = gpcb_receive_byte(rx_byte, &gpcbs_master_rx);
+         if(retval_gpcb == GP_CHECKSUM_MATCH)
+         {
+            /* Handled where it ends so pipelined exchanges can tell whose
+             * response it was.
+             */
+            rs485_master_response_valid = 0;
+            rs485_master_handle_packets();
+            if(rs485_master_response_valid)
+            {
+               rs485_master_valid_end = rs485_master_rx_parsed;
+            }
+         }
       }
    }while((retval == CB_SUCCESS)&&((retval_gpcb == GP_CIRC_BUFFER_SUCCESS)||(retval_gpcb == GP_ERROR_CHECKSUM_MISMATCH)||(retval_gpcb == GP_CHECKSUM_MATCH)));
 
+   rs485_master_check_responses();
+
+   /* Stop-and-wait, the whole frame has been through the parser and nothing
+    * in it was the response.
+    */
+   if((rs485_master_frame_ended)&&(response_received == 0)&&
+      ((int32_t)(rs485_master_rx_parsed - rs485_master_frame_end) >= 0))
+   {
+      rs485_master_frame_garbled = 1;
+   }
+
 }
 
 
@@ -650,8 +1597,10 @@ void rs485_master_handle_packets(void)
    uint8_t address, sensor_type;
    uint8_t retval_tail, retval;
    GenericPacket *gp_ptr;
-   GenericPacket gp_sensor_info;
+   GenericPacket *forward;
+   uint8_t forward_index;
    PoseIsh p;
+   uint32_t unique_id[RS485_UNIQUE_ID_WORDS];
 
    do{
       retval_tail = gpcb_increment_tail(&gpcbs_master_rx);
@@ -681,16 +1630,24 @@ void rs485_master_handle_packets(void)
                         /* GPIO_SetBits(GPIOD, LED_PIN_RED); */
 
                         response_received = 1;
+                        rs485_master_response_valid = 1;
                         /* Need to pass this data along to the ROS system. */
-                        retval = create_rs485_resp_sensor_info(&gp_sensor_info, RS485_ADDRESS_BROADCAST, sensor_type, p);
-                        if(retval == GP_SUCCESS)
+                        forward = rs485_master_forward_get(&forward_index);
+                        if((forward != NULL)&&(create_rs485_resp_sensor_info(forward, RS485_ADDRESS_BROADCAST, sensor_type, p) == GP_SUCCESS))
                         {
-                           /* usart_write_dma(gp_sensor_info.gp, gp_sensor_info.packet_length); */
-
-                           /** @todo AWALKER - Need to add a callback to know when this
-                            *  packet is free to use again.
-                            */
-                           full_duplex_usart_dma_add_to_queue(&gp_sensor_info, NULL, 0);
+                           rs485_master_forward(forward_index);
+                        }
+                     }
+                     break;
+                  case RS485_RESP_UNIQUE_ID:
+                     retval = extract_rs485_resp_unique_id(gp_ptr, &address, unique_id);
+                     if(retval == GP_SUCCESS)
+                     {
+                        /* address is the slave's, pass it upstream as is. */
+                        forward = rs485_master_forward_get(&forward_index);
+                        if((forward != NULL)&&(create_rs485_resp_unique_id(forward, address, unique_id) == GP_SUCCESS))
+                        {
+                           rs485_master_forward(forward_index);
                         }
                      }
                      break;
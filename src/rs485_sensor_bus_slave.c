@@ -8,6 +8,7 @@
  * slave on the sensor bus.
  */
 
+#include "hal.h"
 #include "rs485_sensor_bus.h"
 #include "circular_buffer.h"
 
@@ -19,6 +20,10 @@
 #include "full_duplex_usart_dma.h"
 
 #include "debug.h"
+#include "flash_kv.h"
+#include "event_scheduler.h"
+#include "profile.h"
+#include "watchdog.h"
 
 /* Buffers for raw data dma send and receive. */
 uint8_t rs485_slave_dma_tx_buffer[GP_MAX_PACKET_LENGTH];
@@ -37,7 +42,7 @@ GenericPacketCircularBuffer gpcbs_slave_rx;
 /* Let us know when we're up! */
 volatile uint8_t rs485_slave_initialized = 0;
 
-rs485_master_states slave_state = RS485_SLAVE_INIT;
+rs485_slave_states slave_state = RS485_SLAVE_INIT;
 uint32_t rs485_slave_state_timer = 0;
 
 GenericPacket gp_sensor_info;
@@ -47,6 +52,19 @@ uint8_t debug_slave_ii = 0;
 
 uint32_t num_query_sensor_info = 0;
 
+/* Broadcast snapshot (TDMA) timing, all in state machine ticks. */
+volatile uint32_t rs485_slave_tick = 0;
+volatile uint32_t rs485_slave_rx_tick = 0;
+volatile uint32_t rs485_slave_slot_tick = 0;
+uint32_t rs485_slave_missed_slots = 0;
+GenericPacket *rs485_slave_slot_packet = &gp_sensor_info;
+
+/* Address assignment.  The random state only picks configuration slots. */
+uint8_t rs485_slave_address = RS485_ADDRESS_CONFIGURATION;
+uint32_t rs485_slave_unique_id[RS485_UNIQUE_ID_WORDS];
+uint32_t rs485_slave_random = 1;
+GenericPacket gp_slave_unique_id;
+
 /* Private Function Prototypes */
 void rs485_sensor_bus_init_slave_state_machine(void);
 void rs485_sensor_bus_init_slave_communications(void);
@@ -57,13 +75,20 @@ void rs485_slave_write_dma(uint8_t *data, uint32_t length);
 void rs485_slave_process_rx_dma(void);
 void rs485_slave_process_rx_ram(void);
 void rs485_slave_handle_packets(void);
+void rs485_slave_sample(PoseIsh *p);
+void rs485_slave_arm_slot(GenericPacket *gp, uint32_t slot, uint16_t slot_usec);
+void rs485_slave_load_address(void);
 
 
 /* Public Function - Doxygen documentation is in the header file. */
 void rs485_slave_spin(void)
 {
+   PROFILE_ENTER();
+
    rs485_slave_process_rx_ram();
    rs485_slave_handle_packets();
+
+   PROFILE_EXIT(PROFILE_ID_RS485_SLAVE_SPIN);
 }
 
 
@@ -85,9 +110,18 @@ void TIM1_UP_TIM10_IRQHandler(void)
    GenericPacket packet_query;
    uint8_t retval;
 
-   if(TIM_GetITStatus(TIM10, TIM_IT_Update) != RESET)
+   PROFILE_ENTER_TIMER(PROFILE_ID_TIM10, HAL_TIMER_RS485_SLAVE);
+
+   if(hal_timer_update_pending(HAL_TIMER_RS485_SLAVE))
    {
       rs485_slave_state_timer++;
+      rs485_slave_tick++;
+
+      /* As on the master, every tick outside ERROR feeds the watchdog. */
+      if(slave_state != RS485_SLAVE_ERROR)
+      {
+         watchdog_heartbeat(WATCHDOG_TASK_RS485);
+      }
 
       /* GPIO_SetBits(GPIOD, LED_PIN_BLUE); */
       debug_output_set(DEBUG_LED_BLUE);
@@ -102,6 +136,19 @@ void TIM1_UP_TIM10_IRQHandler(void)
       switch(slave_state)
       {
          case RS485_SLAVE_INIT:
+            {
+               rs485_slave_state_change(RS485_SLAVE_WAIT_FOR_QUERY, 1);
+            } /* RS485_SLAVE_INIT */
+            break;
+         case RS485_SLAVE_SEND_DATA:
+            {
+               /* A broadcast snapshot response is waiting for our slot. */
+               if((int32_t)(rs485_slave_tick - rs485_slave_slot_tick) >= 0)
+               {
+                  rs485_slave_write_dma(rs485_slave_slot_packet->gp, (rs485_slave_slot_packet->packet_length + GP_ALIGNMENT_PADDING));
+                  rs485_slave_state_change(RS485_SLAVE_WAIT_FOR_QUERY, 1);
+               }
+            } /* RS485_SLAVE_SEND_DATA */
             break;
          default:
             break;
@@ -110,9 +157,10 @@ void TIM1_UP_TIM10_IRQHandler(void)
       /* GPIO_ResetBits(GPIOD, LED_PIN_BLUE); */
       debug_output_clear(DEBUG_LED_BLUE);
 
-      TIM_ClearITPendingBit(TIM10, TIM_IT_Update);
+      hal_timer_update_clear(HAL_TIMER_RS485_SLAVE);
    }
 
+   PROFILE_EXIT(PROFILE_ID_TIM10);
 }
 
 /* Public Function - Doxygen documentation is in the header file. */
@@ -156,8 +204,10 @@ uint8_t rs485_sensor_bus_init_slave(void)
    {
 
       /* Finish up! */
+      rs485_slave_load_address();
       rs485_sensor_bus_init_slave_communications();
       rs485_sensor_bus_init_slave_state_machine();
+      watchdog_register(WATCHDOG_TASK_RS485, WATCHDOG_RS485_DEADLINE_MS);
 
       /* Everyone else should hold tight until this is set! */
       rs485_slave_initialized = 1;
@@ -179,15 +229,9 @@ uint8_t rs485_sensor_bus_init_slave(void)
  */
 void rs485_sensor_bus_init_slave_state_machine(void)
 {
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
-   NVIC_InitTypeDef   NVIC_InitStructure;
-
    uint32_t TimerPeriod = 0;
    uint16_t pscale = 0;
 
-   /* Turn the timer clock on! */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM10, ENABLE);
-
    /* TIM10 on APB2 runs at SystemCoreClock. */
    pscale = 3;
    TimerPeriod = (SystemCoreClock / (RS485_SENSOR_BUS_SM_HZ * (pscale+1))) - 1;
@@ -198,26 +242,8 @@ void rs485_sensor_bus_init_slave_state_machine(void)
       TimerPeriod = 0xFFFF;
    }
 
-   /* Time Base configuration */
-   TIM_TimeBaseStructure.TIM_Prescaler = pscale;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-   TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
-   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
-
-   TIM_TimeBaseInit(TIM10, &TIM_TimeBaseStructure);
-
    /** @todo Determine appropriate interrupt priority here. */
-   /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM1_UP_TIM10_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x01;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-   TIM_ITConfig(TIM10, TIM_IT_Update, ENABLE);
-
-   TIM_Cmd(TIM10, ENABLE);
+   hal_timer_init(HAL_TIMER_RS485_SLAVE, pscale, TimerPeriod, 0x00, 0x01);
 
 }
 
@@ -244,118 +270,11 @@ void rs485_sensor_bus_init_slave_communications(void)
     * Rx  -> C7, DMA2 - Channel 5 - Stream 1
     * T/R -> C8
     */
-   USART_InitTypeDef USART_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-   GPIO_InitTypeDef  GPIO_InitStructure;
-   DMA_InitTypeDef  DMA_InitStructure;
-
-   uint8_t retval;
-
-   /* Enable DMA Clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
-   /* Enable the USART Clock */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART6, ENABLE);
-
-   /* Enable GPIO clock */
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
-
-   /* Set up GPIO for T/R line. */
-   GPIO_StructInit(&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-   /* Connect PXx to USARTx_Tx*/
-   GPIO_PinAFConfig(GPIOC, GPIO_PinSource6, GPIO_AF_USART6);
-   /* Connect PXx to USARTx_Rx*/
-   GPIO_PinAFConfig(GPIOC, GPIO_PinSource7, GPIO_AF_USART6);
-   /* Configure USART Tx as alternate function */
-   GPIO_StructInit(&GPIO_InitStructure);
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-   /* Configure USART Rx as alternate function  */
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-
-   /* USART_InitStructure.USART_BaudRate = 115200; */
-   USART_InitStructure.USART_BaudRate = RS485_SENSOR_BUS_BAUD;
-   /* USART_InitStructure.USART_BaudRate = 1500000; */
-   USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-   USART_InitStructure.USART_StopBits = USART_StopBits_1;
-   USART_InitStructure.USART_Parity = USART_Parity_No;
-   USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-   USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
-
-   USART_OverSampling8Cmd(USART6, ENABLE);
-
-   /* USART configuration */
-   USART_Init(USART6, &USART_InitStructure);
-
-   /* Set up DMA Here!!!! */
-   /* Configure TX DMA */
-   DMA_DeInit(DMA2_Stream6);
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART6->DR));
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(rs485_slave_dma_tx_buffer);;
-   DMA_InitStructure.DMA_Channel = DMA_Channel_5;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rs485_slave_dma_tx_buffer;
-   DMA_Init(DMA2_Stream6, &DMA_InitStructure);
-   /* Configure RX DMA */
-   DMA_DeInit(DMA2_Stream1);
-   DMA_InitStructure.DMA_Channel = DMA_Channel_5;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
-   DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)rs485_slave_dma_rx_buffer;
-   DMA_InitStructure.DMA_BufferSize = (uint16_t)sizeof(rs485_slave_dma_rx_buffer);
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(USART6->DR));
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
-   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
-   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
-   DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
-   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
-   DMA_Init(DMA2_Stream1, &DMA_InitStructure);
-   /* Enable the USART Rx DMA request */
-   USART_DMACmd(USART6, USART_DMAReq_Rx, ENABLE);
-   /* Enable the DMA RX Stream */
-   DMA_Cmd(DMA2_Stream1, ENABLE);
-
-   /* Enable USART */
-   USART_Cmd(USART6, ENABLE);
+   hal_gpio_init(HAL_PIN_RS485_SLAVE_TR, HAL_GPIO_OUTPUT);
 
    /* Use DMA interrupt to flip the R/T line for RS485. */
-   /** @todo Need to determine rs485 slave communication interrupt priority. */
-   NVIC_InitStructure.NVIC_IRQChannel = DMA2_Stream6_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
-   NVIC_Init(&NVIC_InitStructure);
-
-   DMA_ITConfig(DMA2_Stream6, DMA_IT_TC, DISABLE);
-
-
+   hal_usart_dma_init(HAL_USART_RS485_SLAVE, RS485_SENSOR_BUS_BAUD, rs485_slave_dma_rx_buffer,
+                      (uint16_t)sizeof(rs485_slave_dma_rx_buffer), 1, 0);
 }
 
 
@@ -378,22 +297,22 @@ void rs485_sensor_bus_init_slave_communications(void)
  */
 void DMA2_Stream6_IRQHandler(void)
 {
-   if(DMA_GetITStatus(DMA2_Stream6, DMA_IT_TCIF6) != RESET)
+   PROFILE_ENTER();
+
+   if(hal_usart_dma_tx_complete(HAL_USART_RS485_SLAVE))
    {
-      /* DMA is Done...we still need to wait for the last byte to exit the USART */
-      while (USART_GetFlagStatus(USART6, USART_FLAG_TC)==RESET);
-      while (DMA_GetFlagStatus(DMA2_Stream6, DMA_FLAG_TCIF6)==RESET);
+      /* DMA is Done...we still need to wait for the last byte to exit the
+       * USART.  Then the DMA and the USART DMA TX requests are turned off.
+       */
+      hal_usart_dma_tx_stop(HAL_USART_RS485_SLAVE);
 
       /* Now put us in receive mode. */
       rs485_sensor_bus_slave_rx();
 
-      /* Disable the DMA */
-      DMA_Cmd(DMA2_Stream6, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART6, USART_DMAReq_Tx, DISABLE);
-
-      DMA_ClearITPendingBit(DMA2_Stream6, DMA_IT_TCIF6);
+      hal_usart_dma_tx_clear(HAL_USART_RS485_SLAVE);
    }
+
+   PROFILE_EXIT(PROFILE_ID_DMA2_STREAM6);
 }
 
 
@@ -409,7 +328,7 @@ void rs485_sensor_bus_slave_tx(void)
 {
    if(rs485_slave_initialized)
    {
-      GPIO_SetBits(GPIOC, GPIO_Pin_8);
+      hal_gpio_set(HAL_PIN_RS485_SLAVE_TR);
    }
 }
 
@@ -426,7 +345,7 @@ void rs485_sensor_bus_slave_rx(void)
 {
    if(rs485_slave_initialized)
    {
-      GPIO_ResetBits(GPIOC, GPIO_Pin_8);
+      hal_gpio_clear(HAL_PIN_RS485_SLAVE_TR);
    }
 }
 
@@ -466,30 +385,11 @@ void rs485_slave_write_dma(uint8_t *data, uint32_t length)
    if(rs485_slave_initialized)
    {
 
-      /* Disable the DMA */
-      DMA_Cmd(DMA2_Stream6, DISABLE);
-      /* Disable USART DMA TX Requsts */
-      USART_DMACmd(USART6, USART_DMAReq_Tx, DISABLE);
-
-      /* Clear DMA Transfer Complete Flags */
-      DMA_ClearFlag(DMA2_Stream6, DMA_FLAG_TCIF6);
-      /* Clear USART Transfer Complete Flags */
-      USART_ClearFlag(USART6, USART_FLAG_TC);
-
       /* Make sure we are in transmit mode. */
       rs485_sensor_bus_slave_tx();
 
-      /* Set the length of data to transmit. */
-      DMA2_Stream6->NDTR = length;
-      /* Set the pointer to the data. */
-      DMA2_Stream6->M0AR = (uint32_t)data;
-
-      DMA_ITConfig(DMA2_Stream6, DMA_IT_TC, ENABLE);
-
-      /* Enable USART DMA TX Requsts */
-      USART_DMACmd(USART6, USART_DMAReq_Tx, ENABLE);
-      /* Enable the DMA */
-      DMA_Cmd(DMA2_Stream6, ENABLE);
+      /* The transfer complete interrupt does the RS485 R/T handling. */
+      hal_usart_dma_tx_start(HAL_USART_RS485_SLAVE, data, (uint16_t)length);
 
    }
 }
@@ -515,7 +415,7 @@ void rs485_slave_process_rx_dma(void)
    uint16_t dma_head;
    uint8_t rx_byte;
 
-   dma_head = (cb_slave_dma_rx.cb_size - DMA2_Stream1->NDTR);
+   dma_head = hal_usart_dma_rx_head(HAL_USART_RS485_SLAVE);
    retval = cb_set_head_dma(&cb_slave_dma_rx, dma_head);
    if(retval == CB_SUCCESS)
    {
@@ -527,6 +427,8 @@ void rs485_slave_process_rx_dma(void)
             debug_output_set(DEBUG_LED_RED);
 
             retval = cb_add_byte(&cb_slave_ram_rx, rx_byte);
+            rs485_slave_rx_tick = rs485_slave_tick;
+            event_post(EVENT_RS485_SLAVE);
 
             /* GPIO_ResetBits(GPIOD, LED_PIN_RED); */
             debug_output_clear(DEBUG_LED_RED);
@@ -594,6 +496,8 @@ void rs485_slave_handle_packets(void)
    uint8_t retval_tail, retval;
    GenericPacket *gp_ptr;
    PoseIsh p;
+   uint16_t slot_usec;
+   uint32_t unique_id[RS485_UNIQUE_ID_WORDS];
 
 
    do{
@@ -631,29 +535,10 @@ void rs485_slave_handle_packets(void)
                            /* address = SLAVE_ADDRESS; */
                            /* address = gp_ptr->gp[GP_LOC_DATA_START]; */
 
-                           if((retval == GP_SUCCESS)&&(address == SLAVE_ADDRESS))
+                           if((retval == GP_SUCCESS)&&(address == rs485_slave_address))
                            {
                               /* Send the response packet to the master. */
-                              if(SLAVE_ADDRESS == 0x02)
-                              {
-                                 num_query_sensor_info++;
-                                 p.x = 2.0f;
-                                 p.y = 2.1f;
-                                 p.z = 2.2f;
-                                 p.roll = 2.3f;
-                                 p.pitch = 2.4f;
-                                 p.yaw = (float)num_query_sensor_info;
-                              }
-                              else
-                              {
-                                 num_query_sensor_info++;
-                                 p.x = (float)num_query_sensor_info;
-                                 p.y = 1.1f;
-                                 p.z = 1.2f;
-                                 p.roll = 1.3f;
-                                 p.pitch = 1.4f;
-                                 p.yaw = 1.5f;
-                              }
+                              rs485_slave_sample(&p);
                               retval = create_rs485_resp_sensor_info(&gp_sensor_info, RS485_ADDRESS_MASTER, RS485_SB_TYPE_PROXIMITY_SONAR, p);
                               if(retval == GP_SUCCESS)
                               {
@@ -664,10 +549,68 @@ void rs485_slave_handle_packets(void)
                            }
                         } /* RS485_QUERY_SENSOR_INFO */
                         break;
+                     case RS485_SYNC_SAMPLE:
+                        {
+                           retval = extract_rs485_sync_sample(gp_ptr, &slot_usec);
+                           if((retval == GP_SUCCESS)&&(rs485_slave_address != RS485_ADDRESS_CONFIGURATION))
+                           {
+                              /* Sample now so every slave reports the same instant. */
+                              rs485_slave_sample(&p);
+                              retval = create_rs485_resp_sensor_info(&gp_sensor_info, RS485_ADDRESS_MASTER, RS485_SB_TYPE_PROXIMITY_SONAR, p);
+                              if(retval == GP_SUCCESS)
+                              {
+                                 rs485_slave_arm_slot(&gp_sensor_info, (rs485_slave_address - RS485_MASTER_FIRST_SLAVE_ADDRESS), slot_usec);
+                              }
+                           }
+                        } /* RS485_SYNC_SAMPLE */
+                        break;
+                     case RS485_QUERY_UNIQUE_ID:
+                        {
+                           retval = extract_rs485_query_unique_id(gp_ptr, &address);
+                           if((retval == GP_SUCCESS)&&(address == rs485_slave_address))
+                           {
+                              retval = create_rs485_resp_unique_id(&gp_slave_unique_id, rs485_slave_address, rs485_slave_unique_id);
+                              if(retval == GP_SUCCESS)
+                              {
+                                 /* Other unassigned slaves may be answering too,
+                                  * so pick a fresh slot every time.
+                                  */
+                                 rs485_slave_random = (rs485_slave_random * 1103515245UL) + 12345UL;
+                                 rs485_slave_arm_slot(&gp_slave_unique_id, ((rs485_slave_random >> 16) % RS485_CONFIG_SLOTS), RS485_CONFIG_SLOT_USEC);
+                              }
+                           }
+                        } /* RS485_QUERY_UNIQUE_ID */
+                        break;
+                     case RS485_SET_ADDRESS:
+                        {
+                           retval = extract_rs485_set_address(gp_ptr, unique_id, &address);
+                           if((retval == GP_SUCCESS)&&
+                              (unique_id[0] == rs485_slave_unique_id[0])&&
+                              (unique_id[1] == rs485_slave_unique_id[1])&&
+                              (unique_id[2] == rs485_slave_unique_id[2]))
+                           {
+                              /* Keep the address across resets, then confirm from it.
+                               * If it can't be stored (the store already moved
+                               * sectors since boot) the address isn't taken and
+                               * the confirmation comes from the old one, which
+                               * the master sees as a NAK.
+                               */
+                              if(flash_kv_write(FLASH_KV_KEY_RS485_ADDRESS, address) == FLASH_KV_SUCCESS)
+                              {
+                                 rs485_slave_address = address;
+                              }
+                              retval = create_rs485_resp_unique_id(&gp_slave_unique_id, rs485_slave_address, rs485_slave_unique_id);
+                              if(retval == GP_SUCCESS)
+                              {
+                                 rs485_slave_write_dma(gp_slave_unique_id.gp, (gp_slave_unique_id.packet_length + GP_ALIGNMENT_PADDING));
+                              }
+                           }
+                        } /* RS485_SET_ADDRESS */
+                        break;
                      case RS485_RESP_SENSOR_INFO:
                         {
                            retval = extract_rs485_resp_sensor_info(gp_ptr, &address, &sensor_type, &p);
-                           if((retval == GP_SUCCESS)&&(address == SLAVE_ADDRESS))
+                           if((retval == GP_SUCCESS)&&(address == rs485_slave_address))
                            {
                               /* As a slave, we should be sending this...not receiving. */
                            }
@@ -691,3 +634,110 @@ void rs485_slave_handle_packets(void)
 
 
 }
+
+
+/**
+ *
+ * @fn void rs485_slave_sample(PoseIsh *p)
+ * @brief Takes a sensor reading for the master.
+ * @param p Filled in with the reading.
+ * @return None
+ *
+ */
+void rs485_slave_sample(PoseIsh *p)
+{
+   num_query_sensor_info++;
+
+   if(rs485_slave_address == 0x02)
+   {
+      p->x = 2.0f;
+      p->y = 2.1f;
+      p->z = 2.2f;
+      p->roll = 2.3f;
+      p->pitch = 2.4f;
+      p->yaw = (float)num_query_sensor_info;
+   }
+   else
+   {
+      p->x = (float)num_query_sensor_info;
+      p->y = 1.1f;
+      p->z = 1.2f;
+      p->roll = 1.3f;
+      p->pitch = 1.4f;
+      p->yaw = 1.5f;
+   }
+}
+
+
+/**
+ *
+ * @fn void rs485_slave_arm_slot(GenericPacket *gp, uint32_t slot, uint16_t slot_usec)
+ * @brief Schedules a response for a slot after the packet just received.
+ *
+ * The slot is counted from the last tick bytes came in, which is the end of
+ * the master's packet as long as we get here before slot 0 opens and other
+ * slaves start talking.  If we are later than that the timing can't be
+ * trusted, so the slot is skipped rather than risk a collision.
+ *
+ * @param gp Packet to send, must stay untouched until it has gone out.
+ * @param slot Slot number, slot 0 starts one slot after the master's packet.
+ * @param slot_usec Slot width.
+ * @return None
+ *
+ */
+void rs485_slave_arm_slot(GenericPacket *gp, uint32_t slot, uint16_t slot_usec)
+{
+   uint32_t slot_ticks;
+
+   slot_ticks = slot_usec / (1000000UL / RS485_SENSOR_BUS_SM_HZ);
+   if(slot_ticks < RS485_TDMA_MIN_SLOT_TICKS)
+   {
+      slot_ticks = RS485_TDMA_MIN_SLOT_TICKS;
+   }
+
+   if((rs485_slave_tick - rs485_slave_rx_tick) >= slot_ticks)
+   {
+      rs485_slave_missed_slots++;
+      return;
+   }
+
+   rs485_slave_slot_packet = gp;
+   rs485_slave_slot_tick = rs485_slave_rx_tick + ((slot + 1) * slot_ticks);
+   rs485_slave_state_change(RS485_SLAVE_SEND_DATA, 1);
+}
+
+
+/**
+ *
+ * @fn void rs485_slave_load_address(void)
+ * @brief Reads the unique ID and the stored slave address.
+ *
+ * flash_kv_init() must have been called already.  Without a valid stored
+ * address the slave waits on RS485_ADDRESS_CONFIGURATION to be assigned one.
+ *
+ * @param None
+ * @return None
+ *
+ */
+void rs485_slave_load_address(void)
+{
+   uint32_t stored;
+
+   hal_unique_id(rs485_slave_unique_id);
+   rs485_slave_random = rs485_slave_unique_id[0] ^ rs485_slave_unique_id[1] ^ rs485_slave_unique_id[2];
+
+   rs485_slave_address = RS485_ADDRESS_CONFIGURATION;
+   if((flash_kv_read(FLASH_KV_KEY_RS485_ADDRESS, &stored) == FLASH_KV_SUCCESS)&&
+      (stored >= RS485_MASTER_FIRST_SLAVE_ADDRESS)&&
+      (stored < (RS485_MASTER_FIRST_SLAVE_ADDRESS + RS485_MASTER_MAX_SLAVES)))
+   {
+      rs485_slave_address = (uint8_t)stored;
+   }
+}
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t rs485_slave_get_address(void)
+{
+   return rs485_slave_address;
+}
@@ -15,6 +15,10 @@
 #include "debug.h"
 
 #include "tilt_stepper_motor_control.h"
+#include "rs485_sensor_bus.h"
+#include "profile.h"
+#include "stack_monitor.h"
+#include "trace.h"
 
 GenericPacketCircularBuffer gpcbs_rx_gp_queue;
 GenericPacket rx_gp_queue[RX_PACKET_HANDLER_GP_QUEUE_SIZE];
@@ -24,6 +28,10 @@ FDUD_TxQueueCallback gpcbs_rx_gp_queue_callback = NULL;
 
 uint8_t new_tail_callback_failed  = 0;
 
+/* Used Internally */
+void rx_packet_handler_send_pid(void);
+void rx_packet_handler_send_nak(GenericPacket *gp_ptr);
+
 /* rx_packet_handler_init
  *
  * Notes:
@@ -73,6 +81,12 @@ void rx_packet_handler(GenericPacket *gp_ptr)
 
    float multiplier;
 
+   uint8_t address;
+   const rs485_slave_entry_t *slave;
+   uint32_t unique_id[RS485_UNIQUE_ID_WORDS];
+
+   uint8_t clear;
+
    if(rx_packet_handler_initialized)
    {
       switch(gp_ptr->gp[GP_LOC_PROJ_ID])
@@ -81,6 +95,27 @@ void rx_packet_handler(GenericPacket *gp_ptr)
             {
                switch(gp_ptr->gp[GP_LOC_PROJ_SPEC])
                {
+                  case UNIVERSAL_QUERY_PROFILE:
+                     {
+                        retval = extract_universal_query_profile(gp_ptr, &clear);
+                        if(retval == GP_SUCCESS)
+                        {
+                           /* The packets are built before this returns, so
+                            * clearing right after only starts a new window.
+                            */
+                           profile_dump();
+                           if(clear)
+                           {
+                              profile_clear();
+                           }
+                        }
+                     }
+                     break; /* UNIVERSAL_QUERY_PROFILE */
+                  case UNIVERSAL_QUERY_STACK:
+                     {
+                        stack_monitor_report();
+                     }
+                     break; /* UNIVERSAL_QUERY_STACK */
                   default:
                      break;
                }
@@ -92,49 +127,39 @@ void rx_packet_handler(GenericPacket *gp_ptr)
                {
                   case MOTOR_SET_PID:
                      {
-                        /* /\* GPIO_SetBits(GPIOD, LED_PIN_RED); *\/ */
-
-                        /* /\* Extract the new values. *\/ */
-                        /* extract_motor_set_pid(gp_ptr, &proportional, &integral, &derivative); */
-                        /* /\* Call a function here to set the gains. *\/ */
-                        /* retval = tilt_motor_set_pid_gains(proportional, integral, derivative); */
-                        /* if(retval == 0) */
-                        /* { */
-                        /*    /\* Query the new gains from the motor driver. *\/ */
-                        /*    proportional = 0.0f; */
-                        /*    integral = 0.0f; */
-                        /*    derivative = 0.0f; */
-                        /*    retval = tilt_motor_query_pid_gains(&proportional, &integral, &derivative); */
-                        /*    if(retval == 0) */
-                        /*    { */
-                        /*       /\* Respond with the new gains. *\/ */
-                        /*       retval_gpcb = gpcb_increment_temp_head(&gpcbs_rx_gp_queue); */
-                        /*       if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS) */
-                        /*       { */
-                        /*          create_motor_resp_pid(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head_temp]), proportional, integral, derivative); */
-                        /*          retval_gpcb = gpcb_increment_head(&gpcbs_rx_gp_queue); */
-                        /*          if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS) */
-                        /*          { */
-                        /*             /\* Add to full_duplex_outgoing_queueu....... *\/ */
-                        /*             /\* And don't forget to write that callback function... *\/ */
-                        /*             retval_fdud = full_duplex_usart_dma_add_to_queue(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head]), gpcbs_rx_gp_queue_callback, gpcbs_rx_gp_queue.gpcb_head); */
-                        /*             if(retval_fdud == FDUD_SUCCESS) */
-                        /*             { */
-
-                        /*             } */
-                        /*          } */
-                        /*       } */
-                        /*       else */
-                        /*       { */
-                        /*          /\* Someone else was already writing the next outgoing */
-                        /*             gp.  We need to handle that somehow. */
-                        /*          *\/ */
-                        /*       } */
-                        /*    } */
-                        /* } */
-                        /* GPIO_ResetBits(GPIOD, LED_PIN_RED); */
+                        retval = extract_motor_set_pid(gp_ptr, &proportional, &integral, &derivative);
+                        if(retval == GP_SUCCESS)
+                        {
+                           retval = tilt_motor_set_pid_gains(proportional, integral, derivative);
+                           if(retval == 0)
+                           {
+                              /* Respond with what the controller has now. */
+                              rx_packet_handler_send_pid();
+                           }
+                           else
+                           {
+                              /* No brushed tilt motor, or it's autotuning. */
+                              rx_packet_handler_send_nak(gp_ptr);
+                           }
+                        }
                      } /* MOTOR_SET_PID */
                      break;
+                  case MOTOR_QUERY_PID:
+                     {
+                        rx_packet_handler_send_pid();
+                     } /* MOTOR_QUERY_PID */
+                     break;
+                  case MOTOR_AUTOTUNE:
+                     {
+                        /* Takes a few seconds, MOTOR_QUERY_PID shows the
+                         * gains it settled on.
+                         */
+                        if(tilt_motor_autotune() != 0)
+                        {
+                           rx_packet_handler_send_nak(gp_ptr);
+                        }
+                     } /* MOTOR_AUTOTUNE */
+                     break;
                   case MOTOR_START:
                      {
                         /* retval = tilt_motor_start(); */
@@ -166,6 +191,7 @@ void rx_packet_handler(GenericPacket *gp_ptr)
                      {
                         tilt_stepper_motor_stop();
                         extract_motor_set_tilt_multiplier(gp_ptr, &multiplier);
+                        /* Slows the sweep down only, below 1.0 sweeps at 1.0. */
                         tilt_stepper_motor_set_profile_multiplier(multiplier);
                         tilt_stepper_motor_tilt();
                      }
@@ -268,6 +294,59 @@ void rx_packet_handler(GenericPacket *gp_ptr)
                break;
 
             } /* GP_PROJ_MOTOR */
+         case GP_PROJ_RS485_SB:
+            {
+               switch(gp_ptr->gp[GP_LOC_PROJ_SPEC])
+               {
+                  case RS485_QUERY_LATENCY:
+                     {
+                        retval = extract_rs485_query_latency(gp_ptr, &address);
+                        if(retval == GP_SUCCESS)
+                        {
+                           slave = rs485_master_get_slave(address);
+                           if(slave != NULL)
+                           {
+                              /* Respond with the slave's turnaround histogram. */
+                              retval_gpcb = gpcb_increment_temp_head(&gpcbs_rx_gp_queue);
+                              if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+                              {
+                                 create_rs485_resp_latency(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head_temp]), address,
+                                                           (slave->p99_x16 >> RS485_MASTER_P99_FRAC_BITS), (slave->timeout_ticks * RS485_MASTER_TICK_USEC),
+                                                           slave->latency_hist, RS485_MASTER_LATENCY_BINS);
+                                 retval_gpcb = gpcb_increment_head(&gpcbs_rx_gp_queue);
+                                 if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+                                 {
+                                    retval_fdud = full_duplex_usart_dma_add_to_queue(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head]), gpcbs_rx_gp_queue_callback, gpcbs_rx_gp_queue.gpcb_head);
+                                 }
+                              }
+                           }
+                        }
+                     }
+                     break; /* RS485_QUERY_LATENCY */
+                  case RS485_QUERY_UNIQUE_ID:
+                     {
+                        retval = extract_rs485_query_unique_id(gp_ptr, &address);
+                        if(retval == GP_SUCCESS)
+                        {
+                           /* Answers come back through the master. */
+                           rs485_master_query_unique_id(address);
+                        }
+                     }
+                     break; /* RS485_QUERY_UNIQUE_ID */
+                  case RS485_SET_ADDRESS:
+                     {
+                        retval = extract_rs485_set_address(gp_ptr, unique_id, &address);
+                        if(retval == GP_SUCCESS)
+                        {
+                           rs485_master_assign_address(unique_id, address);
+                        }
+                     }
+                     break; /* RS485_SET_ADDRESS */
+                  default:
+                     break;
+               }
+            } /* GP_PROJ_RS485_SB */
+            break;
 
          default:
             break;
@@ -291,6 +370,7 @@ void rx_packet_handler_packet_send_callback(uint32_t new_tail)
    if(gpcbs_rx_gp_queue.gpcb_tail != new_tail)
    {
       new_tail_callback_failed = 1;
+      TRACE(TRACE_ID_TX_CALLBACK_MISMATCH, new_tail, gpcbs_rx_gp_queue.gpcb_tail);
       /* Notify myself somehow?  Maybe by putting another packet in the queue
        * that isn't working so well???
        */
@@ -300,3 +380,53 @@ void rx_packet_handler_packet_send_callback(uint32_t new_tail)
    }
 
 }
+
+
+/* rx_packet_handler_send_pid
+ *
+ * Notes:
+ *  +Queues a MOTOR_RESP_PID with the brushed tilt controller's gains.
+ */
+void rx_packet_handler_send_pid(void)
+{
+   uint8_t retval_gpcb;
+   float proportional, integral, derivative;
+
+   tilt_motor_query_pid_gains(&proportional, &integral, &derivative);
+
+   retval_gpcb = gpcb_increment_temp_head(&gpcbs_rx_gp_queue);
+   if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+   {
+      create_motor_resp_pid(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head_temp]), proportional, integral, derivative);
+      retval_gpcb = gpcb_increment_head(&gpcbs_rx_gp_queue);
+      if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+      {
+         full_duplex_usart_dma_add_to_queue(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head]), gpcbs_rx_gp_queue_callback, gpcbs_rx_gp_queue.gpcb_head);
+      }
+   }
+}
+
+
+/* rx_packet_handler_send_nak
+ *
+ * Notes:
+ *  +Queues the RX_PACKET_HANDLER_NAK word for the command in gp_ptr.
+ */
+void rx_packet_handler_send_nak(GenericPacket *gp_ptr)
+{
+   uint8_t retval_gpcb;
+   uint32_t nak;
+
+   nak = RX_PACKET_HANDLER_NAK | ((uint32_t)gp_ptr->gp[GP_LOC_PROJ_ID] << 8) | gp_ptr->gp[GP_LOC_PROJ_SPEC];
+
+   retval_gpcb = gpcb_increment_temp_head(&gpcbs_rx_gp_queue);
+   if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+   {
+      create_universal_word(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head_temp]), nak);
+      retval_gpcb = gpcb_increment_head(&gpcbs_rx_gp_queue);
+      if(retval_gpcb == GP_CIRC_BUFFER_SUCCESS)
+      {
+         full_duplex_usart_dma_add_to_queue(&(gpcbs_rx_gp_queue.gpcb[gpcbs_rx_gp_queue.gpcb_head]), gpcbs_rx_gp_queue_callback, gpcbs_rx_gp_queue.gpcb_head);
+      }
+   }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file stack_monitor.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Stack high-water mark from a painted stack.
+ *
+ * main and every interrupt run on the one MSP stack, with ISRs nesting three
+ * priority levels deep on top of whatever main is doing.  The linker only
+ * checks that _Min_Stack_Size fits, nothing checks it's enough.  Painting the
+ * stack at boot and looking for the lowest word that's been overwritten gives
+ * the deepest it's really been, which the host can ask for with
+ * UNIVERSAL_QUERY_STACK.  make budget does the static half of the job.
+ */
+
+#include "stack_monitor.h"
+#include "full_duplex_usart_dma.h"
+
+/* From STM32F417IG_FLASH.ld.  _estack is just past the end of RAM, where the
+ * stack starts.
+ */
+extern uint32_t _sstack;
+extern uint32_t _estack;
+extern uint8_t _Min_Stack_Size[];
+
+/* SRAM, TX DMA reads it directly. */
+GenericPacket stack_monitor_packet;
+volatile uint8_t stack_monitor_packet_busy = 0;
+
+/* Used Internally */
+uint32_t stack_monitor_top(void);
+void stack_monitor_packet_sent(uint32_t data);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void stack_monitor_init(void)
+{
+   volatile uint32_t *word;
+   uint32_t limit;
+
+   limit = (__get_MSP() - STACK_MONITOR_MARGIN) & ~0x03;
+
+   for(word = &_sstack; (uint32_t)word < limit; word++)
+   {
+      *word = STACK_MONITOR_PAINT;
+   }
+
+   stack_monitor_packet_busy = 0;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t stack_monitor_used(void)
+{
+   volatile uint32_t *word;
+   uint32_t top;
+
+   top = stack_monitor_top();
+
+   /* Interrupts can push below the stack pointer while this runs, but
+    * they'll only ever overwrite paint, so the scan is safe without a lock.
+    */
+   word = &_sstack;
+   while(((uint32_t)word < top) && (*word == STACK_MONITOR_PAINT))
+   {
+      word++;
+   }
+
+   return top - (uint32_t)word;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t stack_monitor_size(void)
+{
+   return stack_monitor_top() - (uint32_t)&_sstack;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t stack_monitor_report(void)
+{
+   if(stack_monitor_packet_busy)
+   {
+      return 0;
+   }
+
+   create_universal_stack(&stack_monitor_packet, stack_monitor_used(),
+                          stack_monitor_size(), (uint32_t)_Min_Stack_Size);
+
+   stack_monitor_packet_busy = 1;
+   if(full_duplex_usart_dma_add_to_queue(&stack_monitor_packet, &stack_monitor_packet_sent, 0) != FDUD_SUCCESS)
+   {
+      stack_monitor_packet_busy = 0;
+      return 0;
+   }
+
+   return 1;
+}
+
+/* PRIVATE stack_monitor_top
+ *
+ * Notes:
+ *  +Word aligned address just past the top of the stack.
+ */
+uint32_t stack_monitor_top(void)
+{
+   return (uint32_t)&_estack;
+}
+
+/* PRIVATE stack_monitor_packet_sent
+ *
+ * Notes:
+ *  +FDUD_TxQueueCallback for the report, frees the packet.
+ */
+void stack_monitor_packet_sent(uint32_t data)
+{
+   stack_monitor_packet_busy = 0;
+}
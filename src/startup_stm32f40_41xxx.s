@@ -55,8 +55,15 @@ defined in linker script */
 .word  _sbss
 /* end address for the .bss section. defined in linker script */
 .word  _ebss
-/* stack used for SystemInit_ExtMemCtl; always internal RAM used */
-.equ __initial_spTop, 0x20000400
+/* start address for the initialization values of the .ccmram section,
+and its start and end.  defined in linker script */
+.word  _siccmram
+.word  _sccmram
+.word  _eccmram
+/* start and end address for the zeroed .ccmbss section. defined in linker
+script */
+.word  _sccmbss
+.word  _eccmbss
 /**
  * @brief  This is the code that gets called when the processor first
  *          starts execution following a reset event. Only the absolutely
@@ -70,7 +77,9 @@ defined in linker script */
   .weak  Reset_Handler
   .type  Reset_Handler, %function
 Reset_Handler:
-ldr   sp, =__initial_spTop     /* set stack pointer */
+/* The top of RAM, clear of .data and .ramfunc, before anything is copied in
+and before SystemInit pushes onto it. */
+  ldr   sp, =_estack
 /* Copy the data segment initializers from flash to SRAM */
   movs  r1, #0
   b  LoopCopyDataInit
@@ -99,13 +108,38 @@ LoopFillZerobss:
   cmp  r2, r3
   bcc  FillZerobss
 
+/* Copy the ccmram initializers from flash to CCM */
+  movs  r1, #0
+  b  LoopCopyCcmInit
+
+CopyCcmInit:
+  ldr  r3, =_siccmram
+  ldr  r3, [r3, r1]
+  str  r3, [r0, r1]
+  adds  r1, r1, #4
+
+LoopCopyCcmInit:
+  ldr  r0, =_sccmram
+  ldr  r3, =_eccmram
+  adds  r2, r0, r1
+  cmp  r2, r3
+  bcc  CopyCcmInit
+  ldr  r2, =_sccmbss
+  b  LoopFillZeroCcmbss
+/* Zero fill the ccmbss segment. */
+FillZeroCcmbss:
+  movs  r3, #0
+  str  r3, [r2], #4
+
+LoopFillZeroCcmbss:
+  ldr  r3, = _eccmbss
+  cmp  r2, r3
+  bcc  FillZeroCcmbss
+
 /* Call the clock system intitialization function.*/
   bl  SystemInit
 /* Call static constructors */
         /* awalker comment:  bl __libc_init_array */
-    /* Restore original stack pointer. */
-  ldr     r0, =_estack
-  msr     MSP, r0
 /* Call the application's entry point.*/
   bl  main
   bx  lr
@@ -136,7 +170,7 @@ Infinite_Loop:
 
 
 g_pfnVectors:
-  .word  __initial_spTop /* Use internal RAM for stack for calling SystemInit. */
+  .word  _estack
   .word  Reset_Handler
   .word  NMI_Handler
   .word  HardFault_Handler
@@ -30,6 +30,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4xx_it.h"
 #include "main.h"
+#include "crash_dump.h"
 
 /** @addtogroup STM32F4xx_StdPeriph_Examples
   * @{
@@ -64,12 +65,10 @@ void NMI_Handler(void)
   * @param  None
   * @retval None
   */
-void HardFault_Handler(void)
+__attribute__((naked)) void HardFault_Handler(void)
 {
-  /* Go to infinite loop when Hard Fault exception occurs */
-  while (1)
-  {
-  }
+  /* Dump and reset, see crash_dump.h */
+  CRASH_DUMP_ENTRY(CRASH_DUMP_FAULT_HARD);
 }
 
 /**
@@ -77,12 +76,10 @@ void HardFault_Handler(void)
   * @param  None
   * @retval None
   */
-void MemManage_Handler(void)
+__attribute__((naked)) void MemManage_Handler(void)
 {
-  /* Go to infinite loop when Memory Manage exception occurs */
-  while (1)
-  {
-  }
+  /* Dump and reset, see crash_dump.h */
+  CRASH_DUMP_ENTRY(CRASH_DUMP_FAULT_MEMMANAGE);
 }
 
 /**
@@ -90,12 +87,10 @@ void MemManage_Handler(void)
   * @param  None
   * @retval None
   */
-void BusFault_Handler(void)
+__attribute__((naked)) void BusFault_Handler(void)
 {
-  /* Go to infinite loop when Bus Fault exception occurs */
-  while (1)
-  {
-  }
+  /* Dump and reset, see crash_dump.h */
+  CRASH_DUMP_ENTRY(CRASH_DUMP_FAULT_BUS);
 }
 
 /**
@@ -103,12 +98,10 @@ void BusFault_Handler(void)
   * @param  None
   * @retval None
   */
-void UsageFault_Handler(void)
+__attribute__((naked)) void UsageFault_Handler(void)
 {
-  /* Go to infinite loop when Usage Fault exception occurs */
-  while (1)
-  {
-  }
+  /* Dump and reset, see crash_dump.h */
+  CRASH_DUMP_ENTRY(CRASH_DUMP_FAULT_USAGE);
 }
 
 /**
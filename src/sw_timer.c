@@ -0,0 +1,202 @@
+/**
+ * @file sw_timer.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief One-shot and periodic software timers on one hardware timer.
+ *
+ * Every module that needs to do something later has ended up with its own
+ * hardware timer or a busy wait.  These share a single compare channel
+ * instead.  Nothing in here touches hardware, that's all in the port
+ * functions (sw_timer_hal.c), so the list handling builds on a PC too.
+ */
+
+#include <stddef.h>
+
+#include "sw_timer.h"
+
+sw_timer_t *sw_timer_head = NULL;
+
+/* Used Internally */
+void sw_timer_insert(sw_timer_t *timer);
+void sw_timer_remove(sw_timer_t *timer);
+int32_t sw_timer_until(uint32_t expires_us, uint32_t now);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_init(void)
+{
+   uint32_t key;
+
+   key = sw_timer_port_lock();
+   while(sw_timer_head != NULL)
+   {
+      sw_timer_head->active = 0;
+      sw_timer_head = sw_timer_head->next;
+   }
+   sw_timer_port_unlock(key);
+
+   sw_timer_port_init();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t sw_timer_start(sw_timer_t *timer, uint32_t delay_us, uint32_t period_us, SwTimerCallback callback, uint32_t data)
+{
+   uint32_t key;
+
+   if((delay_us > SW_TIMER_MAX_DELAY_US)||(period_us > SW_TIMER_MAX_DELAY_US))
+   {
+      return SW_TIMER_ERROR_DELAY;
+   }
+
+   if(callback == NULL)
+   {
+      return SW_TIMER_ERROR_CALLBACK;
+   }
+
+   key = sw_timer_port_lock();
+
+   sw_timer_remove(timer);
+
+   timer->expires_us = sw_timer_port_now() + delay_us;
+   timer->period_us = period_us;
+   timer->callback = callback;
+   timer->data = data;
+   sw_timer_insert(timer);
+
+   /* The head may be this timer with a new expiry, so always re-arm. */
+   sw_timer_port_arm(sw_timer_head->expires_us);
+
+   sw_timer_port_unlock(key);
+
+   return SW_TIMER_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_stop(sw_timer_t *timer)
+{
+   uint32_t key;
+
+   /* Leaving the compare set for a timer that's gone is harmless,
+    * sw_timer_expire() just won't find anything due.
+    */
+   key = sw_timer_port_lock();
+   sw_timer_remove(timer);
+   sw_timer_port_unlock(key);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t sw_timer_now(void)
+{
+   return sw_timer_port_now();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_expire(void)
+{
+   sw_timer_t *timer;
+   SwTimerCallback callback;
+   uint32_t data;
+   uint32_t now;
+   uint32_t key;
+
+   key = sw_timer_port_lock();
+
+   timer = sw_timer_head;
+   now = sw_timer_port_now();
+   while((timer != NULL)&&(sw_timer_until(timer->expires_us, now) <= 0))
+   {
+      sw_timer_head = timer->next;
+      timer->active = 0;
+
+      if(timer->period_us != 0)
+      {
+         timer->expires_us += timer->period_us;
+         if(sw_timer_until(timer->expires_us, now) <= 0)
+         {
+            timer->expires_us = now + timer->period_us;
+         }
+         sw_timer_insert(timer);
+      }
+
+      /* The callback may start or stop timers, this one included. */
+      callback = timer->callback;
+      data = timer->data;
+      sw_timer_port_unlock(key);
+      callback(data);
+      key = sw_timer_port_lock();
+
+      timer = sw_timer_head;
+      now = sw_timer_port_now();
+   }
+
+   if(timer != NULL)
+   {
+      sw_timer_port_arm(timer->expires_us);
+   }
+
+   sw_timer_port_unlock(key);
+}
+
+/* PRIVATE sw_timer_insert
+ *
+ * Notes:
+ *  +Lock must be held.
+ *  +Goes after every timer expiring at or before it, which is what keeps
+ *   timers with the same expiry in start order.
+ */
+void sw_timer_insert(sw_timer_t *timer)
+{
+   sw_timer_t **link;
+   uint32_t now;
+
+   now = sw_timer_port_now();
+
+   link = &sw_timer_head;
+   while((*link != NULL)&&(sw_timer_until((*link)->expires_us, now) <= sw_timer_until(timer->expires_us, now)))
+   {
+      link = &((*link)->next);
+   }
+
+   timer->next = *link;
+   *link = timer;
+   timer->active = 1;
+}
+
+/* PRIVATE sw_timer_remove
+ *
+ * Notes:
+ *  +Lock must be held.
+ */
+void sw_timer_remove(sw_timer_t *timer)
+{
+   sw_timer_t **link;
+
+   if(timer->active == 0)
+   {
+      return;
+   }
+
+   link = &sw_timer_head;
+   while(*link != NULL)
+   {
+      if(*link == timer)
+      {
+         *link = timer->next;
+         break;
+      }
+      link = &((*link)->next);
+   }
+
+   timer->active = 0;
+   timer->next = NULL;
+}
+
+/* PRIVATE sw_timer_until
+ *
+ * Notes:
+ *  +Microseconds from now until expires_us, negative once it's gone by.
+ *   Correct across the counter wrapping as long as the two are within 2^31.
+ */
+int32_t sw_timer_until(uint32_t expires_us, uint32_t now)
+{
+   return (int32_t)(expires_us - now);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file sw_timer_hal.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief HAL port for the software timers.
+ *
+ * HAL_TIMER_SW_TIMER is a 32 bit timer, so it free runs at 1MHz and wraps
+ * with the same 2^32 microseconds the timer list works in.  Its compare
+ * interrupts when the first timer is due.
+ */
+
+#include "sw_timer.h"
+#include "hal.h"
+
+#include "profile.h"
+
+#define SW_TIMER_TICK_HZ        1000000
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_init(void)
+{
+   /* TIM2 on APB1 runs at SystemCoreClock/2.  Same priority as the other
+    * state machines, so callbacks can't preempt them or each other.
+    */
+   hal_timer_compare_init(HAL_TIMER_SW_TIMER, (SystemCoreClock / (SW_TIMER_TICK_HZ * 2)) - 1, 0x01, 0x00);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t sw_timer_port_now(void)
+{
+   return hal_timer_count(HAL_TIMER_SW_TIMER);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_arm(uint32_t expires_us)
+{
+   hal_timer_compare_set(HAL_TIMER_SW_TIMER, expires_us);
+
+   /* The counter may have gone past while we were setting it, a compare
+    * event by hand makes up for the match we missed.
+    */
+   if((int32_t)(expires_us - hal_timer_count(HAL_TIMER_SW_TIMER)) <= 0)
+   {
+      hal_timer_compare_force(HAL_TIMER_SW_TIMER);
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t sw_timer_port_lock(void)
+{
+   return hal_irq_save();
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void sw_timer_port_unlock(uint32_t key)
+{
+   hal_irq_restore(key);
+}
+
+/**
+ * @fn void TIM2_IRQHandler(void)
+ * @brief Software timer compare interrupt.
+ * @param None
+ * @return None
+ *
+ */
+void TIM2_IRQHandler(void)
+{
+   PROFILE_ENTER();
+
+   if(hal_timer_compare_pending(HAL_TIMER_SW_TIMER))
+   {
+      hal_timer_compare_clear(HAL_TIMER_SW_TIMER);
+      sw_timer_expire();
+   }
+
+   PROFILE_EXIT(PROFILE_ID_TIM2);
+}
@@ -8,15 +8,22 @@
  * time, it's good to have a systick.
  */
 #include "systick.h"
+#include "hal.h"
 
 #include "debug.h"
+#include "profile.h"
 
 uint8_t systick_initialized = 0;
 
 /* Free Running Coutner */
 volatile uint32_t ms_counter = 0;
-/* Resettable Counter */
-volatile uint32_t ms_counter_r = 0;
+
+/* Upper half of the 64 bit cycle count, and the last CYCCNT seen so a wrap
+ * can be spotted.  SysTick reads the clock every ms, far more often than
+ * CYCCNT wraps (every 2^32 cycles, 25s at 168MHz).
+ */
+uint32_t systick_cycles_high = 0;
+uint32_t systick_cycles_last = 0;
 
 
 /* Public Function - Doxygen documentation is in the header file. */
@@ -24,6 +31,9 @@ void systick_init(void)
 {
    /* Make sure we are using the correct value for SystemCoreClock! */
    SystemCoreClockUpdate();
+
+   /* The cycle counter behind systick_cycles() and the delays. */
+   hal_cycles_init();
    /* Set SysTick to expire every ms. */
    if (SysTick_Config(SystemCoreClock / 1000))
    {
@@ -55,44 +65,80 @@ void systick_init(void)
  */
 void SysTick_Handler(void)
 {
+   PROFILE_ENTER();
+
    ms_counter++;
-   ms_counter_r++;
 
-   if(ms_counter%50 == 0)
-   {
+   /* Keeps the 64 bit cycle count from missing a CYCCNT wrap. */
+   systick_cycles();
+
+   PROFILE_EXIT(PROFILE_ID_SYSTICK);
+}
 
-      /** @todo Need to get the debug code set up and use that to toggle the
-       *  heartbeat LED here.
-       */
-      debug_output_toggle(DEBUG_LED_GREEN);
 
+/* Public Function - Doxygen documentation is in the header file. */
+uint64_t systick_cycles(void)
+{
+   uint32_t primask;
+   uint32_t now;
+   uint64_t cycles;
+
+   primask = hal_irq_save();
+
+   now = hal_cycles();
+   if(now < systick_cycles_last)
+   {
+      systick_cycles_high++;
    }
+   systick_cycles_last = now;
+   cycles = ((uint64_t)systick_cycles_high << 32) | now;
 
+   hal_irq_restore(primask);
 
+   return cycles;
 }
 
+/* Public Function - Doxygen documentation is in the header file. */
+uint64_t systick_us(void)
+{
+   return systick_cycles() / (SystemCoreClock / 1000000);
+}
 
 /* Public Function - Doxygen documentation is in the header file. */
-void systick_delay_ms(uint32_t delay_ms)
+void systick_delay_ns(uint32_t delay_ns)
 {
-   /** @todo I don't believe this is thread safe.  Be careful where this is
-    *  called from.
-    */
-   ms_counter_r = 0;
-   while(ms_counter_r < delay_ms);
+   uint32_t start;
+   uint32_t cycles;
+
+   start = hal_cycles();
+
+   /* Rounded up so the delay is never short. */
+   cycles = (uint32_t)((((uint64_t)delay_ns * (SystemCoreClock / 1000000)) + 999) / 1000);
+
+   while((hal_cycles() - start) < cycles);
 }
 
+/* Public Function - Doxygen documentation is in the header file. */
+void systick_delay_us(uint32_t delay_us)
+{
+   uint32_t start;
+   uint32_t cycles;
 
-/**
-  * @brief  Inserts a delay time.
-  * @param  nCount: specifies the delay time length.
-  * @retval None
-  */
-void Delay(__IO uint32_t nCount)
+   start = hal_cycles();
+   cycles = delay_us * (SystemCoreClock / 1000000);
+
+   while((hal_cycles() - start) < cycles);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void systick_delay_ms(uint32_t delay_ms)
 {
-  /* Decrement nCount value */
-  while (nCount != 0)
-  {
-    nCount--;
-  }
+   uint32_t start;
+
+   /* Each caller has its own start, so nested or preempting callers no longer
+    * reset each other's delay.  Needs SysTick running, so not with
+    * interrupts masked.
+    */
+   start = ms_counter;
+   while((ms_counter - start) < delay_ms);
 }
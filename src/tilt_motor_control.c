@@ -18,7 +18,10 @@
 #include "quad_encoder.h"
 #include "hardware_TB6612.h"
 #include "motor_control.h"
+#include "motor_autotune.h"
+#include "trajectory.h"
 #include "hardware_STM32F407G_DISC1.h"
+#include "profile.h"
 
 #define RUN_OPEN_LOOP 0
 
@@ -31,266 +34,14 @@
 
 #define HOLD_TIME_MS 100.0f
 
-static uint8_t tilt_dir = 1;
-static uint32_t tilt_index = 0;
-static uint32_t tilt_elements = 1001;
-static float tilt_profile_tangent[] = {
--1.570796f, -1.570796f, -1.570796f, -1.570795f, -1.570794f, -1.570792f, -1.570790f, -1.570786f,
--1.570780f, -1.570774f, -1.570765f, -1.570755f, -1.570743f, -1.570729f, -1.570712f, -1.570693f,
--1.570671f, -1.570646f, -1.570618f, -1.570587f, -1.570552f, -1.570514f, -1.570473f, -1.570427f,
--1.570378f, -1.570324f, -1.570265f, -1.570203f, -1.570135f, -1.570063f, -1.569986f, -1.569903f,
--1.569816f, -1.569722f, -1.569624f, -1.569519f, -1.569409f, -1.569292f, -1.569169f, -1.569040f,
--1.568904f, -1.568762f, -1.568613f, -1.568457f, -1.568294f, -1.568123f, -1.567946f, -1.567760f,
--1.567567f, -1.567367f, -1.567158f, -1.566941f, -1.566716f, -1.566483f, -1.566241f, -1.565991f,
--1.565732f, -1.565464f, -1.565188f, -1.564902f, -1.564607f, -1.564302f, -1.563988f, -1.563665f,
--1.563331f, -1.562988f, -1.562635f, -1.562272f, -1.561898f, -1.561515f, -1.561120f, -1.560716f,
--1.560300f, -1.559874f, -1.559437f, -1.558989f, -1.558530f, -1.558059f, -1.557578f, -1.557085f,
--1.556580f, -1.556063f, -1.555535f, -1.554995f, -1.554443f, -1.553879f, -1.553303f, -1.552715f,
--1.552114f, -1.551500f, -1.550875f, -1.550236f, -1.549585f, -1.548921f, -1.548244f, -1.547554f,
--1.546850f, -1.546134f, -1.545404f, -1.544661f, -1.543904f, -1.543134f, -1.542350f, -1.541553f,
--1.540741f, -1.539916f, -1.539076f, -1.538223f, -1.537355f, -1.536474f, -1.535578f, -1.534667f,
--1.533742f, -1.532803f, -1.531848f, -1.530879f, -1.529896f, -1.528897f, -1.527884f, -1.526856f,
--1.525812f, -1.524754f, -1.523680f, -1.522591f, -1.521486f, -1.520367f, -1.519231f, -1.518081f,
--1.516914f, -1.515732f, -1.514535f, -1.513321f, -1.512092f, -1.510847f, -1.509586f, -1.508308f,
--1.507015f, -1.505706f, -1.504380f, -1.503038f, -1.501680f, -1.500306f, -1.498915f, -1.497508f,
--1.496084f, -1.494644f, -1.493187f, -1.491713f, -1.490223f, -1.488716f, -1.487193f, -1.485652f,
--1.484095f, -1.482520f, -1.480929f, -1.479321f, -1.477696f, -1.476053f, -1.474394f, -1.472717f,
--1.471023f, -1.469312f, -1.467584f, -1.465838f, -1.464075f, -1.462295f, -1.460497f, -1.458682f,
--1.456850f, -1.454999f, -1.453132f, -1.451247f, -1.449344f, -1.447424f, -1.445486f, -1.443530f,
--1.441556f, -1.439565f, -1.437557f, -1.435530f, -1.433486f, -1.431423f, -1.429344f, -1.427246f,
--1.425130f, -1.422996f, -1.420845f, -1.418675f, -1.416488f, -1.414283f, -1.412059f, -1.409818f,
--1.407559f, -1.405282f, -1.402986f, -1.400673f, -1.398342f, -1.395992f, -1.393625f, -1.391239f,
--1.388835f, -1.386413f, -1.383974f, -1.381516f, -1.379039f, -1.376545f, -1.374033f, -1.371502f,
--1.368954f, -1.366387f, -1.363802f, -1.361199f, -1.358578f, -1.355939f, -1.353281f, -1.350606f,
--1.347912f, -1.345200f, -1.342470f, -1.339722f, -1.336956f, -1.334171f, -1.331369f, -1.328548f,
--1.325710f, -1.322853f, -1.319978f, -1.317085f, -1.314174f, -1.311246f, -1.308298f, -1.305333f,
--1.302350f, -1.299349f, -1.296330f, -1.293293f, -1.290238f, -1.287165f, -1.284075f, -1.280966f,
--1.277839f, -1.274695f, -1.271532f, -1.268352f, -1.265154f, -1.261938f, -1.258704f, -1.255453f,
--1.252184f, -1.248897f, -1.245592f, -1.242270f, -1.238930f, -1.235573f, -1.232198f, -1.228805f,
--1.225395f, -1.221967f, -1.218522f, -1.215059f, -1.211579f, -1.208081f, -1.204567f, -1.201034f,
--1.197485f, -1.193918f, -1.190334f, -1.186732f, -1.183114f, -1.179478f, -1.175825f, -1.172155f,
--1.168468f, -1.164764f, -1.161043f, -1.157305f, -1.153551f, -1.149779f, -1.145990f, -1.142185f,
--1.138363f, -1.134524f, -1.130669f, -1.126796f, -1.122908f, -1.119002f, -1.115081f, -1.111142f,
--1.107188f, -1.103216f, -1.099229f, -1.095225f, -1.091205f, -1.087169f, -1.083117f, -1.079048f,
--1.074964f, -1.070863f, -1.066746f, -1.062614f, -1.058465f, -1.054301f, -1.050121f, -1.045925f,
--1.041714f, -1.037487f, -1.033244f, -1.028986f, -1.024712f, -1.020423f, -1.016119f, -1.011799f,
--1.007464f, -1.003114f, -0.998748f, -0.994368f, -0.989972f, -0.985562f, -0.981136f, -0.976696f,
--0.972240f, -0.967770f, -0.963286f, -0.958786f, -0.954272f, -0.949744f, -0.945201f, -0.940644f,
--0.936072f, -0.931486f, -0.926886f, -0.922271f, -0.917643f, -0.913000f, -0.908344f, -0.903673f,
--0.898989f, -0.894291f, -0.889579f, -0.884854f, -0.880114f, -0.875362f, -0.870596f, -0.865816f,
--0.861023f, -0.856217f, -0.851398f, -0.846565f, -0.841720f, -0.836861f, -0.831990f, -0.827106f,
--0.822208f, -0.817299f, -0.812376f, -0.807441f, -0.802493f, -0.797533f, -0.792561f, -0.787576f,
--0.782579f, -0.777570f, -0.772549f, -0.767516f, -0.762470f, -0.757413f, -0.752345f, -0.747264f,
--0.742172f, -0.737068f, -0.731953f, -0.726826f, -0.721688f, -0.716539f, -0.711378f, -0.706206f,
--0.701024f, -0.695830f, -0.690625f, -0.685410f, -0.680184f, -0.674947f, -0.669700f, -0.664442f,
--0.659174f, -0.653895f, -0.648606f, -0.643307f, -0.637998f, -0.632679f, -0.627350f, -0.622011f,
--0.616662f, -0.611303f, -0.605935f, -0.600558f, -0.595171f, -0.589774f, -0.584368f, -0.578953f,
--0.573529f, -0.568096f, -0.562654f, -0.557203f, -0.551743f, -0.546274f, -0.540797f, -0.535312f,
--0.529817f, -0.524315f, -0.518804f, -0.513285f, -0.507758f, -0.502223f, -0.496679f, -0.491128f,
--0.485570f, -0.480003f, -0.474429f, -0.468847f, -0.463258f, -0.457662f, -0.452058f, -0.446447f,
--0.440829f, -0.435204f, -0.429573f, -0.423934f, -0.418289f, -0.412636f, -0.406978f, -0.401313f,
--0.395641f, -0.389964f, -0.384280f, -0.378590f, -0.372894f, -0.367192f, -0.361484f, -0.355770f,
--0.350051f, -0.344326f, -0.338596f, -0.332860f, -0.327119f, -0.321373f, -0.315621f, -0.309865f,
--0.304104f, -0.298338f, -0.292567f, -0.286791f, -0.281011f, -0.275226f, -0.269437f, -0.263644f,
--0.257846f, -0.252045f, -0.246239f, -0.240430f, -0.234616f, -0.228799f, -0.222978f, -0.217154f,
--0.211326f, -0.205495f, -0.199660f, -0.193822f, -0.187981f, -0.182138f, -0.176291f, -0.170441f,
--0.164589f, -0.158734f, -0.152877f, -0.147017f, -0.141155f, -0.135290f, -0.129424f, -0.123555f,
--0.117684f, -0.111812f, -0.105937f, -0.100061f, -0.094183f, -0.088304f, -0.082424f, -0.076542f,
--0.070659f, -0.064774f, -0.058889f, -0.053003f, -0.047116f, -0.041228f, -0.035340f, -0.029450f,
--0.023561f, -0.017671f, -0.011781f, -0.005890f, 0.000000f, 0.005890f, 0.011781f, 0.017671f,
-0.023561f, 0.029450f, 0.035340f, 0.041228f, 0.047116f, 0.053003f, 0.058889f, 0.064774f,
-0.070659f, 0.076542f, 0.082424f, 0.088304f, 0.094183f, 0.100061f, 0.105937f, 0.111812f,
-0.117684f, 0.123555f, 0.129424f, 0.135290f, 0.141155f, 0.147017f, 0.152877f, 0.158734f,
-0.164589f, 0.170441f, 0.176291f, 0.182138f, 0.187981f, 0.193822f, 0.199660f, 0.205495f,
-0.211326f, 0.217154f, 0.222978f, 0.228799f, 0.234616f, 0.240430f, 0.246239f, 0.252045f,
-0.257846f, 0.263644f, 0.269437f, 0.275226f, 0.281011f, 0.286791f, 0.292567f, 0.298338f,
-0.304104f, 0.309865f, 0.315621f, 0.321373f, 0.327119f, 0.332860f, 0.338596f, 0.344326f,
-0.350051f, 0.355770f, 0.361484f, 0.367192f, 0.372894f, 0.378590f, 0.384280f, 0.389964f,
-0.395641f, 0.401313f, 0.406978f, 0.412636f, 0.418289f, 0.423934f, 0.429573f, 0.435204f,
-0.440829f, 0.446447f, 0.452058f, 0.457662f, 0.463258f, 0.468847f, 0.474429f, 0.480003f,
-0.485570f, 0.491128f, 0.496679f, 0.502223f, 0.507758f, 0.513285f, 0.518804f, 0.524315f,
-0.529817f, 0.535312f, 0.540797f, 0.546274f, 0.551743f, 0.557203f, 0.562654f, 0.568096f,
-0.573529f, 0.578953f, 0.584368f, 0.589774f, 0.595171f, 0.600558f, 0.605935f, 0.611303f,
-0.616662f, 0.622011f, 0.627350f, 0.632679f, 0.637998f, 0.643307f, 0.648606f, 0.653895f,
-0.659174f, 0.664442f, 0.669700f, 0.674947f, 0.680184f, 0.685410f, 0.690625f, 0.695830f,
-0.701024f, 0.706206f, 0.711378f, 0.716539f, 0.721688f, 0.726826f, 0.731953f, 0.737068f,
-0.742172f, 0.747264f, 0.752345f, 0.757413f, 0.762470f, 0.767516f, 0.772549f, 0.777570f,
-0.782579f, 0.787576f, 0.792561f, 0.797533f, 0.802493f, 0.807441f, 0.812376f, 0.817299f,
-0.822208f, 0.827106f, 0.831990f, 0.836861f, 0.841720f, 0.846565f, 0.851398f, 0.856217f,
-0.861023f, 0.865816f, 0.870596f, 0.875362f, 0.880114f, 0.884854f, 0.889579f, 0.894291f,
-0.898989f, 0.903673f, 0.908344f, 0.913000f, 0.917643f, 0.922271f, 0.926886f, 0.931486f,
-0.936072f, 0.940644f, 0.945201f, 0.949744f, 0.954272f, 0.958786f, 0.963286f, 0.967770f,
-0.972240f, 0.976696f, 0.981136f, 0.985562f, 0.989972f, 0.994368f, 0.998748f, 1.003114f,
-1.007464f, 1.011799f, 1.016119f, 1.020423f, 1.024712f, 1.028986f, 1.033244f, 1.037487f,
-1.041714f, 1.045925f, 1.050121f, 1.054301f, 1.058465f, 1.062614f, 1.066746f, 1.070863f,
-1.074964f, 1.079048f, 1.083117f, 1.087169f, 1.091205f, 1.095225f, 1.099229f, 1.103216f,
-1.107188f, 1.111142f, 1.115081f, 1.119002f, 1.122908f, 1.126796f, 1.130669f, 1.134524f,
-1.138363f, 1.142185f, 1.145990f, 1.149779f, 1.153551f, 1.157305f, 1.161043f, 1.164764f,
-1.168468f, 1.172155f, 1.175825f, 1.179478f, 1.183114f, 1.186732f, 1.190334f, 1.193918f,
-1.197485f, 1.201034f, 1.204567f, 1.208081f, 1.211579f, 1.215059f, 1.218522f, 1.221967f,
-1.225395f, 1.228805f, 1.232198f, 1.235573f, 1.238930f, 1.242270f, 1.245592f, 1.248897f,
-1.252184f, 1.255453f, 1.258704f, 1.261938f, 1.265154f, 1.268352f, 1.271532f, 1.274695f,
-1.277839f, 1.280966f, 1.284075f, 1.287165f, 1.290238f, 1.293293f, 1.296330f, 1.299349f,
-1.302350f, 1.305333f, 1.308298f, 1.311246f, 1.314174f, 1.317085f, 1.319978f, 1.322853f,
-1.325710f, 1.328548f, 1.331369f, 1.334171f, 1.336956f, 1.339722f, 1.342470f, 1.345200f,
-1.347912f, 1.350606f, 1.353281f, 1.355939f, 1.358578f, 1.361199f, 1.363802f, 1.366387f,
-1.368954f, 1.371502f, 1.374033f, 1.376545f, 1.379039f, 1.381516f, 1.383974f, 1.386413f,
-1.388835f, 1.391239f, 1.393625f, 1.395992f, 1.398342f, 1.400673f, 1.402986f, 1.405282f,
-1.407559f, 1.409818f, 1.412059f, 1.414283f, 1.416488f, 1.418675f, 1.420845f, 1.422996f,
-1.425130f, 1.427246f, 1.429344f, 1.431423f, 1.433486f, 1.435530f, 1.437557f, 1.439565f,
-1.441556f, 1.443530f, 1.445486f, 1.447424f, 1.449344f, 1.451247f, 1.453132f, 1.454999f,
-1.456850f, 1.458682f, 1.460497f, 1.462295f, 1.464075f, 1.465838f, 1.467584f, 1.469312f,
-1.471023f, 1.472717f, 1.474394f, 1.476053f, 1.477696f, 1.479321f, 1.480929f, 1.482520f,
-1.484095f, 1.485652f, 1.487193f, 1.488716f, 1.490223f, 1.491713f, 1.493187f, 1.494644f,
-1.496084f, 1.497508f, 1.498915f, 1.500306f, 1.501680f, 1.503038f, 1.504380f, 1.505706f,
-1.507015f, 1.508308f, 1.509586f, 1.510847f, 1.512092f, 1.513321f, 1.514535f, 1.515732f,
-1.516914f, 1.518081f, 1.519231f, 1.520367f, 1.521486f, 1.522591f, 1.523680f, 1.524754f,
-1.525812f, 1.526856f, 1.527884f, 1.528897f, 1.529896f, 1.530879f, 1.531848f, 1.532803f,
-1.533742f, 1.534667f, 1.535578f, 1.536474f, 1.537355f, 1.538223f, 1.539076f, 1.539916f,
-1.540741f, 1.541553f, 1.542350f, 1.543134f, 1.543904f, 1.544661f, 1.545404f, 1.546134f,
-1.546850f, 1.547554f, 1.548244f, 1.548921f, 1.549585f, 1.550236f, 1.550875f, 1.551500f,
-1.552114f, 1.552715f, 1.553303f, 1.553879f, 1.554443f, 1.554995f, 1.555535f, 1.556063f,
-1.556580f, 1.557085f, 1.557578f, 1.558059f, 1.558530f, 1.558989f, 1.559437f, 1.559874f,
-1.560300f, 1.560716f, 1.561120f, 1.561515f, 1.561898f, 1.562272f, 1.562635f, 1.562988f,
-1.563331f, 1.563665f, 1.563988f, 1.564302f, 1.564607f, 1.564902f, 1.565188f, 1.565464f,
-1.565732f, 1.565991f, 1.566241f, 1.566483f, 1.566716f, 1.566941f, 1.567158f, 1.567367f,
-1.567567f, 1.567760f, 1.567946f, 1.568123f, 1.568294f, 1.568457f, 1.568613f, 1.568762f,
-1.568904f, 1.569040f, 1.569169f, 1.569292f, 1.569409f, 1.569519f, 1.569624f, 1.569722f,
-1.569816f, 1.569903f, 1.569986f, 1.570063f, 1.570135f, 1.570203f, 1.570265f, 1.570324f,
-1.570378f, 1.570427f, 1.570473f, 1.570514f, 1.570552f, 1.570587f, 1.570618f, 1.570646f,
-1.570671f, 1.570693f, 1.570712f, 1.570729f, 1.570743f, 1.570755f, 1.570765f, 1.570774f,
-1.570780f, 1.570786f, 1.570790f, 1.570792f, 1.570794f, 1.570795f, 1.570796f, 1.570796f,
-1.570796f};
-
-/* static uint32_t tilt_elements = 1001; */
-/* static float tilt_profile[] = { */
-/* -1.570796f, -1.570796f, -1.570796f, -1.570795f, -1.570794f, -1.570792f, -1.570790f, -1.570786f, */
-/* -1.570780f, -1.570774f, -1.570765f, -1.570755f, -1.570743f, -1.570729f, -1.570712f, -1.570693f, */
-/* -1.570671f, -1.570646f, -1.570618f, -1.570587f, -1.570552f, -1.570514f, -1.570473f, -1.570427f, */
-/* -1.570378f, -1.570324f, -1.570265f, -1.570203f, -1.570135f, -1.570063f, -1.569986f, -1.569903f, */
-/* -1.569816f, -1.569722f, -1.569624f, -1.569519f, -1.569409f, -1.569292f, -1.569169f, -1.569040f, */
-/* -1.568904f, -1.568762f, -1.568613f, -1.568457f, -1.568294f, -1.568123f, -1.567946f, -1.567760f, */
-/* -1.567567f, -1.567367f, -1.567158f, -1.566941f, -1.566716f, -1.566483f, -1.566241f, -1.565991f, */
-/* -1.565732f, -1.565464f, -1.565188f, -1.564902f, -1.564607f, -1.564302f, -1.563988f, -1.563665f, */
-/* -1.563331f, -1.562988f, -1.562635f, -1.562272f, -1.561898f, -1.561515f, -1.561120f, -1.560716f, */
-/* -1.560300f, -1.559874f, -1.559437f, -1.558989f, -1.558530f, -1.558059f, -1.557578f, -1.557085f, */
-/* -1.556580f, -1.556063f, -1.555535f, -1.554995f, -1.554443f, -1.553879f, -1.553303f, -1.552715f, */
-/* -1.552114f, -1.551500f, -1.550875f, -1.550236f, -1.549585f, -1.548921f, -1.548244f, -1.547554f, */
-/* -1.546850f, -1.546134f, -1.545404f, -1.544661f, -1.543904f, -1.543134f, -1.542350f, -1.541553f, */
-/* -1.540741f, -1.539916f, -1.539076f, -1.538223f, -1.537355f, -1.536474f, -1.535578f, -1.534667f, */
-/* -1.533742f, -1.532803f, -1.531848f, -1.530879f, -1.529896f, -1.528897f, -1.527884f, -1.526856f, */
-/* -1.525812f, -1.524754f, -1.523680f, -1.522591f, -1.521486f, -1.520367f, -1.519231f, -1.518081f, */
-/* -1.516914f, -1.515732f, -1.514535f, -1.513321f, -1.512092f, -1.510847f, -1.509586f, -1.508308f, */
-/* -1.507015f, -1.505706f, -1.504380f, -1.503038f, -1.501680f, -1.500306f, -1.498915f, -1.497508f, */
-/* -1.496084f, -1.494644f, -1.493187f, -1.491713f, -1.490223f, -1.488716f, -1.487193f, -1.485652f, */
-/* -1.484095f, -1.482520f, -1.480929f, -1.479321f, -1.477696f, -1.476053f, -1.474394f, -1.472717f, */
-/* -1.471023f, -1.469312f, -1.467584f, -1.465838f, -1.464075f, -1.462295f, -1.460497f, -1.458682f, */
-/* -1.456850f, -1.454999f, -1.453132f, -1.451247f, -1.449344f, -1.447424f, -1.445486f, -1.443530f, */
-/* -1.441556f, -1.439565f, -1.437557f, -1.435530f, -1.433486f, -1.431423f, -1.429344f, -1.427246f, */
-/* -1.425130f, -1.422996f, -1.420845f, -1.418675f, -1.416488f, -1.414283f, -1.412059f, -1.409818f, */
-/* -1.407559f, -1.405282f, -1.402986f, -1.400673f, -1.398342f, -1.395992f, -1.393625f, -1.391239f, */
-/* -1.388835f, -1.386413f, -1.383974f, -1.381516f, -1.379039f, -1.376545f, -1.374033f, -1.371502f, */
-/* -1.368954f, -1.366387f, -1.363802f, -1.361199f, -1.358578f, -1.355939f, -1.353281f, -1.350606f, */
-/* -1.347912f, -1.345200f, -1.342470f, -1.339722f, -1.336956f, -1.334171f, -1.331369f, -1.328548f, */
-/* -1.325710f, -1.322853f, -1.319978f, -1.317085f, -1.314174f, -1.311246f, -1.308298f, -1.305333f, */
-/* -1.302350f, -1.299349f, -1.296330f, -1.293293f, -1.290238f, -1.287165f, -1.284075f, -1.280966f, */
-/* -1.277839f, -1.274695f, -1.271532f, -1.268352f, -1.265154f, -1.261938f, -1.258704f, -1.255453f, */
-/* -1.252184f, -1.248897f, -1.245592f, -1.242270f, -1.238930f, -1.235573f, -1.232198f, -1.228805f, */
-/* -1.225395f, -1.221967f, -1.218522f, -1.215059f, -1.211579f, -1.208081f, -1.204567f, -1.201034f, */
-/* -1.197485f, -1.193918f, -1.190334f, -1.186732f, -1.183114f, -1.179478f, -1.175825f, -1.172155f, */
-/* -1.168468f, -1.164764f, -1.161043f, -1.157305f, -1.153551f, -1.149779f, -1.145990f, -1.142185f, */
-/* -1.138363f, -1.134524f, -1.130669f, -1.126796f, -1.122908f, -1.119002f, -1.115081f, -1.111142f, */
-/* -1.107188f, -1.103216f, -1.099229f, -1.095225f, -1.091205f, -1.087169f, -1.083117f, -1.079048f, */
-/* -1.074964f, -1.070863f, -1.066746f, -1.062614f, -1.058465f, -1.054301f, -1.050121f, -1.045925f, */
-/* -1.041714f, -1.037487f, -1.033244f, -1.028986f, -1.024712f, -1.020423f, -1.016119f, -1.011799f, */
-/* -1.007464f, -1.003114f, -0.998748f, -0.994368f, -0.989972f, -0.985562f, -0.981136f, -0.976696f, */
-/* -0.972240f, -0.967770f, -0.963286f, -0.958786f, -0.954272f, -0.949744f, -0.945201f, -0.940644f, */
-/* -0.936072f, -0.931486f, -0.926886f, -0.922271f, -0.917643f, -0.913000f, -0.908344f, -0.903673f, */
-/* -0.898989f, -0.894291f, -0.889579f, -0.884854f, -0.880114f, -0.875362f, -0.870596f, -0.865816f, */
-/* -0.861023f, -0.856217f, -0.851398f, -0.846565f, -0.841720f, -0.836861f, -0.831990f, -0.827106f, */
-/* -0.822208f, -0.817299f, -0.812376f, -0.807441f, -0.802493f, -0.797533f, -0.792561f, -0.787576f, */
-/* -0.782579f, -0.777570f, -0.772549f, -0.767516f, -0.762470f, -0.757413f, -0.752345f, -0.747264f, */
-/* -0.742172f, -0.737068f, -0.731953f, -0.726826f, -0.721688f, -0.716539f, -0.711378f, -0.706206f, */
-/* -0.701024f, -0.695830f, -0.690625f, -0.685410f, -0.680184f, -0.674947f, -0.669700f, -0.664442f, */
-/* -0.659174f, -0.653895f, -0.648606f, -0.643307f, -0.637998f, -0.632679f, -0.627350f, -0.622011f, */
-/* -0.616662f, -0.611303f, -0.605935f, -0.600558f, -0.595171f, -0.589774f, -0.584368f, -0.578953f, */
-/* -0.573529f, -0.568096f, -0.562654f, -0.557203f, -0.551743f, -0.546274f, -0.540797f, -0.535312f, */
-/* -0.529817f, -0.524315f, -0.518804f, -0.513285f, -0.507758f, -0.502223f, -0.496679f, -0.491128f, */
-/* -0.485570f, -0.480003f, -0.474429f, -0.468847f, -0.463258f, -0.457662f, -0.452058f, -0.446447f, */
-/* -0.440829f, -0.435204f, -0.429573f, -0.423934f, -0.418289f, -0.412636f, -0.406978f, -0.401313f, */
-/* -0.395641f, -0.389964f, -0.384280f, -0.378590f, -0.372894f, -0.367192f, -0.361484f, -0.355770f, */
-/* -0.350051f, -0.344326f, -0.338596f, -0.332860f, -0.327119f, -0.321373f, -0.315621f, -0.309865f, */
-/* -0.304104f, -0.298338f, -0.292567f, -0.286791f, -0.281011f, -0.275226f, -0.269437f, -0.263644f, */
-/* -0.257846f, -0.252045f, -0.246239f, -0.240430f, -0.234616f, -0.228799f, -0.222978f, -0.217154f, */
-/* -0.211326f, -0.205495f, -0.199660f, -0.193822f, -0.187981f, -0.182138f, -0.176291f, -0.170441f, */
-/* -0.164589f, -0.158734f, -0.152877f, -0.147017f, -0.141155f, -0.135290f, -0.129424f, -0.123555f, */
-/* -0.117684f, -0.111812f, -0.105937f, -0.100061f, -0.094183f, -0.088304f, -0.082424f, -0.076542f, */
-/* -0.070659f, -0.064774f, -0.058889f, -0.053003f, -0.047116f, -0.041228f, -0.035340f, -0.029450f, */
-/* -0.023561f, -0.017671f, -0.011781f, -0.005890f, 0.000000f, 0.005890f, 0.011781f, 0.017671f, */
-/* 0.023561f, 0.029450f, 0.035340f, 0.041228f, 0.047116f, 0.053003f, 0.058889f, 0.064774f, */
-/* 0.070659f, 0.076542f, 0.082424f, 0.088304f, 0.094183f, 0.100061f, 0.105937f, 0.111812f, */
-/* 0.117684f, 0.123555f, 0.129424f, 0.135290f, 0.141155f, 0.147017f, 0.152877f, 0.158734f, */
-/* 0.164589f, 0.170441f, 0.176291f, 0.182138f, 0.187981f, 0.193822f, 0.199660f, 0.205495f, */
-/* 0.211326f, 0.217154f, 0.222978f, 0.228799f, 0.234616f, 0.240430f, 0.246239f, 0.252045f, */
-/* 0.257846f, 0.263644f, 0.269437f, 0.275226f, 0.281011f, 0.286791f, 0.292567f, 0.298338f, */
-/* 0.304104f, 0.309865f, 0.315621f, 0.321373f, 0.327119f, 0.332860f, 0.338596f, 0.344326f, */
-/* 0.350051f, 0.355770f, 0.361484f, 0.367192f, 0.372894f, 0.378590f, 0.384280f, 0.389964f, */
-/* 0.395641f, 0.401313f, 0.406978f, 0.412636f, 0.418289f, 0.423934f, 0.429573f, 0.435204f, */
-/* 0.440829f, 0.446447f, 0.452058f, 0.457662f, 0.463258f, 0.468847f, 0.474429f, 0.480003f, */
-/* 0.485570f, 0.491128f, 0.496679f, 0.502223f, 0.507758f, 0.513285f, 0.518804f, 0.524315f, */
-/* 0.529817f, 0.535312f, 0.540797f, 0.546274f, 0.551743f, 0.557203f, 0.562654f, 0.568096f, */
-/* 0.573529f, 0.578953f, 0.584368f, 0.589774f, 0.595171f, 0.600558f, 0.605935f, 0.611303f, */
-/* 0.616662f, 0.622011f, 0.627350f, 0.632679f, 0.637998f, 0.643307f, 0.648606f, 0.653895f, */
-/* 0.659174f, 0.664442f, 0.669700f, 0.674947f, 0.680184f, 0.685410f, 0.690625f, 0.695830f, */
-/* 0.701024f, 0.706206f, 0.711378f, 0.716539f, 0.721688f, 0.726826f, 0.731953f, 0.737068f, */
-/* 0.742172f, 0.747264f, 0.752345f, 0.757413f, 0.762470f, 0.767516f, 0.772549f, 0.777570f, */
-/* 0.782579f, 0.787576f, 0.792561f, 0.797533f, 0.802493f, 0.807441f, 0.812376f, 0.817299f, */
-/* 0.822208f, 0.827106f, 0.831990f, 0.836861f, 0.841720f, 0.846565f, 0.851398f, 0.856217f, */
-/* 0.861023f, 0.865816f, 0.870596f, 0.875362f, 0.880114f, 0.884854f, 0.889579f, 0.894291f, */
-/* 0.898989f, 0.903673f, 0.908344f, 0.913000f, 0.917643f, 0.922271f, 0.926886f, 0.931486f, */
-/* 0.936072f, 0.940644f, 0.945201f, 0.949744f, 0.954272f, 0.958786f, 0.963286f, 0.967770f, */
-/* 0.972240f, 0.976696f, 0.981136f, 0.985562f, 0.989972f, 0.994368f, 0.998748f, 1.003114f, */
-/* 1.007464f, 1.011799f, 1.016119f, 1.020423f, 1.024712f, 1.028986f, 1.033244f, 1.037487f, */
-/* 1.041714f, 1.045925f, 1.050121f, 1.054301f, 1.058465f, 1.062614f, 1.066746f, 1.070863f, */
-/* 1.074964f, 1.079048f, 1.083117f, 1.087169f, 1.091205f, 1.095225f, 1.099229f, 1.103216f, */
-/* 1.107188f, 1.111142f, 1.115081f, 1.119002f, 1.122908f, 1.126796f, 1.130669f, 1.134524f, */
-/* 1.138363f, 1.142185f, 1.145990f, 1.149779f, 1.153551f, 1.157305f, 1.161043f, 1.164764f, */
-/* 1.168468f, 1.172155f, 1.175825f, 1.179478f, 1.183114f, 1.186732f, 1.190334f, 1.193918f, */
-/* 1.197485f, 1.201034f, 1.204567f, 1.208081f, 1.211579f, 1.215059f, 1.218522f, 1.221967f, */
-/* 1.225395f, 1.228805f, 1.232198f, 1.235573f, 1.238930f, 1.242270f, 1.245592f, 1.248897f, */
-/* 1.252184f, 1.255453f, 1.258704f, 1.261938f, 1.265154f, 1.268352f, 1.271532f, 1.274695f, */
-/* 1.277839f, 1.280966f, 1.284075f, 1.287165f, 1.290238f, 1.293293f, 1.296330f, 1.299349f, */
-/* 1.302350f, 1.305333f, 1.308298f, 1.311246f, 1.314174f, 1.317085f, 1.319978f, 1.322853f, */
-/* 1.325710f, 1.328548f, 1.331369f, 1.334171f, 1.336956f, 1.339722f, 1.342470f, 1.345200f, */
-/* 1.347912f, 1.350606f, 1.353281f, 1.355939f, 1.358578f, 1.361199f, 1.363802f, 1.366387f, */
-/* 1.368954f, 1.371502f, 1.374033f, 1.376545f, 1.379039f, 1.381516f, 1.383974f, 1.386413f, */
-/* 1.388835f, 1.391239f, 1.393625f, 1.395992f, 1.398342f, 1.400673f, 1.402986f, 1.405282f, */
-/* 1.407559f, 1.409818f, 1.412059f, 1.414283f, 1.416488f, 1.418675f, 1.420845f, 1.422996f, */
-/* 1.425130f, 1.427246f, 1.429344f, 1.431423f, 1.433486f, 1.435530f, 1.437557f, 1.439565f, */
-/* 1.441556f, 1.443530f, 1.445486f, 1.447424f, 1.449344f, 1.451247f, 1.453132f, 1.454999f, */
-/* 1.456850f, 1.458682f, 1.460497f, 1.462295f, 1.464075f, 1.465838f, 1.467584f, 1.469312f, */
-/* 1.471023f, 1.472717f, 1.474394f, 1.476053f, 1.477696f, 1.479321f, 1.480929f, 1.482520f, */
-/* 1.484095f, 1.485652f, 1.487193f, 1.488716f, 1.490223f, 1.491713f, 1.493187f, 1.494644f, */
-/* 1.496084f, 1.497508f, 1.498915f, 1.500306f, 1.501680f, 1.503038f, 1.504380f, 1.505706f, */
-/* 1.507015f, 1.508308f, 1.509586f, 1.510847f, 1.512092f, 1.513321f, 1.514535f, 1.515732f, */
-/* 1.516914f, 1.518081f, 1.519231f, 1.520367f, 1.521486f, 1.522591f, 1.523680f, 1.524754f, */
-/* 1.525812f, 1.526856f, 1.527884f, 1.528897f, 1.529896f, 1.530879f, 1.531848f, 1.532803f, */
-/* 1.533742f, 1.534667f, 1.535578f, 1.536474f, 1.537355f, 1.538223f, 1.539076f, 1.539916f, */
-/* 1.540741f, 1.541553f, 1.542350f, 1.543134f, 1.543904f, 1.544661f, 1.545404f, 1.546134f, */
-/* 1.546850f, 1.547554f, 1.548244f, 1.548921f, 1.549585f, 1.550236f, 1.550875f, 1.551500f, */
-/* 1.552114f, 1.552715f, 1.553303f, 1.553879f, 1.554443f, 1.554995f, 1.555535f, 1.556063f, */
-/* 1.556580f, 1.557085f, 1.557578f, 1.558059f, 1.558530f, 1.558989f, 1.559437f, 1.559874f, */
-/* 1.560300f, 1.560716f, 1.561120f, 1.561515f, 1.561898f, 1.562272f, 1.562635f, 1.562988f, */
-/* 1.563331f, 1.563665f, 1.563988f, 1.564302f, 1.564607f, 1.564902f, 1.565188f, 1.565464f, */
-/* 1.565732f, 1.565991f, 1.566241f, 1.566483f, 1.566716f, 1.566941f, 1.567158f, 1.567367f, */
-/* 1.567567f, 1.567760f, 1.567946f, 1.568123f, 1.568294f, 1.568457f, 1.568613f, 1.568762f, */
-/* 1.568904f, 1.569040f, 1.569169f, 1.569292f, 1.569409f, 1.569519f, 1.569624f, 1.569722f, */
-/* 1.569816f, 1.569903f, 1.569986f, 1.570063f, 1.570135f, 1.570203f, 1.570265f, 1.570324f, */
-/* 1.570378f, 1.570427f, 1.570473f, 1.570514f, 1.570552f, 1.570587f, 1.570618f, 1.570646f, */
-/* 1.570671f, 1.570693f, 1.570712f, 1.570729f, 1.570743f, 1.570755f, 1.570765f, 1.570774f, */
-/* 1.570780f, 1.570786f, 1.570790f, 1.570792f, 1.570794f, 1.570795f, 1.570796f, 1.570796f, */
-/* 1.570796f}; */
+/* One way, what the 1001 entry table took at one entry a tick. */
+#define TILT_SWEEP_S  1.0f
 
+/* Relay experiment, see tilt_motor_autotune(). */
+#define TILT_AUTOTUNE_RELAY        0.30f
+#define TILT_AUTOTUNE_HYSTERESIS   ((4.0f * TILT_TWO_PI) / ((float)TILT_MOTOR_QCPR * TILT_MOTOR_GEAR_RATIO))
+#define TILT_AUTOTUNE_LIMIT        0.5f
+#define TILT_AUTOTUNE_RULE         MOTOR_AUTOTUNE_TYREUS_LUYBEN
 
 tilt_motor_states tms;
 tilt_home_states ths;
@@ -304,6 +55,12 @@ uint32_t motor_state_machine_time = 0;
 volatile uint8_t send_motor_feedback = 0;
 volatile motor_feedback_t mf;
 
+uint8_t tilt_motor_initialized = 0;
+motor_autotune_t tilt_autotune;
+
+trajectory_t tilt_trajectory;
+volatile float tilt_sweep_s = TILT_SWEEP_S;
+
 void tilt_motor_init(void)
 {
 
@@ -317,6 +74,8 @@ void tilt_motor_init(void)
 
    tms = TILT_INITIALIZE;
 
+   tilt_motor_initialized = 1;
+
 }
 
 
@@ -328,15 +87,17 @@ void tilt_motor_init_state_machine(void)
    uint32_t TimerPeriod = 0;
    uint16_t pscale = 0;
 
-   /* Turn the timer clock on! */
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+   /* Turn the timer clock on!  TIM2 is the software timers' now, so the
+    * state machine is on TIM7.
+    */
+   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM7, ENABLE);
 
-   /* Start with a 1ms timer for the state machine.  TIM2 is a 32bit counter!
+   /* Start with a 1ms timer for the state machine.  TIM7 is a 16bit counter!
     * And APB1 is counting at 84 MHz...SystemCoreClock is 168 MHz so the
-    * factor of 2 in the denominator. Assumes the Prescaler is 0 and  that
-    * TimerPeriod wouldn't roll a 32 bit number.
+    * factor of 2 in the denominator.  84000 counts won't fit so the
+    * prescaler halves it.
     */
-   pscale = 0;
+   pscale = 1;
    TimerPeriod = (SystemCoreClock / (MOTOR_STATE_MACHINE_HZ * 2 * (pscale + 1))) - 1;
 
    /* Time Base configuration */
@@ -346,30 +107,34 @@ void tilt_motor_init_state_machine(void)
    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
 
-   TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+   TIM_TimeBaseInit(TIM7, &TIM_TimeBaseStructure);
 
    /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM2_IRQn;
+   NVIC_InitStructure.NVIC_IRQChannel = TIM7_IRQn;
    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
    NVIC_Init(&NVIC_InitStructure);
 
-   TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+   TIM_ITConfig(TIM7, TIM_IT_Update, ENABLE);
 
-   TIM_Cmd(TIM2, ENABLE);
+   TIM_Cmd(TIM7, ENABLE);
 
 }
 
 
 /* Tilt motor state machine! */
-void TIM2_IRQHandler(void)
+void TIM7_IRQHandler(void)
 {
    float tilt_rad;
-   uint32_t encoder_cnt;
-   uint32_t flag_counts;
+   float p, i, d;
+   trajectory_point_t pt;
+   int32_t encoder_cnt;
+   int32_t flag_counts;
 
-   if(TIM_GetITStatus(TIM2, TIM_IT_Update) != RESET)
+   PROFILE_ENTER_TIM(PROFILE_ID_TIM7, TIM7, 2);
+
+   if(TIM_GetITStatus(TIM7, TIM_IT_Update) != RESET)
    {
       /* if(GPIO_ReadInputDataBit(GPIOD, LED_PIN_ORANGE) == Bit_SET) */
       /* { */
@@ -385,6 +150,10 @@ void TIM2_IRQHandler(void)
 
       motor_state_machine_time++;
 
+      /* Only the sweep has feed-forward. */
+      mcp.ff_vel = 0.0f;
+      mcp.ff_acc = 0.0f;
+
       switch(tms)
       {
          case TILT_INITIALIZE:
@@ -404,6 +173,7 @@ void TIM2_IRQHandler(void)
 
             /* tms = TILT_CCW; */
             /* tms = TILT_FIND_HOME; */
+            trajectory_init_sweep(&tilt_trajectory, TILT_MIN_ANGLE_RAD, TILT_MAX_ANGLE_RAD, tilt_sweep_s, 0.0f);
             tms = TILT_TABLE;
 
             /* ths = TILT_HOME_INITIALIZE; */
@@ -492,30 +262,22 @@ void TIM2_IRQHandler(void)
 
             break;
          case TILT_TABLE:
-            if(tilt_dir == 1)
-            {
-               tilt_index = tilt_index + 1;
-               if(tilt_index >= (tilt_elements - 1))
-               {
-                  tilt_index = tilt_elements - 1;
-                  tilt_dir = 0;
-               }
-            }
-            else
+            /* A new period from tilt_motor_set_sweep_period() starts here,
+             * where nothing else is using the trajectory.
+             */
+            if(tilt_trajectory.period != tilt_sweep_s)
             {
-               if(tilt_index <= 0)
-               {
-                  tilt_index = 0;
-                  tilt_dir = 1;
-               }
-               else
-               {
-                  tilt_index = tilt_index - 1;
-               }
+               trajectory_set_period(&tilt_trajectory, tilt_sweep_s);
             }
 
-            mcp.cmd = tilt_profile_tangent[tilt_index];
+            trajectory_advance(&tilt_trajectory, MOTOR_STATE_MACHINE_MS / 1000.0f, &pt);
+            mcp.cmd = pt.pos;
+            mcp.ff_vel = pt.vel;
+            mcp.ff_acc = pt.acc;
 
+            break;
+         case TILT_AUTOTUNE:
+            /* The relay drives the motor below, instead of the PID. */
             break;
          case TILT_DISABLE:
             break;
@@ -527,7 +289,27 @@ void TIM2_IRQHandler(void)
 
       }
 
-      if(!RUN_OPEN_LOOP)
+      /* Velocity is estimated at the loop rate. */
+      quad_encoder_sample();
+
+      if(tms == TILT_AUTOTUNE)
+      {
+         tilt_motor_get_angle(&tilt_rad);
+         TB6612_set_duty(motor_autotune_run(&tilt_autotune, tilt_rad));
+
+         if(tilt_autotune.state == MOTOR_AUTOTUNE_DONE)
+         {
+            motor_autotune_gains(&tilt_autotune, TILT_AUTOTUNE_RULE, &p, &i, &d);
+            motor_control_set_pid_gains(&mcp, p, i, d);
+            motor_control_seed_integrator(&mcp, 0.0f);
+            tms = TILT_DISABLE;
+         }
+         else if(tilt_autotune.state != MOTOR_AUTOTUNE_RUNNING)
+         {
+            tms = TILT_ERROR;
+         }
+      }
+      else if(!RUN_OPEN_LOOP)
       {
          tilt_motor_get_angle(&tilt_rad);
          mcp.msr = tilt_rad;
@@ -558,9 +340,10 @@ void TIM2_IRQHandler(void)
       }
 
 
-      TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+      TIM_ClearITPendingBit(TIM7, TIM_IT_Update);
    }
 
+   PROFILE_EXIT(PROFILE_ID_TIM7);
 }
 
 
@@ -601,10 +384,15 @@ void tilt_motor_init_flag(void)
 
 }
 
-/* Tilt Flag Interrupt Handler */
-void EXTI15_10_IRQHandler(void)
+/* Tilt Flag Interrupt
+ *
+ * Notes:
+ *  +EXTI15_10_IRQHandler() belongs to the Hokuyo sync in
+ *   tilt_stepper_motor_control.c, a board with the flag calls this from it.
+ */
+void tilt_motor_flag_edge(void)
 {
-   uint32_t flag_counts;
+   int32_t flag_counts;
 
    if(EXTI_GetITStatus(EXTI_Line15) != RESET)
    {
@@ -632,7 +420,7 @@ void EXTI15_10_IRQHandler(void)
 
 void tilt_motor_get_angle(float *tilt_angle_rad)
 {
-   uint32_t quad_counts;
+   int32_t quad_counts;
 
    quad_encoder_read_position(&quad_counts);
 
@@ -641,13 +429,21 @@ void tilt_motor_get_angle(float *tilt_angle_rad)
 }
 
 
-void tilt_motor_angle_to_counts(float tilt_angle_rad, uint32_t *quad_counts)
+void tilt_motor_get_velocity(float *tilt_rad_per_s)
+{
+
+   *tilt_rad_per_s = (quad_encoder_read_velocity() * TILT_TWO_PI) / ((float)TILT_MOTOR_QCPR * TILT_MOTOR_GEAR_RATIO);
+
+}
+
+
+void tilt_motor_angle_to_counts(float tilt_angle_rad, int32_t *quad_counts)
 {
 
    /* *tilt_angle_rad = (((float)quad_counts - (float)TILT_ZERO_POSITION_QC) * TILT_TWO_PI) / ((float)TILT_MOTOR_QCPR * TILT_MOTOR_GEAR_RATIO); */
 
    /* Need to do bounds check on tilt_angle_rad!!!! */
-   *quad_counts = (uint32_t)( ((tilt_angle_rad * ((float)TILT_MOTOR_QCPR * TILT_MOTOR_GEAR_RATIO)) / TILT_TWO_PI) + (float)TILT_ZERO_POSITION_QC );
+   *quad_counts = (int32_t)( ((tilt_angle_rad * ((float)TILT_MOTOR_QCPR * TILT_MOTOR_GEAR_RATIO)) / TILT_TWO_PI) + (float)TILT_ZERO_POSITION_QC );
 
 }
 
@@ -656,11 +452,34 @@ uint8_t tilt_motor_set_pid_gains(float p, float i, float d)
 {
    uint8_t retval;
 
+   /* Before motor_control_init_pid() there's no period to divide d by. */
+   if((!tilt_motor_initialized)||(tms == TILT_AUTOTUNE))
+   {
+      return 1;
+   }
+
    retval = motor_control_set_pid_gains(&mcp, p, i, d);
 
    return retval;
 }
 
+uint8_t tilt_motor_set_ff_gains(float kv, float ka, float aw)
+{
+   return motor_control_set_ff_gains(&mcp, kv, ka, aw);
+}
+
+uint8_t tilt_motor_set_sweep_period(float period_s)
+{
+   if(!(period_s > 0.0f))
+   {
+      return 1;
+   }
+
+   tilt_sweep_s = period_s;
+
+   return 0;
+}
+
 uint8_t tilt_motor_query_pid_gains(float *p, float *i, float *d)
 {
 
@@ -671,6 +490,37 @@ uint8_t tilt_motor_query_pid_gains(float *p, float *i, float *d)
    return 0;
 }
 
+/* tilt_motor_autotune
+ *
+ * Notes:
+ *  +Runs a relay experiment about wherever the axis is and replaces the gains
+ *   with TILT_AUTOTUNE_RULE's.  Park it at least TILT_AUTOTUNE_LIMIT from
+ *   either end first.
+ *  +Ends in TILT_DISABLE holding nothing, or TILT_ERROR if it failed.
+ *   tilt_motor_query_pid_gains() shows the result, tilt_motor_start() goes
+ *   back to tilting.
+ */
+uint8_t tilt_motor_autotune(void)
+{
+   uint8_t retval;
+   float tilt_rad;
+
+   if(!tilt_motor_initialized)
+   {
+      return 1;
+   }
+
+   tms = TILT_DISABLE;
+   tilt_motor_get_angle(&tilt_rad);
+   retval = motor_autotune_start(&tilt_autotune, tilt_rad, TILT_AUTOTUNE_RELAY, TILT_AUTOTUNE_HYSTERESIS, TILT_AUTOTUNE_LIMIT, mcp.dt);
+   if(retval == MOTOR_AUTOTUNE_SUCCESS)
+   {
+      tms = TILT_AUTOTUNE;
+   }
+
+   return retval;
+}
+
 uint8_t tilt_motor_start(void)
 {
    tms = TILT_INITIALIZE;
@@ -7,7 +7,7 @@
  * Handles step timing, flag sensor for homing, and high level state machine.
  * Lower level motor control is handled in TMC260.c.
  */
-#include "stm32f4xx_conf.h"
+#include "hal.h"
 #include "tilt_stepper_motor_control.h"
 
 #include "debug.h"
@@ -21,8 +21,13 @@
 
 /* Note that this can only bee included one time from one file. */
 #include "tilt_stepper_motor_profile.h"
+#include "trajectory.h"
 
 #include "watchdog.h"
+#include "event_scheduler.h"
+#include "profile.h"
+#include "trace.h"
+#include "memory_sections.h"
 
 volatile uint32_t ts_cont_timer = 0;
 volatile uint32_t ts_state_timer = 0;
@@ -31,9 +36,6 @@ tilt_stepper_states ts_state_after_home =  TILT_STEPPER_TEST_DELAY;
 
 tmc260_status_struct stat_struct;
 
-uint8_t last_dir = 0;
-
-volatile uint32_t tilt_index = 0;
 volatile int32_t steps_from_home = 0;
 tilt_stepper_dirs current_step_dir = TILT_STEPPER_DIR_STOPPED;
 float current_step_freq = 0.0f;
@@ -50,6 +52,17 @@ volatile uint8_t tilt_stepper_motor_send_angle = 0;
 
 float stepper_profile_multiplier = 1.0f;
 
+/* TIM5 counts per TIM11 tick, and the period it polls at while it has no
+ * steps to take.
+ */
+#define TILT_STEPPER_TICK_COUNTS  (SystemCoreClock / (TILT_STEPPER_STATE_MACHINE_HZ * 2 * (pscale + 1)))
+#define TILT_STEPPER_IDLE_PERIOD  ((TILT_STEPPER_TICK_COUNTS / 8) - 1)
+
+/* The sweep, and what TIM11 has asked TIM5 for up to its next tick. */
+trajectory_t tilt_stepper_trajectory;
+volatile int32_t tilt_step_target = 0;
+volatile uint32_t tilt_step_period = 0;
+
 uint32_t TimerPeriod = 0;
 uint16_t pscale = 0;
 
@@ -57,12 +70,13 @@ uint16_t pscale = 0;
 void tilt_stepper_motor_init_state_machine(void);
 void tilt_stepper_motor_init_step_timer(void);
 void tilt_stepper_motor_init_home_sensor(void);
-void tilt_stepper_motor_init_home_sensor_real_deal(void);
 void tilt_stepper_motor_state_change(tilt_stepper_states new_state, uint8_t reset_timer);
 void tilt_stepper_motor_set_CCW(void);
 void tilt_stepper_motor_set_CW(void);
-void tilt_stepper_motor_step(void);
+RAMFUNC void tilt_stepper_motor_step(void);
 void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status);
+void tilt_stepper_motor_schedule_steps(void);
+float tilt_stepper_motor_sweep_period(void);
 
 /* Public function.  Doxygen documentation is in the header file. */
 void tilt_stepper_motor_init(void)
@@ -75,11 +89,7 @@ void tilt_stepper_motor_init(void)
 
    tilt_stepper_motor_init_state_machine();
    tilt_stepper_motor_init_step_timer();
-#ifdef TOS_100_DEV_BOARD
    tilt_stepper_motor_init_home_sensor();
-#else
-   tilt_stepper_motor_init_home_sensor_real_deal();
-#endif
    /* Set initial state and stuch... */
    watchdog_init();
 
@@ -88,122 +98,21 @@ void tilt_stepper_motor_init(void)
 
 /**
  * @fn void tilt_stepper_motor_init_home_sensor(void)
- * @brief Initialize the home sensor.
+ * @brief Initialize the home sensor, and the Hokuyo sync on the real board.
  * @param None
  * @return None
  *
  */
 void tilt_stepper_motor_init_home_sensor(void)
 {
-
-   GPIO_InitTypeDef GPIO_InitStructure;
-   EXTI_InitTypeDef EXTI_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
-   /* Enable clock for SYSCFG */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
-
-
-   /** @todo Make PC1 an EXTI so that we can easily catch HOME. */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_1;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-   SYSCFG_EXTILineConfig(EXTI_PortSourceGPIOC, EXTI_PinSource1);
-
-   EXTI_InitStructure.EXTI_Line = EXTI_Line1;
-   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-   EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
-   /* EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; */
-   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-   EXTI_Init(&EXTI_InitStructure);
-
-   /** @todo Need to set the interrupt priority properly to catch HOME. */
-   NVIC_InitStructure.NVIC_IRQChannel = EXTI1_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-
-
-}
-
-
-/**
- * @fn void tilt_stepper_motor_init_home_sensor(void)
- * @brief Initialize the home sensor.
- * @param None
- * @return None
- *
- */
-void tilt_stepper_motor_init_home_sensor_real_deal(void)
-{
-
-   GPIO_InitTypeDef GPIO_InitStructure;
-   EXTI_InitTypeDef EXTI_InitStructure;
-   NVIC_InitTypeDef NVIC_InitStructure;
-
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
-   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
-   /* Enable clock for SYSCFG */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
-
-
-   /** @todo Make PC1 an EXTI so that we can easily catch HOME. */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-   SYSCFG_EXTILineConfig(EXTI_PortSourceGPIOC, EXTI_PinSource0);
-
-   EXTI_InitStructure.EXTI_Line = EXTI_Line0;
-   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-   EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
-   /* EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; */
-   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-   EXTI_Init(&EXTI_InitStructure);
-
    /** @todo Need to set the interrupt priority properly to catch HOME. */
-   NVIC_InitStructure.NVIC_IRQChannel = EXTI0_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-
-   /** @todo Make PB12 an EXTI so that we can easily catch Hokuyo Sync. */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_12;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-   GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-   GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
-   GPIO_Init(GPIOB, &GPIO_InitStructure);
-
-   SYSCFG_EXTILineConfig(EXTI_PortSourceGPIOB, EXTI_PinSource12);
-
-   EXTI_InitStructure.EXTI_Line = EXTI_Line12;
-   EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-   /* EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling; */
-   EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
-   EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-   EXTI_Init(&EXTI_InitStructure);
-
-   /** @todo Need to set the interrupt priority properly to catch HOME. */
-   NVIC_InitStructure.NVIC_IRQChannel = EXTI15_10_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x0F;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
+   hal_gpio_init(HAL_PIN_TILT_HOME, HAL_GPIO_INPUT_PULLUP);
+   hal_exti_init(HAL_PIN_TILT_HOME, HAL_EXTI_BOTH, 0x0F, 0x0F);
 
+#ifndef TOS_100_DEV_BOARD
+   hal_gpio_init(HAL_PIN_HOKUYO_SYNC, HAL_GPIO_INPUT_PULLUP);
+   hal_exti_init(HAL_PIN_HOKUYO_SYNC, HAL_EXTI_FALLING, 0x0F, 0x0F);
+#endif
 }
 
 
@@ -217,39 +126,14 @@ void tilt_stepper_motor_init_home_sensor_real_deal(void)
  */
 void tilt_stepper_motor_init_state_machine(void)
 {
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
-   NVIC_InitTypeDef   NVIC_InitStructure;
-
    uint32_t TimerPeriod = 0;
    uint16_t pscale = 0;
 
-   /* Turn the timer clock on! */
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM11, ENABLE);
-
    /* TIM11 on APB2 runs at SystemCoreClock. */
    pscale = 2;
    TimerPeriod = (SystemCoreClock / (TILT_STEPPER_STATE_MACHINE_HZ * (pscale+1))) - 1;
 
-   /* Time Base configuration */
-   TIM_TimeBaseStructure.TIM_Prescaler = pscale;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-   TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
-   TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
-
-   TIM_TimeBaseInit(TIM11, &TIM_TimeBaseStructure);
-
-   /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM1_TRG_COM_TIM11_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x01;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-   TIM_ITConfig(TIM11, TIM_IT_Update, ENABLE);
-
-   TIM_Cmd(TIM11, ENABLE);
-
+   hal_timer_init(HAL_TIMER_TILT_STATE, pscale, TimerPeriod, 0x01, 0x00);
 }
 
 /**
@@ -261,18 +145,13 @@ void tilt_stepper_motor_init_state_machine(void)
  * This function will reload the ARR value each time such that the next step
  * will be taken at the appropriate time.  It will do nothing if we aren't
  * in a moving state.
+ *
+ * Runs from RAM along with tilt_stepper_motor_step(), step timing shouldn't
+ * depend on what's in the flash cache.
  */
 void tilt_stepper_motor_init_step_timer(void)
 {
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
-   NVIC_InitTypeDef   NVIC_InitStructure;
-
-
-
-   /* Turn the timer clock on! */
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM5, ENABLE);
-
-   /* Start with a 1ms timer for the state machine.  TIM2 is a 32bit counter!
+   /* Start with a 1ms timer for the state machine.  TIM5 is a 32bit counter!
     * And APB1 is counting at 84 MHz...SystemCoreClock is 168 MHz so the
     * factor of 2 in the denominator. Assumes the Prescaler is 0 and  that
     * TimerPeriod wouldn't roll a 32 bit number.
@@ -281,25 +160,7 @@ void tilt_stepper_motor_init_step_timer(void)
    pscale = 0;
    TimerPeriod = (SystemCoreClock / (current_step_freq * 2 * (pscale + 1))) - 1;
 
-   /* Time Base configuration */
-   TIM_TimeBaseStructure.TIM_Prescaler = pscale;
-   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-   TIM_TimeBaseStructure.TIM_Period = TimerPeriod;
-   TIM_TimeBaseStructure.TIM_ClockDivision = 0;
-   TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
-
-   TIM_TimeBaseInit(TIM5, &TIM_TimeBaseStructure);
-
-   /* Set up interrupt. */
-   NVIC_InitStructure.NVIC_IRQChannel = TIM5_IRQn;
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-
-   TIM_ITConfig(TIM5, TIM_IT_Update, ENABLE);
-
-   TIM_Cmd(TIM5, ENABLE);
+   hal_timer_init(HAL_TIMER_TILT_STEP, pscale, TimerPeriod, 0x00, 0x00);
 }
 
 
@@ -312,61 +173,50 @@ void tilt_stepper_motor_init_step_timer(void)
  */
 void EXTI15_10_IRQHandler(void)
 {
+   PROFILE_ENTER();
 
-   if(EXTI_GetITStatus(EXTI_Line12) != RESET)
+   if(hal_exti_pending(HAL_PIN_HOKUYO_SYNC))
    {
 
       if(tilt_stepper_motor_send_angle == 0)
       {
          tilt_stepper_motor_send_angle = 1;
+         event_post(EVENT_TILT_SYNC);
          /* TMC260_status(TMC260_STATUS_CURRENT, &stat_struct, 1); */
       }
 
-      EXTI_ClearITPendingBit(EXTI_Line12);
+      hal_exti_clear(HAL_PIN_HOKUYO_SYNC);
    }
-}
-
-
-
-/**
- * @fn void EXTI1_Handler(void)
- * @brief Handles the external interrupt generated by the HOME flag.
- *
- * @param None
- * @return None
- */
-void EXTI1_IRQHandler(void)
-{
-   uint8_t home_flag_state;
 
-   if(EXTI_GetITStatus(EXTI_Line1) != RESET)
-   {
-      home_flag_state = GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_1);
+   PROFILE_EXIT(PROFILE_ID_EXTI15_10);
+}
 
-      tilt_stepper_motor_home_flag_handler(home_flag_state);
 
-      EXTI_ClearITPendingBit(EXTI_Line1);
-   }
-}
 
 /**
  * @fn void EXTI0_Handler(void)
  * @brief Handles the external interrupt generated by the HOME flag.
  *
+ * EXTI1 on the TOS_100 dev board, where the flag is on PC1.
+ *
  * @param None
  * @return None
  */
+#ifdef TOS_100_DEV_BOARD
+void EXTI1_IRQHandler(void)
+#else
 void EXTI0_IRQHandler(void)
+#endif
 {
    uint8_t home_flag_state;
 
-   if(EXTI_GetITStatus(EXTI_Line0) != RESET)
+   if(hal_exti_pending(HAL_PIN_TILT_HOME))
    {
-      home_flag_state = GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_0);
+      home_flag_state = hal_gpio_read(HAL_PIN_TILT_HOME);
 
       tilt_stepper_motor_home_flag_handler(home_flag_state);
 
-      EXTI_ClearITPendingBit(EXTI_Line0);
+      hal_exti_clear(HAL_PIN_TILT_HOME);
    }
 }
 
@@ -377,7 +227,7 @@ void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status)
     * @todo Need to actually implement home functionality.
     */
    /* Reset our position to zero. */
-   if(home_flag_status == Bit_SET)
+   if(home_flag_status)
    {
       if(current_step_dir == TILT_STEPPER_DIR_CW)
       {
@@ -390,7 +240,7 @@ void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status)
       else
       {
          /* Flag is uncovered.  We need to go CCW until we cover it. */
-         current_pos_rad = 3.14f;
+         current_pos_rad = TILT_STEPPER_TWO_PI / 2.0f;
          steps_from_home = (int32_t)((current_pos_rad * (float)micro_steps_per_rev * stepper_gear_ratio_num) / (stepper_gear_ratio_den * TILT_STEPPER_TWO_PI));
 
          debug_output_clear(DEBUG_LED_RED);
@@ -401,7 +251,7 @@ void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status)
       if(current_step_dir == TILT_STEPPER_DIR_CW)
       {
          /* Flag is uncovered.  We need to go CCW until we cover it. */
-         current_pos_rad = 3.14f;
+         current_pos_rad = TILT_STEPPER_TWO_PI / 2.0f;
          steps_from_home = (int32_t)((current_pos_rad * (float)micro_steps_per_rev * stepper_gear_ratio_num) / (stepper_gear_ratio_den * TILT_STEPPER_TWO_PI));
 
          debug_output_clear(DEBUG_LED_ORANGE);
@@ -421,9 +271,6 @@ void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status)
    {
       if(ts_state == TILT_STEPPER_HOME)
       {
-         /* Get us tilting in the correct direction. */
-         last_dir = 1;
-
          /* We're home! */
          tilt_stepper_motor_state_change(ts_state_after_home, 1);
       }
@@ -442,9 +289,11 @@ void tilt_stepper_motor_home_flag_handler(uint8_t home_flag_status)
  * will be taken at the appropriate time.  It will do nothing if we aren't
  * in a moving state.
  */
-void TIM5_IRQHandler(void)
+RAMFUNC void TIM5_IRQHandler(void)
 {
-   if(TIM_GetITStatus(TIM5, TIM_IT_Update) != RESET)
+   PROFILE_ENTER_TIMER(PROFILE_ID_TIM5, HAL_TIMER_TILT_STEP);
+
+   if(hal_timer_update_pending(HAL_TIMER_TILT_STEP))
    {
 
       debug_output_toggle(DEBUG_LED_GREEN);
@@ -474,7 +323,7 @@ void TIM5_IRQHandler(void)
             }
 
             TimerPeriod = (SystemCoreClock / (current_step_freq * 2 * (pscale + 1))) - 1;
-            TIM_SetAutoreload(TIM5, TimerPeriod);
+            hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
          }
 
          if(current_pos_rad > target_pos_rad)
@@ -506,27 +355,32 @@ void TIM5_IRQHandler(void)
             }
 
             TimerPeriod = (SystemCoreClock / (current_step_freq * 2 * (pscale + 1))) - 1;
-            TIM_SetAutoreload(TIM5, TimerPeriod);
+            hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
          }
          tilt_stepper_motor_step();
       }
 
       if(ts_state == TILT_STEPPER_TILT_TABLE)
       {
-         tilt_index++;
-         if((tilt_index < tilt_elements)&&(stepper_profile[tilt_index] > 0))
+         /* Only steps toward the target, a direction change in TIM11 with
+          * steps still owed the other way just drops them.
+          */
+         if(((current_step_dir == TILT_STEPPER_DIR_CCW)&&(steps_from_home < tilt_step_target))||
+            ((current_step_dir == TILT_STEPPER_DIR_CW)&&(steps_from_home > tilt_step_target)))
          {
             tilt_stepper_motor_step();
-            TIM_SetAutoreload(TIM5, (uint32_t)(stepper_profile_multiplier * stepper_profile[tilt_index]));
-         }
-         else
-         {
-            tilt_stepper_motor_state_change(TILT_STEPPER_TILT_TABLE, 1);
          }
+
+         /* Only ever written here, just after the update, so it can't be
+          * set under the count.
+          */
+         hal_timer_set_period(HAL_TIMER_TILT_STEP, tilt_step_period);
       }
 
-      TIM_ClearITPendingBit(TIM5, TIM_IT_Update);
+      hal_timer_update_clear(HAL_TIMER_TILT_STEP);
    }
+
+   PROFILE_EXIT(PROFILE_ID_TIM5);
 }
 
 
@@ -539,7 +393,9 @@ void TIM5_IRQHandler(void)
  */
 void TIM1_TRG_COM_TIM11_IRQHandler(void)
 {
-   if(TIM_GetITStatus(TIM11, TIM_IT_Update) != RESET)
+   PROFILE_ENTER_TIMER(PROFILE_ID_TIM11, HAL_TIMER_TILT_STATE);
+
+   if(hal_timer_update_pending(HAL_TIMER_TILT_STATE))
    {
       debug_output_toggle(DEBUG_LED_BLUE);
 
@@ -601,11 +457,11 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
             if(ts_state_timer == 1)
             {
                TMC260_disable();
-               TIM_Cmd(TIM5, DISABLE);
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
                current_step_freq = DEFAULT_STEP_FREQ_HZ;
                TimerPeriod = (SystemCoreClock / (DEFAULT_STEP_FREQ_HZ * 2 * (pscale + 1))) - 1;
-               TIM_SetAutoreload(TIM5, TimerPeriod);
-               TIM_Cmd(TIM5, ENABLE);
+               hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
+               hal_timer_enable(HAL_TIMER_TILT_STEP);
 
                /**
                 * @todo This is not safe yet... It is still possible to start
@@ -619,7 +475,7 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
                TMC260_enable();
                if(steps_from_home == 0)
                {
-                  if(GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_1) == Bit_SET)
+                  if(hal_gpio_read(HAL_PIN_TILT_HOME))
                   {
                      /* Flag is uncovered.  We need to go CCW until we cover it. */
                      tilt_stepper_motor_set_CW();
@@ -647,7 +503,7 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
             /* In case we aren't moving...let's reset again. */
             if(ts_state_timer > 5000)
             {
-               TIM_Cmd(TIM5, DISABLE);
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
                current_pos_rad = 0.0f;
                steps_from_home = 0;
                tilt_stepper_motor_state_change(TILT_STEPPER_INITIALIZE, 1);
@@ -669,11 +525,11 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
                   tilt_stepper_motor_set_CCW();
                }
 
-               TIM_Cmd(TIM5, DISABLE);
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
                current_step_freq = DEFAULT_STEP_FREQ_HZ;
                TimerPeriod = (SystemCoreClock / (DEFAULT_STEP_FREQ_HZ * 2 * (pscale + 1))) - 1;
-               TIM_SetAutoreload(TIM5, TimerPeriod);
-               TIM_Cmd(TIM5, ENABLE);
+               hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
+               hal_timer_enable(HAL_TIMER_TILT_STEP);
             }
 
 
@@ -682,23 +538,25 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
          case TILT_STEPPER_TILT_TABLE:
             if(ts_state_timer == 1)
             {
-               if(last_dir)
-               {
-                  last_dir = 0;
-                  tilt_stepper_motor_set_CCW();
-               }
-               else
+               /* From home, CCW first.  Like the table, from wherever homing
+                * left it so the first tick doesn't have to catch up.
+                */
+               if((trajectory_init_sweep(&tilt_stepper_trajectory, (float)steps_from_home * rad_per_micro_step,
+                                         TILT_STEPPER_SWEEP_RAD, tilt_stepper_motor_sweep_period(), 0.0f) != TRAJECTORY_SUCCESS)||
+                  (trajectory_set_ramp(&tilt_stepper_trajectory, TILT_STEPPER_SWEEP_RAMP) != TRAJECTORY_SUCCESS))
                {
-                  last_dir = 1;
-                  tilt_stepper_motor_set_CW();
+                  tilt_stepper_motor_state_change(TILT_STEPPER_HOLD, 1);
+                  break;
                }
 
-               tilt_index = 0;
-               TIM_Cmd(TIM5, DISABLE);
-               TIM_SetAutoreload(TIM5, stepper_profile[tilt_index]);
-               TIM_Cmd(TIM5, ENABLE);
+               tilt_step_target = steps_from_home;
+               tilt_step_period = TILT_STEPPER_IDLE_PERIOD;
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
+               hal_timer_set_period(HAL_TIMER_TILT_STEP, tilt_step_period);
+               hal_timer_enable(HAL_TIMER_TILT_STEP);
             }
 
+            tilt_stepper_motor_schedule_steps();
 
             break;
          case TILT_STEPPER_TEST_CW:
@@ -706,10 +564,10 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
             {
                tilt_stepper_motor_set_CW();
 
-               TIM_Cmd(TIM5, DISABLE);
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
                TimerPeriod = (SystemCoreClock / (DEFAULT_STEP_FREQ_HZ * 2 * (pscale + 1))) - 1;
-               TIM_SetAutoreload(TIM5, TimerPeriod);
-               TIM_Cmd(TIM5, ENABLE);
+               hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
+               hal_timer_enable(HAL_TIMER_TILT_STEP);
             }
 
 
@@ -730,10 +588,10 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
 
                tilt_stepper_motor_set_CCW();
 
-               TIM_Cmd(TIM5, DISABLE);
+               hal_timer_disable(HAL_TIMER_TILT_STEP);
                TimerPeriod = (SystemCoreClock / (DEFAULT_STEP_FREQ_HZ * 2 * (pscale + 1))) - 1;
-               TIM_SetAutoreload(TIM5, TimerPeriod);
-               TIM_Cmd(TIM5, ENABLE);
+               hal_timer_set_period(HAL_TIMER_TILT_STEP, TimerPeriod);
+               hal_timer_enable(HAL_TIMER_TILT_STEP);
             }
 
             if(ts_state_timer > 80000)
@@ -760,8 +618,10 @@ void TIM1_TRG_COM_TIM11_IRQHandler(void)
             break;
       }
 
-      TIM_ClearITPendingBit(TIM11, TIM_IT_Update);
+      hal_timer_update_clear(HAL_TIMER_TILT_STATE);
    }
+
+   PROFILE_EXIT(PROFILE_ID_TIM11);
 }
 
 
@@ -781,10 +641,78 @@ void tilt_stepper_motor_state_change(tilt_stepper_states new_state, uint8_t rese
       ts_state_timer = 0;
    }
 
+   TRACE(TRACE_ID_TILT_STATE, new_state, ts_state);
    ts_state = new_state;
 
 }
 
+/* PRIVATE tilt_stepper_motor_schedule_steps
+ *
+ * Notes:
+ *  +Called every TIM11 tick in TILT_STEPPER_TILT_TABLE.
+ *  +Works out where the sweep will be at the next tick, in microsteps, and
+ *   spreads the steps to get there evenly over the tick.  What's owed is
+ *   against steps_from_home, not the last target, so a step TIM5 didn't get
+ *   to is made up in the next tick instead of lost.
+ *  +No more than TILT_STEPPER_MAX_STEPS_PER_TICK a tick, catching up after
+ *   starting away from home is a ramp and not a step.
+ */
+void tilt_stepper_motor_schedule_steps(void)
+{
+   trajectory_point_t pt;
+   int32_t target, steps;
+   float micro_steps;
+
+   trajectory_advance(&tilt_stepper_trajectory, 1.0f / TILT_STEPPER_STATE_MACHINE_HZ, &pt);
+
+   micro_steps = pt.pos / rad_per_micro_step;
+   target = (int32_t)((micro_steps >= 0.0f) ? (micro_steps + 0.5f) : (micro_steps - 0.5f));
+   steps = target - steps_from_home;
+
+   if(steps > TILT_STEPPER_MAX_STEPS_PER_TICK)
+   {
+      steps = TILT_STEPPER_MAX_STEPS_PER_TICK;
+      target = steps_from_home + steps;
+   }
+   if(steps < -TILT_STEPPER_MAX_STEPS_PER_TICK)
+   {
+      steps = -TILT_STEPPER_MAX_STEPS_PER_TICK;
+      target = steps_from_home + steps;
+   }
+
+   if(steps > 0)
+   {
+      tilt_stepper_motor_set_CCW();
+   }
+   else if(steps < 0)
+   {
+      tilt_stepper_motor_set_CW();
+      steps = -steps;
+   }
+
+   if(steps > 0)
+   {
+      tilt_step_period = (TILT_STEPPER_TICK_COUNTS / (uint32_t)steps) - 1;
+   }
+   else
+   {
+      tilt_step_period = TILT_STEPPER_IDLE_PERIOD;
+   }
+
+   tilt_step_target = target;
+}
+
+/* PRIVATE tilt_stepper_motor_sweep_period
+ *
+ * Notes:
+ *  +TILT_STEPPER_SWEEP_S times the profile multiplier, which is never below
+ *   1.0.
+ */
+float tilt_stepper_motor_sweep_period(void)
+{
+   return stepper_profile_multiplier * TILT_STEPPER_SWEEP_S;
+}
+
 void tilt_stepper_motor_pos(float *rad, uint32_t *timestamp)
 {
 
@@ -801,7 +729,7 @@ void tilt_stepper_motor_pos(float *rad, uint32_t *timestamp)
 }
 
 
-void tilt_stepper_motor_step(void)
+RAMFUNC void tilt_stepper_motor_step(void)
 {
 
    if(current_step_dir == TILT_STEPPER_DIR_CW)
@@ -871,7 +799,26 @@ void tilt_stepper_motor_go_to_pos(float rad)
    tilt_stepper_motor_state_change(TILT_STEPPER_FIND_POS, 1);
 }
 
-void tilt_stepper_motor_set_profile_multiplier(float multiplier)
+float tilt_stepper_motor_set_profile_multiplier(float multiplier)
 {
+   uint32_t primask;
+
+   /* Faster than the table would be past TILT_STEPPER_MAX_STEP_HZ. */
+   if(!(multiplier >= 1.0f))
+   {
+      multiplier = 1.0f;
+   }
    stepper_profile_multiplier = multiplier;
+
+   /* Mid sweep the new period carries on from the same point of it.  TIM11
+    * advances the trajectory, so it can't tick in between.
+    */
+   primask = hal_irq_save();
+   if(ts_state == TILT_STEPPER_TILT_TABLE)
+   {
+      trajectory_set_period(&tilt_stepper_trajectory, tilt_stepper_motor_sweep_period());
+   }
+   hal_irq_restore(primask);
+
+   return multiplier;
 }
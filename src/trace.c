@@ -0,0 +1,169 @@
+/**
+ * @file trace.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Binary trace ring drained over the packet link.
+ *
+ * State changes and link errors used to be invisible once the board left the
+ * bench.  TRACE() drops an 8 byte record into a ring from wherever it happens,
+ * and the main loop ships the ring out in UNIVERSAL_TRACE packets when it has
+ * nothing better to do.  scripts/trace_decode.c turns them into a timeline.
+ */
+
+#include "trace.h"
+#include "full_duplex_usart_dma.h"
+#include "memory_sections.h"
+
+CCM_BSS trace_record_t trace_ring[TRACE_RING_SIZE];
+
+/* Free running, the ring index is the low bits.  Only trace_write() moves
+ * head and only trace_drain() moves tail.
+ */
+volatile uint32_t trace_head = 0;
+volatile uint32_t trace_tail = 0;
+volatile uint32_t trace_dropped = 0;
+
+/* SRAM, TX DMA reads them directly. */
+GenericPacket trace_packets[TRACE_TX_PACKETS];
+volatile uint8_t trace_packet_busy[TRACE_TX_PACKETS];
+
+/* Used Internally */
+void trace_packet_sent(uint32_t index);
+
+/* Public Function - Doxygen documentation is in the header file. */
+void trace_init(void)
+{
+   uint8_t ii;
+
+   hal_cycles_init();
+
+   trace_head = 0;
+   trace_tail = 0;
+   trace_dropped = 0;
+
+   for(ii=0; ii<TRACE_TX_PACKETS; ii++)
+   {
+      trace_packet_busy[ii] = 0;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void trace_write(uint8_t id, uint8_t arg8, uint16_t arg16)
+{
+   trace_record_t *record;
+   uint32_t primask;
+   uint32_t head;
+
+   primask = hal_irq_save();
+
+   head = trace_head;
+   if((head - trace_tail) < TRACE_RING_SIZE)
+   {
+      record = &(trace_ring[head & (TRACE_RING_SIZE - 1)]);
+      record->cycles = hal_cycles();
+      record->id = id;
+      record->arg8 = arg8;
+      record->arg16 = arg16;
+      trace_head = head + 1;
+   }
+   else
+   {
+      trace_dropped++;
+   }
+
+   hal_irq_restore(primask);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void trace_drain(void)
+{
+   trace_record_t records[TRACE_RECORDS_PER_PACKET];
+   uint32_t primask;
+   uint32_t tail;
+   uint32_t count;
+   uint32_t dropped;
+   uint8_t ii, jj;
+
+   for(ii=0; ii<TRACE_TX_PACKETS; ii++)
+   {
+      if(trace_packet_busy[ii])
+      {
+         continue;
+      }
+
+      tail = trace_tail;
+      count = trace_head - tail;
+      if(count == 0)
+      {
+         return;
+      }
+      if(count > TRACE_RECORDS_PER_PACKET)
+      {
+         count = TRACE_RECORDS_PER_PACKET;
+      }
+
+      /* Copied out so the ring slots can be reused as soon as tail moves. */
+      for(jj=0; jj<count; jj++)
+      {
+         records[jj] = trace_ring[(tail + jj) & (TRACE_RING_SIZE - 1)];
+      }
+
+      primask = hal_irq_save();
+      dropped = trace_dropped;
+      trace_dropped = 0;
+      hal_irq_restore(primask);
+
+      create_universal_trace(&(trace_packets[ii]), hal_millis(), hal_cycles(),
+                             (dropped > 0xFFFF) ? 0xFFFF : (uint16_t)dropped,
+                             (uint8_t *)records, (uint8_t)count);
+
+      trace_packet_busy[ii] = 1;
+      if(full_duplex_usart_dma_add_to_queue(&(trace_packets[ii]), &trace_packet_sent, ii) != FDUD_SUCCESS)
+      {
+         /* TX queue is full.  Leave the records in the ring for next time. */
+         trace_packet_busy[ii] = 0;
+
+         primask = hal_irq_save();
+         trace_dropped += dropped;
+         hal_irq_restore(primask);
+         return;
+      }
+
+      trace_tail = tail + count;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint32_t trace_snapshot(trace_record_t *records, uint32_t max)
+{
+   uint32_t head;
+   uint32_t count;
+   uint32_t ii;
+
+   /* Slots stay as they were after they're drained, so the last ring full
+    * is still there until trace_write() laps it.
+    */
+   head = trace_head;
+   count = (head < TRACE_RING_SIZE) ? head : TRACE_RING_SIZE;
+   if(count > max)
+   {
+      count = max;
+   }
+
+   for(ii=0; ii<count; ii++)
+   {
+      records[ii] = trace_ring[(head - count + ii) & (TRACE_RING_SIZE - 1)];
+   }
+
+   return count;
+}
+
+/* PRIVATE trace_packet_sent
+ *
+ * Notes:
+ *  +FDUD_TxQueueCallback for the trace packets, frees the packet.
+ */
+void trace_packet_sent(uint32_t index)
+{
+   trace_packet_busy[index] = 0;
+}
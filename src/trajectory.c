@@ -0,0 +1,188 @@
+/**
+ * @file trajectory.c
+ * @author Andrew K. Walker
+ * @date 16 OCT 2026
+ * @brief Minimum jerk tilt sweep for the brushed and the stepper axis.
+ *
+ * Nothing in here touches hardware and it builds on a PC too.
+ */
+#include "trajectory.h"
+
+/* Private Function Prototypes */
+void trajectory_cruise(float ramp, float tau, float *s, float *ds, float *dds);
+
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t trajectory_init_sweep(trajectory_t *trj, float from, float to, float period, float dwell)
+{
+   if((!(period > 0.0f))||(dwell < 0.0f))
+   {
+      return TRAJECTORY_ERROR_PARAMETER;
+   }
+
+   trj->from = from;
+   trj->span = to - from;
+   trj->period = period;
+   trj->dwell = dwell;
+   trj->ramp = 0.0f;
+   trj->t = 0.0f;
+
+   return TRAJECTORY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t trajectory_set_period(trajectory_t *trj, float period)
+{
+   float t, half, base = 0.0f;
+
+   if(!(period > 0.0f))
+   {
+      return TRAJECTORY_ERROR_PARAMETER;
+   }
+
+   /* Same fraction of the sweep it's in, or same time into the dwell. */
+   t = trj->t;
+   half = trj->period + trj->dwell;
+   if(t >= half)
+   {
+      t -= half;
+      base = period + trj->dwell;
+   }
+
+   if(t < trj->period)
+   {
+      t = t * (period / trj->period);
+   }
+   else
+   {
+      t = period + (t - trj->period);
+   }
+
+   trj->t = base + t;
+   trj->period = period;
+
+   return TRAJECTORY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t trajectory_set_ramp(trajectory_t *trj, float ramp)
+{
+   if((ramp < 0.0f)||(ramp > 0.5f))
+   {
+      return TRAJECTORY_ERROR_PARAMETER;
+   }
+
+   trj->ramp = ramp;
+
+   return TRAJECTORY_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void trajectory_at(const trajectory_t *trj, float t, trajectory_point_t *pt)
+{
+   float half, tau, s, ds, dds, sign;
+   float cycle = 2.0f * (trj->period + trj->dwell);
+
+   if((t < 0.0f)||(t >= cycle))
+   {
+      t = t - (cycle * (float)(int32_t)(t / cycle));
+      if(t < 0.0f)
+      {
+         t += cycle;
+      }
+   }
+
+   /* On the way back it's the same curve from the other end. */
+   half = trj->period + trj->dwell;
+   if(t < half)
+   {
+      pt->pos = trj->from;
+      sign = 1.0f;
+   }
+   else
+   {
+      t -= half;
+      pt->pos = trj->from + trj->span;
+      sign = -1.0f;
+   }
+
+   if(t >= trj->period)
+   {
+      /* Dwelling at the far end. */
+      pt->pos += sign * trj->span;
+      pt->vel = 0.0f;
+      pt->acc = 0.0f;
+      return;
+   }
+
+   tau = t / trj->period;
+   if(trj->ramp > 0.0f)
+   {
+      trajectory_cruise(trj->ramp, tau, &s, &ds, &dds);
+   }
+   else
+   {
+      s = tau * tau * tau * (10.0f + (tau * (-15.0f + (6.0f * tau))));
+      ds = 30.0f * tau * tau * (1.0f - tau) * (1.0f - tau);
+      dds = 60.0f * tau * (1.0f - tau) * (1.0f - (2.0f * tau));
+   }
+
+   pt->pos += sign * trj->span * s;
+   pt->vel = sign * trj->span * ds / trj->period;
+   pt->acc = sign * trj->span * dds / (trj->period * trj->period);
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void trajectory_advance(trajectory_t *trj, float dt, trajectory_point_t *pt)
+{
+   float cycle = 2.0f * (trj->period + trj->dwell);
+
+   /* Kept inside one cycle so a float second never runs out of bits. */
+   trj->t += dt;
+   while(trj->t >= cycle)
+   {
+      trj->t -= cycle;
+   }
+
+   trajectory_at(trj, trj->t, pt);
+}
+
+/* PRIVATE trajectory_cruise
+ *
+ * Notes:
+ *  +Share of the sweep covered by tau, and its first two derivatives by
+ *   tau, for trajectory_set_ramp()'s shape.
+ *  +Slowing down is speeding up run backwards from the far end.
+ */
+void trajectory_cruise(float ramp, float tau, float *s, float *ds, float *dds)
+{
+   float cruise = 1.0f / (1.0f - ramp);
+   float u;
+   uint8_t slowing = 0;
+
+   if(tau > 0.5f)
+   {
+      tau = 1.0f - tau;
+      slowing = 1;
+   }
+
+   if(tau < ramp)
+   {
+      u = tau / ramp;
+      *s = cruise * ramp * u * u * u * (1.0f - (0.5f * u));
+      *ds = cruise * u * u * (3.0f - (2.0f * u));
+      *dds = cruise * 6.0f * u * (1.0f - u) / ramp;
+   }
+   else
+   {
+      *s = cruise * (tau - (0.5f * ramp));
+      *ds = cruise;
+      *dds = 0.0f;
+   }
+
+   if(slowing)
+   {
+      *s = 1.0f - *s;
+      *dds = -*dds;
+   }
+}
@@ -5,26 +5,29 @@
  * @brief Watchdog implementation in case our micro goes out to lunch...
  */
 #include "watchdog.h"
+#include "memory_sections.h"
 
 volatile uint8_t watchdog_enabled = 0;
 
-void watchdog_init(void)
-{
+/* Counted by watchdog_tickle(), the heartbeats' clock. */
+volatile uint32_t watchdog_ms = 0;
+volatile uint8_t watchdog_starved = 0;
+
+/* A deadline of 0 is a task that isn't registered. */
+uint32_t watchdog_deadline_ms[WATCHDOG_NUM_TASKS];
+volatile uint32_t watchdog_last_ms[WATCHDOG_NUM_TASKS];
+volatile uint8_t watchdog_armed[WATCHDOG_NUM_TASKS];
 
-   /* (#) Enable WWDG clock using RCC_APB1PeriphClockCmd(RCC_APB1Periph_WWDG, ENABLE) function */
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_WWDG, ENABLE);
+NOINIT watchdog_reason_t watchdog_reason;
 
-   /*    (#) Configure the WWDG prescaler using WWDG_SetPrescaler() function */
-   /* WWDG_Prescaler_1 will count at 20507.8125 Hz */
-   WWDG_SetPrescaler(WWDG_Prescaler_1);
+/* Used Internally */
+uint8_t watchdog_find_starved(uint8_t *task, uint32_t *silent_ms);
 
-   /*    (#) Configure the WWDG refresh window using WWDG_SetWindowValue() function */
-   WWDG_SetWindowValue(WATCHDOG_WINDOW_COUNT);
+void watchdog_init(void)
+{
 
-   /*    (#) Set the WWDG counter value and start it using WWDG_Enable() function. */
-   /*    When the WWDG is enabled the counter value should be configured to  */
-   /*    a value greater than 0x40 to prevent generating an immediate reset.   */
-   WWDG_Enable(WATCHDOG_RESET_COUNT);
+   /* Counts at 20507.8125 Hz, see hal_watchdog_init(). */
+   hal_watchdog_init(WATCHDOG_WINDOW_COUNT, WATCHDOG_RESET_COUNT);
 
    watchdog_enabled = 1;
 
@@ -35,13 +38,113 @@ void watchdog_init(void)
 void watchdog_tickle(void)
 {
    uint8_t current_count;
+   uint8_t task;
+   uint32_t silent_ms;
+
+   watchdog_ms++;
 
-   if(watchdog_enabled)
+   if((watchdog_enabled)&&(!watchdog_starved))
    {
-      current_count = WWDG->CR & 0x7F;
+      if(watchdog_find_starved(&task, &silent_ms))
+      {
+         /* Leave a note for the next boot and let the WWDG run out. */
+         watchdog_reason.task = task;
+         watchdog_reason.deadline_ms = watchdog_deadline_ms[task];
+         watchdog_reason.silent_ms = silent_ms;
+         watchdog_reason.uptime_ms = watchdog_ms;
+         hal_memory_barrier();
+         watchdog_reason.magic = WATCHDOG_REASON_MAGIC;
+
+         watchdog_starved = 1;
+         return;
+      }
+
+      current_count = hal_watchdog_count();
       if(current_count < WATCHDOG_WINDOW_COUNT)
       {
-         WWDG_SetCounter(WATCHDOG_RESET_COUNT);
+         hal_watchdog_refresh(WATCHDOG_RESET_COUNT);
+      }
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t watchdog_register(uint8_t task, uint32_t deadline_ms)
+{
+   if((task >= WATCHDOG_NUM_TASKS)||(deadline_ms == 0))
+   {
+      return WATCHDOG_ERROR_PARAMETER;
+   }
+
+   watchdog_last_ms[task] = watchdog_ms;
+   watchdog_armed[task] = 1;
+   hal_memory_barrier();
+   watchdog_deadline_ms[task] = deadline_ms;
+
+   return WATCHDOG_SUCCESS;
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void watchdog_heartbeat(uint8_t task)
+{
+   if(task < WATCHDOG_NUM_TASKS)
+   {
+      /* The time first, so watchdog_tickle() never sees the old one armed. */
+      watchdog_last_ms[task] = watchdog_ms;
+      hal_memory_barrier();
+      watchdog_armed[task] = 1;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+void watchdog_idle(uint8_t task)
+{
+   if(task < WATCHDOG_NUM_TASKS)
+   {
+      watchdog_armed[task] = 0;
+   }
+}
+
+/* Public Function - Doxygen documentation is in the header file. */
+uint8_t watchdog_last_reason(watchdog_reason_t *reason)
+{
+   if(watchdog_reason.magic != WATCHDOG_REASON_MAGIC)
+   {
+      return WATCHDOG_NO_REASON;
+   }
+
+   *reason = watchdog_reason;
+   watchdog_reason.magic = 0;
+
+   return WATCHDOG_SUCCESS;
+}
+
+/* PRIVATE watchdog_find_starved
+ *
+ * Notes:
+ *  +Returns 1 with the first registered and armed task that's gone longer
+ *   than its deadline since it last beat, 0 if they're all alive.
+ *  +Runs in the 1 kHz interrupt, a heartbeat from a higher priority one can
+ *   land part way through.  The worst that does is make a task look alive a
+ *   tick early or late.
+ */
+uint8_t watchdog_find_starved(uint8_t *task, uint32_t *silent_ms)
+{
+   uint8_t ii;
+   uint32_t silent;
+
+   for(ii=0; ii<WATCHDOG_NUM_TASKS; ii++)
+   {
+      if((watchdog_deadline_ms[ii] != 0)&&(watchdog_armed[ii]))
+      {
+         silent = watchdog_ms - watchdog_last_ms[ii];
+         if(silent > watchdog_deadline_ms[ii])
+         {
+            *task = ii;
+            *silent_ms = silent;
+            return 1;
+         }
       }
    }
+
+   return 0;
 }